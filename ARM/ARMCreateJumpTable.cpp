@@ -169,7 +169,8 @@ bool ARMCreateJumpTable::raiseMaichineJumpTable(MachineFunction &MF) {
             uint64_t Offset =
                 IsFPIC ? (MCInstorData.getData() +
                           MCIR->getMCInstIndex(JmpTblOffsetCalcMI) + 16)
-                       : (MCInstorData.getData() - MR->getTextSectionAddress());
+                       : (MCInstorData.getData() -
+                          MCIR->getTextSectionAddress());
             auto MBBNo = MCIR->getMBBNumberOfMCInstOffset(Offset, MF);
             if (MBBNo != -1) {
               MachineBasicBlock *MBB = MF.getBlockNumbered(MBBNo);
@@ -20,6 +20,7 @@
 #include "llvm/BinaryFormat/ELF.h"
 #include "llvm/Object/ELF.h"
 #include "llvm/Object/ELFObjectFile.h"
+#include "llvm/Support/Process.h"
 
 #define DEBUG_TYPE "mctoll"
 
@@ -170,7 +171,7 @@ uint64_t ARMMIRevising::getCalledFunctionAtPLTOffset(uint64_t PLTEndOff,
             IncludedFileInfo::CreateFunction(*CalledFuncSymName, *MR);
         // Bail out if function prototype is not available
         if (!CalledFunc)
-          exit(-1);
+          sys::Process::Exit(-1);
         MR->setSyscallMapping(PLTEndOff, CalledFunc);
         MR->fillInstAddrFuncMap(CallAddr, CalledFunc);
       }
@@ -190,7 +191,8 @@ void ARMMIRevising::relocateBranch(MachineInstr &MInst) {
 
   auto EType = Elf32LEObjFile->getELFFile().getHeader().e_type;
   if ((EType == ELF::ET_DYN) || (EType == ELF::ET_EXEC)) {
-    int64_t TextSectionAddress = MR->getTextSectionAddress();
+    assert(MCIR != nullptr && "MCInstRaiser was not initialized");
+    int64_t TextSectionAddress = MCIR->getTextSectionAddress();
     assert(TextSectionAddress >= 0 && "Failed to find text section address");
 
     // Get MCInst offset - the offset of machine instruction in the binary
@@ -198,7 +200,6 @@ void ARMMIRevising::relocateBranch(MachineInstr &MInst) {
     int64_t MCInstOffset = getMCInstIndex(MInst);
     int64_t CallAddr = MCInstOffset + TextSectionAddress;
     int64_t CallTargetIndex = CallAddr + RelCallTargetOffset + 8;
-    assert(MCIR != nullptr && "MCInstRaiser was not initialized");
     int64_t CallTargetOffset = CallTargetIndex - TextSectionAddress;
     if (CallTargetOffset < 0 || !MCIR->isMCInstInRange(CallTargetOffset)) {
       Function *CalledFunc = nullptr;
@@ -207,7 +208,8 @@ void ARMMIRevising::relocateBranch(MachineInstr &MInst) {
       CalledFunc = MR->getRaisedFunctionAt(CallTargetIndex);
       if (CalledFunc == nullptr) {
         CalledFunc =
-            MR->getCalledFunctionUsingTextReloc(MCInstOffset, MCInstSize);
+            MR->getCalledFunctionUsingTextReloc(MCInstOffset, MCInstSize,
+                                                MCIR->getTextSectionIndex());
       }
       // Look up the PLT to find called function.
       if (CalledFunc == nullptr)
@@ -225,7 +227,8 @@ void ARMMIRevising::relocateBranch(MachineInstr &MInst) {
     }
   } else {
     uint64_t Offset = getMCInstIndex(MInst);
-    const RelocationRef *Reloc = MR->getTextRelocAtOffset(Offset, 4);
+    const RelocationRef *Reloc =
+        MR->getTextRelocAtOffset(Offset, 4, MCIR->getTextSectionIndex());
     auto ImmValOrErr = (*Reloc->getSymbol()).getValue();
     assert(ImmValOrErr && "Failed to get immediate value");
     MInst.getOperand(0).setImm(*ImmValOrErr);
@@ -242,7 +245,7 @@ const Value *ARMMIRevising::getGlobalValueByOffset(int64_t MCInstOffset,
          "Only 32-bit ELF binaries supported at present.");
 
   // Get the text section address
-  int64_t TextSecAddr = MR->getTextSectionAddress();
+  int64_t TextSecAddr = MCIR->getTextSectionAddress();
   assert(TextSecAddr >= 0 && "Failed to find text section address");
 
   uint64_t InstAddr = TextSecAddr + MCInstOffset;
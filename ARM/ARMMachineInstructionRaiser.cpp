@@ -21,6 +21,7 @@
 #include "ARMMachineInstructionRaiser.h"
 #include "ARMModuleRaiser.h"
 #include "ARMSelectionDAGISel.h"
+#include "llvm/Support/TimeProfiler.h"
 
 using namespace llvm;
 using namespace llvm::mctoll;
@@ -34,33 +35,57 @@ bool ARMMachineInstructionRaiser::raiseMachineFunction() {
   assert(ConstAMR != nullptr && "The ARM module raiser is not initialized!");
   ARMModuleRaiser &AMR = const_cast<ARMModuleRaiser &>(*ConstAMR);
 
-  ARMMIRevising MIR(AMR,&MF, RaisedFunction, InstRaiser);
-  MIR.revise();
-
-  ARMEliminatePrologEpilog EPE(AMR, &MF, RaisedFunction);
-  EPE.eliminate();
-
-  ARMCreateJumpTable CJT(AMR, &MF, RaisedFunction, InstRaiser);
-  CJT.create();
-  CJT.getJTlist(JTList);
-
-  ARMArgumentRaiser AR(AMR, &MF, RaisedFunction);
-  AR.raiseArgs();
-
-  ARMFrameBuilder FB(AMR, &MF, RaisedFunction);
-  FB.build();
-
-  ARMInstructionSplitting ISpl(AMR, &MF, RaisedFunction);
-  ISpl.split();
-
-  ARMSelectionDAGISel SelDis(AMR, &MF, RaisedFunction);
-  SelDis.setjtList(JTList);
-  SelDis.doSelection();
+  std::string FuncDesc = getFunctionDescription();
+
+  {
+    TimeTraceScope Scope("ARMMIRevising", FuncDesc);
+    ARMMIRevising MIR(AMR, &MF, RaisedFunction, InstRaiser);
+    MIR.revise();
+  }
+
+  {
+    TimeTraceScope Scope("ARMEliminatePrologEpilog", FuncDesc);
+    ARMEliminatePrologEpilog EPE(AMR, &MF, RaisedFunction);
+    EPE.eliminate();
+  }
+
+  {
+    TimeTraceScope Scope("ARMCreateJumpTable", FuncDesc);
+    ARMCreateJumpTable CJT(AMR, &MF, RaisedFunction, InstRaiser);
+    CJT.create();
+    CJT.getJTlist(JTList);
+  }
+
+  {
+    TimeTraceScope Scope("ARMArgumentRaiser", FuncDesc);
+    ARMArgumentRaiser AR(AMR, &MF, RaisedFunction);
+    AR.raiseArgs();
+  }
+
+  {
+    TimeTraceScope Scope("ARMFrameBuilder", FuncDesc);
+    ARMFrameBuilder FB(AMR, &MF, RaisedFunction);
+    FB.build();
+  }
+
+  {
+    TimeTraceScope Scope("ARMInstructionSplitting", FuncDesc);
+    ARMInstructionSplitting ISpl(AMR, &MF, RaisedFunction);
+    ISpl.split();
+  }
+
+  {
+    TimeTraceScope Scope("ARMSelectionDAGISel", FuncDesc);
+    ARMSelectionDAGISel SelDis(AMR, &MF, RaisedFunction);
+    SelDis.setjtList(JTList);
+    SelDis.doSelection();
+  }
 
   return true;
 }
 
 bool ARMMachineInstructionRaiser::raise() {
+  TimeTraceScope Scope("RaiseMachineFunction", getFunctionDescription());
   return raiseMachineFunction();
   // return true;
 }
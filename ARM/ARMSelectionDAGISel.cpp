@@ -109,6 +109,7 @@ bool ARMSelectionDAGISel::doSelection() {
 
   initEntryBasicBlock();
   for (MachineBasicBlock &Block : *MF) {
+    MR->checkFunctionBudget();
     MBB = &Block;
     BB = FuncInfo->getOrCreateBasicBlock(MBB);
     selectBasicBlock();
@@ -714,7 +714,7 @@ void IREmitter::emitSpecialNode(SDNode *Node) {
     if (CallFunc == nullptr) {
       // According to MI to get BL instruction address.
       // uint64_t callAddr = DAGInfo->NPMap[Node]->InstAddr;
-      uint64_t CallAddr = MR->getTextSectionAddress() +
+      uint64_t CallAddr = MR->getTextSectionAddress(*FuncInfo->MF) +
                           getMCInstIndex(*(DAGInfo->NPMap[Node]->MI));
       Function *IndefiniteFunc = MR->getCallFunc(CallAddr);
       CallFunc = MR->getSyscallFunc(Index);
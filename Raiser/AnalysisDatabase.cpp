@@ -0,0 +1,149 @@
+//===-- AnalysisDatabase.cpp ------------------------------------*- C++ -*-===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+//
+// This file contains the implementation of AnalysisDatabase class
+// for use by llvm-mctoll.
+//
+//===----------------------------------------------------------------------===//
+
+#include "AnalysisDatabase.h"
+#include "llvm/ADT/StringExtras.h"
+#include "llvm/Support/FileSystem.h"
+#include "llvm/Support/FormatVariadic.h"
+#include "llvm/Support/JSON.h"
+#include "llvm/Support/MemoryBuffer.h"
+#include "llvm/Support/SHA1.h"
+#include "llvm/Support/raw_ostream.h"
+
+using namespace llvm;
+using namespace llvm::mctoll;
+
+// Version of the format of the database file. Files of other versions are
+// not loaded.
+static const int64_t Version = 1;
+
+Error AnalysisDatabase::load() {
+  ErrorOr<std::unique_ptr<MemoryBuffer>> BufOrErr =
+      MemoryBuffer::getFile(FileName, /*IsText=*/true);
+  if (!BufOrErr) {
+    if (BufOrErr.getError() == std::errc::no_such_file_or_directory)
+      return Error::success();
+    return createFileError(FileName, BufOrErr.getError());
+  }
+
+  Expected<json::Value> RootOrErr = json::parse((*BufOrErr)->getBuffer());
+  if (!RootOrErr)
+    return createFileError(FileName, RootOrErr.takeError());
+  const json::Object *Root = RootOrErr->getAsObject();
+  if (Root == nullptr || Root->getInteger("version") != Version)
+    return createFileError(
+        FileName, createStringError(inconvertibleErrorCode(),
+                                    "unsupported analysis database format"));
+
+  if (const json::Object *Sections = Root->getObject("sections"))
+    for (const auto &Entry : *Sections) {
+      const json::Array *Functions = Entry.second.getAsArray();
+      if (Functions == nullptr)
+        continue;
+      std::vector<DiscoveredFunction> &Recorded =
+          DiscoveredFunctions[Entry.first];
+      for (const json::Value &Function : *Functions) {
+        const json::Object *F = Function.getAsObject();
+        if (F == nullptr)
+          continue;
+        Optional<int64_t> Address = F->getInteger("address");
+        Optional<StringRef> Name = F->getString("name");
+        if (Address && Name)
+          Recorded.emplace_back(*Address, Name->str());
+      }
+    }
+
+  if (const json::Object *Functions = Root->getObject("functions"))
+    for (const auto &Entry : *Functions) {
+      const json::Object *F = Entry.second.getAsObject();
+      if (F == nullptr)
+        continue;
+      if (Optional<StringRef> Prototype = F->getString("prototype"))
+        Prototypes[Entry.first] = Prototype->str();
+    }
+
+  return Error::success();
+}
+
+Error AnalysisDatabase::save() const {
+  json::Object Sections;
+  for (const auto &Entry : DiscoveredFunctions) {
+    json::Array Functions;
+    for (const DiscoveredFunction &F : Entry.second)
+      Functions.push_back(json::Object{{"address", int64_t(F.first)},
+                                       {"name", F.second}});
+    Sections[Entry.first()] = std::move(Functions);
+  }
+
+  json::Object Functions;
+  for (const auto &Entry : Prototypes)
+    Functions[Entry.first()] = json::Object{{"prototype", Entry.second}};
+
+  json::Object Root{{"version", Version},
+                    {"sections", std::move(Sections)},
+                    {"functions", std::move(Functions)}};
+
+  // Write a temporary file and rename it, so that an interrupted run does not
+  // leave a truncated database behind.
+  std::string TempFileName = FileName + ".tmp";
+  std::error_code EC;
+  raw_fd_ostream OS(TempFileName, EC, sys::fs::OF_Text);
+  if (EC)
+    return createFileError(TempFileName, EC);
+  OS << formatv("{0:2}", json::Value(std::move(Root))) << "\n";
+  OS.close();
+  if (OS.has_error()) {
+    EC = OS.error();
+    OS.clear_error();
+    return createFileError(TempFileName, EC);
+  }
+  if ((EC = sys::fs::rename(TempFileName, FileName)))
+    return createFileError(FileName, EC);
+  return Error::success();
+}
+
+std::string AnalysisDatabase::getKey(ArrayRef<uint8_t> Bytes,
+                                     StringRef Context) const {
+  const StringRef Separator("\0", 1);
+  SHA1 Hasher;
+  Hasher.update(Options);
+  Hasher.update(Separator);
+  Hasher.update(Context);
+  Hasher.update(Separator);
+  Hasher.update(Bytes);
+  return toHex(Hasher.final(), /*LowerCase=*/true);
+}
+
+const std::vector<AnalysisDatabase::DiscoveredFunction> *
+AnalysisDatabase::lookupDiscoveredFunctions(StringRef Key) const {
+  auto Iter = DiscoveredFunctions.find(Key);
+  if (Iter == DiscoveredFunctions.end())
+    return nullptr;
+  return &Iter->second;
+}
+
+void AnalysisDatabase::recordDiscoveredFunctions(
+    StringRef Key, std::vector<DiscoveredFunction> Functions) {
+  DiscoveredFunctions[Key] = std::move(Functions);
+}
+
+StringRef AnalysisDatabase::lookupPrototype(StringRef Key) const {
+  auto Iter = Prototypes.find(Key);
+  if (Iter == Prototypes.end())
+    return StringRef();
+  return Iter->second;
+}
+
+void AnalysisDatabase::recordPrototype(StringRef Key, StringRef Prototype) {
+  Prototypes[Key] = Prototype.str();
+}
@@ -0,0 +1,74 @@
+//===-- AnalysisDatabase.h --------------------------------------*- C++ -*-===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+//
+// This file contains the declaration of AnalysisDatabase class
+// for use by llvm-mctoll.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef LLVM_TOOLS_LLVM_MCTOLL_ANALYSISDATABASE_H
+#define LLVM_TOOLS_LLVM_MCTOLL_ANALYSISDATABASE_H
+
+#include "llvm/ADT/ArrayRef.h"
+#include "llvm/ADT/StringMap.h"
+#include "llvm/Support/Error.h"
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace llvm {
+namespace mctoll {
+
+/// A file of analysis results recorded by earlier runs, for reuse by later
+/// runs on the same binary. Results are recorded under a key that is a hash of
+/// the code they were computed from and of the options they depend on, so a
+/// result is only reused if neither changed. Recorded results are
+///   - the functions discovered in text sections of stripped binaries, and
+///   - the prototypes of raised functions, printed as LLVM IR types.
+class AnalysisDatabase {
+public:
+  /// A function discovered in a stripped binary
+  using DiscoveredFunction = std::pair<uint64_t, std::string>;
+
+  /// Options is a string representation of the options results depend on.
+  AnalysisDatabase(StringRef FileName, StringRef Options)
+      : FileName(FileName.str()), Options(Options.str()) {}
+
+  /// Load the results recorded in the file. A missing file is an empty
+  /// database.
+  Error load();
+  /// Write all results to the file.
+  Error save() const;
+
+  /// Return the key of results computed from Bytes, in the context described
+  /// by Context (e.g., the address of the code).
+  std::string getKey(ArrayRef<uint8_t> Bytes, StringRef Context) const;
+
+  /// Return the functions recorded as discovered under Key; nullptr if none.
+  const std::vector<DiscoveredFunction> *
+  lookupDiscoveredFunctions(StringRef Key) const;
+  void recordDiscoveredFunctions(StringRef Key,
+                                 std::vector<DiscoveredFunction> Functions);
+
+  /// Return the prototype recorded under Key; an empty string if none.
+  StringRef lookupPrototype(StringRef Key) const;
+  void recordPrototype(StringRef Key, StringRef Prototype);
+
+  StringRef getFileName() const { return FileName; }
+
+private:
+  std::string FileName;
+  std::string Options;
+  StringMap<std::vector<DiscoveredFunction>> DiscoveredFunctions;
+  StringMap<std::string> Prototypes;
+};
+
+} // end namespace mctoll
+} // end namespace llvm
+
+#endif // LLVM_TOOLS_LLVM_MCTOLL_ANALYSISDATABASE_H
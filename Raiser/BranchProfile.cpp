@@ -0,0 +1,138 @@
+//===-- BranchProfile.cpp ---------------------------------------*- C++ -*-===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+//
+// This file contains the implementation of BranchProfile class
+// for use by llvm-mctoll.
+//
+//===----------------------------------------------------------------------===//
+
+#include "BranchProfile.h"
+#include "llvm/ADT/SmallVector.h"
+#include "llvm/ADT/StringExtras.h"
+#include "llvm/Support/LineIterator.h"
+#include "llvm/Support/MemoryBuffer.h"
+#include <algorithm>
+
+using namespace llvm;
+using namespace llvm::mctoll;
+
+Error BranchProfile::load() {
+  ErrorOr<std::unique_ptr<MemoryBuffer>> BufOrErr =
+      MemoryBuffer::getFile(FileName, /*IsText=*/true);
+  if (!BufOrErr)
+    return createFileError(FileName, BufOrErr.getError());
+
+  for (line_iterator Line(**BufOrErr, /*SkipBlanks=*/true); !Line.is_at_eof();
+       ++Line) {
+    StringRef Text = Line->trim();
+    if (Text.contains('/')) {
+      // A sample of perf script. The code between the target of an entry and
+      // the source of the next more recent entry was executed in sequence.
+      SmallVector<StringRef, 32> Tokens;
+      SplitString(Text, Tokens);
+      SmallVector<std::pair<uint64_t, uint64_t>, 32> Entries;
+      for (StringRef Token : Tokens) {
+        SmallVector<StringRef, 6> Fields;
+        Token.split(Fields, '/');
+        uint64_t From, To;
+        if ((Fields.size() < 2) || !Fields[0].startswith("0x") ||
+            Fields[0].getAsInteger(0, From) || Fields[1].getAsInteger(0, To))
+          continue;
+        Entries.push_back(std::make_pair(From, To));
+      }
+      for (size_t Idx = 0; Idx < Entries.size(); Idx++) {
+        addBranch(Entries[Idx].first, Entries[Idx].second, 1);
+        if ((Idx + 1 < Entries.size()) &&
+            (Entries[Idx + 1].second <= Entries[Idx].first))
+          addRange(Entries[Idx + 1].second, Entries[Idx].first, 1);
+      }
+      continue;
+    }
+
+    // An entry of an unsymbolized profile of llvm-profgen. Lines with the
+    // number of entries that follow are skipped.
+    StringRef Entry, CountText;
+    std::tie(Entry, CountText) = Text.split(':');
+    uint64_t Count;
+    if (CountText.getAsInteger(10, Count))
+      continue;
+    uint64_t Start, End;
+    if (Entry.contains("->")) {
+      std::pair<StringRef, StringRef> Branch = Entry.split("->");
+      if (!Branch.first.getAsInteger(16, Start) &&
+          !Branch.second.getAsInteger(16, End))
+        addBranch(Start, End, Count);
+    } else {
+      std::pair<StringRef, StringRef> Range = Entry.split('-');
+      if (!Range.first.getAsInteger(16, Start) &&
+          !Range.second.getAsInteger(16, End) && (Start <= End))
+        addRange(Start, End, Count);
+    }
+  }
+
+  if (BranchCounts.empty() && RangeCountDeltas.empty())
+    return createFileError(
+        FileName, createStringError(inconvertibleErrorCode(),
+                                    "no branch samples found in profile"));
+
+  // Accumulate the changes in execution counts.
+  int64_t RangeCount = 0;
+  for (const auto &Delta : RangeCountDeltas) {
+    RangeCount += Delta.second;
+    RangeCounts.push_back(std::make_pair(Delta.first, RangeCount));
+  }
+  RangeCountDeltas.clear();
+  return Error::success();
+}
+
+void BranchProfile::addBranch(uint64_t From, uint64_t To, uint64_t Count) {
+  BranchCounts[std::make_pair(From, To)] += Count;
+  TargetCounts[To] += Count;
+}
+
+// Record that the instructions from Start up to and including the branch at
+// End were executed Count times. Only those before End fell through.
+void BranchProfile::addRange(uint64_t Start, uint64_t End, uint64_t Count) {
+  RangeCountDeltas[Start] += Count;
+  RangeCountDeltas[End] -= Count;
+}
+
+uint64_t BranchProfile::getBranchCount(uint64_t From, uint64_t To) const {
+  auto Iter = BranchCounts.find(std::make_pair(From, To));
+  return (Iter == BranchCounts.end()) ? 0 : Iter->second;
+}
+
+uint64_t BranchProfile::getTargetCount(uint64_t Addr) const {
+  auto Iter = TargetCounts.find(Addr);
+  return (Iter == TargetCounts.end()) ? 0 : Iter->second;
+}
+
+uint64_t BranchProfile::getFallThroughCount(uint64_t Addr) const {
+  auto Iter = std::upper_bound(
+      RangeCounts.begin(), RangeCounts.end(), Addr,
+      [](uint64_t A, const std::pair<uint64_t, uint64_t> &RangeCount) {
+        return A < RangeCount.first;
+      });
+  if (Iter == RangeCounts.begin())
+    return 0;
+  return std::prev(Iter)->second;
+}
+
+bool BranchProfile::hasSamples(uint64_t Start, uint64_t End) const {
+  if (getFallThroughCount(Start) > 0)
+    return true;
+  auto Iter = std::lower_bound(
+      RangeCounts.begin(), RangeCounts.end(), Start,
+      [](const std::pair<uint64_t, uint64_t> &RangeCount, uint64_t A) {
+        return RangeCount.first < A;
+      });
+  if ((Iter != RangeCounts.end()) && (Iter->first < End))
+    return true;
+  auto TargetIter = TargetCounts.lower_bound(Start);
+  return (TargetIter != TargetCounts.end()) && (TargetIter->first < End);
+}
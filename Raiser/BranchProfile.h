@@ -0,0 +1,74 @@
+//===-- BranchProfile.h -----------------------------------------*- C++ -*-===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+//
+// This file contains the declaration of BranchProfile class
+// for use by llvm-mctoll.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef LLVM_TOOLS_LLVM_MCTOLL_BRANCHPROFILE_H
+#define LLVM_TOOLS_LLVM_MCTOLL_BRANCHPROFILE_H
+
+#include "llvm/ADT/StringRef.h"
+#include "llvm/Support/Error.h"
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace llvm {
+namespace mctoll {
+
+/// Execution counts of the branches and of the straight-line code of a binary,
+/// keyed by the addresses of the binary, as sampled by last branch records
+/// (LBR). A profile is read from a text file with either
+///   - the output of `perf script -F brstack`, one sample of branch stack
+///     entries `0x<from>/0x<to>/...` per line, most recent first, or
+///   - the unsymbolized profile of `llvm-profgen --skip-symbolization`, with
+///     lines `<start>-<end>:<count>` of executed address ranges and lines
+///     `<from>-><to>:<count>` of taken branches, in hexadecimal.
+class BranchProfile {
+public:
+  explicit BranchProfile(StringRef FileName) : FileName(FileName.str()) {}
+
+  /// Read the profile from the file.
+  Error load();
+
+  /// Return the number of times the branch at From was taken to To.
+  uint64_t getBranchCount(uint64_t From, uint64_t To) const;
+  /// Return the number of times control was transferred to Addr by a branch
+  /// or a call.
+  uint64_t getTargetCount(uint64_t Addr) const;
+  /// Return the number of times the instruction at Addr was executed and
+  /// execution continued with the next instruction, i.e., the number of times
+  /// a branch at Addr was not taken.
+  uint64_t getFallThroughCount(uint64_t Addr) const;
+  /// Return true if any code in [Start, End) was sampled.
+  bool hasSamples(uint64_t Start, uint64_t End) const;
+
+  StringRef getFileName() const { return FileName; }
+
+private:
+  void addBranch(uint64_t From, uint64_t To, uint64_t Count);
+  void addRange(uint64_t Start, uint64_t End, uint64_t Count);
+
+  std::string FileName;
+  std::map<std::pair<uint64_t, uint64_t>, uint64_t> BranchCounts;
+  std::map<uint64_t, uint64_t> TargetCounts;
+  /// Addresses at which the number of executions of straight-line code
+  /// changes, each with the number of executions of the instructions from it
+  /// up to the next such address
+  std::vector<std::pair<uint64_t, uint64_t>> RangeCounts;
+  /// Changes in the number of executions at the addresses, while loading
+  std::map<uint64_t, int64_t> RangeCountDeltas;
+};
+
+} // end namespace mctoll
+} // end namespace llvm
+
+#endif // LLVM_TOOLS_LLVM_MCTOLL_BRANCHPROFILE_H
@@ -0,0 +1,275 @@
+//===-- FunctionBoundaryDiscovery.cpp ---------------------------*- C++ -*-===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+//
+// This file contains the implementation of FunctionBoundaryDiscovery class
+// for use by llvm-mctoll.
+//
+//===----------------------------------------------------------------------===//
+
+#include "FunctionBoundaryDiscovery.h"
+#include "llvm/ADT/STLExtras.h"
+#include "llvm/BinaryFormat/ELF.h"
+#include "llvm/DebugInfo/DWARF/DWARFContext.h"
+#include "llvm/DebugInfo/DWARF/DWARFDebugFrame.h"
+#include "llvm/MC/MCInst.h"
+#include "llvm/Object/ELFObjectFile.h"
+#include "llvm/Support/Debug.h"
+#include "llvm/Support/Endian.h"
+#include <set>
+
+#define DEBUG_TYPE "mctoll"
+
+using namespace llvm;
+using namespace llvm::mctoll;
+using namespace llvm::object;
+
+// Encoding of ENDBR64, which marks the start of functions that may be called
+// indirectly in binaries built with control-flow enforcement.
+static const uint8_t Endbr64Bytes[] = {0xf3, 0x0f, 0x1e, 0xfa};
+
+// Record the offsets and addends of the dynamic relocations of the binary,
+// sorted by offset. Pointer arrays of position independent binaries are
+// initialized by such relocations.
+void FunctionBoundaryDiscovery::indexDynRelocations() {
+  if (!Obj->isELF())
+    return;
+
+  for (const SectionRef &RelSec : Obj->dynamic_relocation_sections())
+    for (const RelocationRef &Reloc : RelSec.relocations()) {
+      Expected<int64_t> AddendOrErr = ELFRelocationRef(Reloc).getAddend();
+      if (!AddendOrErr) {
+        consumeError(AddendOrErr.takeError());
+        continue;
+      }
+      DynRelocAddends.emplace_back(Reloc.getOffset(), *AddendOrErr);
+    }
+  llvm::stable_sort(DynRelocAddends, llvm::less_first());
+}
+
+// Return the value of the dynamic relocation applied at Addr, if any.
+uint64_t FunctionBoundaryDiscovery::getDynRelocatedPointer(
+    uint64_t Addr) const {
+  auto RelocIter = llvm::partition_point(
+      DynRelocAddends,
+      [Addr](const std::pair<uint64_t, int64_t> &A) { return A.first < Addr; });
+  if ((RelocIter != DynRelocAddends.end()) && (RelocIter->first == Addr))
+    return RelocIter->second;
+  return 0;
+}
+
+void FunctionBoundaryDiscovery::addStart(uint64_t Addr, StringRef Name) {
+  if (!isInSection(Addr))
+    return;
+  std::string &StartName = Starts[Addr];
+  if (StartName.empty())
+    StartName = Name.str();
+}
+
+void FunctionBoundaryDiscovery::addEntryPoint() {
+  Expected<uint64_t> EntryOrErr = Obj->getStartAddress();
+  if (!EntryOrErr) {
+    consumeError(EntryOrErr.takeError());
+    return;
+  }
+  addStart(*EntryOrErr, "_start");
+}
+
+void FunctionBoundaryDiscovery::addPointerArrayEntries(StringRef SectionName,
+                                                       StringRef FirstName) {
+  const unsigned PtrSize = Obj->getBytesInAddress();
+  const support::endianness Endian =
+      Obj->isLittleEndian() ? support::little : support::big;
+
+  for (const SectionRef &Sec : Obj->sections()) {
+    Expected<StringRef> NameOrErr = Sec.getName();
+    if (!NameOrErr) {
+      consumeError(NameOrErr.takeError());
+      continue;
+    }
+    if (*NameOrErr != SectionName)
+      continue;
+
+    Expected<StringRef> ContentsOrErr = Sec.getContents();
+    if (!ContentsOrErr) {
+      consumeError(ContentsOrErr.takeError());
+      continue;
+    }
+    StringRef Contents = *ContentsOrErr;
+    for (uint64_t Offset = 0; Offset + PtrSize <= Contents.size();
+         Offset += PtrSize) {
+      const char *Ptr = Contents.data() + Offset;
+      uint64_t Target = (PtrSize == 8)
+                            ? support::endian::read64(Ptr, Endian)
+                            : support::endian::read32(Ptr, Endian);
+      if (Target == 0)
+        Target = getDynRelocatedPointer(Sec.getAddress() + Offset);
+      addStart(Target, (Offset == 0) ? FirstName : StringRef());
+    }
+  }
+}
+
+void FunctionBoundaryDiscovery::addEHFrameEntries() {
+  std::unique_ptr<DWARFContext> DICtx = DWARFContext::create(*Obj);
+  Expected<const DWARFDebugFrame *> EHFrameOrErr = DICtx->getEHFrame();
+  if (!EHFrameOrErr) {
+    consumeError(EHFrameOrErr.takeError());
+    return;
+  }
+  for (const dwarf::FrameEntry &Entry : (*EHFrameOrErr)->entries())
+    if (const auto *FDE = dyn_cast<dwarf::FDE>(&Entry))
+      addStart(FDE->getInitialLocation());
+}
+
+// Linearly sweep the section and record targets of direct calls and, in
+// x86-64 binaries, locations of ENDBR64 instructions as function starts.
+void FunctionBoundaryDiscovery::scanInstructions(ArrayRef<uint8_t> Bytes) {
+  const bool IsX86_64 = (Obj->getArch() == Triple::x86_64);
+  uint64_t Size;
+  for (uint64_t Index = 0; Index < Bytes.size(); Index += Size) {
+    MCInst Inst;
+    uint64_t Addr = SectionAddr + Index;
+    bool Decoded =
+        DisAsm->getInstruction(Inst, Size, Bytes.slice(Index), Addr, nulls());
+    if (Size == 0)
+      Size = 1;
+    if (!Decoded)
+      continue;
+
+    if (IsX86_64 && Size == sizeof(Endbr64Bytes) &&
+        Bytes.slice(Index, Size) == makeArrayRef(Endbr64Bytes)) {
+      addStart(Addr);
+      continue;
+    }
+
+    uint64_t Target;
+    if (MIA->isCall(Inst) && MIA->evaluateBranch(Inst, Addr, Size, Target))
+      addStart(Target);
+  }
+}
+
+// The entry point of an x86-64 binary passes the address of main to
+// __libc_start_main in RDI. Look for the instruction that sets RDI to an
+// address in the section before the first call of the entry point.
+void FunctionBoundaryDiscovery::addMainFromEntryPoint(ArrayRef<uint8_t> Bytes) {
+  if (Obj->getArch() != Triple::x86_64)
+    return;
+
+  auto EntryIter = llvm::find_if(
+      Starts, [](const std::pair<const uint64_t, std::string> &Start) {
+        return Start.second == "_start";
+      });
+  if (EntryIter == Starts.end())
+    return;
+
+  uint64_t MainAddr = 0;
+  uint64_t Size;
+  for (uint64_t Index = EntryIter->first - SectionAddr; Index < Bytes.size();
+       Index += Size) {
+    MCInst Inst;
+    uint64_t Addr = SectionAddr + Index;
+    if (!DisAsm->getInstruction(Inst, Size, Bytes.slice(Index), Addr, nulls()))
+      break;
+    if (MIA->isCall(Inst) || MIA->isBranch(Inst) || MIA->isReturn(Inst))
+      break;
+    if (Inst.getNumOperands() < 2 || !Inst.getOperand(0).isReg())
+      continue;
+    StringRef DstReg(MRI->getName(Inst.getOperand(0).getReg()));
+    if (DstReg != "RDI" && DstReg != "EDI")
+      continue;
+
+    // mov $main, %rdi
+    if (Inst.getOperand(1).isImm()) {
+      uint64_t Imm = Inst.getOperand(1).getImm();
+      if (isInSection(Imm))
+        MainAddr = Imm;
+      continue;
+    }
+    // lea main(%rip), %rdi
+    Optional<uint64_t> MemAddr =
+        MIA->evaluateMemoryOperandAddress(Inst, nullptr, Addr, Size);
+    if (MemAddr && isInSection(*MemAddr))
+      MainAddr = *MemAddr;
+  }
+
+  if (MainAddr != 0)
+    Starts[MainAddr] = "main";
+}
+
+// Functions linked in from crt1.o and crtbegin.o (e.g., deregister_tm_clones
+// and __do_global_dtors_aux) are laid out between the entry point and
+// frame_dummy. Drop the starts of those not known by name, so that their
+// code is skipped along with that of the entry point.
+void FunctionBoundaryDiscovery::removeRuntimeFunctions() {
+  uint64_t EntryAddr = 0;
+  uint64_t FrameDummyAddr = 0;
+  for (auto &Start : Starts) {
+    if (Start.second == "_start")
+      EntryAddr = Start.first;
+    else if (Start.second == "frame_dummy")
+      FrameDummyAddr = Start.first;
+  }
+  if (EntryAddr == 0 || FrameDummyAddr <= EntryAddr)
+    return;
+
+  for (auto Iter = Starts.upper_bound(EntryAddr);
+       Iter != Starts.end() && Iter->first < FrameDummyAddr;) {
+    if (Iter->second.empty())
+      Iter = Starts.erase(Iter);
+    else
+      ++Iter;
+  }
+}
+
+unsigned FunctionBoundaryDiscovery::discover(const SectionRef &Section,
+                                             SectionSymbolsTy &Symbols,
+                                             StringSaver &Saver) {
+  SectionAddr = Section.getAddress();
+  SectionSize = Section.getSize();
+  Starts.clear();
+
+  Expected<StringRef> ContentsOrErr = Section.getContents();
+  if (!ContentsOrErr) {
+    consumeError(ContentsOrErr.takeError());
+    return 0;
+  }
+  ArrayRef<uint8_t> Bytes(
+      reinterpret_cast<const uint8_t *>(ContentsOrErr->data()),
+      ContentsOrErr->size());
+
+  addEntryPoint();
+  addPointerArrayEntries(".preinit_array", StringRef());
+  addPointerArrayEntries(".init_array", "frame_dummy");
+  addPointerArrayEntries(".fini_array", "__do_global_dtors_aux");
+  addEHFrameEntries();
+  scanInstructions(Bytes);
+  addMainFromEntryPoint(Bytes);
+  removeRuntimeFunctions();
+
+  // Symbols already present (e.g., from the dynamic symbol table) are kept.
+  std::set<uint64_t> SymbolAddrs;
+  for (const SymbolInfoTy &Symbol : Symbols)
+    SymbolAddrs.insert(Symbol.Addr);
+
+  unsigned NumAdded = 0;
+  for (auto &Start : Starts) {
+    if (SymbolAddrs.count(Start.first))
+      continue;
+    std::string Name = Start.second.empty()
+                           ? ("sub_" + Twine::utohexstr(Start.first)).str()
+                           : Start.second;
+    Symbols.emplace_back(Start.first, Saver.save(Name), ELF::STT_FUNC);
+    NumAdded++;
+  }
+
+  LLVM_DEBUG(dbgs() << "Discovered " << NumAdded
+                    << " function(s) without symbols in section at 0x"
+                    << Twine::utohexstr(SectionAddr) << "\n");
+  return NumAdded;
+}
+
+#undef DEBUG_TYPE
@@ -0,0 +1,91 @@
+//===-- FunctionBoundaryDiscovery.h -----------------------------*- C++ -*-===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+//
+// This file contains the declaration of FunctionBoundaryDiscovery class
+// for use by llvm-mctoll.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef LLVM_TOOLS_LLVM_MCTOLL_FUNCTIONBOUNDARYDISCOVERY_H
+#define LLVM_TOOLS_LLVM_MCTOLL_FUNCTIONBOUNDARYDISCOVERY_H
+
+#include "llvm/MC/MCDisassembler/MCDisassembler.h"
+#include "llvm/MC/MCInstrAnalysis.h"
+#include "llvm/MC/MCRegisterInfo.h"
+#include "llvm/Object/ObjectFile.h"
+#include "llvm/Support/StringSaver.h"
+#include <map>
+#include <string>
+#include <vector>
+
+namespace llvm {
+namespace mctoll {
+
+/// Discovers start addresses of functions in a text section of a binary
+/// without a symbol table (i.e., a stripped binary). Function starts are
+/// seeded from
+///   - the entry point of the binary,
+///   - the entries of .init_array, .fini_array and .preinit_array,
+///   - the ranges of FDEs in .eh_frame,
+///   - targets of direct calls, and
+///   - ENDBR64 instructions (x86-64 only).
+/// The entry point and the first entries of .init_array and .fini_array are
+/// named after the C runtime functions they correspond to, so that they are
+/// not raised. The function whose address is passed to __libc_start_main by
+/// the entry point of an x86-64 binary is named main. All other discovered
+/// functions are named sub_<address>.
+class FunctionBoundaryDiscovery {
+public:
+  FunctionBoundaryDiscovery(const object::ObjectFile *Obj,
+                            const MCDisassembler *DisAsm,
+                            const MCInstrAnalysis *MIA,
+                            const MCRegisterInfo *MRI)
+      : Obj(Obj), DisAsm(DisAsm), MIA(MIA), MRI(MRI) {
+    indexDynRelocations();
+  }
+
+  /// Add a function symbol to Symbols for each function discovered in
+  /// Section that does not already have a symbol. Symbol names are allocated
+  /// using Saver. Return the number of symbols added.
+  unsigned discover(const object::SectionRef &Section,
+                    SectionSymbolsTy &Symbols, StringSaver &Saver);
+
+private:
+  /// Record Addr as a function start named Name, unless Addr is outside the
+  /// section being processed or is already named.
+  void addStart(uint64_t Addr, StringRef Name = StringRef());
+  void addEntryPoint();
+  void addPointerArrayEntries(StringRef SectionName, StringRef FirstName);
+  void addEHFrameEntries();
+  void scanInstructions(ArrayRef<uint8_t> Bytes);
+  void addMainFromEntryPoint(ArrayRef<uint8_t> Bytes);
+  void removeRuntimeFunctions();
+  void indexDynRelocations();
+  uint64_t getDynRelocatedPointer(uint64_t Addr) const;
+  bool isInSection(uint64_t Addr) const {
+    return (Addr >= SectionAddr) && (Addr < SectionAddr + SectionSize);
+  }
+
+  const object::ObjectFile *Obj;
+  const MCDisassembler *DisAsm;
+  const MCInstrAnalysis *MIA;
+  const MCRegisterInfo *MRI;
+  uint64_t SectionAddr = 0;
+  uint64_t SectionSize = 0;
+  /// Map of discovered function start address to name. An empty name
+  /// denotes a function not (yet) known by name.
+  std::map<uint64_t, std::string> Starts;
+  /// Offsets and addends of the dynamic relocations of the binary, sorted by
+  /// offset.
+  std::vector<std::pair<uint64_t, int64_t>> DynRelocAddends;
+};
+
+} // end namespace mctoll
+} // end namespace llvm
+
+#endif // LLVM_TOOLS_LLVM_MCTOLL_FUNCTIONBOUNDARYDISCOVERY_H
@@ -0,0 +1,341 @@
+//===-- FunctionDigests.cpp -------------------------------------*- C++ -*-===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+//
+// This file contains the implementation of FunctionDigests class
+// for use by llvm-mctoll.
+//
+//===----------------------------------------------------------------------===//
+
+#include "FunctionDigests.h"
+#include "llvm/ADT/StringExtras.h"
+#include "llvm/BinaryFormat/ELF.h"
+#include "llvm/MC/MCInst.h"
+#include "llvm/Object/ELFObjectFile.h"
+#include "llvm/Support/Debug.h"
+#include "llvm/Support/SHA1.h"
+
+#define DEBUG_TYPE "mctoll"
+
+using namespace llvm;
+using namespace llvm::mctoll;
+using namespace llvm::object;
+
+// Maximum number of instructions of a PLT stub decoded to find the GOT slot
+// it jumps through (e.g., endbr64; bnd jmp *slot(%rip) in .plt.sec).
+static const unsigned MaxPLTStubInsts = 3;
+
+FunctionDigests::FunctionDigests(const ObjectFile *Obj,
+                                 const MCDisassembler *DisAsm,
+                                 const MCInstrAnalysis *MIA)
+    : Obj(Obj), DisAsm(DisAsm), MIA(MIA) {
+  for (const SymbolRef &Sym : Obj->symbols()) {
+    Expected<SymbolRef::Type> TypeOrErr = Sym.getType();
+    Expected<section_iterator> SecOrErr = Sym.getSection();
+    Expected<uint64_t> AddrOrErr = Sym.getAddress();
+    Expected<StringRef> NameOrErr = Sym.getName();
+    if (!TypeOrErr || !SecOrErr || !AddrOrErr || !NameOrErr) {
+      consumeError(TypeOrErr.takeError());
+      consumeError(SecOrErr.takeError());
+      consumeError(AddrOrErr.takeError());
+      consumeError(NameOrErr.takeError());
+      continue;
+    }
+    if ((*TypeOrErr != SymbolRef::ST_Function) ||
+        (*SecOrErr == Obj->section_end()) || !(*SecOrErr)->isText() ||
+        NameOrErr->empty())
+      continue;
+    Functions[(*SecOrErr)->getIndex()].emplace_back(*AddrOrErr, *NameOrErr);
+  }
+  for (auto &Entry : Functions)
+    llvm::sort(Entry.second);
+
+  if (!Obj->isELF())
+    return;
+
+  if (Obj->isRelocatableObject()) {
+    for (const SectionRef &RelSec : Obj->sections()) {
+      Expected<section_iterator> RelocatedOrErr = RelSec.getRelocatedSection();
+      if (!RelocatedOrErr) {
+        consumeError(RelocatedOrErr.takeError());
+        continue;
+      }
+      if ((*RelocatedOrErr == Obj->section_end()) ||
+          !(*RelocatedOrErr)->isText())
+        continue;
+      std::vector<RelocationRef> &SecRelocs =
+          Relocs[(*RelocatedOrErr)->getIndex()];
+      for (const RelocationRef &Reloc : RelSec.relocations())
+        SecRelocs.push_back(Reloc);
+    }
+    return;
+  }
+
+  for (const SectionRef &RelSec : Obj->dynamic_relocation_sections())
+    for (const RelocationRef &Reloc : RelSec.relocations()) {
+      symbol_iterator Sym = Reloc.getSymbol();
+      if (Sym == Obj->symbol_end())
+        continue;
+      Expected<StringRef> NameOrErr = Sym->getName();
+      if (!NameOrErr) {
+        consumeError(NameOrErr.takeError());
+        continue;
+      }
+      if (!NameOrErr->empty())
+        GOTSlotSymbols[Reloc.getOffset()] = *NameOrErr;
+    }
+}
+
+StringMap<std::string> FunctionDigests::compute() {
+  StringMap<std::string> Digests;
+  for (const SectionRef &Section : Obj->sections()) {
+    auto FuncIter = Functions.find(Section.getIndex());
+    if (FuncIter == Functions.end())
+      continue;
+    Expected<StringRef> ContentsOrErr = Section.getContents();
+    if (!ContentsOrErr) {
+      consumeError(ContentsOrErr.takeError());
+      continue;
+    }
+    ArrayRef<uint8_t> Bytes = arrayRefFromStringRef(*ContentsOrErr);
+    const uint64_t SecEnd = Section.getAddress() + Bytes.size();
+
+    const FunctionSymbols &Syms = FuncIter->second;
+    for (auto SymIter = Syms.begin(); SymIter != Syms.end(); ++SymIter) {
+      const uint64_t Start = SymIter->first;
+      auto NextIter = std::upper_bound(
+          SymIter, Syms.end(), Start,
+          [](uint64_t Addr, const std::pair<uint64_t, StringRef> &Sym) {
+            return Addr < Sym.first;
+          });
+      const uint64_t End = (NextIter == Syms.end()) ? SecEnd : NextIter->first;
+      std::string Digest = (Start < End) && (End <= SecEnd)
+                               ? digestFunction(Section, Bytes, Start, End)
+                               : std::string();
+      // Functions of the same name (e.g., static functions of different
+      // sources) cannot be told apart.
+      auto Inserted = Digests.try_emplace(SymIter->second, Digest);
+      if (!Inserted.second)
+        Inserted.first->second.clear();
+    }
+  }
+
+  LLVM_DEBUG(dbgs() << "Computed digests of " << Digests.size()
+                    << " function(s) of " << Obj->getFileName() << "\n");
+  return Digests;
+}
+
+std::string FunctionDigests::digestFunction(const SectionRef &Section,
+                                            ArrayRef<uint8_t> Bytes,
+                                            uint64_t Start, uint64_t End) {
+  std::string Key;
+  raw_string_ostream KeyStream(Key);
+  const uint64_t SecAddr = Section.getAddress();
+
+  uint64_t Size;
+  for (uint64_t Addr = Start; Addr < End; Addr += Size) {
+    MCInst Inst;
+    ArrayRef<uint8_t> InstBytes = Bytes.slice(Addr - SecAddr, End - Addr);
+    if (!DisAsm->getInstruction(Inst, Size, InstBytes, Addr, nulls())) {
+      // Bytes that are not instructions (e.g., data in code) are compared as
+      // they are.
+      if (Size == 0)
+        Size = 1;
+      KeyStream << "D" << toHex(InstBytes.take_front(Size)) << ";";
+      continue;
+    }
+
+    KeyStream << Inst.getOpcode() << "/" << Size;
+    Optional<int64_t> Displacement;
+    uint64_t Target;
+    if ((MIA->isBranch(Inst) || MIA->isCall(Inst)) &&
+        MIA->evaluateBranch(Inst, Addr, Size, Target)) {
+      KeyStream << " " << getReference(Section, Start, End, Target);
+      Displacement = Target - (Addr + Size);
+    } else if (Optional<uint64_t> MemAddr = MIA->evaluateMemoryOperandAddress(
+                   Inst, nullptr, Addr, Size)) {
+      KeyStream << " M" << getReference(Section, Start, End, *MemAddr);
+      Displacement = *MemAddr - (Addr + Size);
+    }
+
+    for (const MCOperand &Op : Inst) {
+      if (Op.isReg()) {
+        KeyStream << " r" << Op.getReg();
+      } else if (Op.isImm()) {
+        // The displacement is given by the reference above.
+        if (Displacement && (*Displacement == Op.getImm())) {
+          Displacement = None;
+          continue;
+        }
+        KeyStream << " i" << Op.getImm();
+      } else {
+        // Operands such as expressions are not compared.
+        return std::string();
+      }
+    }
+    KeyStream << ";";
+  }
+
+  // In a relocatable object, the targets of references are given by the
+  // relocations of the code.
+  auto RelocIter = Relocs.find(Section.getIndex());
+  if (RelocIter != Relocs.end())
+    for (const RelocationRef &Reloc : RelocIter->second) {
+      const uint64_t Offset = Reloc.getOffset();
+      if ((Offset < Start - SecAddr) || (Offset >= End - SecAddr))
+        continue;
+      KeyStream << "R" << Reloc.getType() << "@"
+                << (Offset - (Start - SecAddr));
+      symbol_iterator Sym = Reloc.getSymbol();
+      if (Sym != Obj->symbol_end()) {
+        Expected<StringRef> NameOrErr = Sym->getName();
+        if (!NameOrErr) {
+          consumeError(NameOrErr.takeError());
+          return std::string();
+        }
+        KeyStream << " " << *NameOrErr;
+        // Section symbols have no name.
+        if (NameOrErr->empty()) {
+          Expected<section_iterator> SecOrErr = Sym->getSection();
+          if (!SecOrErr) {
+            consumeError(SecOrErr.takeError());
+            return std::string();
+          }
+          if (*SecOrErr != Obj->section_end()) {
+            Expected<StringRef> SecNameOrErr = (*SecOrErr)->getName();
+            if (!SecNameOrErr) {
+              consumeError(SecNameOrErr.takeError());
+              return std::string();
+            }
+            KeyStream << *SecNameOrErr;
+          }
+        }
+      }
+      Expected<int64_t> AddendOrErr = ELFRelocationRef(Reloc).getAddend();
+      if (AddendOrErr)
+        KeyStream << "+" << *AddendOrErr;
+      else
+        consumeError(AddendOrErr.takeError());
+      KeyStream << ";";
+    }
+
+  SHA1 Hasher;
+  Hasher.update(KeyStream.str());
+  return toHex(Hasher.final(), /*LowerCase=*/true);
+}
+
+std::string FunctionDigests::getReference(const SectionRef &Section,
+                                          uint64_t Start, uint64_t End,
+                                          uint64_t Addr) {
+  if ((Addr >= Start) && (Addr < End))
+    return ("L" + Twine(Addr - Start)).str();
+
+  auto SlotIter = GOTSlotSymbols.find(Addr);
+  if (SlotIter != GOTSlotSymbols.end())
+    return ("G" + SlotIter->second).str();
+
+  // Sections of a relocatable object all start at address 0. References not
+  // given by relocations are to the section of the code.
+  Optional<SectionRef> Target;
+  if (Obj->isRelocatableObject())
+    Target = Section;
+  else
+    for (const SectionRef &Sec : Obj->sections()) {
+      if (Obj->isELF() && !(ELFSectionRef(Sec).getFlags() & ELF::SHF_ALLOC))
+        continue;
+      if ((Addr >= Sec.getAddress()) &&
+          (Addr < Sec.getAddress() + Sec.getSize())) {
+        Target = Sec;
+        break;
+      }
+    }
+  if (!Target)
+    return ("A" + Twine::utohexstr(Addr)).str();
+
+  auto FuncIter = Functions.find(Target->getIndex());
+  if (FuncIter != Functions.end()) {
+    const FunctionSymbols &Syms = FuncIter->second;
+    auto SymIter = std::upper_bound(
+        Syms.begin(), Syms.end(), Addr,
+        [](uint64_t Addr, const std::pair<uint64_t, StringRef> &Sym) {
+          return Addr < Sym.first;
+        });
+    if (SymIter != Syms.begin()) {
+      --SymIter;
+      return ("F" + SymIter->second + "+" + Twine(Addr - SymIter->first))
+          .str();
+    }
+  }
+
+  if (Target->isText()) {
+    StringRef Name = getPLTTargetName(*Target, Addr);
+    if (!Name.empty())
+      return ("P" + Name).str();
+  }
+
+  Expected<StringRef> NameOrErr = Target->getName();
+  if (!NameOrErr) {
+    consumeError(NameOrErr.takeError());
+    return ("A" + Twine::utohexstr(Addr)).str();
+  }
+  return ("S" + *NameOrErr + "+" + Twine(Addr - Target->getAddress()) + "#" +
+          getSectionHash(*Target))
+      .str();
+}
+
+StringRef FunctionDigests::getPLTTargetName(const SectionRef &Section,
+                                            uint64_t Addr) {
+  Expected<StringRef> ContentsOrErr = Section.getContents();
+  if (!ContentsOrErr) {
+    consumeError(ContentsOrErr.takeError());
+    return StringRef();
+  }
+  ArrayRef<uint8_t> Bytes = arrayRefFromStringRef(*ContentsOrErr);
+  const uint64_t SecAddr = Section.getAddress();
+
+  uint64_t Size;
+  uint64_t Index = Addr - SecAddr;
+  for (unsigned NumInsts = 0;
+       NumInsts < MaxPLTStubInsts && Index < Bytes.size();
+       NumInsts++, Index += Size) {
+    MCInst Inst;
+    if (!DisAsm->getInstruction(Inst, Size, Bytes.slice(Index),
+                                SecAddr + Index, nulls()))
+      return StringRef();
+    Optional<uint64_t> SlotAddr = MIA->evaluateMemoryOperandAddress(
+        Inst, nullptr, SecAddr + Index, Size);
+    if (!SlotAddr)
+      continue;
+    auto SlotIter = GOTSlotSymbols.find(*SlotAddr);
+    if (SlotIter == GOTSlotSymbols.end())
+      return StringRef();
+    return SlotIter->second;
+  }
+  return StringRef();
+}
+
+StringRef FunctionDigests::getSectionHash(const SectionRef &Section) {
+  auto Inserted = SectionHashes.try_emplace(Section.getIndex());
+  if (!Inserted.second)
+    return Inserted.first->second;
+
+  SHA1 Hasher;
+  Hasher.update(std::to_string(Section.getSize()));
+  // Sections without contents in the binary (e.g., .bss) are compared by
+  // size.
+  if (!Section.isBSS()) {
+    Expected<StringRef> ContentsOrErr = Section.getContents();
+    if (ContentsOrErr)
+      Hasher.update(*ContentsOrErr);
+    else
+      consumeError(ContentsOrErr.takeError());
+  }
+  Inserted.first->second = toHex(Hasher.final(), /*LowerCase=*/true);
+  return Inserted.first->second;
+}
+
+#undef DEBUG_TYPE
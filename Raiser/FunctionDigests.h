@@ -0,0 +1,83 @@
+//===-- FunctionDigests.h ---------------------------------------*- C++ -*-===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+//
+// This file contains the declaration of FunctionDigests class
+// for use by llvm-mctoll.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef LLVM_TOOLS_LLVM_MCTOLL_FUNCTIONDIGESTS_H
+#define LLVM_TOOLS_LLVM_MCTOLL_FUNCTIONDIGESTS_H
+
+#include "llvm/ADT/StringMap.h"
+#include "llvm/MC/MCDisassembler/MCDisassembler.h"
+#include "llvm/MC/MCInstrAnalysis.h"
+#include "llvm/Object/ObjectFile.h"
+#include <map>
+#include <string>
+#include <vector>
+
+namespace llvm {
+namespace mctoll {
+
+/// Computes a digest of the code of each function symbol in the text sections
+/// of a binary. Digests of a function in two versions of a binary are equal
+/// if the code of the function did not change, even if the function or the
+/// code and data it refers to moved. To that end, each address the code refers
+/// to is expressed as
+///   - an offset in the function, for addresses in the function,
+///   - an offset in the function containing it, for addresses in other
+///     functions,
+///   - the name of the function called, for calls through PLT stubs, and
+///   - an offset in the section containing it along with a hash of the
+///     section contents, for other addresses (e.g., of data).
+/// In relocatable objects, the relocations of the code are part of the digest.
+class FunctionDigests {
+public:
+  FunctionDigests(const object::ObjectFile *Obj, const MCDisassembler *DisAsm,
+                  const MCInstrAnalysis *MIA);
+
+  /// Return a map of the name of each function symbol to the digest of its
+  /// code. The digest of code that could not be decoded is empty.
+  StringMap<std::string> compute();
+
+private:
+  /// Function symbols of a text section, sorted by address
+  using FunctionSymbols = std::vector<std::pair<uint64_t, StringRef>>;
+
+  std::string digestFunction(const object::SectionRef &Section,
+                             ArrayRef<uint8_t> Bytes, uint64_t Start,
+                             uint64_t End);
+  /// Return a string identifying Addr, referenced by the function of Section
+  /// in [Start, End), independently of the layout of the binary.
+  std::string getReference(const object::SectionRef &Section, uint64_t Start,
+                           uint64_t End, uint64_t Addr);
+  /// Return the name of the function the PLT stub at Addr calls; an empty
+  /// string if Addr is not a PLT stub.
+  StringRef getPLTTargetName(const object::SectionRef &Section, uint64_t Addr);
+  StringRef getSectionHash(const object::SectionRef &Section);
+
+  const object::ObjectFile *Obj;
+  const MCDisassembler *DisAsm;
+  const MCInstrAnalysis *MIA;
+  /// Function symbols of text sections, keyed by section index
+  std::map<uint64_t, FunctionSymbols> Functions;
+  /// Relocations of text sections of relocatable objects, keyed by section
+  /// index
+  std::map<uint64_t, std::vector<object::RelocationRef>> Relocs;
+  /// Map of GOT slot address to the name of the symbol whose address is
+  /// stored in the slot by a dynamic relocation.
+  std::map<uint64_t, StringRef> GOTSlotSymbols;
+  /// Hashes of section contents, keyed by section index
+  std::map<uint64_t, std::string> SectionHashes;
+};
+
+} // end namespace mctoll
+} // end namespace llvm
+
+#endif // LLVM_TOOLS_LLVM_MCTOLL_FUNCTIONDIGESTS_H
@@ -27,7 +27,8 @@ public:
   using const_mcinst_iter = std::map<uint64_t, MCInstOrData>::const_iterator;
 
   MCInstRaiser(uint64_t Start, uint64_t End)
-      : FuncStart(Start), FuncEnd(End), DataInCode(false){};
+      : FuncStart(Start), FuncEnd(End), TextSectionIndex(-1),
+        TextSectionAddress(-1), DataInCode(false){};
 
   void addTarget(uint64_t TargetIndex) {
     // Add targetIndex only if it falls within the function start and end
@@ -44,6 +45,15 @@ public:
   std::set<uint64_t> getTargetIndices() const { return TargetIndices; }
   uint64_t getFuncStart() const { return FuncStart; }
   uint64_t getFuncEnd() const { return FuncEnd; }
+  // Set the index and address of the text section containing the function.
+  // Function start and end, as well as instruction indices, are offsets in
+  // this section.
+  void setTextSection(int64_t Index, int64_t Address) {
+    TextSectionIndex = Index;
+    TextSectionAddress = Address;
+  }
+  int64_t getTextSectionIndex() const { return TextSectionIndex; }
+  int64_t getTextSectionAddress() const { return TextSectionAddress; }
   // Change the value of function end to a new value greater than current value
   bool adjustFuncEnd(uint64_t N);
   // Is Index in range of this function?
@@ -110,6 +120,10 @@ private:
   // Start and End offsets of the array of MCInsts in mcInstVector
   uint64_t FuncStart;
   uint64_t FuncEnd;
+  // Index and address of the text section containing the function; -1 if
+  // unknown
+  int64_t TextSectionIndex;
+  int64_t TextSectionAddress;
   // Flag to indicate that the mcInstVector includes data (or uint32_ sized
   // quantities that the disassembler was unable to recognize as instructions
   // and are considered data
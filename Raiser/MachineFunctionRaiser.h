@@ -34,6 +34,9 @@ public:
       : MF(TheMF), M(TheM), MachineInstRaiser(nullptr), MR(TheMR) {
 
     InstRaiser = new MCInstRaiser(Start, End);
+    // The function belongs to the text section being decoded.
+    InstRaiser->setTextSection(MR->getTextSectionIndex(),
+                               MR->getTextSectionAddress());
 
     // The new MachineFunction is not in SSA form, yet
     MF.getProperties().reset(MachineFunctionProperties::Property::IsSSA);
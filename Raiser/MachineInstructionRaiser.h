@@ -52,6 +52,9 @@ public:
 
   virtual bool raise() { return true; };
   virtual FunctionType *getRaisedFunctionPrototype() = 0;
+  // Construct the raised function with prototype FT, discovered by an earlier
+  // run, instead of discovering it. Return false if not supported.
+  virtual bool setRaisedFunctionPrototype(FunctionType *FT) { return false; }
   virtual int getArgumentNumber(unsigned PReg) = 0;
   virtual Value *getRegOrArgValue(unsigned PReg, int MBBNo) = 0;
   virtual bool buildFuncArgTypeVector(const std::set<MCPhysReg> &,
@@ -63,6 +66,17 @@ public:
   MachineFunction &getMF() { return MF; };
   const ModuleRaiser *getModuleRaiser() { return MR; }
 
+  // Return a string of the form <name>@<address> identifying the function
+  // being raised. Used to annotate diagnostics and time trace scopes.
+  std::string getFunctionDescription() const {
+    uint64_t Addr = (InstRaiser != nullptr) ? InstRaiser->getFuncStart() : 0;
+    int64_t TextSecAddr =
+        (InstRaiser != nullptr) ? InstRaiser->getTextSectionAddress() : -1;
+    if (TextSecAddr > 0)
+      Addr += TextSecAddr;
+    return (MF.getName() + "@0x" + Twine::utohexstr(Addr)).str();
+  }
+
   std::vector<ControlTransferInfo *> getControlTransferInfo() {
     return CTInfo;
   };
@@ -8,11 +8,30 @@
 //===----------------------------------------------------------------------===//
 
 #include "ModuleRaiser.h"
+#include "AnalysisDatabase.h"
+#include "InstMetadata.h"
 #include "MachineFunctionRaiser.h"
 #include "MachineInstructionRaiser.h"
+#include "llvm/ADT/SetVector.h"
+#include "llvm/ADT/SmallPtrSet.h"
+#include "llvm/AsmParser/Parser.h"
+#include "llvm/BinaryFormat/Dwarf.h"
+#include "llvm/IR/GlobalAlias.h"
+#include "llvm/IR/InstIterator.h"
 #include "llvm/IR/Instructions.h"
+#include "llvm/Object/ELFObjectFile.h"
+#include "llvm/IR/IntrinsicInst.h"
+#include "llvm/Support/CrashRecoveryContext.h"
 #include "llvm/Support/Debug.h"
+#include "llvm/Support/Format.h"
+#include "llvm/Support/Path.h"
+#include "llvm/Support/TimeProfiler.h"
+#include "llvm/Support/Process.h"
+#include "llvm/Support/SHA1.h"
+#include "llvm/Support/SourceMgr.h"
 #include "llvm/Support/WithColor.h"
+#include "llvm/Transforms/Utils/Cloning.h"
+#include "llvm/Transforms/Utils/ValueMapper.h"
 
 
 #define DEBUG_TYPE "mctoll"
@@ -29,26 +48,26 @@ void mctoll::error(std::error_code EC) {
 
   errs() << ToolName << ": error reading file: " << EC.message() << ".\n";
   errs().flush();
-  exit(1);
+  sys::Process::Exit(1);
 }
 
 void mctoll::error(Error E) {
   if (!E)
     return;
   WithColor::error(errs(), ToolName) << toString(std::move(E));
-  exit(1);
+  sys::Process::Exit(1);
 }
 
 [[noreturn]] void mctoll::error(Twine Message) {
   errs() << ToolName << ": " << Message << ".\n";
   errs().flush();
-  exit(1);
+  sys::Process::Exit(1);
 }
 
 [[noreturn]] void mctoll::reportError(StringRef File, Twine Message) {
   WithColor::error(errs(), ToolName)
       << "'" << File << "': " << Message << ".\n";
-  exit(1);
+  sys::Process::Exit(1);
 }
 
 [[noreturn]] void mctoll::reportError(Error E, StringRef File) {
@@ -58,7 +77,7 @@ void mctoll::error(Error E) {
   logAllUnhandledErrors(std::move(E), OS);
   OS.flush();
   WithColor::error(errs(), ToolName) << "'" << File << "': " << Buf;
-  exit(1);
+  sys::Process::Exit(1);
 }
 
 [[noreturn]] void mctoll::reportError(Error E, StringRef ArchiveName,
@@ -77,7 +96,7 @@ void mctoll::error(Error E) {
   logAllUnhandledErrors(std::move(E), OS);
   OS.flush();
   errs() << ": " << Buf;
-  exit(1);
+  sys::Process::Exit(1);
 }
 
 [[noreturn]] void mctoll::reportError(Error E, StringRef ArchiveName,
@@ -122,48 +141,107 @@ void mctoll::registerModuleRaiser(ModuleRaiser *M) {
 }
 
 Function *ModuleRaiser::getRaisedFunctionAt(uint64_t Index) const {
-  int64_t TextSecAddr = getTextSectionAddress();
-  for (auto *MFR : MFRaiserVector)
-    if ((MFR->getMCInstRaiser()->getFuncStart() + TextSecAddr) == Index)
+  for (auto *MFR : MFRaiserVector) {
+    MCInstRaiser *MCIR = MFR->getMCInstRaiser();
+    if ((MCIR->getFuncStart() + MCIR->getTextSectionAddress()) == Index)
       return MFR->getRaisedFunction();
+  }
+
+  for (const FoldedFunction &FF : FoldedFunctions)
+    if ((FF.Offset + FF.SecAddr) == Index)
+      return FF.Canonical->getRaisedFunction();
+
+  for (const UnraisedFunction &UF : UnraisedFunctions)
+    if ((UF.Offset + UF.SecAddr) == Index) {
+      reportUnraisedReference(UF);
+      return nullptr;
+    }
 
   return nullptr;
 }
 
-const RelocationRef *ModuleRaiser::getDynRelocAtOffset(uint64_t Loc) const {
-  if (DynRelocs.empty())
-    return nullptr;
+Function *ModuleRaiser::getRaisedFunctionAt(uint64_t Offset,
+                                            int64_t SecIdx) const {
+  for (auto *MFR : MFRaiserVector) {
+    MCInstRaiser *MCIR = MFR->getMCInstRaiser();
+    if ((MCIR->getTextSectionIndex() == SecIdx) &&
+        (MCIR->getFuncStart() == Offset))
+      return MFR->getRaisedFunction();
+  }
+
+  for (const FoldedFunction &FF : FoldedFunctions)
+    if ((FF.SecIdx == SecIdx) && (FF.Offset == Offset))
+      return FF.Canonical->getRaisedFunction();
 
-  auto RelocIter = std::find_if(
-      DynRelocs.begin(), DynRelocs.end(),
-      [Loc](const RelocationRef &A) -> bool { return (A.getOffset() == Loc); });
-  if (RelocIter != DynRelocs.end())
+  for (const UnraisedFunction &UF : UnraisedFunctions)
+    if ((UF.SecIdx == SecIdx) && (UF.Offset == Offset)) {
+      reportUnraisedReference(UF);
+      return nullptr;
+    }
+
+  return nullptr;
+}
+
+void ModuleRaiser::addUnraisedFunction(StringRef Name, uint64_t Offset) {
+  UnraisedFunctions.push_back(
+      {Name.str(), TextSectionIndex, TextSectionAddress, Offset});
+}
+
+// A reference to a function that is not raised is not resolved to a
+// declaration, since nothing would define it in the program. It is a
+// reference that the analysis of reachable functions missed.
+void ModuleRaiser::reportUnraisedReference(const UnraisedFunction &UF) const {
+  if (!ReportedUnraisedFunctions.insert(UF.Name).second)
+    return;
+  errs() << "***** WARNING: " << UF.Name
+         << " is referenced by raised code but was not found reachable from "
+            "the roots; add it to --roots to raise it\n";
+}
+
+void ModuleRaiser::sortDynamicRelocations() {
+  // Keep the collection order of relocations with the same offset.
+  llvm::stable_sort(DynRelocs,
+                    [](const RelocationRef &A, const RelocationRef &B) {
+                      return A.getOffset() < B.getOffset();
+                    });
+}
+
+const RelocationRef *ModuleRaiser::getDynRelocAtOffset(uint64_t Loc) const {
+  auto RelocIter = llvm::partition_point(
+      DynRelocs, [Loc](const RelocationRef &A) { return A.getOffset() < Loc; });
+  if ((RelocIter != DynRelocs.end()) && (RelocIter->getOffset() == Loc))
     return &(*RelocIter);
 
   return nullptr;
 }
 
-// Return relocation whose offset is in the range [Index, Index+Size)
+// Return relocation of text section with index SecIdx whose offset is in the
+// range [Index, Index+Size)
 const RelocationRef *ModuleRaiser::getTextRelocAtOffset(uint64_t Index,
-                                                        uint64_t Size) const {
-  if (TextRelocs.empty())
+                                                        uint64_t Size,
+                                                        int64_t SecIdx) const {
+  auto SecRelocsIter = TextRelocs.find(SecIdx);
+  if (SecRelocsIter == TextRelocs.end())
     return nullptr;
 
-  auto RelocIter = std::find_if(TextRelocs.begin(), TextRelocs.end(),
-                                [Index, Size](const RelocationRef &A) -> bool {
-                                  return ((A.getOffset() >= Index) &&
-                                          (A.getOffset() < (Index + Size)));
-                                });
-  if (RelocIter != TextRelocs.end())
+  // Relocations are sorted by offset.
+  const std::vector<RelocationRef> &SecRelocs = SecRelocsIter->second;
+  auto RelocIter = llvm::partition_point(
+      SecRelocs,
+      [Index](const RelocationRef &A) { return A.getOffset() < Index; });
+  if ((RelocIter != SecRelocs.end()) &&
+      (RelocIter->getOffset() < (Index + Size)))
     return &(*RelocIter);
 
   return nullptr;
 }
 
 Function *ModuleRaiser::getCalledFunctionUsingTextReloc(uint64_t Loc,
-                                                        uint64_t Size) const {
+                                                        uint64_t Size,
+                                                        int64_t SecIdx) const {
   // Find the text relocation with offset in the range [Loc, Loc+Size)
-  const RelocationRef *TextReloc = getTextRelocAtOffset(Loc, Loc + Size);
+  const RelocationRef *TextReloc =
+      getTextRelocAtOffset(Loc, Loc + Size, SecIdx);
   if (TextReloc != nullptr) {
     Expected<StringRef> Sym = TextReloc->getSymbol()->getName();
     assert(Sym && "Failed to find call target symbol");
@@ -190,9 +268,15 @@ bool ModuleRaiser::runMachineFunctionPasses() {
   // For each of the functions, run passes to set up for instruction raising.
   for (auto *MFR : MFRaiserVector) {
     // 1. Build CFG
+    TimeTraceScope BuildCFGScope("BuildCFG", [MFR]() {
+      return MFR->getMachineInstrRaiser()->getFunctionDescription();
+    });
     MCInstRaiser *MCIR = MFR->getMCInstRaiser();
     // Populates the MachineFunction with CFG.
-    MCIR->buildCFG(MFR->getMachineFunction(), MIA, MII);
+    runSafely(MFR, "building CFG", [&]() {
+      MCIR->buildCFG(MFR->getMachineFunction(), MIA, MII);
+      return true;
+    });
   }
 
   // Construct function prototypes for each of the MachineFunctions.
@@ -204,32 +288,908 @@ bool ModuleRaiser::runMachineFunctionPasses() {
   bool AllPrototypesConstructed;
   const int IterCount = 2;
   for (int Idx = 0; Idx < IterCount; Idx++) {
+    TimeTraceScope PrototypeIterScope("DiscoverPrototypes",
+                                      "iteration " + std::to_string(Idx));
     AllPrototypesConstructed = true;
     for (auto *MFR : MFRaiserVector) {
+      if (hasFailed(MFR))
+        continue;
       LLVM_DEBUG(dbgs() << "Build Prototype for : "
                         << MFR->getMachineFunction().getName().data() << "\n");
       Function *RF = MFR->getRaisedFunction();
       if (RF == nullptr) {
-        FunctionType *FT =
-            MFR->getMachineInstrRaiser()->getRaisedFunctionPrototype();
+        TimeTraceScope PrototypeScope("DiscoverPrototype", [MFR]() {
+          return MFR->getMachineInstrRaiser()->getFunctionDescription();
+        });
+        FunctionType *FT = nullptr;
+        // A prototype may not be discovered until those of the functions
+        // called are, so no prototype is not a failure.
+        runSafely(MFR, "discovering prototype", [&]() {
+          FT = reuseRecordedPrototype(MFR);
+          if (FT != nullptr)
+            return true;
+          FT = MFR->getMachineInstrRaiser()->getRaisedFunctionPrototype();
+          if ((FT != nullptr) && (AnalysisDB != nullptr)) {
+            std::string Prototype;
+            raw_string_ostream(Prototype) << *FT;
+            AnalysisDB->recordPrototype(getAnalysisKey(MFR), Prototype);
+          }
+          return true;
+        });
         AllPrototypesConstructed |= (FT != nullptr);
       }
     }
     LLVM_DEBUG(dbgs() << "Raised Function Prototypes: \n");
     LLVM_DEBUG({
       for (auto MFR : MFRaiserVector) {
-        MFR->getRaisedFunction()->dump();
+        if (MFR->getRaisedFunction() != nullptr)
+          MFR->getRaisedFunction()->dump();
       }
     });
   }
   assert(AllPrototypesConstructed && "Failed to construct all prototypes");
+  // Save the prototypes before raising, so that a run interrupted while
+  // raising need not discover them again.
+  if (AnalysisDB != nullptr)
+    if (Error E = AnalysisDB->save())
+      WithColor::warning(errs(), ToolName) << toString(std::move(E)) << "\n";
+  raiseUsersOfChangedPrototypes();
   // Run instruction raiser passes.
-  for (auto *MFR : MFRaiserVector)
-    Success |= MFR->runRaiserPasses();
+  for (auto *MFR : MFRaiserVector) {
+    TimeTraceScope RaiseScope("RaiseFunction", [MFR]() {
+      return MFR->getMachineInstrRaiser()->getFunctionDescription();
+    });
+    if (hasFailed(MFR) || isUnchanged(MFR))
+      continue;
+    Success |= runSafely(MFR, "raising",
+                         [MFR]() { return MFR->runRaiserPasses(); });
+  }
+
+  applyFallbacks();
+  createFoldedFunctionAliases();
+  copyUnchangedFunctions();
+  finalizeDebugAddresses();
 
   return Success;
 }
 
+void ModuleRaiser::setFallback(FallbackKind Kind, unsigned TimeBudgetSecs,
+                               unsigned MemoryBudgetMB) {
+  Fallback = Kind;
+  TimeBudget = TimeBudgetSecs;
+  MemoryBudget = MemoryBudgetMB;
+  // Install the signal handlers that recover from crashes (e.g., failed
+  // assertions) while raising a function.
+  if (Fallback != FallbackKind::Abort)
+    CrashRecoveryContext::Enable();
+}
+
+void ModuleRaiser::checkFunctionBudget() const {
+  if (Fallback == FallbackKind::Abort)
+    return;
+
+  if (TimeBudget != 0) {
+    auto Elapsed = std::chrono::steady_clock::now() - BudgetStartTime;
+    if (Elapsed > std::chrono::seconds(TimeBudget))
+      BudgetExceeded = "time budget of " + std::to_string(TimeBudget) +
+                       " second(s) exceeded";
+  }
+  if (MemoryBudget != 0) {
+    size_t Usage = sys::Process::GetMallocUsage();
+    if ((Usage > BudgetStartMemory) &&
+        ((Usage - BudgetStartMemory) >> 20) > MemoryBudget)
+      BudgetExceeded =
+          "memory budget of " + std::to_string(MemoryBudget) + " MB exceeded";
+  }
+  // Exiting is recovered from by the CrashRecoveryContext that runs the
+  // raising of the function.
+  if (!BudgetExceeded.empty())
+    sys::Process::Exit(1);
+}
+
+bool ModuleRaiser::hasFailed(const MachineFunctionRaiser *MFR) const {
+  return llvm::any_of(FailedFunctions, [MFR](const FailedFunction &FF) {
+    return FF.MFR == MFR;
+  });
+}
+
+// Run Fn, which performs Stage of raising the function of MFR, and return
+// its result. Unless failures abort, Fn returning false or crashing or
+// exiting (e.g., due to an unhandled instruction or an exceeded budget) marks
+// the function failed.
+bool ModuleRaiser::runSafely(MachineFunctionRaiser *MFR, StringRef Stage,
+                             function_ref<bool()> Fn) {
+  if (Fallback == FallbackKind::Abort)
+    return Fn();
+  if (hasFailed(MFR))
+    return false;
+
+  BudgetStartTime = std::chrono::steady_clock::now();
+  BudgetStartMemory = sys::Process::GetMallocUsage();
+  BudgetExceeded.clear();
+  bool Result = false;
+  CrashRecoveryContext CRC;
+  if (CRC.RunSafely([&]() { Result = Fn(); }) && Result)
+    return true;
+
+  std::string Reason = "failed while " + Stage.str();
+  if (!BudgetExceeded.empty())
+    Reason = BudgetExceeded + " while " + Stage.str();
+  FailedFunctions.push_back({MFR, Reason});
+  return false;
+}
+
+// Replace the functions that failed to raise by a declaration or by a stub
+// that traps, and report them.
+void ModuleRaiser::applyFallbacks() {
+  if (FailedFunctions.empty())
+    return;
+
+  errs() << "***** WARNING: The following function(s) failed to raise and are "
+         << ((Fallback == FallbackKind::Trap) ? "emitted as trapping stubs"
+                                              : "declared external")
+         << " :\n";
+  for (const FailedFunction &FF : FailedFunctions) {
+    // The placeholder function stands in for functions that failed before
+    // their prototype was discovered.
+    Function *F = FF.MFR->getRaisedFunction();
+    if (F == nullptr)
+      F = &FF.MFR->getMachineFunction().getFunction();
+    errs() << F->getName() << " : " << FF.Reason << "\n";
+
+    F->deleteBody();
+    if (Fallback == FallbackKind::Trap) {
+      BasicBlock *BB = BasicBlock::Create(M->getContext(), "entry", F);
+      CallInst::Create(Intrinsic::getDeclaration(M, Intrinsic::trap), "", BB);
+      new UnreachableInst(M->getContext(), BB);
+    }
+  }
+}
+
+// Line numbers of locations hold the lower 32 bits of addresses. Any higher
+// bits are held in column numbers.
+static unsigned getAddressLine(uint64_t Address) {
+  return Address & 0xffffffff;
+}
+
+static unsigned getAddressColumn(uint64_t Address) {
+  return (Address >> 32) & 0xffff;
+}
+
+DISubprogram *ModuleRaiser::createAddressSubprogram(StringRef Name,
+                                                    uint64_t Address) {
+  if (DIB == nullptr) {
+    DIB = std::make_unique<DIBuilder>(*M);
+    StringRef FileName = Obj->getFileName();
+    DebugFile = DIB->createFile(sys::path::filename(FileName),
+                                sys::path::parent_path(FileName));
+    DIB->createCompileUnit(dwarf::DW_LANG_C, DebugFile, "llvm-mctoll",
+                           /*isOptimized=*/true, "", 0, "",
+                           DICompileUnit::LineTablesOnly);
+  }
+  DISubroutineType *Ty =
+      DIB->createSubroutineType(DIB->getOrCreateTypeArray(None));
+  unsigned Line = getAddressLine(Address);
+  return DIB->createFunction(DebugFile, Name, "", DebugFile, Line, Ty, Line,
+                             DINode::FlagZero,
+                             DISubprogram::SPFlagDefinition |
+                                 DISubprogram::SPFlagOptimized);
+}
+
+DILocation *ModuleRaiser::getAddressLocation(DISubprogram *SP,
+                                             uint64_t Address) {
+  return DILocation::get(SP->getContext(), getAddressLine(Address),
+                         getAddressColumn(Address), SP);
+}
+
+void ModuleRaiser::finalizeDebugAddresses() {
+  if (DIB == nullptr)
+    return;
+  DIB->finalize();
+  M->addModuleFlag(Module::Warning, "Dwarf Version", dwarf::DWARF_VERSION);
+  M->addModuleFlag(Module::Warning, "Debug Info Version",
+                   DEBUG_METADATA_VERSION);
+}
+
+// Build the key of the prototype of the function of MFR from the code of the
+// function and of all functions it calls, directly or transitively, since its
+// prototype is discovered from the prototypes of the functions it calls.
+std::string ModuleRaiser::getAnalysisKey(MachineFunctionRaiser *MFR) const {
+  auto Cached = AnalysisKeys.find(MFR);
+  if (Cached != AnalysisKeys.end())
+    return Cached->second;
+
+  std::vector<std::string> CalleeKeys;
+  SmallPtrSet<MachineFunctionRaiser *, 16> Visited;
+  Visited.insert(MFR);
+  std::vector<MachineFunctionRaiser *> Worklist = {MFR};
+  while (!Worklist.empty()) {
+    MachineFunctionRaiser *Caller = Worklist.back();
+    Worklist.pop_back();
+    for (MachineFunctionRaiser *Callee : getDirectCallees(Caller))
+      if (Visited.insert(Callee).second) {
+        CalleeKeys.push_back(getCodeKey(Callee));
+        Worklist.push_back(Callee);
+      }
+  }
+  llvm::sort(CalleeKeys);
+
+  std::string Callees;
+  raw_string_ostream CalleesStream(Callees);
+  for (const std::string &CalleeKey : CalleeKeys)
+    CalleesStream << CalleeKey << ";";
+  std::string Key = AnalysisDB->getKey(
+      arrayRefFromStringRef(CalleesStream.str()), getCodeKey(MFR));
+  AnalysisKeys[MFR] = Key;
+  return Key;
+}
+
+std::vector<MachineFunctionRaiser *>
+ModuleRaiser::getDirectCallees(MachineFunctionRaiser *MFR) const {
+  std::vector<MachineFunctionRaiser *> Callees;
+  if (MIA == nullptr)
+    return Callees;
+  // Find the function at Offset in the section with index SecIdx or, if
+  // SecIdx is -1, at address Offset.
+  auto FindCallee = [this](int64_t SecIdx,
+                           uint64_t Offset) -> MachineFunctionRaiser * {
+    for (auto *CalleeMFR : MFRaiserVector) {
+      const MCInstRaiser *CalleeMCIR = CalleeMFR->getMCInstRaiser();
+      uint64_t CalleeStart = CalleeMCIR->getFuncStart();
+      if (SecIdx == -1)
+        CalleeStart += CalleeMCIR->getTextSectionAddress();
+      else if (CalleeMCIR->getTextSectionIndex() != SecIdx)
+        continue;
+      if (CalleeStart == Offset)
+        return CalleeMFR;
+    }
+    for (const FoldedFunction &FF : FoldedFunctions)
+      if ((SecIdx == -1) ? ((FF.SecAddr + FF.Offset) == Offset)
+                         : ((FF.SecIdx == SecIdx) && (FF.Offset == Offset)))
+        return FF.Canonical;
+    return nullptr;
+  };
+
+  const MCInstRaiser *MCIR = MFR->getMCInstRaiser();
+  const int64_t SecIdx = MCIR->getTextSectionIndex();
+  const uint64_t SecAddr = MCIR->getTextSectionAddress();
+  for (auto Iter = MCIR->const_mcinstr_begin(),
+            End = MCIR->const_mcinstr_end();
+       Iter != End; ++Iter) {
+    if (Iter->second.isData() || !MIA->isCall(Iter->second.getMCInst()))
+      continue;
+    const uint64_t Offset = Iter->first;
+    const uint64_t Size = MCIR->getMCInstSize(Offset);
+    MachineFunctionRaiser *Callee = nullptr;
+    if (Obj->isRelocatableObject()) {
+      // The callee is given by the symbol of the relocation of the call.
+      const RelocationRef *Reloc = getTextRelocAtOffset(Offset, Size, SecIdx);
+      if (Reloc == nullptr)
+        continue;
+      symbol_iterator Sym = Reloc->getSymbol();
+      if (Sym == Obj->symbol_end())
+        continue;
+      Expected<section_iterator> SymSec = Sym->getSection();
+      Expected<uint64_t> SymValue = Sym->getValue();
+      if (!SymSec || !SymValue) {
+        consumeError(SymSec.takeError());
+        consumeError(SymValue.takeError());
+        continue;
+      }
+      if (*SymSec != Obj->section_end())
+        Callee = FindCallee((*SymSec)->getIndex(), *SymValue);
+    } else {
+      uint64_t Target;
+      if (MIA->evaluateBranch(Iter->second.getMCInst(), SecAddr + Offset, Size,
+                              Target))
+        Callee = FindCallee(-1, Target);
+    }
+    if ((Callee != nullptr) && (Callee != MFR))
+      Callees.push_back(Callee);
+  }
+  return Callees;
+}
+
+// Build the hash of the code of the function of MFR from the bytes of the
+// function. Since references to other functions are resolved by the raiser,
+// the name and address of the function and the relocations applied to its
+// code are part of the hash.
+std::string ModuleRaiser::getCodeKey(MachineFunctionRaiser *MFR) const {
+  const MCInstRaiser *MCIR = MFR->getMCInstRaiser();
+  const int64_t SecIdx = MCIR->getTextSectionIndex();
+  const uint64_t FuncStart = MCIR->getFuncStart();
+  const uint64_t FuncEnd = MCIR->getFuncEnd();
+
+  ArrayRef<uint8_t> Bytes;
+  for (const SectionRef &Sec : Obj->sections()) {
+    if (static_cast<int64_t>(Sec.getIndex()) != SecIdx)
+      continue;
+    Expected<StringRef> ContentsOrErr = Sec.getContents();
+    if (!ContentsOrErr) {
+      consumeError(ContentsOrErr.takeError());
+      break;
+    }
+    Bytes = arrayRefFromStringRef(ContentsOrErr->slice(FuncStart, FuncEnd));
+    break;
+  }
+
+  std::string Context;
+  raw_string_ostream ContextStream(Context);
+  ContextStream << MFR->getMachineFunction().getName() << "@" << SecIdx << ":"
+                << (MCIR->getTextSectionAddress() + FuncStart);
+  auto RelocIter = TextRelocs.find(SecIdx);
+  if (RelocIter != TextRelocs.end())
+    for (const RelocationRef &Reloc : RelocIter->second) {
+      const uint64_t Offset = Reloc.getOffset();
+      if ((Offset < FuncStart) || (Offset >= FuncEnd))
+        continue;
+      ContextStream << ";R" << Reloc.getType() << "@" << (Offset - FuncStart);
+      symbol_iterator Sym = Reloc.getSymbol();
+      if (Sym != Obj->symbol_end()) {
+        Expected<StringRef> NameOrErr = Sym->getName();
+        if (NameOrErr)
+          ContextStream << *NameOrErr;
+        else
+          consumeError(NameOrErr.takeError());
+      }
+      if (Obj->isELF()) {
+        Expected<int64_t> AddendOrErr = ELFRelocationRef(Reloc).getAddend();
+        if (AddendOrErr)
+          ContextStream << "+" << *AddendOrErr;
+        else
+          consumeError(AddendOrErr.takeError());
+      }
+    }
+  return AnalysisDB->getKey(Bytes, ContextStream.str());
+}
+
+FunctionType *
+ModuleRaiser::reuseRecordedPrototype(MachineFunctionRaiser *MFR) {
+  MachineInstructionRaiser *MIR = MFR->getMachineInstrRaiser();
+  if (isUnchanged(MFR)) {
+    StringRef Name = MFR->getMachineFunction().getName();
+    FunctionType *FT = PrevModule->getFunction(Name)->getFunctionType();
+    if (MIR->setRaisedFunctionPrototype(FT))
+      return FT;
+    // Raise the function if the raiser cannot construct it with the
+    // prototype it had.
+    UnchangedFunctions.erase(Name);
+  }
+
+  if (AnalysisDB == nullptr)
+    return nullptr;
+  StringRef Prototype = AnalysisDB->lookupPrototype(getAnalysisKey(MFR));
+  if (Prototype.empty())
+    return nullptr;
+
+  SMDiagnostic Diag;
+  auto *FT = dyn_cast_or_null<FunctionType>(parseType(Prototype, Diag, *M));
+  if ((FT == nullptr) || !MIR->setRaisedFunctionPrototype(FT))
+    return nullptr;
+  LLVM_DEBUG(dbgs() << "Reused recorded prototype of "
+                    << MFR->getMachineFunction().getName() << "\n");
+  return FT;
+}
+
+void ModuleRaiser::setIncrementalBase(std::unique_ptr<Module> Prev,
+                                      StringSet<> Unchanged) {
+  assert((&Prev->getContext() == &M->getContext()) &&
+         "Module of earlier raise expected in the context of the module");
+  PrevModule = std::move(Prev);
+  UnchangedFunctions = std::move(Unchanged);
+}
+
+bool ModuleRaiser::isUnchanged(MachineFunctionRaiser *MFR) const {
+  return (PrevModule != nullptr) &&
+         UnchangedFunctions.contains(MFR->getMachineFunction().getName());
+}
+
+// The raised code of the functions of PrevModule that use a function whose
+// prototype changed is stale. Such functions are raised again, keeping their
+// prototypes.
+void ModuleRaiser::raiseUsersOfChangedPrototypes() {
+  if (PrevModule == nullptr)
+    return;
+
+  for (auto *MFR : MFRaiserVector) {
+    if (isUnchanged(MFR))
+      continue;
+    Function *RF = MFR->getRaisedFunction();
+    Function *PrevF =
+        PrevModule->getFunction(MFR->getMachineFunction().getName());
+    if ((RF == nullptr) || (PrevF == nullptr) ||
+        (RF->getFunctionType() == PrevF->getFunctionType()))
+      continue;
+
+    SmallVector<const User *, 8> Users(PrevF->users());
+    while (!Users.empty()) {
+      const User *U = Users.pop_back_val();
+      if (const auto *I = dyn_cast<Instruction>(U)) {
+        if (UnchangedFunctions.erase(I->getFunction()->getName()))
+          LLVM_DEBUG(dbgs() << "Raising " << I->getFunction()->getName()
+                            << ", a user of " << PrevF->getName() << "\n");
+      } else {
+        // Uses through constants (e.g., casts or tables of function pointers)
+        Users.append(U->user_begin(), U->user_end());
+      }
+    }
+  }
+}
+
+// Copy the bodies of the unchanged functions from PrevModule. Global values
+// they reference are mapped to those of the same name in M; those M does not
+// have are copied as well.
+std::string ModuleRaiser::getSectionDataName(const SectionRef &Sec) {
+  std::string Name;
+  if (Expected<StringRef> NameOrErr = Sec.getName()) {
+    // Drop the leading '.' from section name
+    Name = NameOrErr->drop_front().str();
+  } else {
+    consumeError(NameOrErr.takeError());
+    Name = "AnonDataSec";
+  }
+  return Name + "_" + std::to_string(Sec.getIndex());
+}
+
+// The global holding the contents of a data section is identified by the
+// address of the section recorded in its metadata and by the section name.
+Optional<SectionRef>
+ModuleRaiser::getSectionOfData(const GlobalVariable &PrevGV) const {
+  MDNode *MD = PrevGV.getMetadata(RODATA_SEC_INFO_MD_STR);
+  if ((MD == nullptr) || (MD->getNumOperands() != 1))
+    return None;
+  auto *SecAddr = mdconst::dyn_extract<ConstantInt>(MD->getOperand(0));
+  if (SecAddr == nullptr)
+    return None;
+  StringRef PrevSecName = PrevGV.getName().rsplit('_').first;
+  for (const SectionRef &Sec : Obj->sections())
+    if ((Sec.getAddress() == SecAddr->getZExtValue()) &&
+        (StringRef(getSectionDataName(Sec)).rsplit('_').first == PrevSecName))
+      return Sec;
+  return None;
+}
+
+void ModuleRaiser::copyUnchangedFunctions() {
+  if (PrevModule == nullptr)
+    return;
+
+  TimeTraceScope CopyScope("CopyUnchangedFunctions");
+  ValueToValueMapTy VMap;
+  auto MapGlobalValue = [&VMap](GlobalValue &PrevGV, GlobalValue *GV) {
+    VMap[&PrevGV] =
+        ConstantExpr::getPointerBitCastOrAddrSpaceCast(GV, PrevGV.getType());
+  };
+
+  // Collect the global values referenced by the functions to copy, directly
+  // or through the initializers of global variables and aliasees of aliases.
+  SetVector<GlobalValue *> Referenced;
+  SmallPtrSet<Constant *, 32> VisitedConstants;
+  SmallVector<Constant *, 32> Worklist;
+  auto AddReference = [&](Value *V) {
+    if (auto *C = dyn_cast<Constant>(V))
+      if (VisitedConstants.insert(C).second)
+        Worklist.push_back(C);
+  };
+  for (auto *MFR : MFRaiserVector) {
+    if (!isUnchanged(MFR) || hasFailed(MFR))
+      continue;
+    Function *PrevF =
+        PrevModule->getFunction(MFR->getRaisedFunction()->getName());
+    if (PrevF->hasPersonalityFn())
+      AddReference(PrevF->getPersonalityFn());
+    for (Instruction &I : instructions(PrevF))
+      for (Value *Op : I.operands())
+        AddReference(Op);
+  }
+  while (!Worklist.empty()) {
+    Constant *C = Worklist.pop_back_val();
+    if (auto *GV = dyn_cast<GlobalValue>(C)) {
+      Referenced.insert(GV);
+      if (auto *GVar = dyn_cast<GlobalVariable>(GV)) {
+        if (GVar->hasInitializer())
+          AddReference(GVar->getInitializer());
+      } else if (auto *GA = dyn_cast<GlobalAlias>(GV)) {
+        AddReference(GA->getAliasee());
+      }
+      continue;
+    }
+    for (Value *Op : C->operands())
+      AddReference(Op);
+  }
+
+  std::vector<std::pair<GlobalVariable *, GlobalVariable *>> CopiedGlobals;
+  for (GlobalValue *PrevGV : Referenced) {
+    if (auto *PrevVar = dyn_cast<GlobalVariable>(PrevGV)) {
+      // The contents of a data section are named after the index of the
+      // section, which may differ between versions of the binary.
+      std::string Name = PrevVar->getName().str();
+      if (Optional<SectionRef> Sec = getSectionOfData(*PrevVar))
+        Name = getSectionDataName(*Sec);
+      GlobalValue *GV = M->getGlobalVariable(Name, true /* AllowInternal */);
+      if (GV == nullptr) {
+        auto *NewGV = new GlobalVariable(
+            *M, PrevVar->getValueType(), PrevVar->isConstant(),
+            PrevVar->getLinkage(), nullptr, Name, nullptr,
+            PrevVar->getThreadLocalMode(), PrevVar->getAddressSpace());
+        NewGV->copyAttributesFrom(PrevVar);
+        NewGV->copyMetadata(PrevVar, 0);
+        if (PrevVar->hasInitializer())
+          CopiedGlobals.emplace_back(PrevVar, NewGV);
+        GV = NewGV;
+      }
+      MapGlobalValue(*PrevVar, GV);
+    } else if (auto *PrevF = dyn_cast<Function>(PrevGV)) {
+      GlobalValue *GV = M->getNamedValue(PrevF->getName());
+      if (GV == nullptr) {
+        Function *F = Function::Create(PrevF->getFunctionType(),
+                                       GlobalValue::ExternalLinkage,
+                                       PrevF->getName(), M);
+        F->copyAttributesFrom(PrevF);
+        GV = F;
+      }
+      MapGlobalValue(*PrevF, GV);
+    }
+  }
+
+  for (GlobalValue *PrevGV : Referenced) {
+    auto *PrevGA = dyn_cast<GlobalAlias>(PrevGV);
+    if (PrevGA == nullptr)
+      continue;
+    GlobalValue *GV = M->getNamedValue(PrevGA->getName());
+    if (GV == nullptr)
+      GV = GlobalAlias::create(PrevGA->getValueType(),
+                               PrevGA->getAddressSpace(), PrevGA->getLinkage(),
+                               PrevGA->getName(),
+                               MapValue(PrevGA->getAliasee(), VMap), M);
+    MapGlobalValue(*PrevGA, GV);
+  }
+
+  for (auto &Copied : CopiedGlobals)
+    Copied.second->setInitializer(
+        MapValue(Copied.first->getInitializer(), VMap));
+
+  unsigned NumCopied = 0;
+  for (auto *MFR : MFRaiserVector) {
+    if (!isUnchanged(MFR) || hasFailed(MFR))
+      continue;
+    Function *F = MFR->getRaisedFunction();
+    Function *PrevF = PrevModule->getFunction(F->getName());
+    assert((F->getFunctionType() == PrevF->getFunctionType()) &&
+           F->isDeclaration() && "Unexpected unchanged function");
+    Function::arg_iterator ArgIt = F->arg_begin();
+    for (Argument &PrevArg : PrevF->args())
+      VMap[&PrevArg] = &*ArgIt++;
+    SmallVector<ReturnInst *, 8> Returns;
+    CloneFunctionInto(F, PrevF, VMap, CloneFunctionChangeType::DifferentModule,
+                      Returns);
+    NumCopied++;
+  }
+  LLVM_DEBUG(dbgs() << "Copied " << NumCopied
+                    << " unchanged function(s) from the earlier module\n");
+}
+
+// Build the folding key of the function of MCIR. Each instruction contributes
+// its opcode, size and operands. Targets of branches and addresses of memory
+// references are recorded as offsets from the function start, if in the
+// function, or as absolute addresses, otherwise. The PC-relative displacement
+// operand they are computed from is omitted, since it differs between
+// functions at different addresses even if the targets are the same.
+std::string ModuleRaiser::getFoldingKey(const MCInstRaiser *MCIR) const {
+  std::string Key;
+  raw_string_ostream KeyStream(Key);
+  const uint64_t SecAddr = MCIR->getTextSectionAddress();
+  const uint64_t FuncStart = SecAddr + MCIR->getFuncStart();
+  const uint64_t FuncEnd = SecAddr + MCIR->getFuncEnd();
+  // Sections of a relocatable object all start at address 0, so addresses
+  // outside the function are qualified by the section index.
+  const std::string SecPrefix =
+      Obj->isRelocatableObject()
+          ? std::to_string(MCIR->getTextSectionIndex()) + ":"
+          : std::string();
+  auto AddressKey = [FuncStart, FuncEnd, &SecPrefix](uint64_t Addr) {
+    if ((Addr >= FuncStart) && (Addr < FuncEnd))
+      return "L" + std::to_string(Addr - FuncStart);
+    return "A" + SecPrefix + std::to_string(Addr);
+  };
+
+  for (auto Iter = MCIR->const_mcinstr_begin(),
+            End = MCIR->const_mcinstr_end();
+       Iter != End; ++Iter) {
+    const uint64_t Offset = Iter->first;
+    if (Iter->second.isData()) {
+      KeyStream << "D" << Iter->second.getData() << ";";
+      continue;
+    }
+
+    const MCInst Inst = Iter->second.getMCInst();
+    const uint64_t Size = MCIR->getMCInstSize(Offset);
+    const uint64_t Addr = SecAddr + Offset;
+    KeyStream << Inst.getOpcode() << "/" << Size;
+
+    Optional<int64_t> Displacement;
+    uint64_t Target;
+    if ((MIA->isBranch(Inst) || MIA->isCall(Inst)) &&
+        MIA->evaluateBranch(Inst, Addr, Size, Target)) {
+      KeyStream << AddressKey(Target);
+      Displacement = Target - (Addr + Size);
+    } else if (Optional<uint64_t> MemAddr =
+                   MIA->evaluateMemoryOperandAddress(Inst, nullptr, Addr,
+                                                     Size)) {
+      KeyStream << "M" << AddressKey(*MemAddr);
+      Displacement = *MemAddr - (Addr + Size);
+    }
+
+    for (const MCOperand &Op : Inst) {
+      if (Op.isReg()) {
+        KeyStream << " r" << Op.getReg();
+      } else if (Op.isImm()) {
+        if (Displacement && (*Displacement == Op.getImm())) {
+          Displacement = None;
+          continue;
+        }
+        KeyStream << " i" << Op.getImm();
+      } else {
+        // Operands such as expressions are not compared.
+        return std::string();
+      }
+    }
+
+    // In a relocatable object, the targets of references are given by the
+    // relocations of the instruction.
+    if (const RelocationRef *Reloc = getTextRelocAtOffset(
+            Offset, Size, MCIR->getTextSectionIndex())) {
+      KeyStream << " R" << Reloc->getType() << "@"
+                << (Reloc->getOffset() - Offset);
+      symbol_iterator Sym = Reloc->getSymbol();
+      if (Sym != Obj->symbol_end()) {
+        Expected<StringRef> NameOrErr = Sym->getName();
+        if (!NameOrErr) {
+          consumeError(NameOrErr.takeError());
+          return std::string();
+        }
+        KeyStream << *NameOrErr;
+      }
+      if (Obj->isELF()) {
+        Expected<int64_t> AddendOrErr = ELFRelocationRef(*Reloc).getAddend();
+        if (!AddendOrErr) {
+          consumeError(AddendOrErr.takeError());
+          return std::string();
+        }
+        KeyStream << "+" << *AddendOrErr;
+      }
+    }
+    KeyStream << ";";
+  }
+  return KeyStream.str();
+}
+
+unsigned ModuleRaiser::foldIdenticalFunctions() {
+  if ((MIA == nullptr) || (Obj == nullptr))
+    return 0;
+
+  TimeTraceScope FoldScope("FoldIdenticalFunctions");
+  // Functions are mapped by the SHA1 hash of their folding key, rather than
+  // by the key, which grows with the size of the function. Keys are compared
+  // only when their hashes are equal.
+  std::map<std::string, MachineFunctionRaiser *> CanonicalFunctions;
+  std::vector<MachineFunctionRaiser *> UnfoldedMFRaisers;
+  for (auto *MFR : MFRaiserVector) {
+    MCInstRaiser *MCIR = MFR->getMCInstRaiser();
+    std::string Key;
+    if (!MCIR->hasDataInCode())
+      Key = getFoldingKey(MCIR);
+    if (Key.empty()) {
+      UnfoldedMFRaisers.push_back(MFR);
+      continue;
+    }
+
+    SHA1 Hasher;
+    Hasher.update(Key);
+    auto Inserted =
+        CanonicalFunctions.insert(std::make_pair(Hasher.final().str(), MFR));
+    if (Inserted.second ||
+        (getFoldingKey(Inserted.first->second->getMCInstRaiser()) != Key)) {
+      UnfoldedMFRaisers.push_back(MFR);
+      continue;
+    }
+
+    // Erase the placeholder function of the folded function to make its name
+    // available to the alias defined for it. The folded function is not
+    // raised, so its raisers and machine function are freed as well.
+    Function &Placeholder = MFR->getMachineFunction().getFunction();
+    MachineFunctionRaiser *Canonical = Inserted.first->second;
+    LLVM_DEBUG(dbgs() << "Folding " << Placeholder.getName() << " into "
+                      << Canonical->getMachineFunction().getName() << "\n");
+    FoldedFunctions.push_back({Canonical, Placeholder.getName().str(),
+                               MCIR->getTextSectionIndex(),
+                               MCIR->getTextSectionAddress(),
+                               MCIR->getFuncStart()});
+    delete MFR->getMachineInstrRaiser();
+    delete MFR;
+    MMI->deleteMachineFunctionFor(Placeholder);
+    Placeholder.eraseFromParent();
+  }
+  MFRaiserVector = std::move(UnfoldedMFRaisers);
+  return FoldedFunctions.size();
+}
+
+void ModuleRaiser::createFoldedFunctionAliases() {
+  if (FoldedFunctions.empty())
+    return;
+
+  // Function symbols of the binary, by section index and address
+  std::map<std::pair<int64_t, uint64_t>, std::vector<ELFSymbolRef>>
+      FunctionSymbols;
+  const auto *ELFObj = dyn_cast<ELFObjectFileBase>(Obj);
+  if (ELFObj != nullptr)
+    for (const ELFSymbolRef &Sym : ELFObj->symbols()) {
+      if (Sym.getELFType() != ELF::STT_FUNC)
+        continue;
+      Expected<uint64_t> SymAddr = Sym.getAddress();
+      Expected<section_iterator> SymSec = Sym.getSection();
+      if (!SymAddr || !SymSec) {
+        consumeError(SymAddr.takeError());
+        consumeError(SymSec.takeError());
+        continue;
+      }
+      if (*SymSec == Obj->section_end())
+        continue;
+      FunctionSymbols[{(*SymSec)->getIndex(), *SymAddr}].push_back(Sym);
+    }
+
+  for (const FoldedFunction &FF : FoldedFunctions) {
+    Function *Aliasee = FF.Canonical->getRaisedFunction();
+    if (Aliasee == nullptr)
+      continue;
+    GlobalAlias *Alias = GlobalAlias::create(
+        Aliasee->getValueType(), Aliasee->getAddressSpace(),
+        GlobalValue::ExternalLinkage, FF.Name, Aliasee, M);
+    auto SymsIter = FunctionSymbols.find({FF.SecIdx, FF.SecAddr + FF.Offset});
+    if (SymsIter == FunctionSymbols.end())
+      continue;
+
+    // The alias has the binding and visibility of the symbol of the folded
+    // function, so that local functions do not become visible outside of
+    // the module.
+    for (const ELFSymbolRef &Sym : SymsIter->second) {
+      Expected<StringRef> SymName = Sym.getName();
+      if (!SymName) {
+        consumeError(SymName.takeError());
+        continue;
+      }
+      if (*SymName != FF.Name)
+        continue;
+
+      switch (Sym.getBinding()) {
+      case ELF::STB_LOCAL:
+        Alias->setLinkage(GlobalValue::InternalLinkage);
+        break;
+      case ELF::STB_WEAK:
+        Alias->setLinkage(GlobalValue::WeakAnyLinkage);
+        break;
+      default:
+        break;
+      }
+      if (!Alias->hasLocalLinkage()) {
+        switch (Sym.getOther() & 0x3) {
+        case ELF::STV_HIDDEN:
+        case ELF::STV_INTERNAL:
+          Alias->setVisibility(GlobalValue::HiddenVisibility);
+          break;
+        case ELF::STV_PROTECTED:
+          Alias->setVisibility(GlobalValue::ProtectedVisibility);
+          break;
+        default:
+          break;
+        }
+      }
+      break;
+    }
+  }
+}
+
+// The estimated cost of raising a function is given in units of the time
+// taken to raise an instruction. In addition to raising each instruction,
+// reaching definitions of registers are looked up across the predecessor
+// blocks of each block, which dominates the cost of functions with many
+// blocks.
+static uint64_t getEstimatedRaiseCost(uint64_t NumInsts, uint64_t NumBlocks) {
+  return NumInsts + NumBlocks * NumBlocks;
+}
+
+void ModuleRaiser::printCensus(raw_ostream &OS) const {
+  uint64_t TotalInsts = 0;
+  uint64_t TotalCost = 0;
+  unsigned NumUnsupportedFuncs = 0;
+  std::map<std::string, uint64_t> TotalUnsupported;
+
+  OS << left_justify("Function", 32) << right_justify("Insts", 9)
+     << right_justify("Blocks", 8) << right_justify("IndBr", 7)
+     << right_justify("IndCall", 8) << right_justify("Cost", 11)
+     << "  Unsupported\n";
+  for (auto *MFR : MFRaiserVector) {
+    MCInstRaiser *MCIR = MFR->getMCInstRaiser();
+    const uint64_t SecAddr = MCIR->getTextSectionAddress();
+    uint64_t NumInsts = 0;
+    uint64_t NumIndirectBranches = 0;
+    uint64_t NumIndirectCalls = 0;
+    bool SupportUnknown = false;
+    std::map<std::string, uint64_t> Unsupported;
+
+    for (auto Iter = MCIR->const_mcinstr_begin(),
+              End = MCIR->const_mcinstr_end();
+         Iter != End; ++Iter) {
+      if (!Iter->second.isMCInst())
+        continue;
+      const MCInst Inst = Iter->second.getMCInst();
+      NumInsts++;
+
+      const MCInstrDesc &Desc = MII->get(Inst.getOpcode());
+      if (Desc.isIndirectBranch()) {
+        NumIndirectBranches++;
+      } else if (Desc.isCall()) {
+        uint64_t Target;
+        uint64_t Addr = SecAddr + Iter->first;
+        if (!MIA->evaluateBranch(Inst, Addr, MCIR->getMCInstSize(Iter->first),
+                                 Target))
+          NumIndirectCalls++;
+      }
+
+      switch (classifyInstruction(Inst)) {
+      case InstrSupport::Supported:
+        break;
+      case InstrSupport::Unsupported:
+        Unsupported[MII->getName(Inst.getOpcode()).str()]++;
+        break;
+      case InstrSupport::Unknown:
+        SupportUnknown = true;
+        break;
+      }
+    }
+
+    // Block starts are the function start and the branch targets and
+    // fall-through successors of branches in the function.
+    uint64_t NumBlocks = 0;
+    for (uint64_t TargetIdx : MCIR->getTargetIndices())
+      if (TargetIdx < MCIR->getFuncEnd())
+        NumBlocks++;
+    NumBlocks = std::max<uint64_t>(NumBlocks, 1);
+    const uint64_t Cost = getEstimatedRaiseCost(NumInsts, NumBlocks);
+
+    std::string UnsupportedList;
+    raw_string_ostream UnsupportedStream(UnsupportedList);
+    if (SupportUnknown)
+      UnsupportedStream << "?";
+    for (const auto &Opc : Unsupported) {
+      UnsupportedStream << (UnsupportedList.empty() ? "" : " ") << Opc.first
+                        << "(" << Opc.second << ")";
+      TotalUnsupported[Opc.first] += Opc.second;
+    }
+    if (!Unsupported.empty())
+      NumUnsupportedFuncs++;
+
+    OS << left_justify(MFR->getMachineFunction().getName(), 32)
+       << format_decimal(NumInsts, 9) << format_decimal(NumBlocks, 8)
+       << format_decimal(NumIndirectBranches, 7)
+       << format_decimal(NumIndirectCalls, 8) << format_decimal(Cost, 11)
+       << "  " << UnsupportedStream.str() << "\n";
+    TotalInsts += NumInsts;
+    TotalCost += Cost;
+  }
+
+  OS << "\n"
+     << MFRaiserVector.size() << " function(s), " << TotalInsts
+     << " instruction(s), estimated cost " << TotalCost << "\n";
+  if (TotalUnsupported.empty()) {
+    OS << "No unsupported opcodes found\n";
+    return;
+  }
+  OS << NumUnsupportedFuncs
+     << " function(s) with unsupported opcodes; unsupported opcodes:\n";
+  for (const auto &Opc : TotalUnsupported)
+    OS << "  " << Opc.first << " " << Opc.second << "\n";
+}
+
 // Get the MachineFunction associated with the placeholder
 // function corresponding to raised function.
 MachineFunction *ModuleRaiser::getMachineFunction(Function *RF) {
@@ -240,10 +1200,11 @@ MachineFunction *ModuleRaiser::getMachineFunction(Function *RF) {
 }
 
 bool ModuleRaiser::collectTextSectionRelocs(const SectionRef &TextSec) {
-  // Assuming only one .text section in the binary
-  assert(TextSectionIndex == -1 &&
-         "Relocations for .text section already collected");
   TextSectionIndex = TextSec.getIndex();
+  TextSectionAddress = TextSec.getAddress();
+  assert(TextRelocs.find(TextSectionIndex) == TextRelocs.end() &&
+         "Relocations for text section already collected");
+  std::vector<RelocationRef> &SecRelocs = TextRelocs[TextSectionIndex];
   // Find the section whose relocated section index is TextSecIndex.
   // That section is the one with relocations corresponding to the
   // section with index TextSecIndex.
@@ -260,10 +1221,10 @@ bool ModuleRaiser::collectTextSectionRelocs(const SectionRef &TextSec) {
       // is the section with relocation information for TextSec.
       if (RelocatedSecIter->getIndex() == (uint64_t)TextSectionIndex) {
         for (const RelocationRef &Reloc : CandRelocSection.relocations())
-          TextRelocs.push_back(Reloc);
+          SecRelocs.push_back(Reloc);
 
         // Sort the relocations
-        std::sort(TextRelocs.begin(), TextRelocs.end(),
+        std::sort(SecRelocs.begin(), SecRelocs.end(),
                   [](const RelocationRef &A, const RelocationRef &B) -> bool {
                     return A.getOffset() < B.getOffset();
                   });
@@ -274,17 +1235,25 @@ bool ModuleRaiser::collectTextSectionRelocs(const SectionRef &TextSec) {
   return true;
 }
 
-// Return text section address; or -1 if text section is not found
+// Return address of text section being decoded; or -1 if text section is not
+// found
 int64_t ModuleRaiser::getTextSectionAddress() const {
-  if (!Obj->isELF())
+  // No object file is associated with a module raiser driven on synthetic
+  // input (e.g., by benchmarks).
+  if ((Obj == nullptr) || !Obj->isELF())
     return -1;
 
   assert(TextSectionIndex >= 0 && "Unexpected negative index of text section");
-  for (SectionRef Sec : Obj->sections())
-    if (Sec.getIndex() == (unsigned)TextSectionIndex)
-      return Sec.getAddress();
+  return TextSectionAddress;
+}
+
+// Return address of text section containing MF; or -1 if MF is not found
+int64_t ModuleRaiser::getTextSectionAddress(const MachineFunction &MF) const {
+  for (auto *MFR : MFRaiserVector)
+    if (&MFR->getMachineFunction() == &MF)
+      return MFR->getMCInstRaiser()->getTextSectionAddress();
 
-  llvm_unreachable("Failed to locate text section.");
+  return -1;
 }
 
 // Change return type of TargetFunc and update the change in module and
@@ -381,7 +1350,8 @@ bool ModuleRaiser::changeRaisedFunctionReturnType(Function *TargetFunc,
               Value *NewRetVal = (NewRetTy->isVoidTy()) ? nullptr : TgtFuncCall;
               // If NewRetTy is void, NewRetVal is void else it is OrigCall
               // create and insert a new return instruction returning NewRetVal
-              ReturnInst::Create(Ctx, NewRetVal, RI);
+              ReturnInst::Create(Ctx, NewRetVal, RI)
+                  ->setDebugLoc(RI->getDebugLoc());
               // delete original ret instruction.
               RI->eraseFromParent();
               // No further search for blocks with return needed since the pass
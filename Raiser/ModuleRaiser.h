@@ -15,13 +15,17 @@
 #define LLVM_TOOLS_LLVM_MCTOLL_MODULERAISER_H
 
 #include "FunctionFilter.h"
+#include "llvm/ADT/StringSet.h"
 #include "llvm/CodeGen/MachineBasicBlock.h"
 #include "llvm/CodeGen/MachineModuleInfo.h"
+#include "llvm/IR/DIBuilder.h"
 #include "llvm/MC/MCDisassembler/MCDisassembler.h"
 #include "llvm/MC/MCInstrAnalysis.h"
 #include "llvm/Object/Archive.h"
 #include "llvm/Object/ObjectFile.h"
 #include "llvm/Target/TargetMachine.h"
+#include <chrono>
+#include <map>
 #include <vector>
 
 using namespace llvm;
@@ -31,8 +35,11 @@ using namespace object;
 namespace llvm {
 namespace mctoll {
 
+class AnalysisDatabase;
+class BranchProfile;
 class MachineFunctionRaiser;
 class MachineInstructionRaiser;
+class MCInstRaiser;
 
 using JumpTableBlock = std::pair<ConstantInt *, MachineBasicBlock *>;
 
@@ -55,6 +62,7 @@ public:
       : M(nullptr), TM(nullptr), MMI(nullptr), MIA(nullptr), MII(nullptr),
         MRI(nullptr), MIP(nullptr),
         Obj(nullptr), DisAsm(nullptr), TextSectionIndex(-1),
+        TextSectionAddress(-1),
         Arch(Triple::ArchType::UnknownArch), FFT(nullptr), InfoSet(false) {}
 
   void setModuleRaiserInfo(Module *NewM, const TargetMachine *NewTM,
@@ -100,6 +108,9 @@ public:
     return V.second;
   }
 
+  /// Collect relocations of the text section and make it the section whose
+  /// instructions are being decoded. MachineFunctionRaisers created
+  /// subsequently belong to this section.
   bool collectTextSectionRelocs(const SectionRef &);
   virtual bool collectDynamicRelocations() = 0;
 
@@ -119,23 +130,130 @@ public:
 
   bool runMachineFunctionPasses();
 
+  /// Fold each function whose code is identical to that of a function decoded
+  /// before it into the earlier (canonical) function. Code is compared with
+  /// PC-relative references resolved to their targets and, in relocatable
+  /// objects, with the relocations applied to it. Folded functions are not
+  /// raised and their placeholder functions are erased. References to them
+  /// resolve to the canonical function and they are defined as aliases of the
+  /// canonical function. Return the number of functions folded.
+  unsigned foldIdenticalFunctions();
+
+  /// Handling of a failure to raise a function
+  enum class FallbackKind {
+    /// Abort raising the module
+    Abort,
+    /// Define the function as a stub that traps
+    Trap,
+    /// Declare the function external
+    Declare
+  };
+
+  /// Set the handling of failures to raise a function, and the time (in
+  /// seconds) and memory (in MB) budgets for raising each function. A budget
+  /// of 0 is unlimited. Exceeding a budget is a failure. Budgets are only
+  /// checked if failures do not abort.
+  void setFallback(FallbackKind Kind, unsigned TimeBudgetSecs,
+                   unsigned MemoryBudgetMB);
+
+  /// Fail raising the current function if it exceeded its time or memory
+  /// budget. Called periodically by instruction raisers.
+  void checkFunctionBudget() const;
+
+  /// Allocate the stack slots of raised functions whose address is not taken
+  /// separately, rather than as part of a single frame with the layout of
+  /// the stack frame in the binary.
+  void setSplitStackFrame(bool Split) { SplitStackFrame = Split; }
+  bool splitStackFrame() const { return SplitStackFrame; }
+
+  /// Emit debug information that maps raised instructions to the addresses
+  /// of the instructions of the binary they are raised from. Each raised
+  /// function has a subprogram, and each raised instruction has a location in
+  /// a file named after the binary, with the address as the line number.
+  void setDebugAddresses(bool Emit) { DebugAddresses = Emit; }
+  bool debugAddresses() const { return DebugAddresses; }
+  /// Create the subprogram of the raised function Name at Address.
+  DISubprogram *createAddressSubprogram(StringRef Name, uint64_t Address);
+  /// Return the location of the instruction at Address in function SP.
+  static DILocation *getAddressLocation(DISubprogram *SP, uint64_t Address);
+
+  /// Annotate the raised branches with the execution counts sampled in
+  /// Profile, instead of probabilities inferred from static heuristics.
+  void setBranchProfile(const BranchProfile *Profile) {
+    BranchProf = Profile;
+  }
+  const BranchProfile *getBranchProfile() const { return BranchProf; }
+
+  /// Reuse the function prototypes recorded in DB and record the prototypes
+  /// discovered in it. DB is saved once all prototypes are discovered.
+  void setAnalysisDatabase(AnalysisDatabase *DB) { AnalysisDB = DB; }
+
+  /// Raise incrementally with respect to PrevModule, raised from an earlier
+  /// version of the binary. Functions named in Unchanged have the same code
+  /// in both versions. They keep their prototypes and are not raised; their
+  /// bodies in PrevModule are copied instead. Functions of PrevModule that use
+  /// a function whose prototype changed are raised all the same.
+  void setIncrementalBase(std::unique_ptr<Module> PrevModule,
+                          StringSet<> Unchanged);
+
+  /// Support of an instruction by the instruction raiser of the target
+  enum class InstrSupport { Supported, Unsupported, Unknown };
+
+  /// Return whether the instruction raiser of the target raises Inst.
+  /// Targets that do not classify instructions return Unknown.
+  virtual InstrSupport classifyInstruction(const MCInst &Inst) const {
+    return InstrSupport::Unknown;
+  }
+
+  /// Print a census of the decoded functions to OS, without raising them.
+  /// For each function, the census reports the number of instructions and
+  /// basic blocks, indirect branches and calls, opcodes the instruction
+  /// raiser does not handle and an estimate of the cost of raising it.
+  void printCensus(raw_ostream &OS) const;
+
+  /// Record that the function Name at offset Offset of the text section being
+  /// decoded is not raised (e.g., since it is not reachable from the roots).
+  /// References to it are reported, since nothing would define a declaration
+  /// of it.
+  void addUnraisedFunction(StringRef Name, uint64_t Offset);
+
   /// Return the Function * corresponding to input binary function with
   /// start offset equal to that specified as argument. This returns the pointer
   /// to raised function, if one was constructed; else returns nullptr.
   Function *getRaisedFunctionAt(uint64_t) const;
 
+  /// Return the Function * corresponding to input binary function with
+  /// start offset 'Offset' in text section with index 'SecIdx'. Unlike
+  /// addresses, section offsets are unambiguous in relocatable object files,
+  /// whose sections all start at address 0.
+  Function *getRaisedFunctionAt(uint64_t Offset, int64_t SecIdx) const;
+
   /// Return the Function * corresponding to input binary function from
-  /// text relocation record with off set in the range [Loc, Loc+Size].
-  Function *getCalledFunctionUsingTextReloc(uint64_t Loc, uint64_t Size) const;
+  /// relocation record of text section with index 'SecIdx' with offset in the
+  /// range [Loc, Loc+Size].
+  Function *getCalledFunctionUsingTextReloc(uint64_t Loc, uint64_t Size,
+                                            int64_t SecIdx) const;
+
+  /// Sort the relocations collected by collectDynamicRelocations by offset
+  /// for lookup by getDynRelocAtOffset.
+  void sortDynamicRelocations();
 
   /// Get dynamic relocation with offset 'O'
   const RelocationRef *getDynRelocAtOffset(uint64_t O) const;
 
-  /// Return text relocation of instruction at index 'I'. 'S' is the size of the
-  /// instruction at index 'I'.
-  const RelocationRef *getTextRelocAtOffset(uint64_t I, uint64_t S) const;
+  /// Return relocation of instruction at index 'I' of text section with index
+  /// 'SecIdx'. 'S' is the size of the instruction at index 'I'.
+  const RelocationRef *getTextRelocAtOffset(uint64_t I, uint64_t S,
+                                            int64_t SecIdx) const;
 
+  /// Return the index of the text section being decoded; -1 if none.
+  int64_t getTextSectionIndex() const { return TextSectionIndex; }
+  /// Return the address of the text section being decoded; -1 if none.
   int64_t getTextSectionAddress() const;
+  /// Return the address of the text section containing MF; -1 if none.
+  int64_t getTextSectionAddress(const MachineFunction &MF) const;
+  /// Return the name of the global holding the contents of data section Sec.
+  static std::string getSectionDataName(const SectionRef &Sec);
 
   bool changeRaisedFunctionReturnType(Function *, Type *);
 
@@ -159,10 +277,30 @@ protected:
   /// A map of raised function pointer to place-holder function pointer
   /// that links to the MachineFunction.
   DenseMap<Function *, Function *> PlaceholderRaisedFunctionMap;
-  /// Sorted vector of text relocations
-  std::vector<RelocationRef> TextRelocs;
-  /// Vector of dynamic relocation records
+  /// Sorted vectors of text relocations, keyed by text section index
+  std::map<int64_t, std::vector<RelocationRef>> TextRelocs;
+  /// Vector of dynamic relocation records, sorted by offset
   std::vector<RelocationRef> DynRelocs;
+  /// A function folded into a function with identical code
+  struct FoldedFunction {
+    MachineFunctionRaiser *Canonical;
+    std::string Name;
+    int64_t SecIdx;
+    int64_t SecAddr;
+    uint64_t Offset;
+  };
+  /// Functions removed from MFRaiserVector by foldIdenticalFunctions()
+  std::vector<FoldedFunction> FoldedFunctions;
+  /// A function of the binary that is not raised
+  struct UnraisedFunction {
+    std::string Name;
+    int64_t SecIdx;
+    int64_t SecAddr;
+    uint64_t Offset;
+  };
+  std::vector<UnraisedFunction> UnraisedFunctions;
+  /// Names of unraised functions whose references were reported
+  mutable StringSet<> ReportedUnraisedFunctions;
 
   // Commonly used data structures
   Module *M;
@@ -174,12 +312,81 @@ protected:
   const MCInstPrinter *MIP;
   const ObjectFile *Obj;
   MCDisassembler *DisAsm;
-  /// Index of text section whose instructions are raised
+  /// Index and address of text section whose instructions are decoded
   int64_t TextSectionIndex;
+  int64_t TextSectionAddress;
   Triple::ArchType Arch;
   FunctionFilter *FFT;
   /// Flag to indicate that fields are set. Resetting is not allowed/expected.
   bool InfoSet;
+
+private:
+  /// Return a string that is equal for functions with identical code; an
+  /// empty string if the code of the function is not to be folded.
+  std::string getFoldingKey(const MCInstRaiser *MCIR) const;
+  /// Define each folded function as an alias of its canonical function.
+  void createFoldedFunctionAliases();
+  /// Report a reference to the unraised function UF, once per function.
+  void reportUnraisedReference(const UnraisedFunction &UF) const;
+  bool hasFailed(const MachineFunctionRaiser *MFR) const;
+  bool runSafely(MachineFunctionRaiser *MFR, StringRef Stage,
+                 function_ref<bool()> Fn);
+  void applyFallbacks();
+  /// Return the key of the prototype of the function of MFR in AnalysisDB.
+  std::string getAnalysisKey(MachineFunctionRaiser *MFR) const;
+  /// Return a hash of the code of the function of MFR.
+  std::string getCodeKey(MachineFunctionRaiser *MFR) const;
+  /// Return the raisers of the functions called directly by the function of
+  /// MFR.
+  std::vector<MachineFunctionRaiser *>
+  getDirectCallees(MachineFunctionRaiser *MFR) const;
+  /// Construct the raised function of MFR with its prototype in PrevModule,
+  /// if unchanged, or else the prototype recorded in AnalysisDB and return
+  /// its type; nullptr if none is known.
+  FunctionType *reuseRecordedPrototype(MachineFunctionRaiser *MFR);
+
+  /// Return true if the function of MFR is raised by copying its body from
+  /// the module of an earlier version of the binary.
+  bool isUnchanged(MachineFunctionRaiser *MFR) const;
+  void raiseUsersOfChangedPrototypes();
+  /// Copy the bodies of unchanged functions from PrevModule, along with the
+  /// global values they reference.
+  void copyUnchangedFunctions();
+  /// Return the section of the binary whose contents PrevGV, a global of
+  /// PrevModule, holds; None if PrevGV does not hold the contents of a
+  /// section.
+  Optional<SectionRef> getSectionOfData(const GlobalVariable &PrevGV) const;
+  /// Finalize the debug information of raised functions, if any.
+  void finalizeDebugAddresses();
+
+  AnalysisDatabase *AnalysisDB = nullptr;
+  /// Keys of the prototypes of functions in AnalysisDB, by raiser
+  mutable std::map<MachineFunctionRaiser *, std::string> AnalysisKeys;
+  const BranchProfile *BranchProf = nullptr;
+  /// Module of an earlier version of the binary, and the functions whose
+  /// bodies are copied from it
+  std::unique_ptr<Module> PrevModule;
+  StringSet<> UnchangedFunctions;
+  FallbackKind Fallback = FallbackKind::Abort;
+  unsigned TimeBudget = 0;
+  unsigned MemoryBudget = 0;
+  bool SplitStackFrame = false;
+  bool DebugAddresses = false;
+  /// Builder of the debug information of raised functions, and the file of
+  /// their locations
+  std::unique_ptr<DIBuilder> DIB;
+  DIFile *DebugFile = nullptr;
+  /// Start time and memory usage of the stage of raising a function being
+  /// run, and the budget it exceeded, if any
+  std::chrono::steady_clock::time_point BudgetStartTime;
+  size_t BudgetStartMemory = 0;
+  mutable std::string BudgetExceeded;
+  /// A function that failed to raise
+  struct FailedFunction {
+    MachineFunctionRaiser *MFR;
+    std::string Reason;
+  };
+  std::vector<FailedFunction> FailedFunctions;
 };
 
 bool isSupportedArch(Triple::ArchType Arch);
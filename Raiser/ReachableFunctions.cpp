@@ -0,0 +1,478 @@
+//===-- ReachableFunctions.cpp ----------------------------------*- C++ -*-===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+//
+// This file contains the implementation of ReachableFunctions class
+// for use by llvm-mctoll.
+//
+//===----------------------------------------------------------------------===//
+
+#include "ReachableFunctions.h"
+#include "llvm/ADT/Triple.h"
+#include "llvm/BinaryFormat/ELF.h"
+#include "llvm/MC/MCInst.h"
+#include "llvm/Object/ELFObjectFile.h"
+#include "llvm/Support/Debug.h"
+#include "llvm/Support/Endian.h"
+#include "llvm/Support/MathExtras.h"
+
+#define DEBUG_TYPE "mctoll"
+
+using namespace llvm;
+using namespace llvm::mctoll;
+using namespace llvm::object;
+
+// Maximum number of instructions of a PLT stub decoded to find the GOT slot
+// it jumps through (e.g., endbr64; bnd jmp *slot(%rip) in .plt.sec).
+static const unsigned MaxPLTStubInsts = 3;
+
+ReachableFunctions::ReachableFunctions(const ObjectFile *Obj,
+                                       const MCDisassembler *DisAsm,
+                                       const MCInstrAnalysis *MIA)
+    : Obj(Obj), DisAsm(DisAsm), MIA(MIA) {
+  if (!Obj->isELF() || Obj->isRelocatableObject())
+    return;
+
+  for (const SectionRef &RelSec : Obj->dynamic_relocation_sections())
+    for (const RelocationRef &Reloc : RelSec.relocations()) {
+      symbol_iterator Sym = Reloc.getSymbol();
+      if (Sym == Obj->symbol_end())
+        continue;
+      Expected<StringRef> NameOrErr = Sym->getName();
+      if (!NameOrErr) {
+        consumeError(NameOrErr.takeError());
+        continue;
+      }
+      if (!NameOrErr->empty())
+        GOTSlotSymbols[Reloc.getOffset()] = *NameOrErr;
+    }
+}
+
+void ReachableFunctions::addSection(const SectionRef &Section,
+                                    const SectionSymbolsTy &Symbols) {
+  Expected<StringRef> ContentsOrErr = Section.getContents();
+  if (!ContentsOrErr) {
+    consumeError(ContentsOrErr.takeError());
+    return;
+  }
+
+  const uint64_t SecIdx = Section.getIndex();
+  TextSection &TS = Sections[SecIdx];
+  TS.Section = Section;
+  TS.Bytes = ArrayRef<uint8_t>(
+      reinterpret_cast<const uint8_t *>(ContentsOrErr->data()),
+      ContentsOrErr->size());
+
+  // Code preceding the first symbol of the section is decoded as a function
+  // without name.
+  TS.FuncStarts.push_back(Section.getAddress());
+  for (const SymbolInfoTy &Symbol : Symbols) {
+    if (Obj->isELF() && Symbol.Type != ELF::STT_FUNC)
+      continue;
+    TS.FuncStarts.push_back(Symbol.Addr);
+    FunctionsByName.try_emplace(Symbol.Name, SecIdx, Symbol.Addr);
+  }
+  llvm::sort(TS.FuncStarts);
+  TS.FuncStarts.erase(std::unique(TS.FuncStarts.begin(), TS.FuncStarts.end()),
+                      TS.FuncStarts.end());
+
+  if (Obj->isRelocatableObject())
+    for (const SectionRef &RelSec : Obj->sections()) {
+      Expected<section_iterator> RelocatedOrErr = RelSec.getRelocatedSection();
+      if (!RelocatedOrErr) {
+        consumeError(RelocatedOrErr.takeError());
+        continue;
+      }
+      if (*RelocatedOrErr == Obj->section_end() || **RelocatedOrErr != Section)
+        continue;
+      for (const RelocationRef &Reloc : RelSec.relocations())
+        TS.Relocs.push_back(Reloc);
+    }
+}
+
+const ReachableFunctions::TextSection *
+ReachableFunctions::getSectionContaining(uint64_t Addr) const {
+  for (const auto &Entry : Sections) {
+    const TextSection &TS = Entry.second;
+    uint64_t SecAddr = TS.Section.getAddress();
+    if (Addr >= SecAddr && Addr < SecAddr + TS.Bytes.size())
+      return &TS;
+  }
+  return nullptr;
+}
+
+void ReachableFunctions::addFunctionContaining(uint64_t SecIdx, uint64_t Addr) {
+  auto SecIter = Sections.find(SecIdx);
+  if (SecIter == Sections.end())
+    return;
+  const std::vector<uint64_t> &FuncStarts = SecIter->second.FuncStarts;
+  auto StartIter = llvm::upper_bound(FuncStarts, Addr);
+  if (StartIter == FuncStarts.begin())
+    return;
+  FunctionKey Func(SecIdx, *std::prev(StartIter));
+  if (Reachable.insert(Func).second)
+    Worklist.push_back(Func);
+}
+
+void ReachableFunctions::addFunctionStartingAt(uint64_t Addr) {
+  const TextSection *TS = getSectionContaining(Addr);
+  if (TS == nullptr || !std::binary_search(TS->FuncStarts.begin(),
+                                           TS->FuncStarts.end(), Addr))
+    return;
+  addFunctionContaining(TS->Section.getIndex(), Addr);
+}
+
+void ReachableFunctions::addPLTTarget(uint64_t Addr) {
+  for (const SectionRef &Sec : Obj->sections()) {
+    uint64_t SecAddr = Sec.getAddress();
+    if (!Sec.isText() || Addr < SecAddr || Addr >= SecAddr + Sec.getSize())
+      continue;
+    Expected<StringRef> ContentsOrErr = Sec.getContents();
+    if (!ContentsOrErr) {
+      consumeError(ContentsOrErr.takeError());
+      return;
+    }
+    ArrayRef<uint8_t> Bytes(
+        reinterpret_cast<const uint8_t *>(ContentsOrErr->data()),
+        ContentsOrErr->size());
+
+    uint64_t Size;
+    uint64_t Index = Addr - SecAddr;
+    for (unsigned NumInsts = 0;
+         NumInsts < MaxPLTStubInsts && Index < Bytes.size();
+         NumInsts++, Index += Size) {
+      MCInst Inst;
+      if (!DisAsm->getInstruction(Inst, Size, Bytes.slice(Index),
+                                  SecAddr + Index, nulls()))
+        return;
+      Optional<uint64_t> SlotAddr = MIA->evaluateMemoryOperandAddress(
+          Inst, nullptr, SecAddr + Index, Size);
+      if (!SlotAddr)
+        continue;
+      addGOTSlotTarget(*SlotAddr);
+      return;
+    }
+    return;
+  }
+}
+
+void ReachableFunctions::addGOTSlotTarget(uint64_t SlotAddr) {
+  auto SlotIter = GOTSlotSymbols.find(SlotAddr);
+  if (SlotIter == GOTSlotSymbols.end())
+    return;
+  auto FuncIter = FunctionsByName.find(SlotIter->second);
+  if (FuncIter != FunctionsByName.end())
+    addFunctionContaining(FuncIter->second.first, FuncIter->second.second);
+}
+
+void ReachableFunctions::addBranchTarget(uint64_t SecIdx, uint64_t Addr) {
+  // Sections of a relocatable object overlap. Targets not reached through a
+  // relocation are in the section of the branch.
+  if (Obj->isRelocatableObject()) {
+    addFunctionContaining(SecIdx, Addr);
+    return;
+  }
+  if (const TextSection *TS = getSectionContaining(Addr))
+    addFunctionContaining(TS->Section.getIndex(), Addr);
+  else
+    addPLTTarget(Addr);
+}
+
+// Functions referenced by relocations of a relocatable object are reached
+// through the symbol of the relocation.
+void ReachableFunctions::addRelocationTarget(const RelocationRef &Reloc) {
+  symbol_iterator Sym = Reloc.getSymbol();
+  if (Sym == Obj->symbol_end())
+    return;
+  Expected<section_iterator> SecOrErr = Sym->getSection();
+  if (!SecOrErr) {
+    consumeError(SecOrErr.takeError());
+    return;
+  }
+  // Undefined symbols are defined by other objects.
+  if (*SecOrErr == Obj->section_end())
+    return;
+  Expected<uint64_t> AddrOrErr = Sym->getAddress();
+  if (!AddrOrErr) {
+    consumeError(AddrOrErr.takeError());
+    return;
+  }
+
+  uint64_t Target = *AddrOrErr;
+  // A section symbol refers to code at an offset given by the addend, which
+  // for PC-relative references is relative to the end of the 4-byte field.
+  ELFSymbolRef ELFSym(*Sym);
+  if (ELFSym.getELFType() == ELF::STT_SECTION) {
+    Expected<int64_t> AddendOrErr = ELFRelocationRef(Reloc).getAddend();
+    if (!AddendOrErr) {
+      consumeError(AddendOrErr.takeError());
+      return;
+    }
+    Target += *AddendOrErr;
+    if (Reloc.getType() == ELF::R_X86_64_PC32 ||
+        Reloc.getType() == ELF::R_X86_64_PLT32)
+      Target += 4;
+  }
+  addFunctionContaining((*SecOrErr)->getIndex(), Target);
+}
+
+void ReachableFunctions::addRelocationTargets(const TextSection &TS,
+                                              uint64_t Start, uint64_t End) {
+  for (const RelocationRef &Reloc : TS.Relocs) {
+    uint64_t Offset = Reloc.getOffset();
+    if (Offset >= Start && Offset < End)
+      addRelocationTarget(Reloc);
+  }
+}
+
+// Return true if Section holds data of the program that may contain addresses
+// of functions. Tables of the runtime (e.g., .eh_frame, referring to every
+// function) and of the dynamic linker (e.g., .dynsym) are not.
+static bool isProgramDataSection(const SectionRef &Section) {
+  if (Section.isText() || Section.isVirtual())
+    return false;
+  ELFSectionRef ELFSec(Section);
+  if (!(ELFSec.getFlags() & ELF::SHF_ALLOC))
+    return false;
+  switch (ELFSec.getType()) {
+  case ELF::SHT_PROGBITS:
+  case ELF::SHT_INIT_ARRAY:
+  case ELF::SHT_FINI_ARRAY:
+  case ELF::SHT_PREINIT_ARRAY:
+    break;
+  default:
+    return false;
+  }
+  Expected<StringRef> NameOrErr = Section.getName();
+  if (!NameOrErr) {
+    consumeError(NameOrErr.takeError());
+    return false;
+  }
+  return !NameOrErr->startswith(".eh_frame") &&
+         (*NameOrErr != ".gcc_except_table");
+}
+
+// Return true if the words of Section are addresses, even in binaries that
+// are not position independent, whose addresses are not relocated. These are
+// the arrays of constructors and destructors, the GOT and the data that the
+// compiler places in .data.rel.ro since it holds addresses (e.g., vtables).
+static bool isAddressTableSection(const SectionRef &Section) {
+  if (Section.isVirtual())
+    return false;
+  ELFSectionRef ELFSec(Section);
+  switch (ELFSec.getType()) {
+  case ELF::SHT_INIT_ARRAY:
+  case ELF::SHT_FINI_ARRAY:
+  case ELF::SHT_PREINIT_ARRAY:
+    return true;
+  case ELF::SHT_PROGBITS:
+    break;
+  default:
+    return false;
+  }
+  Expected<StringRef> NameOrErr = Section.getName();
+  if (!NameOrErr) {
+    consumeError(NameOrErr.takeError());
+    return false;
+  }
+  return (*NameOrErr == ".got") || (*NameOrErr == ".data.rel.ro") ||
+         NameOrErr->startswith(".data.rel.ro.");
+}
+
+// Return true if a dynamic relocation of type Type stores an address in a word
+// of data, either relative to the load address or that of a symbol.
+static bool isAddressRelocation(const ObjectFile *Obj, uint64_t Type) {
+  switch (Obj->getArch()) {
+  case Triple::x86_64:
+    return (Type == ELF::R_X86_64_RELATIVE) || (Type == ELF::R_X86_64_64);
+  case Triple::x86:
+    return (Type == ELF::R_386_RELATIVE) || (Type == ELF::R_386_32);
+  case Triple::arm:
+    return (Type == ELF::R_ARM_RELATIVE) || (Type == ELF::R_ARM_ABS32);
+  default:
+    return false;
+  }
+}
+
+// Return the pointer-sized word at Addr of the data of Obj, if any.
+static Optional<uint64_t> readAddressAt(const ObjectFile *Obj, uint64_t Addr) {
+  const unsigned PtrSize = Obj->getBytesInAddress();
+  const support::endianness Endian =
+      Obj->isLittleEndian() ? support::little : support::big;
+  for (const SectionRef &Section : Obj->sections()) {
+    uint64_t SecAddr = Section.getAddress();
+    if (Section.isVirtual() || Addr < SecAddr ||
+        Addr + PtrSize > SecAddr + Section.getSize())
+      continue;
+    Expected<StringRef> ContentsOrErr = Section.getContents();
+    if (!ContentsOrErr) {
+      consumeError(ContentsOrErr.takeError());
+      return None;
+    }
+    const char *Data = ContentsOrErr->data() + (Addr - SecAddr);
+    return (PtrSize == 8) ? support::endian::read64(Data, Endian)
+                          : support::endian::read32(Data, Endian);
+  }
+  return None;
+}
+
+void ReachableFunctions::addDataReferences() {
+  if (!Obj->isELF())
+    return;
+
+  // Addresses in data of relocatable objects are relocated.
+  if (Obj->isRelocatableObject()) {
+    for (const SectionRef &RelSec : Obj->sections()) {
+      Expected<section_iterator> RelocatedOrErr = RelSec.getRelocatedSection();
+      if (!RelocatedOrErr) {
+        consumeError(RelocatedOrErr.takeError());
+        continue;
+      }
+      if (*RelocatedOrErr == Obj->section_end() ||
+          !isProgramDataSection(**RelocatedOrErr))
+        continue;
+      for (const RelocationRef &Reloc : RelSec.relocations())
+        addRelocationTarget(Reloc);
+    }
+    return;
+  }
+
+  // Addresses stored by dynamic relocations, i.e., relative to the load
+  // address in position independent binaries or of exported functions.
+  // Relocations of GOT and PLT slots of functions called by raised code are
+  // followed from the code.
+  for (const SectionRef &RelSec : Obj->dynamic_relocation_sections())
+    for (const RelocationRef &Reloc : RelSec.relocations()) {
+      if (!isAddressRelocation(Obj, Reloc.getType()))
+        continue;
+      symbol_iterator Sym = Reloc.getSymbol();
+      if (Sym == Obj->symbol_end()) {
+        // Relocations without addend (i.e., REL) relocate the stored word.
+        Expected<int64_t> AddendOrErr = ELFRelocationRef(Reloc).getAddend();
+        if (AddendOrErr) {
+          addFunctionStartingAt(*AddendOrErr);
+          continue;
+        }
+        consumeError(AddendOrErr.takeError());
+        if (Optional<uint64_t> Value = readAddressAt(Obj, Reloc.getOffset()))
+          addFunctionStartingAt(*Value);
+        continue;
+      }
+      Expected<section_iterator> SecOrErr = Sym->getSection();
+      if (!SecOrErr) {
+        consumeError(SecOrErr.takeError());
+        continue;
+      }
+      if (*SecOrErr == Obj->section_end())
+        continue;
+      Expected<uint64_t> AddrOrErr = Sym->getAddress();
+      if (AddrOrErr)
+        addFunctionStartingAt(*AddrOrErr);
+      else
+        consumeError(AddrOrErr.takeError());
+    }
+
+  // Addresses stored in tables of addresses, at pointer-aligned addresses.
+  const unsigned PtrSize = Obj->getBytesInAddress();
+  const support::endianness Endian =
+      Obj->isLittleEndian() ? support::little : support::big;
+  for (const SectionRef &Section : Obj->sections()) {
+    if (!isAddressTableSection(Section))
+      continue;
+    Expected<StringRef> ContentsOrErr = Section.getContents();
+    if (!ContentsOrErr) {
+      consumeError(ContentsOrErr.takeError());
+      continue;
+    }
+    const uint64_t SecAddr = Section.getAddress();
+    const char *Data = ContentsOrErr->data();
+    for (uint64_t Offset = alignTo(SecAddr, PtrSize) - SecAddr;
+         Offset + PtrSize <= ContentsOrErr->size(); Offset += PtrSize) {
+      uint64_t Value = (PtrSize == 8)
+                           ? support::endian::read64(Data + Offset, Endian)
+                           : support::endian::read32(Data + Offset, Endian);
+      addFunctionStartingAt(Value);
+    }
+  }
+}
+
+void ReachableFunctions::scanFunction(const FunctionKey &Func) {
+  const TextSection &TS = Sections[Func.first];
+  const uint64_t SecAddr = TS.Section.getAddress();
+  const uint64_t Start = Func.second;
+  auto NextStart = llvm::upper_bound(TS.FuncStarts, Start);
+  const uint64_t End = (NextStart == TS.FuncStarts.end())
+                           ? SecAddr + TS.Bytes.size()
+                           : *NextStart;
+
+  LLVM_DEBUG(dbgs() << "Scanning reachable function at 0x"
+                    << Twine::utohexstr(Start) << "\n");
+
+  if (Obj->isRelocatableObject())
+    addRelocationTargets(TS, Start - SecAddr, End - SecAddr);
+
+  uint64_t Size;
+  for (uint64_t Addr = Start; Addr < End; Addr += Size) {
+    MCInst Inst;
+    bool Decoded = DisAsm->getInstruction(
+        Inst, Size, TS.Bytes.slice(Addr - SecAddr, End - Addr), Addr, nulls());
+    if (Size == 0)
+      Size = 1;
+    if (!Decoded)
+      continue;
+
+    uint64_t Target;
+    if ((MIA->isCall(Inst) || MIA->isBranch(Inst)) &&
+        MIA->evaluateBranch(Inst, Addr, Size, Target)) {
+      if (Target < Start || Target >= End)
+        addBranchTarget(Func.first, Target);
+      continue;
+    }
+
+    // References to code of a relocatable object are relocated.
+    if (Obj->isRelocatableObject())
+      continue;
+
+    // Functions whose address is taken, either PC-relative or absolute, or
+    // loaded from their GOT slot.
+    if (Optional<uint64_t> MemAddr =
+            MIA->evaluateMemoryOperandAddress(Inst, nullptr, Addr, Size)) {
+      addFunctionStartingAt(*MemAddr);
+      addGOTSlotTarget(*MemAddr);
+    }
+    for (const MCOperand &Op : Inst)
+      if (Op.isImm())
+        addFunctionStartingAt(Op.getImm());
+  }
+}
+
+std::vector<std::string>
+ReachableFunctions::compute(ArrayRef<std::string> Roots) {
+  std::vector<std::string> NotFound;
+  for (const std::string &Root : Roots) {
+    auto FuncIter = FunctionsByName.find(Root);
+    if (FuncIter == FunctionsByName.end()) {
+      NotFound.push_back(Root);
+      continue;
+    }
+    addFunctionContaining(FuncIter->second.first, FuncIter->second.second);
+  }
+  addDataReferences();
+
+  while (!Worklist.empty()) {
+    FunctionKey Func = Worklist.back();
+    Worklist.pop_back();
+    if (MIA != nullptr)
+      scanFunction(Func);
+  }
+
+  LLVM_DEBUG(dbgs() << Reachable.size()
+                    << " function(s) reachable from the roots\n");
+  return NotFound;
+}
+
+#undef DEBUG_TYPE
@@ -0,0 +1,117 @@
+//===-- ReachableFunctions.h ------------------------------------*- C++ -*-===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+//
+// This file contains the declaration of ReachableFunctions class
+// for use by llvm-mctoll.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef LLVM_TOOLS_LLVM_MCTOLL_REACHABLEFUNCTIONS_H
+#define LLVM_TOOLS_LLVM_MCTOLL_REACHABLEFUNCTIONS_H
+
+#include "llvm/ADT/StringMap.h"
+#include "llvm/MC/MCDisassembler/MCDisassembler.h"
+#include "llvm/MC/MCInstrAnalysis.h"
+#include "llvm/Object/ObjectFile.h"
+#include <map>
+#include <set>
+#include <string>
+#include <vector>
+
+namespace llvm {
+namespace mctoll {
+
+/// Computes the set of functions of the text sections of a binary that are
+/// reachable from a set of root functions. Only the functions reached are
+/// decoded. A function reaches
+///   - the targets of its direct calls and direct (tail) jumps,
+///   - functions of the binary called through PLT stubs,
+///   - functions whose address it takes (e.g., to pass a callback) or loads
+///     from their GOT slot, and
+///   - in relocatable objects, the targets of the relocations of its code.
+/// Jump tables of a function only refer to blocks of the function itself,
+/// all of which are decoded along with the function. Functions whose address
+/// is stored in data may be called from anywhere and are reachable as well.
+/// These are the functions whose address is stored by a relocation (e.g., in
+/// tables of callbacks of position independent binaries) or in a table of
+/// addresses (.init_array, .fini_array, .data.rel.ro or the GOT).
+class ReachableFunctions {
+public:
+  ReachableFunctions(const object::ObjectFile *Obj,
+                     const MCDisassembler *DisAsm, const MCInstrAnalysis *MIA);
+
+  /// Register the text section Section with the sorted list of its symbols.
+  void addSection(const object::SectionRef &Section,
+                  const SectionSymbolsTy &Symbols);
+
+  /// Compute the functions reachable from the functions named in Roots.
+  /// Return the names in Roots that are not names of functions in any of the
+  /// registered sections.
+  std::vector<std::string> compute(ArrayRef<std::string> Roots);
+
+  /// Return true if the function starting at Addr in Section is reachable.
+  bool isReachable(const object::SectionRef &Section, uint64_t Addr) const {
+    return Reachable.count({Section.getIndex(), Addr}) != 0;
+  }
+
+  unsigned getNumReachable() const { return Reachable.size(); }
+
+private:
+  /// A function is identified by the index of its section and its start
+  /// address. All sections of a relocatable object start at address 0.
+  using FunctionKey = std::pair<uint64_t, uint64_t>;
+
+  struct TextSection {
+    object::SectionRef Section;
+    ArrayRef<uint8_t> Bytes;
+    /// Sorted start addresses of the functions of the section.
+    std::vector<uint64_t> FuncStarts;
+    /// Relocations of the section, if the binary is a relocatable object.
+    std::vector<object::RelocationRef> Relocs;
+  };
+
+  /// Mark the function of section SecIdx containing Addr reachable.
+  void addFunctionContaining(uint64_t SecIdx, uint64_t Addr);
+  /// Mark the function starting at Addr reachable, if there is one.
+  void addFunctionStartingAt(uint64_t Addr);
+  /// Mark the function of the binary called by the PLT stub at Addr
+  /// reachable, if any.
+  void addPLTTarget(uint64_t Addr);
+  /// Mark the function of the binary whose address is stored in the GOT slot
+  /// at SlotAddr reachable, if any.
+  void addGOTSlotTarget(uint64_t SlotAddr);
+  /// Mark the function at the branch target Addr of an instruction in
+  /// section SecIdx reachable.
+  void addBranchTarget(uint64_t SecIdx, uint64_t Addr);
+  /// Mark the function referenced by the relocation Reloc of a relocatable
+  /// object reachable.
+  void addRelocationTarget(const object::RelocationRef &Reloc);
+  void addRelocationTargets(const TextSection &TS, uint64_t Start,
+                            uint64_t End);
+  /// Mark the functions whose address is stored in data reachable.
+  void addDataReferences();
+  void scanFunction(const FunctionKey &Func);
+  const TextSection *getSectionContaining(uint64_t Addr) const;
+
+  const object::ObjectFile *Obj;
+  const MCDisassembler *DisAsm;
+  const MCInstrAnalysis *MIA;
+  /// Registered text sections, keyed by section index.
+  std::map<uint64_t, TextSection> Sections;
+  StringMap<FunctionKey> FunctionsByName;
+  /// Map of GOT slot address to the name of the symbol whose address is
+  /// stored in the slot by a dynamic relocation.
+  std::map<uint64_t, StringRef> GOTSlotSymbols;
+  std::set<FunctionKey> Reachable;
+  std::vector<FunctionKey> Worklist;
+};
+
+} // end namespace mctoll
+} // end namespace llvm
+
+#endif // LLVM_TOOLS_LLVM_MCTOLL_REACHABLEFUNCTIONS_H
@@ -24,7 +24,7 @@ static constexpr const_addl_instr_info::value_type MapData[] = {
     {X86::AAD8i8, {0, Unknown}},
     {X86::AAM8i8, {0, Unknown}},
     {X86::AAS, {0, Unknown}},
-    {X86::ABS_F, {0, Unknown}},
+    {X86::ABS_F, {0, FPU_REG_OP}},
     {X86::ABS_Fp32, {0, Unknown}},
     {X86::ABS_Fp64, {0, Unknown}},
     {X86::ABS_Fp80, {0, Unknown}},
@@ -129,12 +129,12 @@ static constexpr const_addl_instr_info::value_type MapData[] = {
     {X86::ADDSUBPDrr, {0, Unknown}},
     {X86::ADDSUBPSrm, {0, Unknown}},
     {X86::ADDSUBPSrr, {0, Unknown}},
-    {X86::ADD_F32m, {0, Unknown}},
-    {X86::ADD_F64m, {0, Unknown}},
-    {X86::ADD_FI16m, {0, Unknown}},
-    {X86::ADD_FI32m, {0, Unknown}},
+    {X86::ADD_F32m, {4, LOAD_FPU_REG}},
+    {X86::ADD_F64m, {8, LOAD_FPU_REG}},
+    {X86::ADD_FI16m, {2, LOAD_FPU_REG}},
+    {X86::ADD_FI32m, {4, LOAD_FPU_REG}},
     {X86::ADD_FPrST0, {0, FPU_REG_OP}},
-    {X86::ADD_FST0r, {0, Unknown}},
+    {X86::ADD_FST0r, {0, FPU_REG_OP}},
     {X86::ADD_Fp32, {0, Unknown}},
     {X86::ADD_Fp32m, {0, Unknown}},
     {X86::ADD_Fp64, {0, Unknown}},
@@ -149,7 +149,7 @@ static constexpr const_addl_instr_info::value_type MapData[] = {
     {X86::ADD_FpI32m32, {0, Unknown}},
     {X86::ADD_FpI32m64, {0, Unknown}},
     {X86::ADD_FpI32m80, {0, Unknown}},
-    {X86::ADD_FrST0, {0, Unknown}},
+    {X86::ADD_FrST0, {0, FPU_REG_OP}},
     {X86::ADJCALLSTACKDOWN32, {0, Unknown}},
     {X86::ADJCALLSTACKDOWN64, {0, Unknown}},
     {X86::ADJCALLSTACKUP32, {0, Unknown}},
@@ -206,10 +206,10 @@ static constexpr const_addl_instr_info::value_type MapData[] = {
     {X86::AND8rm, {1, BINARY_OP_RM}},
     {X86::AND8rr, {0, BINARY_OP_RR}},
     {X86::AND8rr_REV, {0, Unknown}},
-    {X86::ANDN32rm, {4, Unknown}},
-    {X86::ANDN32rr, {0, Unknown}},
-    {X86::ANDN64rm, {8, Unknown}},
-    {X86::ANDN64rr, {0, Unknown}},
+    {X86::ANDN32rm, {4, BIT_MANIP_OP}},
+    {X86::ANDN32rr, {0, BIT_MANIP_OP}},
+    {X86::ANDN64rm, {8, BIT_MANIP_OP}},
+    {X86::ANDN64rr, {0, BIT_MANIP_OP}},
     {X86::ANDNPDrm, {16, BINARY_OP_RM}},
     {X86::ANDNPDrr, {0, BINARY_OP_RR}},
     {X86::ANDNPSrm, {16, BINARY_OP_RM}},
@@ -272,38 +272,38 @@ static constexpr const_addl_instr_info::value_type MapData[] = {
     {X86::BLSFILL32rr, {0, Unknown}},
     {X86::BLSFILL64rm, {8, Unknown}},
     {X86::BLSFILL64rr, {0, Unknown}},
-    {X86::BLSI32rm, {4, Unknown}},
-    {X86::BLSI32rr, {0, Unknown}},
-    {X86::BLSI64rm, {8, Unknown}},
-    {X86::BLSI64rr, {0, Unknown}},
+    {X86::BLSI32rm, {4, BIT_MANIP_OP}},
+    {X86::BLSI32rr, {0, BIT_MANIP_OP}},
+    {X86::BLSI64rm, {8, BIT_MANIP_OP}},
+    {X86::BLSI64rr, {0, BIT_MANIP_OP}},
     {X86::BLSIC32rm, {4, Unknown}},
     {X86::BLSIC32rr, {0, Unknown}},
     {X86::BLSIC64rm, {8, Unknown}},
     {X86::BLSIC64rr, {0, Unknown}},
-    {X86::BLSMSK32rm, {4, Unknown}},
-    {X86::BLSMSK32rr, {0, Unknown}},
-    {X86::BLSMSK64rm, {8, Unknown}},
-    {X86::BLSMSK64rr, {0, Unknown}},
-    {X86::BLSR32rm, {4, Unknown}},
-    {X86::BLSR32rr, {0, Unknown}},
-    {X86::BLSR64rm, {8, Unknown}},
-    {X86::BLSR64rr, {0, Unknown}},
+    {X86::BLSMSK32rm, {4, BIT_MANIP_OP}},
+    {X86::BLSMSK32rr, {0, BIT_MANIP_OP}},
+    {X86::BLSMSK64rm, {8, BIT_MANIP_OP}},
+    {X86::BLSMSK64rr, {0, BIT_MANIP_OP}},
+    {X86::BLSR32rm, {4, BIT_MANIP_OP}},
+    {X86::BLSR32rr, {0, BIT_MANIP_OP}},
+    {X86::BLSR64rm, {8, BIT_MANIP_OP}},
+    {X86::BLSR64rr, {0, BIT_MANIP_OP}},
     {X86::BOUNDS16rm, {2, Unknown}},
     {X86::BOUNDS32rm, {4, Unknown}},
-    {X86::BSF16rm, {2, Unknown}},
-    {X86::BSF16rr, {0, Unknown}},
-    {X86::BSF32rm, {4, Unknown}},
-    {X86::BSF32rr, {0, Unknown}},
-    {X86::BSF64rm, {8, Unknown}},
-    {X86::BSF64rr, {0, Unknown}},
-    {X86::BSR16rm, {2, Unknown}},
-    {X86::BSR16rr, {0, Unknown}},
-    {X86::BSR32rm, {4, Unknown}},
-    {X86::BSR32rr, {0, Unknown}},
-    {X86::BSR64rm, {8, Unknown}},
-    {X86::BSR64rr, {0, Unknown}},
-    {X86::BSWAP32r, {0, Unknown}},
-    {X86::BSWAP64r, {0, Unknown}},
+    {X86::BSF16rm, {2, BIT_MANIP_OP}},
+    {X86::BSF16rr, {0, BIT_MANIP_OP}},
+    {X86::BSF32rm, {4, BIT_MANIP_OP}},
+    {X86::BSF32rr, {0, BIT_MANIP_OP}},
+    {X86::BSF64rm, {8, BIT_MANIP_OP}},
+    {X86::BSF64rr, {0, BIT_MANIP_OP}},
+    {X86::BSR16rm, {2, BIT_MANIP_OP}},
+    {X86::BSR16rr, {0, BIT_MANIP_OP}},
+    {X86::BSR32rm, {4, BIT_MANIP_OP}},
+    {X86::BSR32rr, {0, BIT_MANIP_OP}},
+    {X86::BSR64rm, {8, BIT_MANIP_OP}},
+    {X86::BSR64rr, {0, BIT_MANIP_OP}},
+    {X86::BSWAP32r, {0, BIT_MANIP_OP}},
+    {X86::BSWAP64r, {0, BIT_MANIP_OP}},
     {X86::BT16mi8, {2, BIT_TEST_OP}},
     {X86::BT16mr, {2, BIT_TEST_OP}},
     {X86::BT16ri8, {0, BIT_TEST_OP}},
@@ -353,10 +353,10 @@ static constexpr const_addl_instr_info::value_type MapData[] = {
     {X86::BTS64ri8, {0, BIT_TEST_OP}},
     {X86::BTS64rr, {0, BIT_TEST_OP}},
     {X86::BUNDLE, {0, Unknown}},
-    {X86::BZHI32rm, {4, Unknown}},
-    {X86::BZHI32rr, {0, Unknown}},
-    {X86::BZHI64rm, {8, Unknown}},
-    {X86::BZHI64rr, {0, Unknown}},
+    {X86::BZHI32rm, {4, BIT_MANIP_OP}},
+    {X86::BZHI32rr, {0, BIT_MANIP_OP}},
+    {X86::BZHI64rm, {8, BIT_MANIP_OP}},
+    {X86::BZHI64rr, {0, BIT_MANIP_OP}},
     {X86::CALL16m, {0, Unknown}},
     {X86::CALL16m_NT, {0, Unknown}},
     {X86::CALL16r, {0, Unknown}},
@@ -377,7 +377,7 @@ static constexpr const_addl_instr_info::value_type MapData[] = {
     {X86::CDQ, {0, CONVERT_WDDQQO}},
     {X86::CDQE, {0, CONVERT_BWWDDQ}},
     {X86::CFI_INSTRUCTION, {0, Unknown}},
-    {X86::CHS_F, {0, Unknown}},
+    {X86::CHS_F, {0, FPU_REG_OP}},
     {X86::CHS_Fp32, {0, Unknown}},
     {X86::CHS_Fp64, {0, Unknown}},
     {X86::CHS_Fp80, {0, Unknown}},
@@ -472,31 +472,31 @@ static constexpr const_addl_instr_info::value_type MapData[] = {
     {X86::CMP8rm, {1, Unknown}},
     {X86::CMP8rr, {0, COMPARE}},
     {X86::CMP8rr_REV, {0, Unknown}},
-    {X86::CMPPDrmi, {0, Unknown}},
-    {X86::CMPPDrri, {0, Unknown}},
-    {X86::CMPPSrmi, {0, Unknown}},
-    {X86::CMPPSrri, {0, Unknown}},
-    {X86::CMPSB, {0, Unknown}},
+    {X86::CMPPDrmi, {16, SSE_PACKED_OP}},
+    {X86::CMPPDrri, {0, SSE_PACKED_OP}},
+    {X86::CMPPSrmi, {16, SSE_PACKED_OP}},
+    {X86::CMPPSrri, {0, SSE_PACKED_OP}},
+    {X86::CMPSB, {1, STRING_OP}},
     {X86::CMPSDrm, {0, Unknown}},
     {X86::CMPSDrm_Int, {8, SSE_COMPARE_RM}},
     {X86::CMPSDrr, {0, Unknown}},
     {X86::CMPSDrr_Int, {0, SSE_COMPARE_RR}},
-    {X86::CMPSL, {0, Unknown}},
-    {X86::CMPSQ, {0, Unknown}},
+    {X86::CMPSL, {4, STRING_OP}},
+    {X86::CMPSQ, {8, STRING_OP}},
     {X86::CMPSSrm, {0, Unknown}},
     {X86::CMPSSrm_Int, {4, SSE_COMPARE_RM}},
     {X86::CMPSSrr, {0, Unknown}},
     {X86::CMPSSrr_Int, {0, SSE_COMPARE_RR}},
-    {X86::CMPSW, {0, Unknown}},
+    {X86::CMPSW, {2, STRING_OP}},
     {X86::CMPXCHG16B, {0, Unknown}},
-    {X86::CMPXCHG16rm, {2, Unknown}},
+    {X86::CMPXCHG16rm, {2, ATOMIC_MEM_OP}},
     {X86::CMPXCHG16rr, {0, Unknown}},
-    {X86::CMPXCHG32rm, {4, Unknown}},
+    {X86::CMPXCHG32rm, {4, ATOMIC_MEM_OP}},
     {X86::CMPXCHG32rr, {0, Unknown}},
-    {X86::CMPXCHG64rm, {8, Unknown}},
+    {X86::CMPXCHG64rm, {8, ATOMIC_MEM_OP}},
     {X86::CMPXCHG64rr, {0, Unknown}},
     {X86::CMPXCHG8B, {0, Unknown}},
-    {X86::CMPXCHG8rm, {1, Unknown}},
+    {X86::CMPXCHG8rm, {1, ATOMIC_MEM_OP}},
     {X86::CMPXCHG8rr, {0, Unknown}},
     {X86::COMISDrm, {0, Unknown}},
     {X86::COMISDrm_Int, {0, Unknown}},
@@ -507,23 +507,23 @@ static constexpr const_addl_instr_info::value_type MapData[] = {
     {X86::COMISSrr, {0, Unknown}},
     {X86::COMISSrr_Int, {0, Unknown}},
     {X86::COMP_FST0r, {0, Unknown}},
-    {X86::COM_FIPr, {0, Unknown}},
-    {X86::COM_FIr, {0, Unknown}},
+    {X86::COM_FIPr, {0, FPU_REG_OP}},
+    {X86::COM_FIr, {0, FPU_REG_OP}},
     {X86::COM_FST0r, {0, Unknown}},
     {X86::COPY, {0, Unknown}},
     {X86::COPY_TO_REGCLASS, {0, Unknown}},
     {X86::CPUID, {0, Unknown}},
     {X86::CQO, {0, CONVERT_WDDQQO}},
-    {X86::CRC32r32m16, {0, Unknown}},
-    {X86::CRC32r32m32, {0, Unknown}},
-    {X86::CRC32r32m8, {0, Unknown}},
-    {X86::CRC32r32r16, {0, Unknown}},
-    {X86::CRC32r32r32, {0, Unknown}},
-    {X86::CRC32r32r8, {0, Unknown}},
-    {X86::CRC32r64m64, {0, Unknown}},
-    {X86::CRC32r64m8, {0, Unknown}},
-    {X86::CRC32r64r64, {0, Unknown}},
-    {X86::CRC32r64r8, {0, Unknown}},
+    {X86::CRC32r32m16, {2, BIT_MANIP_OP}},
+    {X86::CRC32r32m32, {4, BIT_MANIP_OP}},
+    {X86::CRC32r32m8, {1, BIT_MANIP_OP}},
+    {X86::CRC32r32r16, {0, BIT_MANIP_OP}},
+    {X86::CRC32r32r32, {0, BIT_MANIP_OP}},
+    {X86::CRC32r32r8, {0, BIT_MANIP_OP}},
+    {X86::CRC32r64m64, {8, BIT_MANIP_OP}},
+    {X86::CRC32r64m8, {1, BIT_MANIP_OP}},
+    {X86::CRC32r64r64, {0, BIT_MANIP_OP}},
+    {X86::CRC32r64r8, {0, BIT_MANIP_OP}},
     {X86::CS_PREFIX, {0, Unknown}},
     {X86::CVTDQ2PDrm, {8, SSE_CONVERT_RM}},
     {X86::CVTDQ2PDrr, {0, SSE_CONVERT_RR}},
@@ -617,12 +617,12 @@ static constexpr const_addl_instr_info::value_type MapData[] = {
     {X86::DIVPDrr, {0, BINARY_OP_RR}},
     {X86::DIVPSrm, {16, BINARY_OP_RM}},
     {X86::DIVPSrr, {0, BINARY_OP_RR}},
-    {X86::DIVR_F32m, {0, Unknown}},
-    {X86::DIVR_F64m, {0, Unknown}},
-    {X86::DIVR_FI16m, {0, Unknown}},
-    {X86::DIVR_FI32m, {0, Unknown}},
+    {X86::DIVR_F32m, {4, LOAD_FPU_REG}},
+    {X86::DIVR_F64m, {8, LOAD_FPU_REG}},
+    {X86::DIVR_FI16m, {2, LOAD_FPU_REG}},
+    {X86::DIVR_FI32m, {4, LOAD_FPU_REG}},
     {X86::DIVR_FPrST0, {0, FPU_REG_OP}},
-    {X86::DIVR_FST0r, {0, Unknown}},
+    {X86::DIVR_FST0r, {0, FPU_REG_OP}},
     {X86::DIVR_Fp32m, {0, Unknown}},
     {X86::DIVR_Fp64m, {0, Unknown}},
     {X86::DIVR_Fp64m32, {0, Unknown}},
@@ -634,7 +634,7 @@ static constexpr const_addl_instr_info::value_type MapData[] = {
     {X86::DIVR_FpI32m32, {0, Unknown}},
     {X86::DIVR_FpI32m64, {0, Unknown}},
     {X86::DIVR_FpI32m80, {0, Unknown}},
-    {X86::DIVR_FrST0, {0, Unknown}},
+    {X86::DIVR_FrST0, {0, FPU_REG_OP}},
     {X86::DIVSDrm, {0, Unknown}},
     {X86::DIVSDrm_Int, {8, BINARY_OP_RM}},
     {X86::DIVSDrr, {0, Unknown}},
@@ -643,12 +643,12 @@ static constexpr const_addl_instr_info::value_type MapData[] = {
     {X86::DIVSSrm_Int, {4, BINARY_OP_RM}},
     {X86::DIVSSrr, {0, Unknown}},
     {X86::DIVSSrr_Int, {0, BINARY_OP_RR}},
-    {X86::DIV_F32m, {0, Unknown}},
-    {X86::DIV_F64m, {0, Unknown}},
-    {X86::DIV_FI16m, {0, Unknown}},
-    {X86::DIV_FI32m, {0, Unknown}},
+    {X86::DIV_F32m, {4, LOAD_FPU_REG}},
+    {X86::DIV_F64m, {8, LOAD_FPU_REG}},
+    {X86::DIV_FI16m, {2, LOAD_FPU_REG}},
+    {X86::DIV_FI32m, {4, LOAD_FPU_REG}},
     {X86::DIV_FPrST0, {0, FPU_REG_OP}},
-    {X86::DIV_FST0r, {0, Unknown}},
+    {X86::DIV_FST0r, {0, FPU_REG_OP}},
     {X86::DIV_Fp32, {0, Unknown}},
     {X86::DIV_Fp32m, {0, Unknown}},
     {X86::DIV_Fp64, {0, Unknown}},
@@ -663,7 +663,7 @@ static constexpr const_addl_instr_info::value_type MapData[] = {
     {X86::DIV_FpI32m32, {0, Unknown}},
     {X86::DIV_FpI32m64, {0, Unknown}},
     {X86::DIV_FpI32m80, {0, Unknown}},
-    {X86::DIV_FrST0, {0, Unknown}},
+    {X86::DIV_FrST0, {0, FPU_REG_OP}},
     {X86::DPPDrmi, {0, Unknown}},
     {X86::DPPDrri, {0, Unknown}},
     {X86::DPPSrmi, {0, Unknown}},
@@ -717,11 +717,11 @@ static constexpr const_addl_instr_info::value_type MapData[] = {
     {X86::FINCSTP, {0, Unknown}},
     {X86::FLDCW16m, {0, Unknown}},
     {X86::FLDENVm, {0, Unknown}},
-    {X86::FLDL2E, {0, Unknown}},
-    {X86::FLDL2T, {0, Unknown}},
-    {X86::FLDLG2, {0, Unknown}},
-    {X86::FLDLN2, {0, Unknown}},
-    {X86::FLDPI, {0, Unknown}},
+    {X86::FLDL2E, {0, FPU_REG_OP}},
+    {X86::FLDL2T, {0, FPU_REG_OP}},
+    {X86::FLDLG2, {0, FPU_REG_OP}},
+    {X86::FLDLN2, {0, FPU_REG_OP}},
+    {X86::FLDPI, {0, FPU_REG_OP}},
     {X86::FNCLEX, {0, Unknown}},
     {X86::FNINIT, {0, Unknown}},
     {X86::FNOP, {0, Unknown}},
@@ -741,7 +741,7 @@ static constexpr const_addl_instr_info::value_type MapData[] = {
     {X86::FPREM, {0, Unknown}},
     {X86::FPREM1, {0, Unknown}},
     {X86::FPTAN, {0, Unknown}},
-    {X86::FRNDINT, {0, Unknown}},
+    {X86::FRNDINT, {0, FPU_REG_OP}},
     {X86::FRSTORm, {0, Unknown}},
     {X86::FSAVEm, {0, Unknown}},
     {X86::FSCALE, {0, Unknown}},
@@ -871,7 +871,7 @@ static constexpr const_addl_instr_info::value_type MapData[] = {
     {X86::IDIV64r, {0, DIVIDE_REG_OP}},
     {X86::IDIV8m, {1, DIVIDE_MEM_OP}},
     {X86::IDIV8r, {0, DIVIDE_REG_OP}},
-    {X86::ILD_F16m, {0, Unknown}},
+    {X86::ILD_F16m, {2, LOAD_FPU_REG}},
     {X86::ILD_F32m, {4, LOAD_FPU_REG}},
     {X86::ILD_F64m, {8, LOAD_FPU_REG}},
     {X86::ILD_Fp16m32, {0, Unknown}},
@@ -954,9 +954,9 @@ static constexpr const_addl_instr_info::value_type MapData[] = {
     {X86::IRET16, {0, Unknown}},
     {X86::IRET32, {0, Unknown}},
     {X86::IRET64, {0, Unknown}},
-    {X86::ISTT_FP16m, {0, Unknown}},
-    {X86::ISTT_FP32m, {0, Unknown}},
-    {X86::ISTT_FP64m, {0, Unknown}},
+    {X86::ISTT_FP16m, {2, STORE_FPU_REG}},
+    {X86::ISTT_FP32m, {4, STORE_FPU_REG}},
+    {X86::ISTT_FP64m, {8, STORE_FPU_REG}},
     {X86::ISTT_Fp16m32, {0, Unknown}},
     {X86::ISTT_Fp16m64, {0, Unknown}},
     {X86::ISTT_Fp16m80, {0, Unknown}},
@@ -966,11 +966,11 @@ static constexpr const_addl_instr_info::value_type MapData[] = {
     {X86::ISTT_Fp64m32, {0, Unknown}},
     {X86::ISTT_Fp64m64, {0, Unknown}},
     {X86::ISTT_Fp64m80, {0, Unknown}},
-    {X86::IST_F16m, {0, Unknown}},
-    {X86::IST_F32m, {0, Unknown}},
-    {X86::IST_FP16m, {0, Unknown}},
-    {X86::IST_FP32m, {0, Unknown}},
-    {X86::IST_FP64m, {0, Unknown}},
+    {X86::IST_F16m, {2, STORE_FPU_REG}},
+    {X86::IST_F32m, {4, STORE_FPU_REG}},
+    {X86::IST_FP16m, {2, STORE_FPU_REG}},
+    {X86::IST_FP32m, {4, STORE_FPU_REG}},
+    {X86::IST_FP64m, {8, STORE_FPU_REG}},
     {X86::IST_Fp16m32, {0, Unknown}},
     {X86::IST_Fp16m64, {0, Unknown}},
     {X86::IST_Fp16m80, {0, Unknown}},
@@ -1094,11 +1094,11 @@ static constexpr const_addl_instr_info::value_type MapData[] = {
     {X86::LDMXCSR, {0, Unknown}},
     {X86::LDS16rm, {2, Unknown}},
     {X86::LDS32rm, {4, Unknown}},
-    {X86::LD_F0, {0, Unknown}},
-    {X86::LD_F1, {0, Unknown}},
-    {X86::LD_F32m, {8, LOAD_FPU_REG}},
-    {X86::LD_F64m, {0, LOAD_FPU_REG}},
-    {X86::LD_F80m, {0, Unknown}},
+    {X86::LD_F0, {0, FPU_REG_OP}},
+    {X86::LD_F1, {0, FPU_REG_OP}},
+    {X86::LD_F32m, {4, LOAD_FPU_REG}},
+    {X86::LD_F64m, {8, LOAD_FPU_REG}},
+    {X86::LD_F80m, {10, LOAD_FPU_REG}},
     {X86::LD_Fp032, {0, Unknown}},
     {X86::LD_Fp064, {0, Unknown}},
     {X86::LD_Fp080, {0, Unknown}},
@@ -1111,7 +1111,7 @@ static constexpr const_addl_instr_info::value_type MapData[] = {
     {X86::LD_Fp64m, {0, Unknown}},
     {X86::LD_Fp64m80, {0, Unknown}},
     {X86::LD_Fp80m, {0, Unknown}},
-    {X86::LD_Frr, {0, Unknown}},
+    {X86::LD_Frr, {0, FPU_REG_OP}},
     {X86::LEA16r, {2, LEA_OP}},    // Memory address size 2 bytes
     {X86::LEA32r, {4, LEA_OP}},    // Memory address size 4 bytes
     {X86::LEA64_32r, {8, LEA_OP}}, // Memory address size 8 bytes
@@ -1120,7 +1120,7 @@ static constexpr const_addl_instr_info::value_type MapData[] = {
     {X86::LEAVE64, {0, LEAVE_OP}},
     {X86::LES16rm, {2, Unknown}},
     {X86::LES32rm, {4, Unknown}},
-    {X86::LFENCE, {0, Unknown}},
+    {X86::LFENCE, {0, FENCE}},
     {X86::LFS16rm, {2, Unknown}},
     {X86::LFS32rm, {4, Unknown}},
     {X86::LFS64rm, {8, Unknown}},
@@ -1243,12 +1243,12 @@ static constexpr const_addl_instr_info::value_type MapData[] = {
     {X86::LXADD32, {0, Unknown}},
     {X86::LXADD64, {0, Unknown}},
     {X86::LXADD8, {0, Unknown}},
-    {X86::LZCNT16rm, {2, Unknown}},
-    {X86::LZCNT16rr, {0, Unknown}},
-    {X86::LZCNT32rm, {4, Unknown}},
-    {X86::LZCNT32rr, {0, Unknown}},
-    {X86::LZCNT64rm, {8, Unknown}},
-    {X86::LZCNT64rr, {0, Unknown}},
+    {X86::LZCNT16rm, {2, BIT_MANIP_OP}},
+    {X86::LZCNT16rr, {0, BIT_MANIP_OP}},
+    {X86::LZCNT32rm, {4, BIT_MANIP_OP}},
+    {X86::LZCNT32rr, {0, BIT_MANIP_OP}},
+    {X86::LZCNT64rm, {8, BIT_MANIP_OP}},
+    {X86::LZCNT64rr, {0, BIT_MANIP_OP}},
     {X86::MASKMOVDQU, {0, Unknown}},
     {X86::MASKMOVDQU64, {0, Unknown}},
     {X86::MAXCPDrm, {0, Unknown}},
@@ -1259,10 +1259,10 @@ static constexpr const_addl_instr_info::value_type MapData[] = {
     {X86::MAXCSDrr, {0, Unknown}},
     {X86::MAXCSSrm, {0, Unknown}},
     {X86::MAXCSSrr, {0, Unknown}},
-    {X86::MAXPDrm, {0, Unknown}},
-    {X86::MAXPDrr, {0, Unknown}},
-    {X86::MAXPSrm, {0, Unknown}},
-    {X86::MAXPSrr, {0, Unknown}},
+    {X86::MAXPDrm, {16, SSE_PACKED_OP}},
+    {X86::MAXPDrr, {0, SSE_PACKED_OP}},
+    {X86::MAXPSrm, {16, SSE_PACKED_OP}},
+    {X86::MAXPSrr, {0, SSE_PACKED_OP}},
     {X86::MAXSDrm, {0, Unknown}},
     {X86::MAXSDrm_Int, {8, BINARY_OP_RM}},
     {X86::MAXSDrr, {0, Unknown}},
@@ -1271,7 +1271,7 @@ static constexpr const_addl_instr_info::value_type MapData[] = {
     {X86::MAXSSrm_Int, {4, BINARY_OP_RM}},
     {X86::MAXSSrr, {0, Unknown}},
     {X86::MAXSSrr_Int, {0, BINARY_OP_RR}},
-    {X86::MFENCE, {0, Unknown}},
+    {X86::MFENCE, {0, FENCE}},
     {X86::MINCPDrm, {0, Unknown}},
     {X86::MINCPDrr, {0, Unknown}},
     {X86::MINCPSrm, {0, Unknown}},
@@ -1280,10 +1280,10 @@ static constexpr const_addl_instr_info::value_type MapData[] = {
     {X86::MINCSDrr, {0, Unknown}},
     {X86::MINCSSrm, {0, Unknown}},
     {X86::MINCSSrr, {0, Unknown}},
-    {X86::MINPDrm, {0, Unknown}},
-    {X86::MINPDrr, {0, Unknown}},
-    {X86::MINPSrm, {0, Unknown}},
-    {X86::MINPSrr, {0, Unknown}},
+    {X86::MINPDrm, {16, SSE_PACKED_OP}},
+    {X86::MINPDrr, {0, SSE_PACKED_OP}},
+    {X86::MINPSrm, {16, SSE_PACKED_OP}},
+    {X86::MINPSrr, {0, SSE_PACKED_OP}},
     {X86::MINSDrm, {0, Unknown}},
     {X86::MINSDrm_Int, {8, BINARY_OP_RM}},
     {X86::MINSDrr, {0, Unknown}},
@@ -1598,14 +1598,14 @@ static constexpr const_addl_instr_info::value_type MapData[] = {
     {X86::MOVLPDrm, {0, Unknown}},
     {X86::MOVLPSmr, {0, Unknown}},
     {X86::MOVLPSrm, {0, Unknown}},
-    {X86::MOVMSKPDrr, {0, Unknown}},
-    {X86::MOVMSKPSrr, {0, Unknown}},
+    {X86::MOVMSKPDrr, {0, SSE_PACKED_OP}},
+    {X86::MOVMSKPSrr, {0, SSE_PACKED_OP}},
     {X86::MOVNTDQArm, {0, Unknown}},
-    {X86::MOVNTDQmr, {0, Unknown}},
+    {X86::MOVNTDQmr, {16, SSE_PACKED_OP}},
     {X86::MOVNTI_64mr, {8, Unknown}},
     {X86::MOVNTImr, {0, Unknown}},
-    {X86::MOVNTPDmr, {0, Unknown}},
-    {X86::MOVNTPSmr, {0, Unknown}},
+    {X86::MOVNTPDmr, {16, SSE_PACKED_OP}},
+    {X86::MOVNTPSmr, {16, SSE_PACKED_OP}},
     {X86::MOVNTSD, {0, Unknown}},
     {X86::MOVNTSS, {0, Unknown}},
     {X86::MOVPC32r, {0, Unknown}},
@@ -1616,7 +1616,7 @@ static constexpr const_addl_instr_info::value_type MapData[] = {
     {X86::MOVPQIto64mr, {8, Unknown}},
     {X86::MOVPQIto64rr, {0, SSE_MOV_RR}},
     {X86::MOVQI2PQIrm, {8, SSE_MOV_FROM_MEM}},
-    {X86::MOVSB, {0, Unknown}},
+    {X86::MOVSB, {1, STRING_OP}},
     {X86::MOVSDmr, {8, SSE_MOV_TO_MEM}},
     {X86::MOVSDrm, {8, SSE_MOV_FROM_MEM}},
     {X86::MOVSDrr, {0, Unknown}},
@@ -1624,16 +1624,16 @@ static constexpr const_addl_instr_info::value_type MapData[] = {
     {X86::MOVSDto64rr, {0, Unknown}},
     {X86::MOVSHDUPrm, {0, Unknown}},
     {X86::MOVSHDUPrr, {0, Unknown}},
-    {X86::MOVSL, {0, Unknown}},
+    {X86::MOVSL, {4, STRING_OP}},
     {X86::MOVSLDUPrm, {0, Unknown}},
     {X86::MOVSLDUPrr, {0, Unknown}},
-    {X86::MOVSQ, {0, Unknown}},
+    {X86::MOVSQ, {8, STRING_OP}},
     {X86::MOVSS2DIrr, {0, Unknown}},
     {X86::MOVSSmr, {4, SSE_MOV_TO_MEM}},
     {X86::MOVSSrm, {4, SSE_MOV_FROM_MEM}},
     {X86::MOVSSrr, {0, Unknown}},
     {X86::MOVSSrr_REV, {0, Unknown}},
-    {X86::MOVSW, {0, Unknown}},
+    {X86::MOVSW, {2, STRING_OP}},
     {X86::MOVSX16rm8, {1, Unknown}},
     {X86::MOVSX16rr8, {0, MOV_RR}},
     {X86::MOVSX32rm16, {2, MOV_FROM_MEM}},
@@ -1695,12 +1695,12 @@ static constexpr const_addl_instr_info::value_type MapData[] = {
     {X86::MULX32rr, {0, Unknown}},
     {X86::MULX64rm, {8, Unknown}},
     {X86::MULX64rr, {0, Unknown}},
-    {X86::MUL_F32m, {0, Unknown}},
-    {X86::MUL_F64m, {0, Unknown}},
-    {X86::MUL_FI16m, {0, Unknown}},
-    {X86::MUL_FI32m, {0, Unknown}},
+    {X86::MUL_F32m, {4, LOAD_FPU_REG}},
+    {X86::MUL_F64m, {8, LOAD_FPU_REG}},
+    {X86::MUL_FI16m, {2, LOAD_FPU_REG}},
+    {X86::MUL_FI32m, {4, LOAD_FPU_REG}},
     {X86::MUL_FPrST0, {0, FPU_REG_OP}},
-    {X86::MUL_FST0r, {0, Unknown}},
+    {X86::MUL_FST0r, {0, FPU_REG_OP}},
     {X86::MUL_Fp32, {0, Unknown}},
     {X86::MUL_Fp32m, {0, Unknown}},
     {X86::MUL_Fp64, {0, Unknown}},
@@ -1715,7 +1715,7 @@ static constexpr const_addl_instr_info::value_type MapData[] = {
     {X86::MUL_FpI32m32, {0, Unknown}},
     {X86::MUL_FpI32m64, {0, Unknown}},
     {X86::MUL_FpI32m80, {0, Unknown}},
-    {X86::MUL_FrST0, {0, Unknown}},
+    {X86::MUL_FrST0, {0, FPU_REG_OP}},
     {X86::MWAITXrrr, {0, Unknown}},
     {X86::MWAITrr, {0, Unknown}},
     {X86::NEG16m, {0, Unknown}},
@@ -1790,12 +1790,12 @@ static constexpr const_addl_instr_info::value_type MapData[] = {
     {X86::OUTSB, {0, Unknown}},
     {X86::OUTSL, {0, Unknown}},
     {X86::OUTSW, {0, Unknown}},
-    {X86::PABSBrm, {0, Unknown}},
-    {X86::PABSBrr, {0, Unknown}},
-    {X86::PABSDrm, {0, Unknown}},
-    {X86::PABSDrr, {0, Unknown}},
-    {X86::PABSWrm, {0, Unknown}},
-    {X86::PABSWrr, {0, Unknown}},
+    {X86::PABSBrm, {16, SSE_PACKED_OP}},
+    {X86::PABSBrr, {0, SSE_PACKED_OP}},
+    {X86::PABSDrm, {16, SSE_PACKED_OP}},
+    {X86::PABSDrr, {0, SSE_PACKED_OP}},
+    {X86::PABSWrm, {16, SSE_PACKED_OP}},
+    {X86::PABSWrr, {0, SSE_PACKED_OP}},
     {X86::PACKSSDWrm, {0, Unknown}},
     {X86::PACKSSDWrr, {0, Unknown}},
     {X86::PACKSSWBrm, {0, Unknown}},
@@ -1814,10 +1814,10 @@ static constexpr const_addl_instr_info::value_type MapData[] = {
     {X86::PADDSBrr, {0, BINARY_OP_RR}},
     {X86::PADDSWrm, {16, BINARY_OP_RM}},
     {X86::PADDSWrr, {0, BINARY_OP_RR}},
-    {X86::PADDUSBrm, {0, Unknown}},
-    {X86::PADDUSBrr, {0, Unknown}},
-    {X86::PADDUSWrm, {0, Unknown}},
-    {X86::PADDUSWrr, {0, Unknown}},
+    {X86::PADDUSBrm, {16, SSE_PACKED_OP}},
+    {X86::PADDUSBrr, {0, SSE_PACKED_OP}},
+    {X86::PADDUSWrm, {16, SSE_PACKED_OP}},
+    {X86::PADDUSWrr, {0, SSE_PACKED_OP}},
     {X86::PADDWrm, {16, BINARY_OP_RM}},
     {X86::PADDWrr, {0, BINARY_OP_RR}},
     {X86::PALIGNRrmi, {0, Unknown}},
@@ -1856,14 +1856,14 @@ static constexpr const_addl_instr_info::value_type MapData[] = {
     {X86::PCMPEQWrr, {0, SSE_COMPARE_RR}},
     {X86::PCMPGTDrr, {0, SSE_COMPARE_RR}},
     {X86::PCMPGTDrm, {0, SSE_COMPARE_RM}},
-    {X86::PDEP32rm, {4, Unknown}},
-    {X86::PDEP32rr, {0, Unknown}},
-    {X86::PDEP64rm, {8, Unknown}},
-    {X86::PDEP64rr, {0, Unknown}},
-    {X86::PEXT32rm, {4, Unknown}},
-    {X86::PEXT32rr, {0, Unknown}},
-    {X86::PEXT64rm, {8, Unknown}},
-    {X86::PEXT64rr, {0, Unknown}},
+    {X86::PDEP32rm, {4, BIT_MANIP_OP}},
+    {X86::PDEP32rr, {0, BIT_MANIP_OP}},
+    {X86::PDEP64rm, {8, BIT_MANIP_OP}},
+    {X86::PDEP64rr, {0, BIT_MANIP_OP}},
+    {X86::PEXT32rm, {4, BIT_MANIP_OP}},
+    {X86::PEXT32rr, {0, BIT_MANIP_OP}},
+    {X86::PEXT64rm, {8, BIT_MANIP_OP}},
+    {X86::PEXT64rr, {0, BIT_MANIP_OP}},
     {X86::PEXTRBmr, {0, Unknown}},
     {X86::PEXTRBrr, {0, Unknown}},
     {X86::PEXTRDmr, {0, Unknown}},
@@ -1966,7 +1966,7 @@ static constexpr const_addl_instr_info::value_type MapData[] = {
     {X86::PMINUDrr, {0, BINARY_OP_RR}},
     {X86::PMINUWrm, {16, BINARY_OP_RM}},
     {X86::PMINUWrr, {0, BINARY_OP_RR}},
-    {X86::PMOVMSKBrr, {0, Unknown}},
+    {X86::PMOVMSKBrr, {0, SSE_PACKED_OP}},
     {X86::PMOVSXBDrm, {0, Unknown}},
     {X86::PMOVSXBDrr, {0, Unknown}},
     {X86::PMOVSXBQrm, {0, Unknown}},
@@ -2001,10 +2001,10 @@ static constexpr const_addl_instr_info::value_type MapData[] = {
     {X86::PMULHUWrr, {0, Unknown}},
     {X86::PMULHWrm, {0, Unknown}},
     {X86::PMULHWrr, {0, Unknown}},
-    {X86::PMULLDrm, {0, Unknown}},
-    {X86::PMULLDrr, {0, Unknown}},
-    {X86::PMULLWrm, {0, Unknown}},
-    {X86::PMULLWrr, {0, Unknown}},
+    {X86::PMULLDrm, {16, SSE_PACKED_OP}},
+    {X86::PMULLDrr, {0, SSE_PACKED_OP}},
+    {X86::PMULLWrm, {16, SSE_PACKED_OP}},
+    {X86::PMULLWrr, {0, SSE_PACKED_OP}},
     {X86::PMULUDQrm, {0, Unknown}},
     {X86::PMULUDQrr, {0, Unknown}},
     {X86::POP16r, {0, Unknown}},
@@ -2018,12 +2018,12 @@ static constexpr const_addl_instr_info::value_type MapData[] = {
     {X86::POP64rmr, {8, Unknown}},
     {X86::POPA16, {0, Unknown}},
     {X86::POPA32, {0, Unknown}},
-    {X86::POPCNT16rm, {2, Unknown}},
-    {X86::POPCNT16rr, {0, BINARY_OP_RR}},
-    {X86::POPCNT32rm, {4, Unknown}},
-    {X86::POPCNT32rr, {0, BINARY_OP_RR}},
-    {X86::POPCNT64rm, {8, Unknown}},
-    {X86::POPCNT64rr, {0, BINARY_OP_RR}},
+    {X86::POPCNT16rm, {2, BIT_MANIP_OP}},
+    {X86::POPCNT16rr, {0, BIT_MANIP_OP}},
+    {X86::POPCNT32rm, {4, BIT_MANIP_OP}},
+    {X86::POPCNT32rr, {0, BIT_MANIP_OP}},
+    {X86::POPCNT64rm, {8, BIT_MANIP_OP}},
+    {X86::POPCNT64rr, {0, BIT_MANIP_OP}},
     {X86::POPDS16, {0, Unknown}},
     {X86::POPDS32, {0, Unknown}},
     {X86::POPES16, {0, Unknown}},
@@ -2050,8 +2050,8 @@ static constexpr const_addl_instr_info::value_type MapData[] = {
     {X86::PREFETCHWT1, {0, Unknown}},
     {X86::PSADBWrm, {0, Unknown}},
     {X86::PSADBWrr, {0, Unknown}},
-    {X86::PSHUFBrm, {0, Unknown}},
-    {X86::PSHUFBrr, {0, Unknown}},
+    {X86::PSHUFBrm, {16, SSE_PACKED_OP}},
+    {X86::PSHUFBrr, {0, SSE_PACKED_OP}},
     {X86::PSHUFDmi, {16, BINARY_OP_RM}},
     {X86::PSHUFDri, {0, BINARY_OP_WITH_IMM}},
     {X86::PSHUFHWmi, {0, Unknown}},
@@ -2065,29 +2065,29 @@ static constexpr const_addl_instr_info::value_type MapData[] = {
     {X86::PSIGNWrm, {0, Unknown}},
     {X86::PSIGNWrr, {0, Unknown}},
     {X86::PSLLDQri, {0, Unknown}},
-    {X86::PSLLDri, {0, Unknown}},
+    {X86::PSLLDri, {0, SSE_PACKED_OP}},
     {X86::PSLLDrm, {0, Unknown}},
     {X86::PSLLDrr, {0, Unknown}},
-    {X86::PSLLQri, {0, Unknown}},
+    {X86::PSLLQri, {0, SSE_PACKED_OP}},
     {X86::PSLLQrm, {0, Unknown}},
     {X86::PSLLQrr, {0, Unknown}},
-    {X86::PSLLWri, {0, Unknown}},
+    {X86::PSLLWri, {0, SSE_PACKED_OP}},
     {X86::PSLLWrm, {0, Unknown}},
     {X86::PSLLWrr, {0, Unknown}},
-    {X86::PSRADri, {0, Unknown}},
+    {X86::PSRADri, {0, SSE_PACKED_OP}},
     {X86::PSRADrm, {0, Unknown}},
     {X86::PSRADrr, {0, Unknown}},
-    {X86::PSRAWri, {0, Unknown}},
+    {X86::PSRAWri, {0, SSE_PACKED_OP}},
     {X86::PSRAWrm, {0, Unknown}},
     {X86::PSRAWrr, {0, Unknown}},
     {X86::PSRLDQri, {0, Unknown}},
-    {X86::PSRLDri, {0, Unknown}},
+    {X86::PSRLDri, {0, SSE_PACKED_OP}},
     {X86::PSRLDrm, {0, Unknown}},
     {X86::PSRLDrr, {0, Unknown}},
-    {X86::PSRLQri, {0, Unknown}},
+    {X86::PSRLQri, {0, SSE_PACKED_OP}},
     {X86::PSRLQrm, {0, Unknown}},
     {X86::PSRLQrr, {0, Unknown}},
-    {X86::PSRLWri, {0, Unknown}},
+    {X86::PSRLWri, {0, SSE_PACKED_OP}},
     {X86::PSRLWrm, {0, Unknown}},
     {X86::PSRLWrr, {0, Unknown}},
     {X86::PSUBBrm, {16, BINARY_OP_RM}},
@@ -2100,10 +2100,10 @@ static constexpr const_addl_instr_info::value_type MapData[] = {
     {X86::PSUBSBrr, {0, BINARY_OP_RR}},
     {X86::PSUBSWrm, {16, BINARY_OP_RM}},
     {X86::PSUBSWrr, {0, BINARY_OP_RR}},
-    {X86::PSUBUSBrm, {0, Unknown}},
-    {X86::PSUBUSBrr, {0, Unknown}},
-    {X86::PSUBUSWrm, {0, Unknown}},
-    {X86::PSUBUSWrr, {0, Unknown}},
+    {X86::PSUBUSBrm, {16, SSE_PACKED_OP}},
+    {X86::PSUBUSBrr, {0, SSE_PACKED_OP}},
+    {X86::PSUBUSWrm, {16, SSE_PACKED_OP}},
+    {X86::PSUBUSWrr, {0, SSE_PACKED_OP}},
     {X86::PSUBWrm, {16, BINARY_OP_RM}},
     {X86::PSUBWrr, {0, BINARY_OP_RR}},
     {X86::PSWAPDrm, {0, Unknown}},
@@ -2114,22 +2114,22 @@ static constexpr const_addl_instr_info::value_type MapData[] = {
     {X86::PTWRITE64r, {0, Unknown}},
     {X86::PTWRITEm, {0, Unknown}},
     {X86::PTWRITEr, {0, Unknown}},
-    {X86::PUNPCKHBWrm, {0, Unknown}},
-    {X86::PUNPCKHBWrr, {0, Unknown}},
-    {X86::PUNPCKHDQrm, {0, Unknown}},
-    {X86::PUNPCKHDQrr, {0, Unknown}},
-    {X86::PUNPCKHQDQrm, {0, Unknown}},
-    {X86::PUNPCKHQDQrr, {0, Unknown}},
-    {X86::PUNPCKHWDrm, {0, Unknown}},
-    {X86::PUNPCKHWDrr, {0, Unknown}},
-    {X86::PUNPCKLBWrm, {0, Unknown}},
-    {X86::PUNPCKLBWrr, {0, Unknown}},
-    {X86::PUNPCKLDQrm, {0, Unknown}},
-    {X86::PUNPCKLDQrr, {0, Unknown}},
-    {X86::PUNPCKLQDQrm, {0, Unknown}},
-    {X86::PUNPCKLQDQrr, {0, Unknown}},
-    {X86::PUNPCKLWDrm, {0, Unknown}},
-    {X86::PUNPCKLWDrr, {0, Unknown}},
+    {X86::PUNPCKHBWrm, {16, SSE_PACKED_OP}},
+    {X86::PUNPCKHBWrr, {0, SSE_PACKED_OP}},
+    {X86::PUNPCKHDQrm, {16, SSE_PACKED_OP}},
+    {X86::PUNPCKHDQrr, {0, SSE_PACKED_OP}},
+    {X86::PUNPCKHQDQrm, {16, SSE_PACKED_OP}},
+    {X86::PUNPCKHQDQrr, {0, SSE_PACKED_OP}},
+    {X86::PUNPCKHWDrm, {16, SSE_PACKED_OP}},
+    {X86::PUNPCKHWDrr, {0, SSE_PACKED_OP}},
+    {X86::PUNPCKLBWrm, {16, SSE_PACKED_OP}},
+    {X86::PUNPCKLBWrr, {0, SSE_PACKED_OP}},
+    {X86::PUNPCKLDQrm, {16, SSE_PACKED_OP}},
+    {X86::PUNPCKLDQrr, {0, SSE_PACKED_OP}},
+    {X86::PUNPCKLQDQrm, {16, SSE_PACKED_OP}},
+    {X86::PUNPCKLQDQrr, {0, SSE_PACKED_OP}},
+    {X86::PUNPCKLWDrm, {16, SSE_PACKED_OP}},
+    {X86::PUNPCKLWDrr, {0, SSE_PACKED_OP}},
     {X86::PUSH16i8, {1, Unknown}},
     {X86::PUSH16r, {2, Unknown}},
     {X86::PUSH16rmm, {2, Unknown}},
@@ -2270,54 +2270,54 @@ static constexpr const_addl_instr_info::value_type MapData[] = {
     {X86::ROL16mCL, {0, Unknown}},
     {X86::ROL16mi, {2, Unknown}},
     {X86::ROL16r1, {0, BINARY_OP_WITH_IMM}},
-    {X86::ROL16rCL, {0, Unknown}},
+    {X86::ROL16rCL, {0, BIT_MANIP_OP}},
     {X86::ROL16ri, {0, BINARY_OP_WITH_IMM}},
     {X86::ROL32m1, {0, Unknown}},
     {X86::ROL32mCL, {0, Unknown}},
     {X86::ROL32mi, {4, Unknown}},
     {X86::ROL32r1, {0, BINARY_OP_WITH_IMM}},
-    {X86::ROL32rCL, {0, Unknown}},
+    {X86::ROL32rCL, {0, BIT_MANIP_OP}},
     {X86::ROL32ri, {0, BINARY_OP_WITH_IMM}},
     {X86::ROL64m1, {0, Unknown}},
     {X86::ROL64mCL, {0, Unknown}},
     {X86::ROL64mi, {8, Unknown}},
     {X86::ROL64r1, {0, BINARY_OP_WITH_IMM}},
-    {X86::ROL64rCL, {0, Unknown}},
+    {X86::ROL64rCL, {0, BIT_MANIP_OP}},
     {X86::ROL64ri, {0, BINARY_OP_WITH_IMM}},
     {X86::ROL8m1, {0, Unknown}},
     {X86::ROL8mCL, {0, Unknown}},
     {X86::ROL8mi, {1, Unknown}},
     {X86::ROL8r1, {0, BINARY_OP_WITH_IMM}},
-    {X86::ROL8rCL, {0, Unknown}},
+    {X86::ROL8rCL, {0, BIT_MANIP_OP}},
     {X86::ROL8ri, {0, BINARY_OP_WITH_IMM}},
     {X86::ROR16m1, {0, Unknown}},
     {X86::ROR16mCL, {0, Unknown}},
     {X86::ROR16mi, {2, Unknown}},
     {X86::ROR16r1, {0, BINARY_OP_WITH_IMM}},
-    {X86::ROR16rCL, {0, Unknown}},
+    {X86::ROR16rCL, {0, BIT_MANIP_OP}},
     {X86::ROR16ri, {0, BINARY_OP_WITH_IMM}},
     {X86::ROR32m1, {0, Unknown}},
     {X86::ROR32mCL, {0, Unknown}},
     {X86::ROR32mi, {4, Unknown}},
     {X86::ROR32r1, {0, BINARY_OP_WITH_IMM}},
-    {X86::ROR32rCL, {0, Unknown}},
+    {X86::ROR32rCL, {0, BIT_MANIP_OP}},
     {X86::ROR32ri, {0, BINARY_OP_WITH_IMM}},
     {X86::ROR64m1, {0, Unknown}},
     {X86::ROR64mCL, {0, Unknown}},
     {X86::ROR64mi, {8, Unknown}},
     {X86::ROR64r1, {0, BINARY_OP_WITH_IMM}},
-    {X86::ROR64rCL, {0, Unknown}},
+    {X86::ROR64rCL, {0, BIT_MANIP_OP}},
     {X86::ROR64ri, {0, BINARY_OP_WITH_IMM}},
     {X86::ROR8m1, {0, Unknown}},
     {X86::ROR8mCL, {0, Unknown}},
     {X86::ROR8mi, {1, Unknown}},
     {X86::ROR8r1, {0, BINARY_OP_WITH_IMM}},
-    {X86::ROR8rCL, {0, Unknown}},
+    {X86::ROR8rCL, {0, BIT_MANIP_OP}},
     {X86::ROR8ri, {0, BINARY_OP_WITH_IMM}},
-    {X86::RORX32mi, {4, Unknown}},
-    {X86::RORX32ri, {0, Unknown}},
-    {X86::RORX64mi, {8, Unknown}},
-    {X86::RORX64ri, {0, Unknown}},
+    {X86::RORX32mi, {4, BIT_MANIP_OP}},
+    {X86::RORX32ri, {0, BIT_MANIP_OP}},
+    {X86::RORX64mi, {8, BIT_MANIP_OP}},
+    {X86::RORX64ri, {0, BIT_MANIP_OP}},
     {X86::ROUNDPDm, {0, Unknown}},
     {X86::ROUNDPDr, {0, Unknown}},
     {X86::ROUNDPSm, {0, Unknown}},
@@ -2421,7 +2421,7 @@ static constexpr const_addl_instr_info::value_type MapData[] = {
     {X86::SEH_StackAlloc, {0, Unknown}},
     {X86::SETCCr, {0, SETCC}},
     {X86::SETCCm, {1, SETCC}},
-    {X86::SFENCE, {0, Unknown}},
+    {X86::SFENCE, {0, FENCE}},
     {X86::SGDT16m, {0, Unknown}},
     {X86::SGDT32m, {0, Unknown}},
     {X86::SGDT64m, {0, Unknown}},
@@ -2519,10 +2519,10 @@ static constexpr const_addl_instr_info::value_type MapData[] = {
     {X86::SHRX32rr, {0, Unknown}},
     {X86::SHRX64rm, {8, Unknown}},
     {X86::SHRX64rr, {0, Unknown}},
-    {X86::SHUFPDrmi, {0, Unknown}},
-    {X86::SHUFPDrri, {0, Unknown}},
-    {X86::SHUFPSrmi, {0, Unknown}},
-    {X86::SHUFPSrri, {0, Unknown}},
+    {X86::SHUFPDrmi, {16, SSE_PACKED_OP}},
+    {X86::SHUFPDrri, {0, SSE_PACKED_OP}},
+    {X86::SHUFPSrmi, {16, SSE_PACKED_OP}},
+    {X86::SHUFPSrri, {0, SSE_PACKED_OP}},
     {X86::SIDT16m, {0, Unknown}},
     {X86::SIDT32m, {0, Unknown}},
     {X86::SIDT64m, {0, Unknown}},
@@ -2536,10 +2536,10 @@ static constexpr const_addl_instr_info::value_type MapData[] = {
     {X86::SMSW16r, {0, Unknown}},
     {X86::SMSW32r, {0, Unknown}},
     {X86::SMSW64r, {0, Unknown}},
-    {X86::SQRTPDm, {0, Unknown}},
-    {X86::SQRTPDr, {0, Unknown}},
-    {X86::SQRTPSm, {0, Unknown}},
-    {X86::SQRTPSr, {0, Unknown}},
+    {X86::SQRTPDm, {16, SSE_PACKED_OP}},
+    {X86::SQRTPDr, {0, SSE_PACKED_OP}},
+    {X86::SQRTPSm, {16, SSE_PACKED_OP}},
+    {X86::SQRTPSr, {0, SSE_PACKED_OP}},
     {X86::SQRTSDm, {8, BINARY_OP_RM}},
     {X86::SQRTSDm_Int, {8, BINARY_OP_RM}},
     {X86::SQRTSDr, {0, BINARY_OP_RR}},
@@ -2548,7 +2548,7 @@ static constexpr const_addl_instr_info::value_type MapData[] = {
     {X86::SQRTSSm_Int, {4, BINARY_OP_RM}},
     {X86::SQRTSSr, {0, BINARY_OP_RR}},
     {X86::SQRTSSr_Int, {0, BINARY_OP_RR}},
-    {X86::SQRT_F, {0, Unknown}},
+    {X86::SQRT_F, {0, FPU_REG_OP}},
     {X86::SQRT_Fp32, {0, Unknown}},
     {X86::SQRT_Fp64, {0, Unknown}},
     {X86::SQRT_Fp80, {0, Unknown}},
@@ -2561,20 +2561,20 @@ static constexpr const_addl_instr_info::value_type MapData[] = {
     {X86::STGI, {0, Unknown}},
     {X86::STI, {0, Unknown}},
     {X86::STMXCSR, {0, Unknown}},
-    {X86::STOSB, {0, Unknown}},
-    {X86::STOSL, {0, Unknown}},
-    {X86::STOSQ, {0, Unknown}},
-    {X86::STOSW, {0, Unknown}},
+    {X86::STOSB, {1, STRING_OP}},
+    {X86::STOSL, {4, STRING_OP}},
+    {X86::STOSQ, {8, STRING_OP}},
+    {X86::STOSW, {2, STRING_OP}},
     {X86::STR16r, {0, Unknown}},
     {X86::STR32r, {0, Unknown}},
     {X86::STR64r, {0, Unknown}},
     {X86::STRm, {0, Unknown}},
-    {X86::ST_F32m, {0, Unknown}},
-    {X86::ST_F64m, {0, Unknown}},
+    {X86::ST_F32m, {4, STORE_FPU_REG}},
+    {X86::ST_F64m, {8, STORE_FPU_REG}},
     {X86::ST_FP32m, {4, STORE_FPU_REG}},
     {X86::ST_FP64m, {8, STORE_FPU_REG}},
-    {X86::ST_FP80m, {0, Unknown}},
-    {X86::ST_FPrr, {0, Unknown}},
+    {X86::ST_FP80m, {10, STORE_FPU_REG}},
+    {X86::ST_FPrr, {0, FPU_REG_OP}},
     {X86::ST_Fp32m, {0, Unknown}},
     {X86::ST_Fp64m, {0, Unknown}},
     {X86::ST_Fp64m32, {0, Unknown}},
@@ -2586,7 +2586,7 @@ static constexpr const_addl_instr_info::value_type MapData[] = {
     {X86::ST_FpP80m, {0, Unknown}},
     {X86::ST_FpP80m32, {0, Unknown}},
     {X86::ST_FpP80m64, {0, Unknown}},
-    {X86::ST_Frr, {0, Unknown}},
+    {X86::ST_Frr, {0, FPU_REG_OP}},
     {X86::SUB16i16, {0, Unknown}},
     {X86::SUB16mi, {2, COMPARE}},
     {X86::SUB16mi8, {2, COMPARE}},
@@ -2628,12 +2628,12 @@ static constexpr const_addl_instr_info::value_type MapData[] = {
     {X86::SUBPSrm, {16, BINARY_OP_RM}},
     {X86::SUBPSrr, {0, BINARY_OP_RR}},
     {X86::SUBREG_TO_REG, {0, Unknown}},
-    {X86::SUBR_F32m, {0, Unknown}},
-    {X86::SUBR_F64m, {0, Unknown}},
-    {X86::SUBR_FI16m, {0, Unknown}},
-    {X86::SUBR_FI32m, {0, Unknown}},
-    {X86::SUBR_FPrST0, {0, Unknown}},
-    {X86::SUBR_FST0r, {0, Unknown}},
+    {X86::SUBR_F32m, {4, LOAD_FPU_REG}},
+    {X86::SUBR_F64m, {8, LOAD_FPU_REG}},
+    {X86::SUBR_FI16m, {2, LOAD_FPU_REG}},
+    {X86::SUBR_FI32m, {4, LOAD_FPU_REG}},
+    {X86::SUBR_FPrST0, {0, FPU_REG_OP}},
+    {X86::SUBR_FST0r, {0, FPU_REG_OP}},
     {X86::SUBR_Fp32m, {0, Unknown}},
     {X86::SUBR_Fp64m, {0, Unknown}},
     {X86::SUBR_Fp64m32, {0, Unknown}},
@@ -2645,7 +2645,7 @@ static constexpr const_addl_instr_info::value_type MapData[] = {
     {X86::SUBR_FpI32m32, {0, Unknown}},
     {X86::SUBR_FpI32m64, {0, Unknown}},
     {X86::SUBR_FpI32m80, {0, Unknown}},
-    {X86::SUBR_FrST0, {0, Unknown}},
+    {X86::SUBR_FrST0, {0, FPU_REG_OP}},
     {X86::SUBSDrm, {0, Unknown}},
     {X86::SUBSDrm_Int, {8, BINARY_OP_RM}},
     {X86::SUBSDrr, {0, Unknown}},
@@ -2654,12 +2654,12 @@ static constexpr const_addl_instr_info::value_type MapData[] = {
     {X86::SUBSSrm_Int, {4, BINARY_OP_RM}},
     {X86::SUBSSrr, {0, Unknown}},
     {X86::SUBSSrr_Int, {0, BINARY_OP_RR}},
-    {X86::SUB_F32m, {0, Unknown}},
-    {X86::SUB_F64m, {0, Unknown}},
-    {X86::SUB_FI16m, {0, Unknown}},
-    {X86::SUB_FI32m, {0, Unknown}},
-    {X86::SUB_FPrST0, {0, Unknown}},
-    {X86::SUB_FST0r, {0, Unknown}},
+    {X86::SUB_F32m, {4, LOAD_FPU_REG}},
+    {X86::SUB_F64m, {8, LOAD_FPU_REG}},
+    {X86::SUB_FI16m, {2, LOAD_FPU_REG}},
+    {X86::SUB_FI32m, {4, LOAD_FPU_REG}},
+    {X86::SUB_FPrST0, {0, FPU_REG_OP}},
+    {X86::SUB_FST0r, {0, FPU_REG_OP}},
     {X86::SUB_Fp32, {0, Unknown}},
     {X86::SUB_Fp32m, {0, Unknown}},
     {X86::SUB_Fp64, {0, Unknown}},
@@ -2674,7 +2674,7 @@ static constexpr const_addl_instr_info::value_type MapData[] = {
     {X86::SUB_FpI32m32, {0, Unknown}},
     {X86::SUB_FpI32m64, {0, Unknown}},
     {X86::SUB_FpI32m80, {0, Unknown}},
-    {X86::SUB_FrST0, {0, Unknown}},
+    {X86::SUB_FrST0, {0, FPU_REG_OP}},
     {X86::SWAPGS, {0, Unknown}},
     {X86::SYSCALL, {0, Unknown}},
     {X86::SYSENTER, {0, Unknown}},
@@ -2735,12 +2735,12 @@ static constexpr const_addl_instr_info::value_type MapData[] = {
     {X86::TST_Fp32, {0, Unknown}},
     {X86::TST_Fp64, {0, Unknown}},
     {X86::TST_Fp80, {0, Unknown}},
-    {X86::TZCNT16rm, {2, Unknown}},
-    {X86::TZCNT16rr, {0, Unknown}},
-    {X86::TZCNT32rm, {4, Unknown}},
-    {X86::TZCNT32rr, {0, Unknown}},
-    {X86::TZCNT64rm, {8, Unknown}},
-    {X86::TZCNT64rr, {0, Unknown}},
+    {X86::TZCNT16rm, {2, BIT_MANIP_OP}},
+    {X86::TZCNT16rr, {0, BIT_MANIP_OP}},
+    {X86::TZCNT32rm, {4, BIT_MANIP_OP}},
+    {X86::TZCNT32rr, {0, BIT_MANIP_OP}},
+    {X86::TZCNT64rm, {8, BIT_MANIP_OP}},
+    {X86::TZCNT64rr, {0, BIT_MANIP_OP}},
     {X86::TZMSK32rm, {4, Unknown}},
     {X86::TZMSK32rr, {0, Unknown}},
     {X86::TZMSK64rm, {8, Unknown}},
@@ -2753,8 +2753,8 @@ static constexpr const_addl_instr_info::value_type MapData[] = {
     {X86::UCOMISSrm_Int, {0, Unknown}},
     {X86::UCOMISSrr, {0, SSE_COMPARE_RR}},
     {X86::UCOMISSrr_Int, {0, Unknown}},
-    {X86::UCOM_FIPr, {0, Unknown}},
-    {X86::UCOM_FIr, {0, Unknown}},
+    {X86::UCOM_FIPr, {0, FPU_REG_OP}},
+    {X86::UCOM_FIr, {0, FPU_REG_OP}},
     {X86::UCOM_FPPr, {0, Unknown}},
     {X86::UCOM_FPr, {0, Unknown}},
     {X86::UCOM_FpIr32, {0, Unknown}},
@@ -2764,17 +2764,17 @@ static constexpr const_addl_instr_info::value_type MapData[] = {
     {X86::UCOM_Fpr64, {0, Unknown}},
     {X86::UCOM_Fpr80, {0, Unknown}},
     {X86::UCOM_Fr, {0, Unknown}},
-    {X86::UNPCKHPDrm, {0, Unknown}},
-    {X86::UNPCKHPDrr, {0, Unknown}},
-    {X86::UNPCKHPSrm, {0, Unknown}},
-    {X86::UNPCKHPSrr, {0, Unknown}},
+    {X86::UNPCKHPDrm, {16, SSE_PACKED_OP}},
+    {X86::UNPCKHPDrr, {0, SSE_PACKED_OP}},
+    {X86::UNPCKHPSrm, {16, SSE_PACKED_OP}},
+    {X86::UNPCKHPSrr, {0, SSE_PACKED_OP}},
     {X86::UNPCKLPDrm, {16, BINARY_OP_RM}},
     {X86::UNPCKLPDrr, {0, BINARY_OP_RR}},
     {X86::UNPCKLPSrm, {16, BINARY_OP_RM}},
     {X86::UNPCKLPSrr, {0, BINARY_OP_RR}},
     {X86::VAARG_64, {0, Unknown}},
-    {X86::VADDPDYrm, {0, Unknown}},
-    {X86::VADDPDYrr, {0, Unknown}},
+    {X86::VADDPDYrm, {32, SSE_PACKED_OP}},
+    {X86::VADDPDYrr, {0, SSE_PACKED_OP}},
     {X86::VADDPDZ128rm, {1, Unknown}},
     {X86::VADDPDZ128rmb, {1, Unknown}},
     {X86::VADDPDZ128rmbk, {1, Unknown}},
@@ -2805,10 +2805,10 @@ static constexpr const_addl_instr_info::value_type MapData[] = {
     {X86::VADDPDZrrbkz, {0, Unknown}},
     {X86::VADDPDZrrk, {0, Unknown}},
     {X86::VADDPDZrrkz, {0, Unknown}},
-    {X86::VADDPDrm, {0, Unknown}},
-    {X86::VADDPDrr, {0, Unknown}},
-    {X86::VADDPSYrm, {0, Unknown}},
-    {X86::VADDPSYrr, {0, Unknown}},
+    {X86::VADDPDrm, {16, SSE_PACKED_OP}},
+    {X86::VADDPDrr, {0, SSE_PACKED_OP}},
+    {X86::VADDPSYrm, {32, SSE_PACKED_OP}},
+    {X86::VADDPSYrr, {0, SSE_PACKED_OP}},
     {X86::VADDPSZ128rm, {1, Unknown}},
     {X86::VADDPSZ128rmb, {1, Unknown}},
     {X86::VADDPSZ128rmbk, {1, Unknown}},
@@ -2839,8 +2839,8 @@ static constexpr const_addl_instr_info::value_type MapData[] = {
     {X86::VADDPSZrrbkz, {0, Unknown}},
     {X86::VADDPSZrrk, {0, Unknown}},
     {X86::VADDPSZrrkz, {0, Unknown}},
-    {X86::VADDPSrm, {0, Unknown}},
-    {X86::VADDPSrr, {0, Unknown}},
+    {X86::VADDPSrm, {16, SSE_PACKED_OP}},
+    {X86::VADDPSrr, {0, SSE_PACKED_OP}},
     {X86::VADDSDZrm, {0, Unknown}},
     {X86::VADDSDZrm_Int, {0, Unknown}},
     {X86::VADDSDZrm_Intk, {0, Unknown}},
@@ -2977,8 +2977,8 @@ static constexpr const_addl_instr_info::value_type MapData[] = {
     {X86::VALIGNQZrri, {0, Unknown}},
     {X86::VALIGNQZrrik, {0, Unknown}},
     {X86::VALIGNQZrrikz, {0, Unknown}},
-    {X86::VANDNPDYrm, {0, Unknown}},
-    {X86::VANDNPDYrr, {0, Unknown}},
+    {X86::VANDNPDYrm, {32, SSE_PACKED_OP}},
+    {X86::VANDNPDYrr, {0, SSE_PACKED_OP}},
     {X86::VANDNPDZ128rm, {1, Unknown}},
     {X86::VANDNPDZ128rmb, {1, Unknown}},
     {X86::VANDNPDZ128rmbk, {1, Unknown}},
@@ -3006,10 +3006,10 @@ static constexpr const_addl_instr_info::value_type MapData[] = {
     {X86::VANDNPDZrr, {0, Unknown}},
     {X86::VANDNPDZrrk, {0, Unknown}},
     {X86::VANDNPDZrrkz, {0, Unknown}},
-    {X86::VANDNPDrm, {0, Unknown}},
-    {X86::VANDNPDrr, {0, Unknown}},
-    {X86::VANDNPSYrm, {0, Unknown}},
-    {X86::VANDNPSYrr, {0, Unknown}},
+    {X86::VANDNPDrm, {16, SSE_PACKED_OP}},
+    {X86::VANDNPDrr, {0, SSE_PACKED_OP}},
+    {X86::VANDNPSYrm, {32, SSE_PACKED_OP}},
+    {X86::VANDNPSYrr, {0, SSE_PACKED_OP}},
     {X86::VANDNPSZ128rm, {1, Unknown}},
     {X86::VANDNPSZ128rmb, {1, Unknown}},
     {X86::VANDNPSZ128rmbk, {1, Unknown}},
@@ -3037,10 +3037,10 @@ static constexpr const_addl_instr_info::value_type MapData[] = {
     {X86::VANDNPSZrr, {0, Unknown}},
     {X86::VANDNPSZrrk, {0, Unknown}},
     {X86::VANDNPSZrrkz, {0, Unknown}},
-    {X86::VANDNPSrm, {0, Unknown}},
-    {X86::VANDNPSrr, {0, Unknown}},
-    {X86::VANDPDYrm, {0, Unknown}},
-    {X86::VANDPDYrr, {0, Unknown}},
+    {X86::VANDNPSrm, {16, SSE_PACKED_OP}},
+    {X86::VANDNPSrr, {0, SSE_PACKED_OP}},
+    {X86::VANDPDYrm, {32, SSE_PACKED_OP}},
+    {X86::VANDPDYrr, {0, SSE_PACKED_OP}},
     {X86::VANDPDZ128rm, {1, Unknown}},
     {X86::VANDPDZ128rmb, {1, Unknown}},
     {X86::VANDPDZ128rmbk, {1, Unknown}},
@@ -3068,10 +3068,10 @@ static constexpr const_addl_instr_info::value_type MapData[] = {
     {X86::VANDPDZrr, {0, Unknown}},
     {X86::VANDPDZrrk, {0, Unknown}},
     {X86::VANDPDZrrkz, {0, Unknown}},
-    {X86::VANDPDrm, {0, Unknown}},
-    {X86::VANDPDrr, {0, Unknown}},
-    {X86::VANDPSYrm, {0, Unknown}},
-    {X86::VANDPSYrr, {0, Unknown}},
+    {X86::VANDPDrm, {16, SSE_PACKED_OP}},
+    {X86::VANDPDrr, {0, SSE_PACKED_OP}},
+    {X86::VANDPSYrm, {32, SSE_PACKED_OP}},
+    {X86::VANDPSYrr, {0, SSE_PACKED_OP}},
     {X86::VANDPSZ128rm, {1, Unknown}},
     {X86::VANDPSZ128rmb, {1, Unknown}},
     {X86::VANDPSZ128rmbk, {1, Unknown}},
@@ -3099,8 +3099,8 @@ static constexpr const_addl_instr_info::value_type MapData[] = {
     {X86::VANDPSZrr, {0, Unknown}},
     {X86::VANDPSZrrk, {0, Unknown}},
     {X86::VANDPSZrrkz, {0, Unknown}},
-    {X86::VANDPSrm, {0, Unknown}},
-    {X86::VANDPSrr, {0, Unknown}},
+    {X86::VANDPSrm, {16, SSE_PACKED_OP}},
+    {X86::VANDPSrr, {0, SSE_PACKED_OP}},
     {X86::VASTART_SAVE_XMM_REGS, {0, Unknown}},
     {X86::VBLENDMPDZ128rm, {1, Unknown}},
     {X86::VBLENDMPDZ128rmb, {1, Unknown}},
@@ -3207,14 +3207,14 @@ static constexpr const_addl_instr_info::value_type MapData[] = {
     {X86::VBROADCASTI64X4rm, {0, Unknown}},
     {X86::VBROADCASTI64X4rmk, {0, Unknown}},
     {X86::VBROADCASTI64X4rmkz, {0, Unknown}},
-    {X86::VBROADCASTSDYrm, {0, Unknown}},
-    {X86::VBROADCASTSDYrr, {0, Unknown}},
-    {X86::VBROADCASTSSYrm, {0, Unknown}},
-    {X86::VBROADCASTSSYrr, {0, Unknown}},
-    {X86::VBROADCASTSSrm, {0, Unknown}},
-    {X86::VBROADCASTSSrr, {0, Unknown}},
-    {X86::VCMPPDYrmi, {0, Unknown}},
-    {X86::VCMPPDYrri, {0, Unknown}},
+    {X86::VBROADCASTSDYrm, {8, SSE_PACKED_OP}},
+    {X86::VBROADCASTSDYrr, {0, SSE_PACKED_OP}},
+    {X86::VBROADCASTSSYrm, {4, SSE_PACKED_OP}},
+    {X86::VBROADCASTSSYrr, {0, SSE_PACKED_OP}},
+    {X86::VBROADCASTSSrm, {4, SSE_PACKED_OP}},
+    {X86::VBROADCASTSSrr, {0, SSE_PACKED_OP}},
+    {X86::VCMPPDYrmi, {32, SSE_PACKED_OP}},
+    {X86::VCMPPDYrri, {0, SSE_PACKED_OP}},
     {X86::VCMPPDZ128rmbi, {1, Unknown}},
     {X86::VCMPPDZ128rmbik, {1, Unknown}},
     {X86::VCMPPDZ128rmi, {1, Unknown}},
@@ -3235,10 +3235,10 @@ static constexpr const_addl_instr_info::value_type MapData[] = {
     {X86::VCMPPDZrrib, {0, Unknown}},
     {X86::VCMPPDZrribk, {0, Unknown}},
     {X86::VCMPPDZrrik, {0, Unknown}},
-    {X86::VCMPPDrmi, {0, Unknown}},
-    {X86::VCMPPDrri, {0, Unknown}},
-    {X86::VCMPPSYrmi, {0, Unknown}},
-    {X86::VCMPPSYrri, {0, Unknown}},
+    {X86::VCMPPDrmi, {16, SSE_PACKED_OP}},
+    {X86::VCMPPDrri, {0, SSE_PACKED_OP}},
+    {X86::VCMPPSYrmi, {32, SSE_PACKED_OP}},
+    {X86::VCMPPSYrri, {0, SSE_PACKED_OP}},
     {X86::VCMPPSZ128rmbi, {1, Unknown}},
     {X86::VCMPPSZ128rmbik, {1, Unknown}},
     {X86::VCMPPSZ128rmi, {1, Unknown}},
@@ -3259,8 +3259,8 @@ static constexpr const_addl_instr_info::value_type MapData[] = {
     {X86::VCMPPSZrrib, {0, Unknown}},
     {X86::VCMPPSZrribk, {0, Unknown}},
     {X86::VCMPPSZrrik, {0, Unknown}},
-    {X86::VCMPPSrmi, {0, Unknown}},
-    {X86::VCMPPSrri, {0, Unknown}},
+    {X86::VCMPPSrmi, {16, SSE_PACKED_OP}},
+    {X86::VCMPPSrri, {0, SSE_PACKED_OP}},
     {X86::VCMPSDZrm, {0, Unknown}},
     {X86::VCMPSDZrm_Int, {0, Unknown}},
     {X86::VCMPSDZrm_Intk, {0, Unknown}},
@@ -4376,8 +4376,8 @@ static constexpr const_addl_instr_info::value_type MapData[] = {
     {X86::VDBPSADBWZrri, {0, Unknown}},
     {X86::VDBPSADBWZrrik, {0, Unknown}},
     {X86::VDBPSADBWZrrikz, {0, Unknown}},
-    {X86::VDIVPDYrm, {0, Unknown}},
-    {X86::VDIVPDYrr, {0, Unknown}},
+    {X86::VDIVPDYrm, {32, SSE_PACKED_OP}},
+    {X86::VDIVPDYrr, {0, SSE_PACKED_OP}},
     {X86::VDIVPDZ128rm, {1, Unknown}},
     {X86::VDIVPDZ128rmb, {1, Unknown}},
     {X86::VDIVPDZ128rmbk, {1, Unknown}},
@@ -4408,10 +4408,10 @@ static constexpr const_addl_instr_info::value_type MapData[] = {
     {X86::VDIVPDZrrbkz, {0, Unknown}},
     {X86::VDIVPDZrrk, {0, Unknown}},
     {X86::VDIVPDZrrkz, {0, Unknown}},
-    {X86::VDIVPDrm, {0, Unknown}},
-    {X86::VDIVPDrr, {0, Unknown}},
-    {X86::VDIVPSYrm, {0, Unknown}},
-    {X86::VDIVPSYrr, {0, Unknown}},
+    {X86::VDIVPDrm, {16, SSE_PACKED_OP}},
+    {X86::VDIVPDrr, {0, SSE_PACKED_OP}},
+    {X86::VDIVPSYrm, {32, SSE_PACKED_OP}},
+    {X86::VDIVPSYrr, {0, SSE_PACKED_OP}},
     {X86::VDIVPSZ128rm, {1, Unknown}},
     {X86::VDIVPSZ128rmb, {1, Unknown}},
     {X86::VDIVPSZ128rmbk, {1, Unknown}},
@@ -4442,8 +4442,8 @@ static constexpr const_addl_instr_info::value_type MapData[] = {
     {X86::VDIVPSZrrbkz, {0, Unknown}},
     {X86::VDIVPSZrrk, {0, Unknown}},
     {X86::VDIVPSZrrkz, {0, Unknown}},
-    {X86::VDIVPSrm, {0, Unknown}},
-    {X86::VDIVPSrr, {0, Unknown}},
+    {X86::VDIVPSrm, {16, SSE_PACKED_OP}},
+    {X86::VDIVPSrr, {0, SSE_PACKED_OP}},
     {X86::VDIVSDZrm, {0, Unknown}},
     {X86::VDIVSDZrm_Int, {0, Unknown}},
     {X86::VDIVSDZrm_Intk, {0, Unknown}},
@@ -4521,7 +4521,7 @@ static constexpr const_addl_instr_info::value_type MapData[] = {
     {X86::VEXPANDPSZrrk, {0, Unknown}},
     {X86::VEXPANDPSZrrkz, {0, Unknown}},
     {X86::VEXTRACTF128mr, {1, Unknown}},
-    {X86::VEXTRACTF128rr, {0, Unknown}},
+    {X86::VEXTRACTF128rr, {0, SSE_PACKED_OP}},
     {X86::VEXTRACTF32x4Z256mr, {0, Unknown}},
     {X86::VEXTRACTF32x4Z256mrk, {0, Unknown}},
     {X86::VEXTRACTF32x4Z256rr, {0, Unknown}},
@@ -4553,7 +4553,7 @@ static constexpr const_addl_instr_info::value_type MapData[] = {
     {X86::VEXTRACTF64x4Zrrk, {0, Unknown}},
     {X86::VEXTRACTF64x4Zrrkz, {0, Unknown}},
     {X86::VEXTRACTI128mr, {1, Unknown}},
-    {X86::VEXTRACTI128rr, {0, Unknown}},
+    {X86::VEXTRACTI128rr, {0, SSE_PACKED_OP}},
     {X86::VEXTRACTI32x4Z256mr, {0, Unknown}},
     {X86::VEXTRACTI32x4Z256mrk, {0, Unknown}},
     {X86::VEXTRACTI32x4Z256rr, {0, Unknown}},
@@ -6508,8 +6508,8 @@ static constexpr const_addl_instr_info::value_type MapData[] = {
     {X86::VHSUBPSYrr, {0, Unknown}},
     {X86::VHSUBPSrm, {0, Unknown}},
     {X86::VHSUBPSrr, {0, Unknown}},
-    {X86::VINSERTF128rm, {1, Unknown}},
-    {X86::VINSERTF128rr, {0, Unknown}},
+    {X86::VINSERTF128rm, {16, SSE_PACKED_OP}},
+    {X86::VINSERTF128rr, {0, SSE_PACKED_OP}},
     {X86::VINSERTF32x4Z256rm, {0, Unknown}},
     {X86::VINSERTF32x4Z256rmk, {0, Unknown}},
     {X86::VINSERTF32x4Z256rmkz, {0, Unknown}},
@@ -6546,8 +6546,8 @@ static constexpr const_addl_instr_info::value_type MapData[] = {
     {X86::VINSERTF64x4Zrr, {0, Unknown}},
     {X86::VINSERTF64x4Zrrk, {0, Unknown}},
     {X86::VINSERTF64x4Zrrkz, {0, Unknown}},
-    {X86::VINSERTI128rm, {1, Unknown}},
-    {X86::VINSERTI128rr, {0, Unknown}},
+    {X86::VINSERTI128rm, {16, SSE_PACKED_OP}},
+    {X86::VINSERTI128rr, {0, SSE_PACKED_OP}},
     {X86::VINSERTI32x4Z256rm, {0, Unknown}},
     {X86::VINSERTI32x4Z256rmk, {0, Unknown}},
     {X86::VINSERTI32x4Z256rmkz, {0, Unknown}},
@@ -6671,8 +6671,8 @@ static constexpr const_addl_instr_info::value_type MapData[] = {
     {X86::VMAXCSSZrr, {0, Unknown}},
     {X86::VMAXCSSrm, {0, Unknown}},
     {X86::VMAXCSSrr, {0, Unknown}},
-    {X86::VMAXPDYrm, {0, Unknown}},
-    {X86::VMAXPDYrr, {0, Unknown}},
+    {X86::VMAXPDYrm, {32, SSE_PACKED_OP}},
+    {X86::VMAXPDYrr, {0, SSE_PACKED_OP}},
     {X86::VMAXPDZ128rm, {1, Unknown}},
     {X86::VMAXPDZ128rmb, {1, Unknown}},
     {X86::VMAXPDZ128rmbk, {1, Unknown}},
@@ -6703,10 +6703,10 @@ static constexpr const_addl_instr_info::value_type MapData[] = {
     {X86::VMAXPDZrrbkz, {0, Unknown}},
     {X86::VMAXPDZrrk, {0, Unknown}},
     {X86::VMAXPDZrrkz, {0, Unknown}},
-    {X86::VMAXPDrm, {0, Unknown}},
-    {X86::VMAXPDrr, {0, Unknown}},
-    {X86::VMAXPSYrm, {0, Unknown}},
-    {X86::VMAXPSYrr, {0, Unknown}},
+    {X86::VMAXPDrm, {16, SSE_PACKED_OP}},
+    {X86::VMAXPDrr, {0, SSE_PACKED_OP}},
+    {X86::VMAXPSYrm, {32, SSE_PACKED_OP}},
+    {X86::VMAXPSYrr, {0, SSE_PACKED_OP}},
     {X86::VMAXPSZ128rm, {1, Unknown}},
     {X86::VMAXPSZ128rmb, {1, Unknown}},
     {X86::VMAXPSZ128rmbk, {1, Unknown}},
@@ -6737,8 +6737,8 @@ static constexpr const_addl_instr_info::value_type MapData[] = {
     {X86::VMAXPSZrrbkz, {0, Unknown}},
     {X86::VMAXPSZrrk, {0, Unknown}},
     {X86::VMAXPSZrrkz, {0, Unknown}},
-    {X86::VMAXPSrm, {0, Unknown}},
-    {X86::VMAXPSrr, {0, Unknown}},
+    {X86::VMAXPSrm, {16, SSE_PACKED_OP}},
+    {X86::VMAXPSrr, {0, SSE_PACKED_OP}},
     {X86::VMAXSDZrm, {0, Unknown}},
     {X86::VMAXSDZrm_Int, {0, Unknown}},
     {X86::VMAXSDZrm_Intk, {0, Unknown}},
@@ -6842,8 +6842,8 @@ static constexpr const_addl_instr_info::value_type MapData[] = {
     {X86::VMINCSSZrr, {0, Unknown}},
     {X86::VMINCSSrm, {0, Unknown}},
     {X86::VMINCSSrr, {0, Unknown}},
-    {X86::VMINPDYrm, {0, Unknown}},
-    {X86::VMINPDYrr, {0, Unknown}},
+    {X86::VMINPDYrm, {32, SSE_PACKED_OP}},
+    {X86::VMINPDYrr, {0, SSE_PACKED_OP}},
     {X86::VMINPDZ128rm, {1, Unknown}},
     {X86::VMINPDZ128rmb, {1, Unknown}},
     {X86::VMINPDZ128rmbk, {1, Unknown}},
@@ -6874,10 +6874,10 @@ static constexpr const_addl_instr_info::value_type MapData[] = {
     {X86::VMINPDZrrbkz, {0, Unknown}},
     {X86::VMINPDZrrk, {0, Unknown}},
     {X86::VMINPDZrrkz, {0, Unknown}},
-    {X86::VMINPDrm, {0, Unknown}},
-    {X86::VMINPDrr, {0, Unknown}},
-    {X86::VMINPSYrm, {0, Unknown}},
-    {X86::VMINPSYrr, {0, Unknown}},
+    {X86::VMINPDrm, {16, SSE_PACKED_OP}},
+    {X86::VMINPDrr, {0, SSE_PACKED_OP}},
+    {X86::VMINPSYrm, {32, SSE_PACKED_OP}},
+    {X86::VMINPSYrr, {0, SSE_PACKED_OP}},
     {X86::VMINPSZ128rm, {1, Unknown}},
     {X86::VMINPSZ128rmb, {1, Unknown}},
     {X86::VMINPSZ128rmbk, {1, Unknown}},
@@ -6908,8 +6908,8 @@ static constexpr const_addl_instr_info::value_type MapData[] = {
     {X86::VMINPSZrrbkz, {0, Unknown}},
     {X86::VMINPSZrrk, {0, Unknown}},
     {X86::VMINPSZrrkz, {0, Unknown}},
-    {X86::VMINPSrm, {0, Unknown}},
-    {X86::VMINPSrr, {0, Unknown}},
+    {X86::VMINPSrm, {16, SSE_PACKED_OP}},
+    {X86::VMINPSrr, {0, SSE_PACKED_OP}},
     {X86::VMINSDZrm, {0, Unknown}},
     {X86::VMINSDZrm_Int, {0, Unknown}},
     {X86::VMINSDZrm_Intk, {0, Unknown}},
@@ -6947,13 +6947,13 @@ static constexpr const_addl_instr_info::value_type MapData[] = {
     {X86::VMOV64toPQIZrm, {0, Unknown}},
     {X86::VMOV64toPQIZrr, {0, Unknown}},
     {X86::VMOV64toPQIrm, {0, Unknown}},
-    {X86::VMOV64toPQIrr, {0, Unknown}},
+    {X86::VMOV64toPQIrr, {0, SSE_MOV_RR}},
     {X86::VMOV64toSDZrr, {0, Unknown}},
     {X86::VMOV64toSDrr, {0, Unknown}},
-    {X86::VMOVAPDYmr, {0, Unknown}},
-    {X86::VMOVAPDYrm, {0, Unknown}},
-    {X86::VMOVAPDYrr, {0, Unknown}},
-    {X86::VMOVAPDYrr_REV, {0, Unknown}},
+    {X86::VMOVAPDYmr, {32, SSE_PACKED_OP}},
+    {X86::VMOVAPDYrm, {32, SSE_PACKED_OP}},
+    {X86::VMOVAPDYrr, {0, SSE_PACKED_OP}},
+    {X86::VMOVAPDYrr_REV, {0, SSE_PACKED_OP}},
     {X86::VMOVAPDZ128mr, {1, Unknown}},
     {X86::VMOVAPDZ128mrk, {1, Unknown}},
     {X86::VMOVAPDZ128rm, {1, Unknown}},
@@ -6987,14 +6987,14 @@ static constexpr const_addl_instr_info::value_type MapData[] = {
     {X86::VMOVAPDZrrk_REV, {0, Unknown}},
     {X86::VMOVAPDZrrkz, {0, Unknown}},
     {X86::VMOVAPDZrrkz_REV, {0, Unknown}},
-    {X86::VMOVAPDmr, {0, Unknown}},
-    {X86::VMOVAPDrm, {0, Unknown}},
-    {X86::VMOVAPDrr, {0, Unknown}},
-    {X86::VMOVAPDrr_REV, {0, Unknown}},
-    {X86::VMOVAPSYmr, {0, Unknown}},
-    {X86::VMOVAPSYrm, {0, Unknown}},
-    {X86::VMOVAPSYrr, {0, Unknown}},
-    {X86::VMOVAPSYrr_REV, {0, Unknown}},
+    {X86::VMOVAPDmr, {16, SSE_PACKED_OP}},
+    {X86::VMOVAPDrm, {16, SSE_PACKED_OP}},
+    {X86::VMOVAPDrr, {0, SSE_PACKED_OP}},
+    {X86::VMOVAPDrr_REV, {0, SSE_PACKED_OP}},
+    {X86::VMOVAPSYmr, {32, SSE_PACKED_OP}},
+    {X86::VMOVAPSYrm, {32, SSE_PACKED_OP}},
+    {X86::VMOVAPSYrr, {0, SSE_PACKED_OP}},
+    {X86::VMOVAPSYrr_REV, {0, SSE_PACKED_OP}},
     {X86::VMOVAPSZ128mr, {1, Unknown}},
     {X86::VMOVAPSZ128mr_NOVLX, {1, Unknown}},
     {X86::VMOVAPSZ128mrk, {1, Unknown}},
@@ -7032,10 +7032,10 @@ static constexpr const_addl_instr_info::value_type MapData[] = {
     {X86::VMOVAPSZrrk_REV, {0, Unknown}},
     {X86::VMOVAPSZrrkz, {0, Unknown}},
     {X86::VMOVAPSZrrkz_REV, {0, Unknown}},
-    {X86::VMOVAPSmr, {0, Unknown}},
-    {X86::VMOVAPSrm, {0, Unknown}},
-    {X86::VMOVAPSrr, {0, Unknown}},
-    {X86::VMOVAPSrr_REV, {0, Unknown}},
+    {X86::VMOVAPSmr, {16, SSE_PACKED_OP}},
+    {X86::VMOVAPSrm, {16, SSE_PACKED_OP}},
+    {X86::VMOVAPSrr, {0, SSE_PACKED_OP}},
+    {X86::VMOVAPSrr_REV, {0, SSE_PACKED_OP}},
     {X86::VMOVDDUPYrm, {0, Unknown}},
     {X86::VMOVDDUPYrr, {0, Unknown}},
     {X86::VMOVDDUPZ128rm, {1, Unknown}},
@@ -7061,7 +7061,7 @@ static constexpr const_addl_instr_info::value_type MapData[] = {
     {X86::VMOVDI2PDIZrm, {0, Unknown}},
     {X86::VMOVDI2PDIZrr, {0, Unknown}},
     {X86::VMOVDI2PDIrm, {0, Unknown}},
-    {X86::VMOVDI2PDIrr, {0, Unknown}},
+    {X86::VMOVDI2PDIrr, {0, SSE_MOV_RR}},
     {X86::VMOVDI2SSZrr, {0, Unknown}},
     {X86::VMOVDI2SSrr, {0, Unknown}},
     {X86::VMOVDQA32Z128mr, {1, Unknown}},
@@ -7130,14 +7130,14 @@ static constexpr const_addl_instr_info::value_type MapData[] = {
     {X86::VMOVDQA64Zrrk_REV, {0, Unknown}},
     {X86::VMOVDQA64Zrrkz, {0, Unknown}},
     {X86::VMOVDQA64Zrrkz_REV, {0, Unknown}},
-    {X86::VMOVDQAYmr, {0, Unknown}},
-    {X86::VMOVDQAYrm, {0, Unknown}},
-    {X86::VMOVDQAYrr, {0, Unknown}},
-    {X86::VMOVDQAYrr_REV, {0, Unknown}},
-    {X86::VMOVDQAmr, {0, Unknown}},
-    {X86::VMOVDQArm, {0, Unknown}},
-    {X86::VMOVDQArr, {0, Unknown}},
-    {X86::VMOVDQArr_REV, {0, Unknown}},
+    {X86::VMOVDQAYmr, {32, SSE_PACKED_OP}},
+    {X86::VMOVDQAYrm, {32, SSE_PACKED_OP}},
+    {X86::VMOVDQAYrr, {0, SSE_PACKED_OP}},
+    {X86::VMOVDQAYrr_REV, {0, SSE_PACKED_OP}},
+    {X86::VMOVDQAmr, {16, SSE_PACKED_OP}},
+    {X86::VMOVDQArm, {16, SSE_PACKED_OP}},
+    {X86::VMOVDQArr, {0, SSE_PACKED_OP}},
+    {X86::VMOVDQArr_REV, {0, SSE_PACKED_OP}},
     {X86::VMOVDQU16Z128mr, {1, Unknown}},
     {X86::VMOVDQU16Z128mrk, {1, Unknown}},
     {X86::VMOVDQU16Z128rm, {1, Unknown}},
@@ -7270,14 +7270,14 @@ static constexpr const_addl_instr_info::value_type MapData[] = {
     {X86::VMOVDQU8Zrrk_REV, {0, Unknown}},
     {X86::VMOVDQU8Zrrkz, {0, Unknown}},
     {X86::VMOVDQU8Zrrkz_REV, {0, Unknown}},
-    {X86::VMOVDQUYmr, {0, Unknown}},
-    {X86::VMOVDQUYrm, {0, Unknown}},
-    {X86::VMOVDQUYrr, {0, Unknown}},
-    {X86::VMOVDQUYrr_REV, {0, Unknown}},
-    {X86::VMOVDQUmr, {0, Unknown}},
-    {X86::VMOVDQUrm, {0, Unknown}},
-    {X86::VMOVDQUrr, {0, Unknown}},
-    {X86::VMOVDQUrr_REV, {0, Unknown}},
+    {X86::VMOVDQUYmr, {32, SSE_PACKED_OP}},
+    {X86::VMOVDQUYrm, {32, SSE_PACKED_OP}},
+    {X86::VMOVDQUYrr, {0, SSE_PACKED_OP}},
+    {X86::VMOVDQUYrr_REV, {0, SSE_PACKED_OP}},
+    {X86::VMOVDQUmr, {16, SSE_PACKED_OP}},
+    {X86::VMOVDQUrm, {16, SSE_PACKED_OP}},
+    {X86::VMOVDQUrr, {0, SSE_PACKED_OP}},
+    {X86::VMOVDQUrr_REV, {0, SSE_PACKED_OP}},
     {X86::VMOVHLPSZrr, {0, Unknown}},
     {X86::VMOVHLPSrr, {0, Unknown}},
     {X86::VMOVHPDZ128mr, {1, Unknown}},
@@ -7298,34 +7298,34 @@ static constexpr const_addl_instr_info::value_type MapData[] = {
     {X86::VMOVLPSZ128rm, {1, Unknown}},
     {X86::VMOVLPSmr, {0, Unknown}},
     {X86::VMOVLPSrm, {0, Unknown}},
-    {X86::VMOVMSKPDYrr, {0, Unknown}},
-    {X86::VMOVMSKPDrr, {0, Unknown}},
-    {X86::VMOVMSKPSYrr, {0, Unknown}},
-    {X86::VMOVMSKPSrr, {0, Unknown}},
+    {X86::VMOVMSKPDYrr, {0, SSE_PACKED_OP}},
+    {X86::VMOVMSKPDrr, {0, SSE_PACKED_OP}},
+    {X86::VMOVMSKPSYrr, {0, SSE_PACKED_OP}},
+    {X86::VMOVMSKPSrr, {0, SSE_PACKED_OP}},
     {X86::VMOVNTDQAYrm, {0, Unknown}},
     {X86::VMOVNTDQAZ128rm, {1, Unknown}},
     {X86::VMOVNTDQAZ256rm, {0, Unknown}},
     {X86::VMOVNTDQAZrm, {0, Unknown}},
     {X86::VMOVNTDQArm, {0, Unknown}},
-    {X86::VMOVNTDQYmr, {0, Unknown}},
+    {X86::VMOVNTDQYmr, {32, SSE_PACKED_OP}},
     {X86::VMOVNTDQZ128mr, {1, Unknown}},
     {X86::VMOVNTDQZ256mr, {0, Unknown}},
     {X86::VMOVNTDQZmr, {0, Unknown}},
-    {X86::VMOVNTDQmr, {0, Unknown}},
-    {X86::VMOVNTPDYmr, {0, Unknown}},
+    {X86::VMOVNTDQmr, {16, SSE_PACKED_OP}},
+    {X86::VMOVNTPDYmr, {32, SSE_PACKED_OP}},
     {X86::VMOVNTPDZ128mr, {1, Unknown}},
     {X86::VMOVNTPDZ256mr, {0, Unknown}},
     {X86::VMOVNTPDZmr, {0, Unknown}},
-    {X86::VMOVNTPDmr, {0, Unknown}},
-    {X86::VMOVNTPSYmr, {0, Unknown}},
+    {X86::VMOVNTPDmr, {16, SSE_PACKED_OP}},
+    {X86::VMOVNTPSYmr, {32, SSE_PACKED_OP}},
     {X86::VMOVNTPSZ128mr, {1, Unknown}},
     {X86::VMOVNTPSZ256mr, {0, Unknown}},
     {X86::VMOVNTPSZmr, {0, Unknown}},
-    {X86::VMOVNTPSmr, {0, Unknown}},
+    {X86::VMOVNTPSmr, {16, SSE_PACKED_OP}},
     {X86::VMOVPDI2DIZmr, {0, Unknown}},
     {X86::VMOVPDI2DIZrr, {0, Unknown}},
     {X86::VMOVPDI2DImr, {0, Unknown}},
-    {X86::VMOVPDI2DIrr, {0, Unknown}},
+    {X86::VMOVPDI2DIrr, {0, SSE_MOV_RR}},
     {X86::VMOVPQI2QIZmr, {0, Unknown}},
     {X86::VMOVPQI2QIZrr, {0, Unknown}},
     {X86::VMOVPQI2QImr, {0, Unknown}},
@@ -7333,7 +7333,7 @@ static constexpr const_addl_instr_info::value_type MapData[] = {
     {X86::VMOVPQIto64Zmr, {0, Unknown}},
     {X86::VMOVPQIto64Zrr, {0, Unknown}},
     {X86::VMOVPQIto64mr, {8, Unknown}},
-    {X86::VMOVPQIto64rr, {0, Unknown}},
+    {X86::VMOVPQIto64rr, {0, SSE_MOV_RR}},
     {X86::VMOVQI2PQIZrm, {0, Unknown}},
     {X86::VMOVQI2PQIrm, {0, Unknown}},
     {X86::VMOVSDZmr, {0, Unknown}},
@@ -7414,10 +7414,10 @@ static constexpr const_addl_instr_info::value_type MapData[] = {
     {X86::VMOVSSrm, {0, Unknown}},
     {X86::VMOVSSrr, {0, Unknown}},
     {X86::VMOVSSrr_REV, {0, Unknown}},
-    {X86::VMOVUPDYmr, {0, Unknown}},
-    {X86::VMOVUPDYrm, {0, Unknown}},
-    {X86::VMOVUPDYrr, {0, Unknown}},
-    {X86::VMOVUPDYrr_REV, {0, Unknown}},
+    {X86::VMOVUPDYmr, {32, SSE_PACKED_OP}},
+    {X86::VMOVUPDYrm, {32, SSE_PACKED_OP}},
+    {X86::VMOVUPDYrr, {0, SSE_PACKED_OP}},
+    {X86::VMOVUPDYrr_REV, {0, SSE_PACKED_OP}},
     {X86::VMOVUPDZ128mr, {1, Unknown}},
     {X86::VMOVUPDZ128mrk, {1, Unknown}},
     {X86::VMOVUPDZ128rm, {1, Unknown}},
@@ -7451,14 +7451,14 @@ static constexpr const_addl_instr_info::value_type MapData[] = {
     {X86::VMOVUPDZrrk_REV, {0, Unknown}},
     {X86::VMOVUPDZrrkz, {0, Unknown}},
     {X86::VMOVUPDZrrkz_REV, {0, Unknown}},
-    {X86::VMOVUPDmr, {0, Unknown}},
-    {X86::VMOVUPDrm, {0, Unknown}},
-    {X86::VMOVUPDrr, {0, Unknown}},
-    {X86::VMOVUPDrr_REV, {0, Unknown}},
-    {X86::VMOVUPSYmr, {0, Unknown}},
-    {X86::VMOVUPSYrm, {0, Unknown}},
-    {X86::VMOVUPSYrr, {0, Unknown}},
-    {X86::VMOVUPSYrr_REV, {0, Unknown}},
+    {X86::VMOVUPDmr, {16, SSE_PACKED_OP}},
+    {X86::VMOVUPDrm, {16, SSE_PACKED_OP}},
+    {X86::VMOVUPDrr, {0, SSE_PACKED_OP}},
+    {X86::VMOVUPDrr_REV, {0, SSE_PACKED_OP}},
+    {X86::VMOVUPSYmr, {32, SSE_PACKED_OP}},
+    {X86::VMOVUPSYrm, {32, SSE_PACKED_OP}},
+    {X86::VMOVUPSYrr, {0, SSE_PACKED_OP}},
+    {X86::VMOVUPSYrr_REV, {0, SSE_PACKED_OP}},
     {X86::VMOVUPSZ128mr, {1, Unknown}},
     {X86::VMOVUPSZ128mr_NOVLX, {1, Unknown}},
     {X86::VMOVUPSZ128mrk, {1, Unknown}},
@@ -7496,10 +7496,10 @@ static constexpr const_addl_instr_info::value_type MapData[] = {
     {X86::VMOVUPSZrrk_REV, {0, Unknown}},
     {X86::VMOVUPSZrrkz, {0, Unknown}},
     {X86::VMOVUPSZrrkz_REV, {0, Unknown}},
-    {X86::VMOVUPSmr, {0, Unknown}},
-    {X86::VMOVUPSrm, {0, Unknown}},
-    {X86::VMOVUPSrr, {0, Unknown}},
-    {X86::VMOVUPSrr_REV, {0, Unknown}},
+    {X86::VMOVUPSmr, {16, SSE_PACKED_OP}},
+    {X86::VMOVUPSrm, {16, SSE_PACKED_OP}},
+    {X86::VMOVUPSrr, {0, SSE_PACKED_OP}},
+    {X86::VMOVUPSrr_REV, {0, SSE_PACKED_OP}},
     {X86::VMOVZPQILo2PQIZrr, {0, Unknown}},
     {X86::VMOVZPQILo2PQIrr, {0, Unknown}},
     {X86::VMPSADBWYrmi, {0, Unknown}},
@@ -7517,8 +7517,8 @@ static constexpr const_addl_instr_info::value_type MapData[] = {
     {X86::VMRUN64, {0, Unknown}},
     {X86::VMSAVE32, {0, Unknown}},
     {X86::VMSAVE64, {0, Unknown}},
-    {X86::VMULPDYrm, {0, Unknown}},
-    {X86::VMULPDYrr, {0, Unknown}},
+    {X86::VMULPDYrm, {32, SSE_PACKED_OP}},
+    {X86::VMULPDYrr, {0, SSE_PACKED_OP}},
     {X86::VMULPDZ128rm, {1, Unknown}},
     {X86::VMULPDZ128rmb, {1, Unknown}},
     {X86::VMULPDZ128rmbk, {1, Unknown}},
@@ -7549,10 +7549,10 @@ static constexpr const_addl_instr_info::value_type MapData[] = {
     {X86::VMULPDZrrbkz, {0, Unknown}},
     {X86::VMULPDZrrk, {0, Unknown}},
     {X86::VMULPDZrrkz, {0, Unknown}},
-    {X86::VMULPDrm, {0, Unknown}},
-    {X86::VMULPDrr, {0, Unknown}},
-    {X86::VMULPSYrm, {0, Unknown}},
-    {X86::VMULPSYrr, {0, Unknown}},
+    {X86::VMULPDrm, {16, SSE_PACKED_OP}},
+    {X86::VMULPDrr, {0, SSE_PACKED_OP}},
+    {X86::VMULPSYrm, {32, SSE_PACKED_OP}},
+    {X86::VMULPSYrr, {0, SSE_PACKED_OP}},
     {X86::VMULPSZ128rm, {1, Unknown}},
     {X86::VMULPSZ128rmb, {1, Unknown}},
     {X86::VMULPSZ128rmbk, {1, Unknown}},
@@ -7583,8 +7583,8 @@ static constexpr const_addl_instr_info::value_type MapData[] = {
     {X86::VMULPSZrrbkz, {0, Unknown}},
     {X86::VMULPSZrrk, {0, Unknown}},
     {X86::VMULPSZrrkz, {0, Unknown}},
-    {X86::VMULPSrm, {0, Unknown}},
-    {X86::VMULPSrr, {0, Unknown}},
+    {X86::VMULPSrm, {16, SSE_PACKED_OP}},
+    {X86::VMULPSrr, {0, SSE_PACKED_OP}},
     {X86::VMULSDZrm, {0, Unknown}},
     {X86::VMULSDZrm_Int, {0, Unknown}},
     {X86::VMULSDZrm_Intk, {0, Unknown}},
@@ -7621,8 +7621,8 @@ static constexpr const_addl_instr_info::value_type MapData[] = {
     {X86::VMWRITE64rr, {0, Unknown}},
     {X86::VMXOFF, {0, Unknown}},
     {X86::VMXON, {0, Unknown}},
-    {X86::VORPDYrm, {0, Unknown}},
-    {X86::VORPDYrr, {0, Unknown}},
+    {X86::VORPDYrm, {32, SSE_PACKED_OP}},
+    {X86::VORPDYrr, {0, SSE_PACKED_OP}},
     {X86::VORPDZ128rm, {1, Unknown}},
     {X86::VORPDZ128rmb, {1, Unknown}},
     {X86::VORPDZ128rmbk, {1, Unknown}},
@@ -7650,10 +7650,10 @@ static constexpr const_addl_instr_info::value_type MapData[] = {
     {X86::VORPDZrr, {0, Unknown}},
     {X86::VORPDZrrk, {0, Unknown}},
     {X86::VORPDZrrkz, {0, Unknown}},
-    {X86::VORPDrm, {0, Unknown}},
-    {X86::VORPDrr, {0, Unknown}},
-    {X86::VORPSYrm, {0, Unknown}},
-    {X86::VORPSYrr, {0, Unknown}},
+    {X86::VORPDrm, {16, SSE_PACKED_OP}},
+    {X86::VORPDrr, {0, SSE_PACKED_OP}},
+    {X86::VORPSYrm, {32, SSE_PACKED_OP}},
+    {X86::VORPSYrr, {0, SSE_PACKED_OP}},
     {X86::VORPSZ128rm, {1, Unknown}},
     {X86::VORPSZ128rmb, {1, Unknown}},
     {X86::VORPSZ128rmbk, {1, Unknown}},
@@ -7681,10 +7681,10 @@ static constexpr const_addl_instr_info::value_type MapData[] = {
     {X86::VORPSZrr, {0, Unknown}},
     {X86::VORPSZrrk, {0, Unknown}},
     {X86::VORPSZrrkz, {0, Unknown}},
-    {X86::VORPSrm, {0, Unknown}},
-    {X86::VORPSrr, {0, Unknown}},
-    {X86::VPABSBYrm, {0, Unknown}},
-    {X86::VPABSBYrr, {0, Unknown}},
+    {X86::VORPSrm, {16, SSE_PACKED_OP}},
+    {X86::VORPSrr, {0, SSE_PACKED_OP}},
+    {X86::VPABSBYrm, {32, SSE_PACKED_OP}},
+    {X86::VPABSBYrr, {0, SSE_PACKED_OP}},
     {X86::VPABSBZ128rm, {1, Unknown}},
     {X86::VPABSBZ128rmk, {1, Unknown}},
     {X86::VPABSBZ128rmkz, {1, Unknown}},
@@ -7703,10 +7703,10 @@ static constexpr const_addl_instr_info::value_type MapData[] = {
     {X86::VPABSBZrr, {0, Unknown}},
     {X86::VPABSBZrrk, {0, Unknown}},
     {X86::VPABSBZrrkz, {0, Unknown}},
-    {X86::VPABSBrm, {0, Unknown}},
-    {X86::VPABSBrr, {0, Unknown}},
-    {X86::VPABSDYrm, {0, Unknown}},
-    {X86::VPABSDYrr, {0, Unknown}},
+    {X86::VPABSBrm, {16, SSE_PACKED_OP}},
+    {X86::VPABSBrr, {0, SSE_PACKED_OP}},
+    {X86::VPABSDYrm, {32, SSE_PACKED_OP}},
+    {X86::VPABSDYrr, {0, SSE_PACKED_OP}},
     {X86::VPABSDZ128rm, {1, Unknown}},
     {X86::VPABSDZ128rmb, {1, Unknown}},
     {X86::VPABSDZ128rmbk, {1, Unknown}},
@@ -7734,8 +7734,8 @@ static constexpr const_addl_instr_info::value_type MapData[] = {
     {X86::VPABSDZrr, {0, Unknown}},
     {X86::VPABSDZrrk, {0, Unknown}},
     {X86::VPABSDZrrkz, {0, Unknown}},
-    {X86::VPABSDrm, {0, Unknown}},
-    {X86::VPABSDrr, {0, Unknown}},
+    {X86::VPABSDrm, {16, SSE_PACKED_OP}},
+    {X86::VPABSDrr, {0, SSE_PACKED_OP}},
     {X86::VPABSQZ128rm, {1, Unknown}},
     {X86::VPABSQZ128rmb, {1, Unknown}},
     {X86::VPABSQZ128rmbk, {1, Unknown}},
@@ -7763,8 +7763,8 @@ static constexpr const_addl_instr_info::value_type MapData[] = {
     {X86::VPABSQZrr, {0, Unknown}},
     {X86::VPABSQZrrk, {0, Unknown}},
     {X86::VPABSQZrrkz, {0, Unknown}},
-    {X86::VPABSWYrm, {0, Unknown}},
-    {X86::VPABSWYrr, {0, Unknown}},
+    {X86::VPABSWYrm, {32, SSE_PACKED_OP}},
+    {X86::VPABSWYrr, {0, SSE_PACKED_OP}},
     {X86::VPABSWZ128rm, {1, Unknown}},
     {X86::VPABSWZ128rmk, {1, Unknown}},
     {X86::VPABSWZ128rmkz, {1, Unknown}},
@@ -7783,8 +7783,8 @@ static constexpr const_addl_instr_info::value_type MapData[] = {
     {X86::VPABSWZrr, {0, Unknown}},
     {X86::VPABSWZrrk, {0, Unknown}},
     {X86::VPABSWZrrkz, {0, Unknown}},
-    {X86::VPABSWrm, {0, Unknown}},
-    {X86::VPABSWrr, {0, Unknown}},
+    {X86::VPABSWrm, {16, SSE_PACKED_OP}},
+    {X86::VPABSWrr, {0, SSE_PACKED_OP}},
     {X86::VPACKSSDWYrm, {0, Unknown}},
     {X86::VPACKSSDWYrr, {0, Unknown}},
     {X86::VPACKSSDWZ128rm, {1, Unknown}},
@@ -7891,8 +7891,8 @@ static constexpr const_addl_instr_info::value_type MapData[] = {
     {X86::VPACKUSWBZrrkz, {0, Unknown}},
     {X86::VPACKUSWBrm, {0, Unknown}},
     {X86::VPACKUSWBrr, {0, Unknown}},
-    {X86::VPADDBYrm, {0, Unknown}},
-    {X86::VPADDBYrr, {0, Unknown}},
+    {X86::VPADDBYrm, {32, SSE_PACKED_OP}},
+    {X86::VPADDBYrr, {0, SSE_PACKED_OP}},
     {X86::VPADDBZ128rm, {1, Unknown}},
     {X86::VPADDBZ128rmk, {1, Unknown}},
     {X86::VPADDBZ128rmkz, {1, Unknown}},
@@ -7911,10 +7911,10 @@ static constexpr const_addl_instr_info::value_type MapData[] = {
     {X86::VPADDBZrr, {0, Unknown}},
     {X86::VPADDBZrrk, {0, Unknown}},
     {X86::VPADDBZrrkz, {0, Unknown}},
-    {X86::VPADDBrm, {0, Unknown}},
-    {X86::VPADDBrr, {0, Unknown}},
-    {X86::VPADDDYrm, {0, Unknown}},
-    {X86::VPADDDYrr, {0, Unknown}},
+    {X86::VPADDBrm, {16, SSE_PACKED_OP}},
+    {X86::VPADDBrr, {0, SSE_PACKED_OP}},
+    {X86::VPADDDYrm, {32, SSE_PACKED_OP}},
+    {X86::VPADDDYrr, {0, SSE_PACKED_OP}},
     {X86::VPADDDZ128rm, {1, Unknown}},
     {X86::VPADDDZ128rmb, {1, Unknown}},
     {X86::VPADDDZ128rmbk, {1, Unknown}},
@@ -7942,10 +7942,10 @@ static constexpr const_addl_instr_info::value_type MapData[] = {
     {X86::VPADDDZrr, {0, Unknown}},
     {X86::VPADDDZrrk, {0, Unknown}},
     {X86::VPADDDZrrkz, {0, Unknown}},
-    {X86::VPADDDrm, {0, Unknown}},
-    {X86::VPADDDrr, {0, Unknown}},
-    {X86::VPADDQYrm, {0, Unknown}},
-    {X86::VPADDQYrr, {0, Unknown}},
+    {X86::VPADDDrm, {16, SSE_PACKED_OP}},
+    {X86::VPADDDrr, {0, SSE_PACKED_OP}},
+    {X86::VPADDQYrm, {32, SSE_PACKED_OP}},
+    {X86::VPADDQYrr, {0, SSE_PACKED_OP}},
     {X86::VPADDQZ128rm, {1, Unknown}},
     {X86::VPADDQZ128rmb, {1, Unknown}},
     {X86::VPADDQZ128rmbk, {1, Unknown}},
@@ -7973,10 +7973,10 @@ static constexpr const_addl_instr_info::value_type MapData[] = {
     {X86::VPADDQZrr, {0, Unknown}},
     {X86::VPADDQZrrk, {0, Unknown}},
     {X86::VPADDQZrrkz, {0, Unknown}},
-    {X86::VPADDQrm, {0, Unknown}},
-    {X86::VPADDQrr, {0, Unknown}},
-    {X86::VPADDSBYrm, {0, Unknown}},
-    {X86::VPADDSBYrr, {0, Unknown}},
+    {X86::VPADDQrm, {16, SSE_PACKED_OP}},
+    {X86::VPADDQrr, {0, SSE_PACKED_OP}},
+    {X86::VPADDSBYrm, {32, SSE_PACKED_OP}},
+    {X86::VPADDSBYrr, {0, SSE_PACKED_OP}},
     {X86::VPADDSBZ128rm, {1, Unknown}},
     {X86::VPADDSBZ128rmk, {1, Unknown}},
     {X86::VPADDSBZ128rmkz, {1, Unknown}},
@@ -7995,10 +7995,10 @@ static constexpr const_addl_instr_info::value_type MapData[] = {
     {X86::VPADDSBZrr, {0, Unknown}},
     {X86::VPADDSBZrrk, {0, Unknown}},
     {X86::VPADDSBZrrkz, {0, Unknown}},
-    {X86::VPADDSBrm, {0, Unknown}},
-    {X86::VPADDSBrr, {0, Unknown}},
-    {X86::VPADDSWYrm, {0, Unknown}},
-    {X86::VPADDSWYrr, {0, Unknown}},
+    {X86::VPADDSBrm, {16, SSE_PACKED_OP}},
+    {X86::VPADDSBrr, {0, SSE_PACKED_OP}},
+    {X86::VPADDSWYrm, {32, SSE_PACKED_OP}},
+    {X86::VPADDSWYrr, {0, SSE_PACKED_OP}},
     {X86::VPADDSWZ128rm, {1, Unknown}},
     {X86::VPADDSWZ128rmk, {1, Unknown}},
     {X86::VPADDSWZ128rmkz, {1, Unknown}},
@@ -8017,10 +8017,10 @@ static constexpr const_addl_instr_info::value_type MapData[] = {
     {X86::VPADDSWZrr, {0, Unknown}},
     {X86::VPADDSWZrrk, {0, Unknown}},
     {X86::VPADDSWZrrkz, {0, Unknown}},
-    {X86::VPADDSWrm, {0, Unknown}},
-    {X86::VPADDSWrr, {0, Unknown}},
-    {X86::VPADDUSBYrm, {0, Unknown}},
-    {X86::VPADDUSBYrr, {0, Unknown}},
+    {X86::VPADDSWrm, {16, SSE_PACKED_OP}},
+    {X86::VPADDSWrr, {0, SSE_PACKED_OP}},
+    {X86::VPADDUSBYrm, {32, SSE_PACKED_OP}},
+    {X86::VPADDUSBYrr, {0, SSE_PACKED_OP}},
     {X86::VPADDUSBZ128rm, {1, Unknown}},
     {X86::VPADDUSBZ128rmk, {1, Unknown}},
     {X86::VPADDUSBZ128rmkz, {1, Unknown}},
@@ -8039,10 +8039,10 @@ static constexpr const_addl_instr_info::value_type MapData[] = {
     {X86::VPADDUSBZrr, {0, Unknown}},
     {X86::VPADDUSBZrrk, {0, Unknown}},
     {X86::VPADDUSBZrrkz, {0, Unknown}},
-    {X86::VPADDUSBrm, {0, Unknown}},
-    {X86::VPADDUSBrr, {0, Unknown}},
-    {X86::VPADDUSWYrm, {0, Unknown}},
-    {X86::VPADDUSWYrr, {0, Unknown}},
+    {X86::VPADDUSBrm, {16, SSE_PACKED_OP}},
+    {X86::VPADDUSBrr, {0, SSE_PACKED_OP}},
+    {X86::VPADDUSWYrm, {32, SSE_PACKED_OP}},
+    {X86::VPADDUSWYrr, {0, SSE_PACKED_OP}},
     {X86::VPADDUSWZ128rm, {1, Unknown}},
     {X86::VPADDUSWZ128rmk, {1, Unknown}},
     {X86::VPADDUSWZ128rmkz, {1, Unknown}},
@@ -8061,10 +8061,10 @@ static constexpr const_addl_instr_info::value_type MapData[] = {
     {X86::VPADDUSWZrr, {0, Unknown}},
     {X86::VPADDUSWZrrk, {0, Unknown}},
     {X86::VPADDUSWZrrkz, {0, Unknown}},
-    {X86::VPADDUSWrm, {0, Unknown}},
-    {X86::VPADDUSWrr, {0, Unknown}},
-    {X86::VPADDWYrm, {0, Unknown}},
-    {X86::VPADDWYrr, {0, Unknown}},
+    {X86::VPADDUSWrm, {16, SSE_PACKED_OP}},
+    {X86::VPADDUSWrr, {0, SSE_PACKED_OP}},
+    {X86::VPADDWYrm, {32, SSE_PACKED_OP}},
+    {X86::VPADDWYrr, {0, SSE_PACKED_OP}},
     {X86::VPADDWZ128rm, {1, Unknown}},
     {X86::VPADDWZ128rmk, {1, Unknown}},
     {X86::VPADDWZ128rmkz, {1, Unknown}},
@@ -8083,8 +8083,8 @@ static constexpr const_addl_instr_info::value_type MapData[] = {
     {X86::VPADDWZrr, {0, Unknown}},
     {X86::VPADDWZrrk, {0, Unknown}},
     {X86::VPADDWZrrkz, {0, Unknown}},
-    {X86::VPADDWrm, {0, Unknown}},
-    {X86::VPADDWrr, {0, Unknown}},
+    {X86::VPADDWrm, {16, SSE_PACKED_OP}},
+    {X86::VPADDWrr, {0, SSE_PACKED_OP}},
     {X86::VPALIGNRYrmi, {0, Unknown}},
     {X86::VPALIGNRYrri, {0, Unknown}},
     {X86::VPALIGNRZ128rmi, {1, Unknown}},
@@ -8188,10 +8188,10 @@ static constexpr const_addl_instr_info::value_type MapData[] = {
     {X86::VPANDNQZrr, {0, Unknown}},
     {X86::VPANDNQZrrk, {0, Unknown}},
     {X86::VPANDNQZrrkz, {0, Unknown}},
-    {X86::VPANDNYrm, {0, Unknown}},
-    {X86::VPANDNYrr, {0, Unknown}},
-    {X86::VPANDNrm, {0, Unknown}},
-    {X86::VPANDNrr, {0, Unknown}},
+    {X86::VPANDNYrm, {32, SSE_PACKED_OP}},
+    {X86::VPANDNYrr, {0, SSE_PACKED_OP}},
+    {X86::VPANDNrm, {16, SSE_PACKED_OP}},
+    {X86::VPANDNrr, {0, SSE_PACKED_OP}},
     {X86::VPANDQZ128rm, {1, Unknown}},
     {X86::VPANDQZ128rmb, {1, Unknown}},
     {X86::VPANDQZ128rmbk, {1, Unknown}},
@@ -8219,10 +8219,10 @@ static constexpr const_addl_instr_info::value_type MapData[] = {
     {X86::VPANDQZrr, {0, Unknown}},
     {X86::VPANDQZrrk, {0, Unknown}},
     {X86::VPANDQZrrkz, {0, Unknown}},
-    {X86::VPANDYrm, {0, Unknown}},
-    {X86::VPANDYrr, {0, Unknown}},
-    {X86::VPANDrm, {0, Unknown}},
-    {X86::VPANDrr, {0, Unknown}},
+    {X86::VPANDYrm, {32, SSE_PACKED_OP}},
+    {X86::VPANDYrr, {0, SSE_PACKED_OP}},
+    {X86::VPANDrm, {16, SSE_PACKED_OP}},
+    {X86::VPANDrr, {0, SSE_PACKED_OP}},
     {X86::VPAVGBYrm, {0, Unknown}},
     {X86::VPAVGBYrr, {0, Unknown}},
     {X86::VPAVGBZ128rm, {1, Unknown}},
@@ -8369,28 +8369,28 @@ static constexpr const_addl_instr_info::value_type MapData[] = {
     {X86::VPBLENDWYrri, {0, Unknown}},
     {X86::VPBLENDWrmi, {0, Unknown}},
     {X86::VPBLENDWrri, {0, Unknown}},
-    {X86::VPBROADCASTBYrm, {0, Unknown}},
-    {X86::VPBROADCASTBYrr, {0, Unknown}},
-    {X86::VPBROADCASTBrm, {0, Unknown}},
-    {X86::VPBROADCASTBrr, {0, Unknown}},
-    {X86::VPBROADCASTDYrm, {0, Unknown}},
-    {X86::VPBROADCASTDYrr, {0, Unknown}},
-    {X86::VPBROADCASTDrm, {0, Unknown}},
-    {X86::VPBROADCASTDrr, {0, Unknown}},
+    {X86::VPBROADCASTBYrm, {1, SSE_PACKED_OP}},
+    {X86::VPBROADCASTBYrr, {0, SSE_PACKED_OP}},
+    {X86::VPBROADCASTBrm, {1, SSE_PACKED_OP}},
+    {X86::VPBROADCASTBrr, {0, SSE_PACKED_OP}},
+    {X86::VPBROADCASTDYrm, {4, SSE_PACKED_OP}},
+    {X86::VPBROADCASTDYrr, {0, SSE_PACKED_OP}},
+    {X86::VPBROADCASTDrm, {4, SSE_PACKED_OP}},
+    {X86::VPBROADCASTDrr, {0, SSE_PACKED_OP}},
     {X86::VPBROADCASTMB2QZ128rr, {0, Unknown}},
     {X86::VPBROADCASTMB2QZ256rr, {0, Unknown}},
     {X86::VPBROADCASTMB2QZrr, {0, Unknown}},
     {X86::VPBROADCASTMW2DZ128rr, {0, Unknown}},
     {X86::VPBROADCASTMW2DZ256rr, {0, Unknown}},
     {X86::VPBROADCASTMW2DZrr, {0, Unknown}},
-    {X86::VPBROADCASTQYrm, {0, Unknown}},
-    {X86::VPBROADCASTQYrr, {0, Unknown}},
-    {X86::VPBROADCASTQrm, {0, Unknown}},
-    {X86::VPBROADCASTQrr, {0, Unknown}},
-    {X86::VPBROADCASTWYrm, {0, Unknown}},
-    {X86::VPBROADCASTWYrr, {0, Unknown}},
-    {X86::VPBROADCASTWrm, {0, Unknown}},
-    {X86::VPBROADCASTWrr, {0, Unknown}},
+    {X86::VPBROADCASTQYrm, {8, SSE_PACKED_OP}},
+    {X86::VPBROADCASTQYrr, {0, SSE_PACKED_OP}},
+    {X86::VPBROADCASTQrm, {8, SSE_PACKED_OP}},
+    {X86::VPBROADCASTQrr, {0, SSE_PACKED_OP}},
+    {X86::VPBROADCASTWYrm, {2, SSE_PACKED_OP}},
+    {X86::VPBROADCASTWYrr, {0, SSE_PACKED_OP}},
+    {X86::VPBROADCASTWrm, {2, SSE_PACKED_OP}},
+    {X86::VPBROADCASTWrr, {0, SSE_PACKED_OP}},
     {X86::VPCLMULQDQYrm, {0, Unknown}},
     {X86::VPCLMULQDQYrr, {0, Unknown}},
     {X86::VPCLMULQDQZ128rm, {1, Unknown}},
@@ -8439,8 +8439,8 @@ static constexpr const_addl_instr_info::value_type MapData[] = {
     {X86::VPCMPDZrmik, {0, Unknown}},
     {X86::VPCMPDZrri, {0, Unknown}},
     {X86::VPCMPDZrrik, {0, Unknown}},
-    {X86::VPCMPEQBYrm, {0, Unknown}},
-    {X86::VPCMPEQBYrr, {0, Unknown}},
+    {X86::VPCMPEQBYrm, {32, SSE_PACKED_OP}},
+    {X86::VPCMPEQBYrr, {0, SSE_PACKED_OP}},
     {X86::VPCMPEQBZ128rm, {1, Unknown}},
     {X86::VPCMPEQBZ128rmk, {1, Unknown}},
     {X86::VPCMPEQBZ128rr, {0, Unknown}},
@@ -8453,10 +8453,10 @@ static constexpr const_addl_instr_info::value_type MapData[] = {
     {X86::VPCMPEQBZrmk, {0, Unknown}},
     {X86::VPCMPEQBZrr, {0, Unknown}},
     {X86::VPCMPEQBZrrk, {0, Unknown}},
-    {X86::VPCMPEQBrm, {0, Unknown}},
-    {X86::VPCMPEQBrr, {0, Unknown}},
-    {X86::VPCMPEQDYrm, {0, Unknown}},
-    {X86::VPCMPEQDYrr, {0, Unknown}},
+    {X86::VPCMPEQBrm, {16, SSE_PACKED_OP}},
+    {X86::VPCMPEQBrr, {0, SSE_PACKED_OP}},
+    {X86::VPCMPEQDYrm, {32, SSE_PACKED_OP}},
+    {X86::VPCMPEQDYrr, {0, SSE_PACKED_OP}},
     {X86::VPCMPEQDZ128rm, {1, Unknown}},
     {X86::VPCMPEQDZ128rmb, {1, Unknown}},
     {X86::VPCMPEQDZ128rmbk, {1, Unknown}},
@@ -8475,10 +8475,10 @@ static constexpr const_addl_instr_info::value_type MapData[] = {
     {X86::VPCMPEQDZrmk, {0, Unknown}},
     {X86::VPCMPEQDZrr, {0, Unknown}},
     {X86::VPCMPEQDZrrk, {0, Unknown}},
-    {X86::VPCMPEQDrm, {0, Unknown}},
-    {X86::VPCMPEQDrr, {0, Unknown}},
-    {X86::VPCMPEQQYrm, {0, Unknown}},
-    {X86::VPCMPEQQYrr, {0, Unknown}},
+    {X86::VPCMPEQDrm, {16, SSE_PACKED_OP}},
+    {X86::VPCMPEQDrr, {0, SSE_PACKED_OP}},
+    {X86::VPCMPEQQYrm, {32, SSE_PACKED_OP}},
+    {X86::VPCMPEQQYrr, {0, SSE_PACKED_OP}},
     {X86::VPCMPEQQZ128rm, {1, Unknown}},
     {X86::VPCMPEQQZ128rmb, {1, Unknown}},
     {X86::VPCMPEQQZ128rmbk, {1, Unknown}},
@@ -8497,10 +8497,10 @@ static constexpr const_addl_instr_info::value_type MapData[] = {
     {X86::VPCMPEQQZrmk, {0, Unknown}},
     {X86::VPCMPEQQZrr, {0, Unknown}},
     {X86::VPCMPEQQZrrk, {0, Unknown}},
-    {X86::VPCMPEQQrm, {0, Unknown}},
-    {X86::VPCMPEQQrr, {0, Unknown}},
-    {X86::VPCMPEQWYrm, {0, Unknown}},
-    {X86::VPCMPEQWYrr, {0, Unknown}},
+    {X86::VPCMPEQQrm, {16, SSE_PACKED_OP}},
+    {X86::VPCMPEQQrr, {0, SSE_PACKED_OP}},
+    {X86::VPCMPEQWYrm, {32, SSE_PACKED_OP}},
+    {X86::VPCMPEQWYrr, {0, SSE_PACKED_OP}},
     {X86::VPCMPEQWZ128rm, {1, Unknown}},
     {X86::VPCMPEQWZ128rmk, {1, Unknown}},
     {X86::VPCMPEQWZ128rr, {0, Unknown}},
@@ -8513,10 +8513,10 @@ static constexpr const_addl_instr_info::value_type MapData[] = {
     {X86::VPCMPEQWZrmk, {0, Unknown}},
     {X86::VPCMPEQWZrr, {0, Unknown}},
     {X86::VPCMPEQWZrrk, {0, Unknown}},
-    {X86::VPCMPEQWrm, {0, Unknown}},
-    {X86::VPCMPEQWrr, {0, Unknown}},
-    {X86::VPCMPGTBYrm, {0, Unknown}},
-    {X86::VPCMPGTBYrr, {0, Unknown}},
+    {X86::VPCMPEQWrm, {16, SSE_PACKED_OP}},
+    {X86::VPCMPEQWrr, {0, SSE_PACKED_OP}},
+    {X86::VPCMPGTBYrm, {32, SSE_PACKED_OP}},
+    {X86::VPCMPGTBYrr, {0, SSE_PACKED_OP}},
     {X86::VPCMPGTBZ128rm, {1, Unknown}},
     {X86::VPCMPGTBZ128rmk, {1, Unknown}},
     {X86::VPCMPGTBZ128rr, {0, Unknown}},
@@ -8529,10 +8529,10 @@ static constexpr const_addl_instr_info::value_type MapData[] = {
     {X86::VPCMPGTBZrmk, {0, Unknown}},
     {X86::VPCMPGTBZrr, {0, Unknown}},
     {X86::VPCMPGTBZrrk, {0, Unknown}},
-    {X86::VPCMPGTBrm, {0, Unknown}},
-    {X86::VPCMPGTBrr, {0, Unknown}},
-    {X86::VPCMPGTDYrm, {0, Unknown}},
-    {X86::VPCMPGTDYrr, {0, Unknown}},
+    {X86::VPCMPGTBrm, {16, SSE_PACKED_OP}},
+    {X86::VPCMPGTBrr, {0, SSE_PACKED_OP}},
+    {X86::VPCMPGTDYrm, {32, SSE_PACKED_OP}},
+    {X86::VPCMPGTDYrr, {0, SSE_PACKED_OP}},
     {X86::VPCMPGTDZ128rm, {1, Unknown}},
     {X86::VPCMPGTDZ128rmb, {1, Unknown}},
     {X86::VPCMPGTDZ128rmbk, {1, Unknown}},
@@ -8551,10 +8551,10 @@ static constexpr const_addl_instr_info::value_type MapData[] = {
     {X86::VPCMPGTDZrmk, {0, Unknown}},
     {X86::VPCMPGTDZrr, {0, Unknown}},
     {X86::VPCMPGTDZrrk, {0, Unknown}},
-    {X86::VPCMPGTDrm, {0, Unknown}},
-    {X86::VPCMPGTDrr, {0, Unknown}},
-    {X86::VPCMPGTQYrm, {0, Unknown}},
-    {X86::VPCMPGTQYrr, {0, Unknown}},
+    {X86::VPCMPGTDrm, {16, SSE_PACKED_OP}},
+    {X86::VPCMPGTDrr, {0, SSE_PACKED_OP}},
+    {X86::VPCMPGTQYrm, {32, SSE_PACKED_OP}},
+    {X86::VPCMPGTQYrr, {0, SSE_PACKED_OP}},
     {X86::VPCMPGTQZ128rm, {1, Unknown}},
     {X86::VPCMPGTQZ128rmb, {1, Unknown}},
     {X86::VPCMPGTQZ128rmbk, {1, Unknown}},
@@ -8573,10 +8573,10 @@ static constexpr const_addl_instr_info::value_type MapData[] = {
     {X86::VPCMPGTQZrmk, {0, Unknown}},
     {X86::VPCMPGTQZrr, {0, Unknown}},
     {X86::VPCMPGTQZrrk, {0, Unknown}},
-    {X86::VPCMPGTQrm, {0, Unknown}},
-    {X86::VPCMPGTQrr, {0, Unknown}},
-    {X86::VPCMPGTWYrm, {0, Unknown}},
-    {X86::VPCMPGTWYrr, {0, Unknown}},
+    {X86::VPCMPGTQrm, {16, SSE_PACKED_OP}},
+    {X86::VPCMPGTQrr, {0, SSE_PACKED_OP}},
+    {X86::VPCMPGTWYrm, {32, SSE_PACKED_OP}},
+    {X86::VPCMPGTWYrr, {0, SSE_PACKED_OP}},
     {X86::VPCMPGTWZ128rm, {1, Unknown}},
     {X86::VPCMPGTWZ128rmk, {1, Unknown}},
     {X86::VPCMPGTWZ128rr, {0, Unknown}},
@@ -8589,8 +8589,8 @@ static constexpr const_addl_instr_info::value_type MapData[] = {
     {X86::VPCMPGTWZrmk, {0, Unknown}},
     {X86::VPCMPGTWZrr, {0, Unknown}},
     {X86::VPCMPGTWZrrk, {0, Unknown}},
-    {X86::VPCMPGTWrm, {0, Unknown}},
-    {X86::VPCMPGTWrr, {0, Unknown}},
+    {X86::VPCMPGTWrm, {16, SSE_PACKED_OP}},
+    {X86::VPCMPGTWrr, {0, SSE_PACKED_OP}},
     {X86::VPCMPISTRIrm, {0, Unknown}},
     {X86::VPCMPISTRIrr, {0, Unknown}},
     {X86::VPCMPQZ128rmi, {1, Unknown}},
@@ -8921,10 +8921,10 @@ static constexpr const_addl_instr_info::value_type MapData[] = {
     {X86::VPDPWSSDZr, {0, Unknown}},
     {X86::VPDPWSSDZrk, {0, Unknown}},
     {X86::VPDPWSSDZrkz, {0, Unknown}},
-    {X86::VPERM2F128rm, {1, Unknown}},
-    {X86::VPERM2F128rr, {0, Unknown}},
-    {X86::VPERM2I128rm, {1, Unknown}},
-    {X86::VPERM2I128rr, {0, Unknown}},
+    {X86::VPERM2F128rm, {32, SSE_PACKED_OP}},
+    {X86::VPERM2F128rr, {0, SSE_PACKED_OP}},
+    {X86::VPERM2I128rm, {32, SSE_PACKED_OP}},
+    {X86::VPERM2I128rr, {0, SSE_PACKED_OP}},
     {X86::VPERMBZ128rm, {1, Unknown}},
     {X86::VPERMBZ128rmk, {1, Unknown}},
     {X86::VPERMBZ128rmkz, {1, Unknown}},
@@ -8943,8 +8943,8 @@ static constexpr const_addl_instr_info::value_type MapData[] = {
     {X86::VPERMBZrr, {0, Unknown}},
     {X86::VPERMBZrrk, {0, Unknown}},
     {X86::VPERMBZrrkz, {0, Unknown}},
-    {X86::VPERMDYrm, {0, Unknown}},
-    {X86::VPERMDYrr, {0, Unknown}},
+    {X86::VPERMDYrm, {32, SSE_PACKED_OP}},
+    {X86::VPERMDYrr, {0, SSE_PACKED_OP}},
     {X86::VPERMDZ256rm, {0, Unknown}},
     {X86::VPERMDZ256rmb, {0, Unknown}},
     {X86::VPERMDZ256rmbk, {0, Unknown}},
@@ -9247,8 +9247,8 @@ static constexpr const_addl_instr_info::value_type MapData[] = {
     {X86::VPERMILPSri, {0, Unknown}},
     {X86::VPERMILPSrm, {0, Unknown}},
     {X86::VPERMILPSrr, {0, Unknown}},
-    {X86::VPERMPDYmi, {0, Unknown}},
-    {X86::VPERMPDYri, {0, Unknown}},
+    {X86::VPERMPDYmi, {32, SSE_PACKED_OP}},
+    {X86::VPERMPDYri, {0, SSE_PACKED_OP}},
     {X86::VPERMPDZ256mbi, {0, Unknown}},
     {X86::VPERMPDZ256mbik, {0, Unknown}},
     {X86::VPERMPDZ256mbikz, {0, Unknown}},
@@ -9285,8 +9285,8 @@ static constexpr const_addl_instr_info::value_type MapData[] = {
     {X86::VPERMPDZrr, {0, Unknown}},
     {X86::VPERMPDZrrk, {0, Unknown}},
     {X86::VPERMPDZrrkz, {0, Unknown}},
-    {X86::VPERMPSYrm, {0, Unknown}},
-    {X86::VPERMPSYrr, {0, Unknown}},
+    {X86::VPERMPSYrm, {32, SSE_PACKED_OP}},
+    {X86::VPERMPSYrr, {0, SSE_PACKED_OP}},
     {X86::VPERMPSZ256rm, {0, Unknown}},
     {X86::VPERMPSZ256rmb, {0, Unknown}},
     {X86::VPERMPSZ256rmbk, {0, Unknown}},
@@ -9305,8 +9305,8 @@ static constexpr const_addl_instr_info::value_type MapData[] = {
     {X86::VPERMPSZrr, {0, Unknown}},
     {X86::VPERMPSZrrk, {0, Unknown}},
     {X86::VPERMPSZrrkz, {0, Unknown}},
-    {X86::VPERMQYmi, {0, Unknown}},
-    {X86::VPERMQYri, {0, Unknown}},
+    {X86::VPERMQYmi, {32, SSE_PACKED_OP}},
+    {X86::VPERMQYri, {0, SSE_PACKED_OP}},
     {X86::VPERMQZ256mbi, {0, Unknown}},
     {X86::VPERMQZ256mbik, {0, Unknown}},
     {X86::VPERMQZ256mbikz, {0, Unknown}},
@@ -9871,8 +9871,8 @@ static constexpr const_addl_instr_info::value_type MapData[] = {
     {X86::VPMASKMOVQYrm, {0, Unknown}},
     {X86::VPMASKMOVQmr, {0, Unknown}},
     {X86::VPMASKMOVQrm, {0, Unknown}},
-    {X86::VPMAXSBYrm, {0, Unknown}},
-    {X86::VPMAXSBYrr, {0, Unknown}},
+    {X86::VPMAXSBYrm, {32, SSE_PACKED_OP}},
+    {X86::VPMAXSBYrr, {0, SSE_PACKED_OP}},
     {X86::VPMAXSBZ128rm, {1, Unknown}},
     {X86::VPMAXSBZ128rmk, {1, Unknown}},
     {X86::VPMAXSBZ128rmkz, {1, Unknown}},
@@ -9891,10 +9891,10 @@ static constexpr const_addl_instr_info::value_type MapData[] = {
     {X86::VPMAXSBZrr, {0, Unknown}},
     {X86::VPMAXSBZrrk, {0, Unknown}},
     {X86::VPMAXSBZrrkz, {0, Unknown}},
-    {X86::VPMAXSBrm, {0, Unknown}},
-    {X86::VPMAXSBrr, {0, Unknown}},
-    {X86::VPMAXSDYrm, {0, Unknown}},
-    {X86::VPMAXSDYrr, {0, Unknown}},
+    {X86::VPMAXSBrm, {16, SSE_PACKED_OP}},
+    {X86::VPMAXSBrr, {0, SSE_PACKED_OP}},
+    {X86::VPMAXSDYrm, {32, SSE_PACKED_OP}},
+    {X86::VPMAXSDYrr, {0, SSE_PACKED_OP}},
     {X86::VPMAXSDZ128rm, {1, Unknown}},
     {X86::VPMAXSDZ128rmb, {1, Unknown}},
     {X86::VPMAXSDZ128rmbk, {1, Unknown}},
@@ -9922,8 +9922,8 @@ static constexpr const_addl_instr_info::value_type MapData[] = {
     {X86::VPMAXSDZrr, {0, Unknown}},
     {X86::VPMAXSDZrrk, {0, Unknown}},
     {X86::VPMAXSDZrrkz, {0, Unknown}},
-    {X86::VPMAXSDrm, {0, Unknown}},
-    {X86::VPMAXSDrr, {0, Unknown}},
+    {X86::VPMAXSDrm, {16, SSE_PACKED_OP}},
+    {X86::VPMAXSDrr, {0, SSE_PACKED_OP}},
     {X86::VPMAXSQZ128rm, {1, Unknown}},
     {X86::VPMAXSQZ128rmb, {1, Unknown}},
     {X86::VPMAXSQZ128rmbk, {1, Unknown}},
@@ -9951,8 +9951,8 @@ static constexpr const_addl_instr_info::value_type MapData[] = {
     {X86::VPMAXSQZrr, {0, Unknown}},
     {X86::VPMAXSQZrrk, {0, Unknown}},
     {X86::VPMAXSQZrrkz, {0, Unknown}},
-    {X86::VPMAXSWYrm, {0, Unknown}},
-    {X86::VPMAXSWYrr, {0, Unknown}},
+    {X86::VPMAXSWYrm, {32, SSE_PACKED_OP}},
+    {X86::VPMAXSWYrr, {0, SSE_PACKED_OP}},
     {X86::VPMAXSWZ128rm, {1, Unknown}},
     {X86::VPMAXSWZ128rmk, {1, Unknown}},
     {X86::VPMAXSWZ128rmkz, {1, Unknown}},
@@ -9971,10 +9971,10 @@ static constexpr const_addl_instr_info::value_type MapData[] = {
     {X86::VPMAXSWZrr, {0, Unknown}},
     {X86::VPMAXSWZrrk, {0, Unknown}},
     {X86::VPMAXSWZrrkz, {0, Unknown}},
-    {X86::VPMAXSWrm, {0, Unknown}},
-    {X86::VPMAXSWrr, {0, Unknown}},
-    {X86::VPMAXUBYrm, {0, Unknown}},
-    {X86::VPMAXUBYrr, {0, Unknown}},
+    {X86::VPMAXSWrm, {16, SSE_PACKED_OP}},
+    {X86::VPMAXSWrr, {0, SSE_PACKED_OP}},
+    {X86::VPMAXUBYrm, {32, SSE_PACKED_OP}},
+    {X86::VPMAXUBYrr, {0, SSE_PACKED_OP}},
     {X86::VPMAXUBZ128rm, {1, Unknown}},
     {X86::VPMAXUBZ128rmk, {1, Unknown}},
     {X86::VPMAXUBZ128rmkz, {1, Unknown}},
@@ -9993,10 +9993,10 @@ static constexpr const_addl_instr_info::value_type MapData[] = {
     {X86::VPMAXUBZrr, {0, Unknown}},
     {X86::VPMAXUBZrrk, {0, Unknown}},
     {X86::VPMAXUBZrrkz, {0, Unknown}},
-    {X86::VPMAXUBrm, {0, Unknown}},
-    {X86::VPMAXUBrr, {0, Unknown}},
-    {X86::VPMAXUDYrm, {0, Unknown}},
-    {X86::VPMAXUDYrr, {0, Unknown}},
+    {X86::VPMAXUBrm, {16, SSE_PACKED_OP}},
+    {X86::VPMAXUBrr, {0, SSE_PACKED_OP}},
+    {X86::VPMAXUDYrm, {32, SSE_PACKED_OP}},
+    {X86::VPMAXUDYrr, {0, SSE_PACKED_OP}},
     {X86::VPMAXUDZ128rm, {1, Unknown}},
     {X86::VPMAXUDZ128rmb, {1, Unknown}},
     {X86::VPMAXUDZ128rmbk, {1, Unknown}},
@@ -10024,8 +10024,8 @@ static constexpr const_addl_instr_info::value_type MapData[] = {
     {X86::VPMAXUDZrr, {0, Unknown}},
     {X86::VPMAXUDZrrk, {0, Unknown}},
     {X86::VPMAXUDZrrkz, {0, Unknown}},
-    {X86::VPMAXUDrm, {0, Unknown}},
-    {X86::VPMAXUDrr, {0, Unknown}},
+    {X86::VPMAXUDrm, {16, SSE_PACKED_OP}},
+    {X86::VPMAXUDrr, {0, SSE_PACKED_OP}},
     {X86::VPMAXUQZ128rm, {1, Unknown}},
     {X86::VPMAXUQZ128rmb, {1, Unknown}},
     {X86::VPMAXUQZ128rmbk, {1, Unknown}},
@@ -10053,8 +10053,8 @@ static constexpr const_addl_instr_info::value_type MapData[] = {
     {X86::VPMAXUQZrr, {0, Unknown}},
     {X86::VPMAXUQZrrk, {0, Unknown}},
     {X86::VPMAXUQZrrkz, {0, Unknown}},
-    {X86::VPMAXUWYrm, {0, Unknown}},
-    {X86::VPMAXUWYrr, {0, Unknown}},
+    {X86::VPMAXUWYrm, {32, SSE_PACKED_OP}},
+    {X86::VPMAXUWYrr, {0, SSE_PACKED_OP}},
     {X86::VPMAXUWZ128rm, {1, Unknown}},
     {X86::VPMAXUWZ128rmk, {1, Unknown}},
     {X86::VPMAXUWZ128rmkz, {1, Unknown}},
@@ -10073,10 +10073,10 @@ static constexpr const_addl_instr_info::value_type MapData[] = {
     {X86::VPMAXUWZrr, {0, Unknown}},
     {X86::VPMAXUWZrrk, {0, Unknown}},
     {X86::VPMAXUWZrrkz, {0, Unknown}},
-    {X86::VPMAXUWrm, {0, Unknown}},
-    {X86::VPMAXUWrr, {0, Unknown}},
-    {X86::VPMINSBYrm, {0, Unknown}},
-    {X86::VPMINSBYrr, {0, Unknown}},
+    {X86::VPMAXUWrm, {16, SSE_PACKED_OP}},
+    {X86::VPMAXUWrr, {0, SSE_PACKED_OP}},
+    {X86::VPMINSBYrm, {32, SSE_PACKED_OP}},
+    {X86::VPMINSBYrr, {0, SSE_PACKED_OP}},
     {X86::VPMINSBZ128rm, {1, Unknown}},
     {X86::VPMINSBZ128rmk, {1, Unknown}},
     {X86::VPMINSBZ128rmkz, {1, Unknown}},
@@ -10095,10 +10095,10 @@ static constexpr const_addl_instr_info::value_type MapData[] = {
     {X86::VPMINSBZrr, {0, Unknown}},
     {X86::VPMINSBZrrk, {0, Unknown}},
     {X86::VPMINSBZrrkz, {0, Unknown}},
-    {X86::VPMINSBrm, {0, Unknown}},
-    {X86::VPMINSBrr, {0, Unknown}},
-    {X86::VPMINSDYrm, {0, Unknown}},
-    {X86::VPMINSDYrr, {0, Unknown}},
+    {X86::VPMINSBrm, {16, SSE_PACKED_OP}},
+    {X86::VPMINSBrr, {0, SSE_PACKED_OP}},
+    {X86::VPMINSDYrm, {32, SSE_PACKED_OP}},
+    {X86::VPMINSDYrr, {0, SSE_PACKED_OP}},
     {X86::VPMINSDZ128rm, {1, Unknown}},
     {X86::VPMINSDZ128rmb, {1, Unknown}},
     {X86::VPMINSDZ128rmbk, {1, Unknown}},
@@ -10126,8 +10126,8 @@ static constexpr const_addl_instr_info::value_type MapData[] = {
     {X86::VPMINSDZrr, {0, Unknown}},
     {X86::VPMINSDZrrk, {0, Unknown}},
     {X86::VPMINSDZrrkz, {0, Unknown}},
-    {X86::VPMINSDrm, {0, Unknown}},
-    {X86::VPMINSDrr, {0, Unknown}},
+    {X86::VPMINSDrm, {16, SSE_PACKED_OP}},
+    {X86::VPMINSDrr, {0, SSE_PACKED_OP}},
     {X86::VPMINSQZ128rm, {1, Unknown}},
     {X86::VPMINSQZ128rmb, {1, Unknown}},
     {X86::VPMINSQZ128rmbk, {1, Unknown}},
@@ -10155,8 +10155,8 @@ static constexpr const_addl_instr_info::value_type MapData[] = {
     {X86::VPMINSQZrr, {0, Unknown}},
     {X86::VPMINSQZrrk, {0, Unknown}},
     {X86::VPMINSQZrrkz, {0, Unknown}},
-    {X86::VPMINSWYrm, {0, Unknown}},
-    {X86::VPMINSWYrr, {0, Unknown}},
+    {X86::VPMINSWYrm, {32, SSE_PACKED_OP}},
+    {X86::VPMINSWYrr, {0, SSE_PACKED_OP}},
     {X86::VPMINSWZ128rm, {1, Unknown}},
     {X86::VPMINSWZ128rmk, {1, Unknown}},
     {X86::VPMINSWZ128rmkz, {1, Unknown}},
@@ -10175,10 +10175,10 @@ static constexpr const_addl_instr_info::value_type MapData[] = {
     {X86::VPMINSWZrr, {0, Unknown}},
     {X86::VPMINSWZrrk, {0, Unknown}},
     {X86::VPMINSWZrrkz, {0, Unknown}},
-    {X86::VPMINSWrm, {0, Unknown}},
-    {X86::VPMINSWrr, {0, Unknown}},
-    {X86::VPMINUBYrm, {0, Unknown}},
-    {X86::VPMINUBYrr, {0, Unknown}},
+    {X86::VPMINSWrm, {16, SSE_PACKED_OP}},
+    {X86::VPMINSWrr, {0, SSE_PACKED_OP}},
+    {X86::VPMINUBYrm, {32, SSE_PACKED_OP}},
+    {X86::VPMINUBYrr, {0, SSE_PACKED_OP}},
     {X86::VPMINUBZ128rm, {1, Unknown}},
     {X86::VPMINUBZ128rmk, {1, Unknown}},
     {X86::VPMINUBZ128rmkz, {1, Unknown}},
@@ -10197,10 +10197,10 @@ static constexpr const_addl_instr_info::value_type MapData[] = {
     {X86::VPMINUBZrr, {0, Unknown}},
     {X86::VPMINUBZrrk, {0, Unknown}},
     {X86::VPMINUBZrrkz, {0, Unknown}},
-    {X86::VPMINUBrm, {0, Unknown}},
-    {X86::VPMINUBrr, {0, Unknown}},
-    {X86::VPMINUDYrm, {0, Unknown}},
-    {X86::VPMINUDYrr, {0, Unknown}},
+    {X86::VPMINUBrm, {16, SSE_PACKED_OP}},
+    {X86::VPMINUBrr, {0, SSE_PACKED_OP}},
+    {X86::VPMINUDYrm, {32, SSE_PACKED_OP}},
+    {X86::VPMINUDYrr, {0, SSE_PACKED_OP}},
     {X86::VPMINUDZ128rm, {1, Unknown}},
     {X86::VPMINUDZ128rmb, {1, Unknown}},
     {X86::VPMINUDZ128rmbk, {1, Unknown}},
@@ -10228,8 +10228,8 @@ static constexpr const_addl_instr_info::value_type MapData[] = {
     {X86::VPMINUDZrr, {0, Unknown}},
     {X86::VPMINUDZrrk, {0, Unknown}},
     {X86::VPMINUDZrrkz, {0, Unknown}},
-    {X86::VPMINUDrm, {0, Unknown}},
-    {X86::VPMINUDrr, {0, Unknown}},
+    {X86::VPMINUDrm, {16, SSE_PACKED_OP}},
+    {X86::VPMINUDrr, {0, SSE_PACKED_OP}},
     {X86::VPMINUQZ128rm, {1, Unknown}},
     {X86::VPMINUQZ128rmb, {1, Unknown}},
     {X86::VPMINUQZ128rmbk, {1, Unknown}},
@@ -10257,8 +10257,8 @@ static constexpr const_addl_instr_info::value_type MapData[] = {
     {X86::VPMINUQZrr, {0, Unknown}},
     {X86::VPMINUQZrrk, {0, Unknown}},
     {X86::VPMINUQZrrkz, {0, Unknown}},
-    {X86::VPMINUWYrm, {0, Unknown}},
-    {X86::VPMINUWYrr, {0, Unknown}},
+    {X86::VPMINUWYrm, {32, SSE_PACKED_OP}},
+    {X86::VPMINUWYrr, {0, SSE_PACKED_OP}},
     {X86::VPMINUWZ128rm, {1, Unknown}},
     {X86::VPMINUWZ128rmk, {1, Unknown}},
     {X86::VPMINUWZ128rmkz, {1, Unknown}},
@@ -10277,8 +10277,8 @@ static constexpr const_addl_instr_info::value_type MapData[] = {
     {X86::VPMINUWZrr, {0, Unknown}},
     {X86::VPMINUWZrrk, {0, Unknown}},
     {X86::VPMINUWZrrkz, {0, Unknown}},
-    {X86::VPMINUWrm, {0, Unknown}},
-    {X86::VPMINUWrr, {0, Unknown}},
+    {X86::VPMINUWrm, {16, SSE_PACKED_OP}},
+    {X86::VPMINUWrr, {0, SSE_PACKED_OP}},
     {X86::VPMOVB2MZ128rr, {0, Unknown}},
     {X86::VPMOVB2MZ256rr, {0, Unknown}},
     {X86::VPMOVB2MZrr, {0, Unknown}},
@@ -10327,8 +10327,8 @@ static constexpr const_addl_instr_info::value_type MapData[] = {
     {X86::VPMOVM2WZ128rr, {0, Unknown}},
     {X86::VPMOVM2WZ256rr, {0, Unknown}},
     {X86::VPMOVM2WZrr, {0, Unknown}},
-    {X86::VPMOVMSKBYrr, {0, Unknown}},
-    {X86::VPMOVMSKBrr, {0, Unknown}},
+    {X86::VPMOVMSKBYrr, {0, SSE_PACKED_OP}},
+    {X86::VPMOVMSKBrr, {0, SSE_PACKED_OP}},
     {X86::VPMOVQ2MZ128rr, {0, Unknown}},
     {X86::VPMOVQ2MZ256rr, {0, Unknown}},
     {X86::VPMOVQ2MZrr, {0, Unknown}},
@@ -10936,8 +10936,8 @@ static constexpr const_addl_instr_info::value_type MapData[] = {
     {X86::VPMULHWZrrkz, {0, Unknown}},
     {X86::VPMULHWrm, {0, Unknown}},
     {X86::VPMULHWrr, {0, Unknown}},
-    {X86::VPMULLDYrm, {0, Unknown}},
-    {X86::VPMULLDYrr, {0, Unknown}},
+    {X86::VPMULLDYrm, {32, SSE_PACKED_OP}},
+    {X86::VPMULLDYrr, {0, SSE_PACKED_OP}},
     {X86::VPMULLDZ128rm, {1, Unknown}},
     {X86::VPMULLDZ128rmb, {1, Unknown}},
     {X86::VPMULLDZ128rmbk, {1, Unknown}},
@@ -10965,8 +10965,8 @@ static constexpr const_addl_instr_info::value_type MapData[] = {
     {X86::VPMULLDZrr, {0, Unknown}},
     {X86::VPMULLDZrrk, {0, Unknown}},
     {X86::VPMULLDZrrkz, {0, Unknown}},
-    {X86::VPMULLDrm, {0, Unknown}},
-    {X86::VPMULLDrr, {0, Unknown}},
+    {X86::VPMULLDrm, {16, SSE_PACKED_OP}},
+    {X86::VPMULLDrr, {0, SSE_PACKED_OP}},
     {X86::VPMULLQZ128rm, {1, Unknown}},
     {X86::VPMULLQZ128rmb, {1, Unknown}},
     {X86::VPMULLQZ128rmbk, {1, Unknown}},
@@ -10994,8 +10994,8 @@ static constexpr const_addl_instr_info::value_type MapData[] = {
     {X86::VPMULLQZrr, {0, Unknown}},
     {X86::VPMULLQZrrk, {0, Unknown}},
     {X86::VPMULLQZrrkz, {0, Unknown}},
-    {X86::VPMULLWYrm, {0, Unknown}},
-    {X86::VPMULLWYrr, {0, Unknown}},
+    {X86::VPMULLWYrm, {32, SSE_PACKED_OP}},
+    {X86::VPMULLWYrr, {0, SSE_PACKED_OP}},
     {X86::VPMULLWZ128rm, {1, Unknown}},
     {X86::VPMULLWZ128rmk, {1, Unknown}},
     {X86::VPMULLWZ128rmkz, {1, Unknown}},
@@ -11014,8 +11014,8 @@ static constexpr const_addl_instr_info::value_type MapData[] = {
     {X86::VPMULLWZrr, {0, Unknown}},
     {X86::VPMULLWZrrk, {0, Unknown}},
     {X86::VPMULLWZrrkz, {0, Unknown}},
-    {X86::VPMULLWrm, {0, Unknown}},
-    {X86::VPMULLWrr, {0, Unknown}},
+    {X86::VPMULLWrm, {16, SSE_PACKED_OP}},
+    {X86::VPMULLWrr, {0, SSE_PACKED_OP}},
     {X86::VPMULTISHIFTQBZ128rm, {1, Unknown}},
     {X86::VPMULTISHIFTQBZ128rmb, {1, Unknown}},
     {X86::VPMULTISHIFTQBZ128rmbk, {1, Unknown}},
@@ -11218,10 +11218,10 @@ static constexpr const_addl_instr_info::value_type MapData[] = {
     {X86::VPORQZrr, {0, Unknown}},
     {X86::VPORQZrrk, {0, Unknown}},
     {X86::VPORQZrrkz, {0, Unknown}},
-    {X86::VPORYrm, {0, Unknown}},
-    {X86::VPORYrr, {0, Unknown}},
-    {X86::VPORrm, {0, Unknown}},
-    {X86::VPORrr, {0, Unknown}},
+    {X86::VPORYrm, {32, SSE_PACKED_OP}},
+    {X86::VPORYrr, {0, SSE_PACKED_OP}},
+    {X86::VPORrm, {16, SSE_PACKED_OP}},
+    {X86::VPORrr, {0, SSE_PACKED_OP}},
     {X86::VPPERMrmr, {0, Unknown}},
     {X86::VPPERMrrm, {0, Unknown}},
     {X86::VPPERMrrr, {0, Unknown}},
@@ -11820,8 +11820,8 @@ static constexpr const_addl_instr_info::value_type MapData[] = {
     {X86::VPSHUFBITQMBZrmk, {0, Unknown}},
     {X86::VPSHUFBITQMBZrr, {0, Unknown}},
     {X86::VPSHUFBITQMBZrrk, {0, Unknown}},
-    {X86::VPSHUFBYrm, {0, Unknown}},
-    {X86::VPSHUFBYrr, {0, Unknown}},
+    {X86::VPSHUFBYrm, {32, SSE_PACKED_OP}},
+    {X86::VPSHUFBYrr, {0, SSE_PACKED_OP}},
     {X86::VPSHUFBZ128rm, {1, Unknown}},
     {X86::VPSHUFBZ128rmk, {1, Unknown}},
     {X86::VPSHUFBZ128rmkz, {1, Unknown}},
@@ -11840,10 +11840,10 @@ static constexpr const_addl_instr_info::value_type MapData[] = {
     {X86::VPSHUFBZrr, {0, Unknown}},
     {X86::VPSHUFBZrrk, {0, Unknown}},
     {X86::VPSHUFBZrrkz, {0, Unknown}},
-    {X86::VPSHUFBrm, {0, Unknown}},
-    {X86::VPSHUFBrr, {0, Unknown}},
-    {X86::VPSHUFDYmi, {0, Unknown}},
-    {X86::VPSHUFDYri, {0, Unknown}},
+    {X86::VPSHUFBrm, {16, SSE_PACKED_OP}},
+    {X86::VPSHUFBrr, {0, SSE_PACKED_OP}},
+    {X86::VPSHUFDYmi, {32, SSE_PACKED_OP}},
+    {X86::VPSHUFDYri, {0, SSE_PACKED_OP}},
     {X86::VPSHUFDZ128mbi, {0, Unknown}},
     {X86::VPSHUFDZ128mbik, {0, Unknown}},
     {X86::VPSHUFDZ128mbikz, {0, Unknown}},
@@ -11871,8 +11871,8 @@ static constexpr const_addl_instr_info::value_type MapData[] = {
     {X86::VPSHUFDZri, {0, Unknown}},
     {X86::VPSHUFDZrik, {0, Unknown}},
     {X86::VPSHUFDZrikz, {0, Unknown}},
-    {X86::VPSHUFDmi, {0, Unknown}},
-    {X86::VPSHUFDri, {0, Unknown}},
+    {X86::VPSHUFDmi, {16, SSE_PACKED_OP}},
+    {X86::VPSHUFDri, {0, SSE_PACKED_OP}},
     {X86::VPSHUFHWYmi, {0, Unknown}},
     {X86::VPSHUFHWYri, {0, Unknown}},
     {X86::VPSHUFHWZ128mi, {1, Unknown}},
@@ -11931,7 +11931,7 @@ static constexpr const_addl_instr_info::value_type MapData[] = {
     {X86::VPSIGNWrr, {0, Unknown}},
     {X86::VPSLLDQYri, {0, Unknown}},
     {X86::VPSLLDQri, {0, Unknown}},
-    {X86::VPSLLDYri, {0, Unknown}},
+    {X86::VPSLLDYri, {0, SSE_PACKED_OP}},
     {X86::VPSLLDYrm, {0, Unknown}},
     {X86::VPSLLDYrr, {0, Unknown}},
     {X86::VPSLLDZ128mbi, {0, Unknown}},
@@ -11979,10 +11979,10 @@ static constexpr const_addl_instr_info::value_type MapData[] = {
     {X86::VPSLLDZrr, {0, Unknown}},
     {X86::VPSLLDZrrk, {0, Unknown}},
     {X86::VPSLLDZrrkz, {0, Unknown}},
-    {X86::VPSLLDri, {0, Unknown}},
+    {X86::VPSLLDri, {0, SSE_PACKED_OP}},
     {X86::VPSLLDrm, {0, Unknown}},
     {X86::VPSLLDrr, {0, Unknown}},
-    {X86::VPSLLQYri, {0, Unknown}},
+    {X86::VPSLLQYri, {0, SSE_PACKED_OP}},
     {X86::VPSLLQYrm, {0, Unknown}},
     {X86::VPSLLQYrr, {0, Unknown}},
     {X86::VPSLLQZ128mbi, {0, Unknown}},
@@ -12030,11 +12030,11 @@ static constexpr const_addl_instr_info::value_type MapData[] = {
     {X86::VPSLLQZrr, {0, Unknown}},
     {X86::VPSLLQZrrk, {0, Unknown}},
     {X86::VPSLLQZrrkz, {0, Unknown}},
-    {X86::VPSLLQri, {0, Unknown}},
+    {X86::VPSLLQri, {0, SSE_PACKED_OP}},
     {X86::VPSLLQrm, {0, Unknown}},
     {X86::VPSLLQrr, {0, Unknown}},
-    {X86::VPSLLVDYrm, {0, Unknown}},
-    {X86::VPSLLVDYrr, {0, Unknown}},
+    {X86::VPSLLVDYrm, {32, SSE_PACKED_OP}},
+    {X86::VPSLLVDYrr, {0, SSE_PACKED_OP}},
     {X86::VPSLLVDZ128rm, {1, Unknown}},
     {X86::VPSLLVDZ128rmb, {1, Unknown}},
     {X86::VPSLLVDZ128rmbk, {1, Unknown}},
@@ -12062,10 +12062,10 @@ static constexpr const_addl_instr_info::value_type MapData[] = {
     {X86::VPSLLVDZrr, {0, Unknown}},
     {X86::VPSLLVDZrrk, {0, Unknown}},
     {X86::VPSLLVDZrrkz, {0, Unknown}},
-    {X86::VPSLLVDrm, {0, Unknown}},
-    {X86::VPSLLVDrr, {0, Unknown}},
-    {X86::VPSLLVQYrm, {0, Unknown}},
-    {X86::VPSLLVQYrr, {0, Unknown}},
+    {X86::VPSLLVDrm, {16, SSE_PACKED_OP}},
+    {X86::VPSLLVDrr, {0, SSE_PACKED_OP}},
+    {X86::VPSLLVQYrm, {32, SSE_PACKED_OP}},
+    {X86::VPSLLVQYrr, {0, SSE_PACKED_OP}},
     {X86::VPSLLVQZ128rm, {1, Unknown}},
     {X86::VPSLLVQZ128rmb, {1, Unknown}},
     {X86::VPSLLVQZ128rmbk, {1, Unknown}},
@@ -12093,8 +12093,8 @@ static constexpr const_addl_instr_info::value_type MapData[] = {
     {X86::VPSLLVQZrr, {0, Unknown}},
     {X86::VPSLLVQZrrk, {0, Unknown}},
     {X86::VPSLLVQZrrkz, {0, Unknown}},
-    {X86::VPSLLVQrm, {0, Unknown}},
-    {X86::VPSLLVQrr, {0, Unknown}},
+    {X86::VPSLLVQrm, {16, SSE_PACKED_OP}},
+    {X86::VPSLLVQrr, {0, SSE_PACKED_OP}},
     {X86::VPSLLVWZ128rm, {1, Unknown}},
     {X86::VPSLLVWZ128rmk, {1, Unknown}},
     {X86::VPSLLVWZ128rmkz, {1, Unknown}},
@@ -12113,7 +12113,7 @@ static constexpr const_addl_instr_info::value_type MapData[] = {
     {X86::VPSLLVWZrr, {0, Unknown}},
     {X86::VPSLLVWZrrk, {0, Unknown}},
     {X86::VPSLLVWZrrkz, {0, Unknown}},
-    {X86::VPSLLWYri, {0, Unknown}},
+    {X86::VPSLLWYri, {0, SSE_PACKED_OP}},
     {X86::VPSLLWYrm, {0, Unknown}},
     {X86::VPSLLWYrr, {0, Unknown}},
     {X86::VPSLLWZ128mi, {1, Unknown}},
@@ -12152,10 +12152,10 @@ static constexpr const_addl_instr_info::value_type MapData[] = {
     {X86::VPSLLWZrr, {0, Unknown}},
     {X86::VPSLLWZrrk, {0, Unknown}},
     {X86::VPSLLWZrrkz, {0, Unknown}},
-    {X86::VPSLLWri, {0, Unknown}},
+    {X86::VPSLLWri, {0, SSE_PACKED_OP}},
     {X86::VPSLLWrm, {0, Unknown}},
     {X86::VPSLLWrr, {0, Unknown}},
-    {X86::VPSRADYri, {0, Unknown}},
+    {X86::VPSRADYri, {0, SSE_PACKED_OP}},
     {X86::VPSRADYrm, {0, Unknown}},
     {X86::VPSRADYrr, {0, Unknown}},
     {X86::VPSRADZ128mbi, {0, Unknown}},
@@ -12203,7 +12203,7 @@ static constexpr const_addl_instr_info::value_type MapData[] = {
     {X86::VPSRADZrr, {0, Unknown}},
     {X86::VPSRADZrrk, {0, Unknown}},
     {X86::VPSRADZrrkz, {0, Unknown}},
-    {X86::VPSRADri, {0, Unknown}},
+    {X86::VPSRADri, {0, SSE_PACKED_OP}},
     {X86::VPSRADrm, {0, Unknown}},
     {X86::VPSRADrr, {0, Unknown}},
     {X86::VPSRAQZ128mbi, {0, Unknown}},
@@ -12251,8 +12251,8 @@ static constexpr const_addl_instr_info::value_type MapData[] = {
     {X86::VPSRAQZrr, {0, Unknown}},
     {X86::VPSRAQZrrk, {0, Unknown}},
     {X86::VPSRAQZrrkz, {0, Unknown}},
-    {X86::VPSRAVDYrm, {0, Unknown}},
-    {X86::VPSRAVDYrr, {0, Unknown}},
+    {X86::VPSRAVDYrm, {32, SSE_PACKED_OP}},
+    {X86::VPSRAVDYrr, {0, SSE_PACKED_OP}},
     {X86::VPSRAVDZ128rm, {1, Unknown}},
     {X86::VPSRAVDZ128rmb, {1, Unknown}},
     {X86::VPSRAVDZ128rmbk, {1, Unknown}},
@@ -12280,8 +12280,8 @@ static constexpr const_addl_instr_info::value_type MapData[] = {
     {X86::VPSRAVDZrr, {0, Unknown}},
     {X86::VPSRAVDZrrk, {0, Unknown}},
     {X86::VPSRAVDZrrkz, {0, Unknown}},
-    {X86::VPSRAVDrm, {0, Unknown}},
-    {X86::VPSRAVDrr, {0, Unknown}},
+    {X86::VPSRAVDrm, {16, SSE_PACKED_OP}},
+    {X86::VPSRAVDrr, {0, SSE_PACKED_OP}},
     {X86::VPSRAVQZ128rm, {1, Unknown}},
     {X86::VPSRAVQZ128rmb, {1, Unknown}},
     {X86::VPSRAVQZ128rmbk, {1, Unknown}},
@@ -12327,7 +12327,7 @@ static constexpr const_addl_instr_info::value_type MapData[] = {
     {X86::VPSRAVWZrr, {0, Unknown}},
     {X86::VPSRAVWZrrk, {0, Unknown}},
     {X86::VPSRAVWZrrkz, {0, Unknown}},
-    {X86::VPSRAWYri, {0, Unknown}},
+    {X86::VPSRAWYri, {0, SSE_PACKED_OP}},
     {X86::VPSRAWYrm, {0, Unknown}},
     {X86::VPSRAWYrr, {0, Unknown}},
     {X86::VPSRAWZ128mi, {1, Unknown}},
@@ -12366,12 +12366,12 @@ static constexpr const_addl_instr_info::value_type MapData[] = {
     {X86::VPSRAWZrr, {0, Unknown}},
     {X86::VPSRAWZrrk, {0, Unknown}},
     {X86::VPSRAWZrrkz, {0, Unknown}},
-    {X86::VPSRAWri, {0, Unknown}},
+    {X86::VPSRAWri, {0, SSE_PACKED_OP}},
     {X86::VPSRAWrm, {0, Unknown}},
     {X86::VPSRAWrr, {0, Unknown}},
     {X86::VPSRLDQYri, {0, Unknown}},
     {X86::VPSRLDQri, {0, Unknown}},
-    {X86::VPSRLDYri, {0, Unknown}},
+    {X86::VPSRLDYri, {0, SSE_PACKED_OP}},
     {X86::VPSRLDYrm, {0, Unknown}},
     {X86::VPSRLDYrr, {0, Unknown}},
     {X86::VPSRLDZ128mbi, {0, Unknown}},
@@ -12419,10 +12419,10 @@ static constexpr const_addl_instr_info::value_type MapData[] = {
     {X86::VPSRLDZrr, {0, Unknown}},
     {X86::VPSRLDZrrk, {0, Unknown}},
     {X86::VPSRLDZrrkz, {0, Unknown}},
-    {X86::VPSRLDri, {0, Unknown}},
+    {X86::VPSRLDri, {0, SSE_PACKED_OP}},
     {X86::VPSRLDrm, {0, Unknown}},
     {X86::VPSRLDrr, {0, Unknown}},
-    {X86::VPSRLQYri, {0, Unknown}},
+    {X86::VPSRLQYri, {0, SSE_PACKED_OP}},
     {X86::VPSRLQYrm, {0, Unknown}},
     {X86::VPSRLQYrr, {0, Unknown}},
     {X86::VPSRLQZ128mbi, {0, Unknown}},
@@ -12470,11 +12470,11 @@ static constexpr const_addl_instr_info::value_type MapData[] = {
     {X86::VPSRLQZrr, {0, Unknown}},
     {X86::VPSRLQZrrk, {0, Unknown}},
     {X86::VPSRLQZrrkz, {0, Unknown}},
-    {X86::VPSRLQri, {0, Unknown}},
+    {X86::VPSRLQri, {0, SSE_PACKED_OP}},
     {X86::VPSRLQrm, {0, Unknown}},
     {X86::VPSRLQrr, {0, Unknown}},
-    {X86::VPSRLVDYrm, {0, Unknown}},
-    {X86::VPSRLVDYrr, {0, Unknown}},
+    {X86::VPSRLVDYrm, {32, SSE_PACKED_OP}},
+    {X86::VPSRLVDYrr, {0, SSE_PACKED_OP}},
     {X86::VPSRLVDZ128rm, {1, Unknown}},
     {X86::VPSRLVDZ128rmb, {1, Unknown}},
     {X86::VPSRLVDZ128rmbk, {1, Unknown}},
@@ -12502,10 +12502,10 @@ static constexpr const_addl_instr_info::value_type MapData[] = {
     {X86::VPSRLVDZrr, {0, Unknown}},
     {X86::VPSRLVDZrrk, {0, Unknown}},
     {X86::VPSRLVDZrrkz, {0, Unknown}},
-    {X86::VPSRLVDrm, {0, Unknown}},
-    {X86::VPSRLVDrr, {0, Unknown}},
-    {X86::VPSRLVQYrm, {0, Unknown}},
-    {X86::VPSRLVQYrr, {0, Unknown}},
+    {X86::VPSRLVDrm, {16, SSE_PACKED_OP}},
+    {X86::VPSRLVDrr, {0, SSE_PACKED_OP}},
+    {X86::VPSRLVQYrm, {32, SSE_PACKED_OP}},
+    {X86::VPSRLVQYrr, {0, SSE_PACKED_OP}},
     {X86::VPSRLVQZ128rm, {1, Unknown}},
     {X86::VPSRLVQZ128rmb, {1, Unknown}},
     {X86::VPSRLVQZ128rmbk, {1, Unknown}},
@@ -12533,8 +12533,8 @@ static constexpr const_addl_instr_info::value_type MapData[] = {
     {X86::VPSRLVQZrr, {0, Unknown}},
     {X86::VPSRLVQZrrk, {0, Unknown}},
     {X86::VPSRLVQZrrkz, {0, Unknown}},
-    {X86::VPSRLVQrm, {0, Unknown}},
-    {X86::VPSRLVQrr, {0, Unknown}},
+    {X86::VPSRLVQrm, {16, SSE_PACKED_OP}},
+    {X86::VPSRLVQrr, {0, SSE_PACKED_OP}},
     {X86::VPSRLVWZ128rm, {1, Unknown}},
     {X86::VPSRLVWZ128rmk, {1, Unknown}},
     {X86::VPSRLVWZ128rmkz, {1, Unknown}},
@@ -12553,7 +12553,7 @@ static constexpr const_addl_instr_info::value_type MapData[] = {
     {X86::VPSRLVWZrr, {0, Unknown}},
     {X86::VPSRLVWZrrk, {0, Unknown}},
     {X86::VPSRLVWZrrkz, {0, Unknown}},
-    {X86::VPSRLWYri, {0, Unknown}},
+    {X86::VPSRLWYri, {0, SSE_PACKED_OP}},
     {X86::VPSRLWYrm, {0, Unknown}},
     {X86::VPSRLWYrr, {0, Unknown}},
     {X86::VPSRLWZ128mi, {1, Unknown}},
@@ -12592,11 +12592,11 @@ static constexpr const_addl_instr_info::value_type MapData[] = {
     {X86::VPSRLWZrr, {0, Unknown}},
     {X86::VPSRLWZrrk, {0, Unknown}},
     {X86::VPSRLWZrrkz, {0, Unknown}},
-    {X86::VPSRLWri, {0, Unknown}},
+    {X86::VPSRLWri, {0, SSE_PACKED_OP}},
     {X86::VPSRLWrm, {0, Unknown}},
     {X86::VPSRLWrr, {0, Unknown}},
-    {X86::VPSUBBYrm, {0, Unknown}},
-    {X86::VPSUBBYrr, {0, Unknown}},
+    {X86::VPSUBBYrm, {32, SSE_PACKED_OP}},
+    {X86::VPSUBBYrr, {0, SSE_PACKED_OP}},
     {X86::VPSUBBZ128rm, {1, Unknown}},
     {X86::VPSUBBZ128rmk, {1, Unknown}},
     {X86::VPSUBBZ128rmkz, {1, Unknown}},
@@ -12615,10 +12615,10 @@ static constexpr const_addl_instr_info::value_type MapData[] = {
     {X86::VPSUBBZrr, {0, Unknown}},
     {X86::VPSUBBZrrk, {0, Unknown}},
     {X86::VPSUBBZrrkz, {0, Unknown}},
-    {X86::VPSUBBrm, {0, Unknown}},
-    {X86::VPSUBBrr, {0, Unknown}},
-    {X86::VPSUBDYrm, {0, Unknown}},
-    {X86::VPSUBDYrr, {0, Unknown}},
+    {X86::VPSUBBrm, {16, SSE_PACKED_OP}},
+    {X86::VPSUBBrr, {0, SSE_PACKED_OP}},
+    {X86::VPSUBDYrm, {32, SSE_PACKED_OP}},
+    {X86::VPSUBDYrr, {0, SSE_PACKED_OP}},
     {X86::VPSUBDZ128rm, {1, Unknown}},
     {X86::VPSUBDZ128rmb, {1, Unknown}},
     {X86::VPSUBDZ128rmbk, {1, Unknown}},
@@ -12646,10 +12646,10 @@ static constexpr const_addl_instr_info::value_type MapData[] = {
     {X86::VPSUBDZrr, {0, Unknown}},
     {X86::VPSUBDZrrk, {0, Unknown}},
     {X86::VPSUBDZrrkz, {0, Unknown}},
-    {X86::VPSUBDrm, {0, Unknown}},
-    {X86::VPSUBDrr, {0, Unknown}},
-    {X86::VPSUBQYrm, {0, Unknown}},
-    {X86::VPSUBQYrr, {0, Unknown}},
+    {X86::VPSUBDrm, {16, SSE_PACKED_OP}},
+    {X86::VPSUBDrr, {0, SSE_PACKED_OP}},
+    {X86::VPSUBQYrm, {32, SSE_PACKED_OP}},
+    {X86::VPSUBQYrr, {0, SSE_PACKED_OP}},
     {X86::VPSUBQZ128rm, {1, Unknown}},
     {X86::VPSUBQZ128rmb, {1, Unknown}},
     {X86::VPSUBQZ128rmbk, {1, Unknown}},
@@ -12677,10 +12677,10 @@ static constexpr const_addl_instr_info::value_type MapData[] = {
     {X86::VPSUBQZrr, {0, Unknown}},
     {X86::VPSUBQZrrk, {0, Unknown}},
     {X86::VPSUBQZrrkz, {0, Unknown}},
-    {X86::VPSUBQrm, {0, Unknown}},
-    {X86::VPSUBQrr, {0, Unknown}},
-    {X86::VPSUBSBYrm, {0, Unknown}},
-    {X86::VPSUBSBYrr, {0, Unknown}},
+    {X86::VPSUBQrm, {16, SSE_PACKED_OP}},
+    {X86::VPSUBQrr, {0, SSE_PACKED_OP}},
+    {X86::VPSUBSBYrm, {32, SSE_PACKED_OP}},
+    {X86::VPSUBSBYrr, {0, SSE_PACKED_OP}},
     {X86::VPSUBSBZ128rm, {1, Unknown}},
     {X86::VPSUBSBZ128rmk, {1, Unknown}},
     {X86::VPSUBSBZ128rmkz, {1, Unknown}},
@@ -12699,10 +12699,10 @@ static constexpr const_addl_instr_info::value_type MapData[] = {
     {X86::VPSUBSBZrr, {0, Unknown}},
     {X86::VPSUBSBZrrk, {0, Unknown}},
     {X86::VPSUBSBZrrkz, {0, Unknown}},
-    {X86::VPSUBSBrm, {0, Unknown}},
-    {X86::VPSUBSBrr, {0, Unknown}},
-    {X86::VPSUBSWYrm, {0, Unknown}},
-    {X86::VPSUBSWYrr, {0, Unknown}},
+    {X86::VPSUBSBrm, {16, SSE_PACKED_OP}},
+    {X86::VPSUBSBrr, {0, SSE_PACKED_OP}},
+    {X86::VPSUBSWYrm, {32, SSE_PACKED_OP}},
+    {X86::VPSUBSWYrr, {0, SSE_PACKED_OP}},
     {X86::VPSUBSWZ128rm, {1, Unknown}},
     {X86::VPSUBSWZ128rmk, {1, Unknown}},
     {X86::VPSUBSWZ128rmkz, {1, Unknown}},
@@ -12721,10 +12721,10 @@ static constexpr const_addl_instr_info::value_type MapData[] = {
     {X86::VPSUBSWZrr, {0, Unknown}},
     {X86::VPSUBSWZrrk, {0, Unknown}},
     {X86::VPSUBSWZrrkz, {0, Unknown}},
-    {X86::VPSUBSWrm, {0, Unknown}},
-    {X86::VPSUBSWrr, {0, Unknown}},
-    {X86::VPSUBUSBYrm, {0, Unknown}},
-    {X86::VPSUBUSBYrr, {0, Unknown}},
+    {X86::VPSUBSWrm, {16, SSE_PACKED_OP}},
+    {X86::VPSUBSWrr, {0, SSE_PACKED_OP}},
+    {X86::VPSUBUSBYrm, {32, SSE_PACKED_OP}},
+    {X86::VPSUBUSBYrr, {0, SSE_PACKED_OP}},
     {X86::VPSUBUSBZ128rm, {1, Unknown}},
     {X86::VPSUBUSBZ128rmk, {1, Unknown}},
     {X86::VPSUBUSBZ128rmkz, {1, Unknown}},
@@ -12743,10 +12743,10 @@ static constexpr const_addl_instr_info::value_type MapData[] = {
     {X86::VPSUBUSBZrr, {0, Unknown}},
     {X86::VPSUBUSBZrrk, {0, Unknown}},
     {X86::VPSUBUSBZrrkz, {0, Unknown}},
-    {X86::VPSUBUSBrm, {0, Unknown}},
-    {X86::VPSUBUSBrr, {0, Unknown}},
-    {X86::VPSUBUSWYrm, {0, Unknown}},
-    {X86::VPSUBUSWYrr, {0, Unknown}},
+    {X86::VPSUBUSBrm, {16, SSE_PACKED_OP}},
+    {X86::VPSUBUSBrr, {0, SSE_PACKED_OP}},
+    {X86::VPSUBUSWYrm, {32, SSE_PACKED_OP}},
+    {X86::VPSUBUSWYrr, {0, SSE_PACKED_OP}},
     {X86::VPSUBUSWZ128rm, {1, Unknown}},
     {X86::VPSUBUSWZ128rmk, {1, Unknown}},
     {X86::VPSUBUSWZ128rmkz, {1, Unknown}},
@@ -12765,10 +12765,10 @@ static constexpr const_addl_instr_info::value_type MapData[] = {
     {X86::VPSUBUSWZrr, {0, Unknown}},
     {X86::VPSUBUSWZrrk, {0, Unknown}},
     {X86::VPSUBUSWZrrkz, {0, Unknown}},
-    {X86::VPSUBUSWrm, {0, Unknown}},
-    {X86::VPSUBUSWrr, {0, Unknown}},
-    {X86::VPSUBWYrm, {0, Unknown}},
-    {X86::VPSUBWYrr, {0, Unknown}},
+    {X86::VPSUBUSWrm, {16, SSE_PACKED_OP}},
+    {X86::VPSUBUSWrr, {0, SSE_PACKED_OP}},
+    {X86::VPSUBWYrm, {32, SSE_PACKED_OP}},
+    {X86::VPSUBWYrr, {0, SSE_PACKED_OP}},
     {X86::VPSUBWZ128rm, {1, Unknown}},
     {X86::VPSUBWZ128rmk, {1, Unknown}},
     {X86::VPSUBWZ128rmkz, {1, Unknown}},
@@ -12787,8 +12787,8 @@ static constexpr const_addl_instr_info::value_type MapData[] = {
     {X86::VPSUBWZrr, {0, Unknown}},
     {X86::VPSUBWZrrk, {0, Unknown}},
     {X86::VPSUBWZrrkz, {0, Unknown}},
-    {X86::VPSUBWrm, {0, Unknown}},
-    {X86::VPSUBWrr, {0, Unknown}},
+    {X86::VPSUBWrm, {16, SSE_PACKED_OP}},
+    {X86::VPSUBWrr, {0, SSE_PACKED_OP}},
     {X86::VPTERNLOGDZ128rmbi, {1, Unknown}},
     {X86::VPTERNLOGDZ128rmbik, {1, Unknown}},
     {X86::VPTERNLOGDZ128rmbikz, {1, Unknown}},
@@ -12967,8 +12967,8 @@ static constexpr const_addl_instr_info::value_type MapData[] = {
     {X86::VPTESTYrr, {0, Unknown}},
     {X86::VPTESTrm, {0, Unknown}},
     {X86::VPTESTrr, {0, Unknown}},
-    {X86::VPUNPCKHBWYrm, {0, Unknown}},
-    {X86::VPUNPCKHBWYrr, {0, Unknown}},
+    {X86::VPUNPCKHBWYrm, {32, SSE_PACKED_OP}},
+    {X86::VPUNPCKHBWYrr, {0, SSE_PACKED_OP}},
     {X86::VPUNPCKHBWZ128rm, {1, Unknown}},
     {X86::VPUNPCKHBWZ128rmk, {1, Unknown}},
     {X86::VPUNPCKHBWZ128rmkz, {1, Unknown}},
@@ -12987,10 +12987,10 @@ static constexpr const_addl_instr_info::value_type MapData[] = {
     {X86::VPUNPCKHBWZrr, {0, Unknown}},
     {X86::VPUNPCKHBWZrrk, {0, Unknown}},
     {X86::VPUNPCKHBWZrrkz, {0, Unknown}},
-    {X86::VPUNPCKHBWrm, {0, Unknown}},
-    {X86::VPUNPCKHBWrr, {0, Unknown}},
-    {X86::VPUNPCKHDQYrm, {0, Unknown}},
-    {X86::VPUNPCKHDQYrr, {0, Unknown}},
+    {X86::VPUNPCKHBWrm, {16, SSE_PACKED_OP}},
+    {X86::VPUNPCKHBWrr, {0, SSE_PACKED_OP}},
+    {X86::VPUNPCKHDQYrm, {32, SSE_PACKED_OP}},
+    {X86::VPUNPCKHDQYrr, {0, SSE_PACKED_OP}},
     {X86::VPUNPCKHDQZ128rm, {1, Unknown}},
     {X86::VPUNPCKHDQZ128rmb, {1, Unknown}},
     {X86::VPUNPCKHDQZ128rmbk, {1, Unknown}},
@@ -13018,10 +13018,10 @@ static constexpr const_addl_instr_info::value_type MapData[] = {
     {X86::VPUNPCKHDQZrr, {0, Unknown}},
     {X86::VPUNPCKHDQZrrk, {0, Unknown}},
     {X86::VPUNPCKHDQZrrkz, {0, Unknown}},
-    {X86::VPUNPCKHDQrm, {0, Unknown}},
-    {X86::VPUNPCKHDQrr, {0, Unknown}},
-    {X86::VPUNPCKHQDQYrm, {0, Unknown}},
-    {X86::VPUNPCKHQDQYrr, {0, Unknown}},
+    {X86::VPUNPCKHDQrm, {16, SSE_PACKED_OP}},
+    {X86::VPUNPCKHDQrr, {0, SSE_PACKED_OP}},
+    {X86::VPUNPCKHQDQYrm, {32, SSE_PACKED_OP}},
+    {X86::VPUNPCKHQDQYrr, {0, SSE_PACKED_OP}},
     {X86::VPUNPCKHQDQZ128rm, {1, Unknown}},
     {X86::VPUNPCKHQDQZ128rmb, {1, Unknown}},
     {X86::VPUNPCKHQDQZ128rmbk, {1, Unknown}},
@@ -13049,10 +13049,10 @@ static constexpr const_addl_instr_info::value_type MapData[] = {
     {X86::VPUNPCKHQDQZrr, {0, Unknown}},
     {X86::VPUNPCKHQDQZrrk, {0, Unknown}},
     {X86::VPUNPCKHQDQZrrkz, {0, Unknown}},
-    {X86::VPUNPCKHQDQrm, {0, Unknown}},
-    {X86::VPUNPCKHQDQrr, {0, Unknown}},
-    {X86::VPUNPCKHWDYrm, {0, Unknown}},
-    {X86::VPUNPCKHWDYrr, {0, Unknown}},
+    {X86::VPUNPCKHQDQrm, {16, SSE_PACKED_OP}},
+    {X86::VPUNPCKHQDQrr, {0, SSE_PACKED_OP}},
+    {X86::VPUNPCKHWDYrm, {32, SSE_PACKED_OP}},
+    {X86::VPUNPCKHWDYrr, {0, SSE_PACKED_OP}},
     {X86::VPUNPCKHWDZ128rm, {1, Unknown}},
     {X86::VPUNPCKHWDZ128rmk, {1, Unknown}},
     {X86::VPUNPCKHWDZ128rmkz, {1, Unknown}},
@@ -13071,10 +13071,10 @@ static constexpr const_addl_instr_info::value_type MapData[] = {
     {X86::VPUNPCKHWDZrr, {0, Unknown}},
     {X86::VPUNPCKHWDZrrk, {0, Unknown}},
     {X86::VPUNPCKHWDZrrkz, {0, Unknown}},
-    {X86::VPUNPCKHWDrm, {0, Unknown}},
-    {X86::VPUNPCKHWDrr, {0, Unknown}},
-    {X86::VPUNPCKLBWYrm, {0, Unknown}},
-    {X86::VPUNPCKLBWYrr, {0, Unknown}},
+    {X86::VPUNPCKHWDrm, {16, SSE_PACKED_OP}},
+    {X86::VPUNPCKHWDrr, {0, SSE_PACKED_OP}},
+    {X86::VPUNPCKLBWYrm, {32, SSE_PACKED_OP}},
+    {X86::VPUNPCKLBWYrr, {0, SSE_PACKED_OP}},
     {X86::VPUNPCKLBWZ128rm, {1, Unknown}},
     {X86::VPUNPCKLBWZ128rmk, {1, Unknown}},
     {X86::VPUNPCKLBWZ128rmkz, {1, Unknown}},
@@ -13093,10 +13093,10 @@ static constexpr const_addl_instr_info::value_type MapData[] = {
     {X86::VPUNPCKLBWZrr, {0, Unknown}},
     {X86::VPUNPCKLBWZrrk, {0, Unknown}},
     {X86::VPUNPCKLBWZrrkz, {0, Unknown}},
-    {X86::VPUNPCKLBWrm, {0, Unknown}},
-    {X86::VPUNPCKLBWrr, {0, Unknown}},
-    {X86::VPUNPCKLDQYrm, {0, Unknown}},
-    {X86::VPUNPCKLDQYrr, {0, Unknown}},
+    {X86::VPUNPCKLBWrm, {16, SSE_PACKED_OP}},
+    {X86::VPUNPCKLBWrr, {0, SSE_PACKED_OP}},
+    {X86::VPUNPCKLDQYrm, {32, SSE_PACKED_OP}},
+    {X86::VPUNPCKLDQYrr, {0, SSE_PACKED_OP}},
     {X86::VPUNPCKLDQZ128rm, {1, Unknown}},
     {X86::VPUNPCKLDQZ128rmb, {1, Unknown}},
     {X86::VPUNPCKLDQZ128rmbk, {1, Unknown}},
@@ -13124,10 +13124,10 @@ static constexpr const_addl_instr_info::value_type MapData[] = {
     {X86::VPUNPCKLDQZrr, {0, Unknown}},
     {X86::VPUNPCKLDQZrrk, {0, Unknown}},
     {X86::VPUNPCKLDQZrrkz, {0, Unknown}},
-    {X86::VPUNPCKLDQrm, {0, Unknown}},
-    {X86::VPUNPCKLDQrr, {0, Unknown}},
-    {X86::VPUNPCKLQDQYrm, {0, Unknown}},
-    {X86::VPUNPCKLQDQYrr, {0, Unknown}},
+    {X86::VPUNPCKLDQrm, {16, SSE_PACKED_OP}},
+    {X86::VPUNPCKLDQrr, {0, SSE_PACKED_OP}},
+    {X86::VPUNPCKLQDQYrm, {32, SSE_PACKED_OP}},
+    {X86::VPUNPCKLQDQYrr, {0, SSE_PACKED_OP}},
     {X86::VPUNPCKLQDQZ128rm, {1, Unknown}},
     {X86::VPUNPCKLQDQZ128rmb, {1, Unknown}},
     {X86::VPUNPCKLQDQZ128rmbk, {1, Unknown}},
@@ -13155,10 +13155,10 @@ static constexpr const_addl_instr_info::value_type MapData[] = {
     {X86::VPUNPCKLQDQZrr, {0, Unknown}},
     {X86::VPUNPCKLQDQZrrk, {0, Unknown}},
     {X86::VPUNPCKLQDQZrrkz, {0, Unknown}},
-    {X86::VPUNPCKLQDQrm, {0, Unknown}},
-    {X86::VPUNPCKLQDQrr, {0, Unknown}},
-    {X86::VPUNPCKLWDYrm, {0, Unknown}},
-    {X86::VPUNPCKLWDYrr, {0, Unknown}},
+    {X86::VPUNPCKLQDQrm, {16, SSE_PACKED_OP}},
+    {X86::VPUNPCKLQDQrr, {0, SSE_PACKED_OP}},
+    {X86::VPUNPCKLWDYrm, {32, SSE_PACKED_OP}},
+    {X86::VPUNPCKLWDYrr, {0, SSE_PACKED_OP}},
     {X86::VPUNPCKLWDZ128rm, {1, Unknown}},
     {X86::VPUNPCKLWDZ128rmk, {1, Unknown}},
     {X86::VPUNPCKLWDZ128rmkz, {1, Unknown}},
@@ -13177,8 +13177,8 @@ static constexpr const_addl_instr_info::value_type MapData[] = {
     {X86::VPUNPCKLWDZrr, {0, Unknown}},
     {X86::VPUNPCKLWDZrrk, {0, Unknown}},
     {X86::VPUNPCKLWDZrrkz, {0, Unknown}},
-    {X86::VPUNPCKLWDrm, {0, Unknown}},
-    {X86::VPUNPCKLWDrr, {0, Unknown}},
+    {X86::VPUNPCKLWDrm, {16, SSE_PACKED_OP}},
+    {X86::VPUNPCKLWDrr, {0, SSE_PACKED_OP}},
     {X86::VPXORDZ128rm, {1, Unknown}},
     {X86::VPXORDZ128rmb, {1, Unknown}},
     {X86::VPXORDZ128rmbk, {1, Unknown}},
@@ -13233,10 +13233,10 @@ static constexpr const_addl_instr_info::value_type MapData[] = {
     {X86::VPXORQZrr, {0, Unknown}},
     {X86::VPXORQZrrk, {0, Unknown}},
     {X86::VPXORQZrrkz, {0, Unknown}},
-    {X86::VPXORYrm, {0, Unknown}},
-    {X86::VPXORYrr, {0, Unknown}},
-    {X86::VPXORrm, {0, Unknown}},
-    {X86::VPXORrr, {0, Unknown}},
+    {X86::VPXORYrm, {32, SSE_PACKED_OP}},
+    {X86::VPXORYrr, {0, SSE_PACKED_OP}},
+    {X86::VPXORrm, {16, SSE_PACKED_OP}},
+    {X86::VPXORrr, {0, SSE_PACKED_OP}},
     {X86::VRCPPSYm, {0, Unknown}},
     {X86::VRCPPSYr, {0, Unknown}},
     {X86::VRCPPSm, {0, Unknown}},
@@ -13353,8 +13353,8 @@ static constexpr const_addl_instr_info::value_type MapData[] = {
     {X86::VSHUFI64X2Zrri, {0, Unknown}},
     {X86::VSHUFI64X2Zrrik, {0, Unknown}},
     {X86::VSHUFI64X2Zrrikz, {0, Unknown}},
-    {X86::VSHUFPDYrmi, {0, Unknown}},
-    {X86::VSHUFPDYrri, {0, Unknown}},
+    {X86::VSHUFPDYrmi, {32, SSE_PACKED_OP}},
+    {X86::VSHUFPDYrri, {0, SSE_PACKED_OP}},
     {X86::VSHUFPDZ128rmbi, {1, Unknown}},
     {X86::VSHUFPDZ128rmbik, {1, Unknown}},
     {X86::VSHUFPDZ128rmbikz, {1, Unknown}},
@@ -13382,10 +13382,10 @@ static constexpr const_addl_instr_info::value_type MapData[] = {
     {X86::VSHUFPDZrri, {0, Unknown}},
     {X86::VSHUFPDZrrik, {0, Unknown}},
     {X86::VSHUFPDZrrikz, {0, Unknown}},
-    {X86::VSHUFPDrmi, {0, Unknown}},
-    {X86::VSHUFPDrri, {0, Unknown}},
-    {X86::VSHUFPSYrmi, {0, Unknown}},
-    {X86::VSHUFPSYrri, {0, Unknown}},
+    {X86::VSHUFPDrmi, {16, SSE_PACKED_OP}},
+    {X86::VSHUFPDrri, {0, SSE_PACKED_OP}},
+    {X86::VSHUFPSYrmi, {32, SSE_PACKED_OP}},
+    {X86::VSHUFPSYrri, {0, SSE_PACKED_OP}},
     {X86::VSHUFPSZ128rmbi, {1, Unknown}},
     {X86::VSHUFPSZ128rmbik, {1, Unknown}},
     {X86::VSHUFPSZ128rmbikz, {1, Unknown}},
@@ -13413,10 +13413,10 @@ static constexpr const_addl_instr_info::value_type MapData[] = {
     {X86::VSHUFPSZrri, {0, Unknown}},
     {X86::VSHUFPSZrrik, {0, Unknown}},
     {X86::VSHUFPSZrrikz, {0, Unknown}},
-    {X86::VSHUFPSrmi, {0, Unknown}},
-    {X86::VSHUFPSrri, {0, Unknown}},
-    {X86::VSQRTPDYm, {0, Unknown}},
-    {X86::VSQRTPDYr, {0, Unknown}},
+    {X86::VSHUFPSrmi, {16, SSE_PACKED_OP}},
+    {X86::VSHUFPSrri, {0, SSE_PACKED_OP}},
+    {X86::VSQRTPDYm, {32, SSE_PACKED_OP}},
+    {X86::VSQRTPDYr, {0, SSE_PACKED_OP}},
     {X86::VSQRTPDZ128m, {0, Unknown}},
     {X86::VSQRTPDZ128mb, {0, Unknown}},
     {X86::VSQRTPDZ128mbk, {0, Unknown}},
@@ -13447,10 +13447,10 @@ static constexpr const_addl_instr_info::value_type MapData[] = {
     {X86::VSQRTPDZrbkz, {0, Unknown}},
     {X86::VSQRTPDZrk, {0, Unknown}},
     {X86::VSQRTPDZrkz, {0, Unknown}},
-    {X86::VSQRTPDm, {0, Unknown}},
-    {X86::VSQRTPDr, {0, Unknown}},
-    {X86::VSQRTPSYm, {0, Unknown}},
-    {X86::VSQRTPSYr, {0, Unknown}},
+    {X86::VSQRTPDm, {16, SSE_PACKED_OP}},
+    {X86::VSQRTPDr, {0, SSE_PACKED_OP}},
+    {X86::VSQRTPSYm, {32, SSE_PACKED_OP}},
+    {X86::VSQRTPSYr, {0, SSE_PACKED_OP}},
     {X86::VSQRTPSZ128m, {0, Unknown}},
     {X86::VSQRTPSZ128mb, {0, Unknown}},
     {X86::VSQRTPSZ128mbk, {0, Unknown}},
@@ -13481,8 +13481,8 @@ static constexpr const_addl_instr_info::value_type MapData[] = {
     {X86::VSQRTPSZrbkz, {0, Unknown}},
     {X86::VSQRTPSZrk, {0, Unknown}},
     {X86::VSQRTPSZrkz, {0, Unknown}},
-    {X86::VSQRTPSm, {0, Unknown}},
-    {X86::VSQRTPSr, {0, Unknown}},
+    {X86::VSQRTPSm, {16, SSE_PACKED_OP}},
+    {X86::VSQRTPSr, {0, SSE_PACKED_OP}},
     {X86::VSQRTSDZm, {0, Unknown}},
     {X86::VSQRTSDZm_Int, {0, Unknown}},
     {X86::VSQRTSDZm_Intk, {0, Unknown}},
@@ -13514,8 +13514,8 @@ static constexpr const_addl_instr_info::value_type MapData[] = {
     {X86::VSQRTSSr, {0, Unknown}},
     {X86::VSQRTSSr_Int, {0, Unknown}},
     {X86::VSTMXCSR, {0, Unknown}},
-    {X86::VSUBPDYrm, {0, Unknown}},
-    {X86::VSUBPDYrr, {0, Unknown}},
+    {X86::VSUBPDYrm, {32, SSE_PACKED_OP}},
+    {X86::VSUBPDYrr, {0, SSE_PACKED_OP}},
     {X86::VSUBPDZ128rm, {1, Unknown}},
     {X86::VSUBPDZ128rmb, {1, Unknown}},
     {X86::VSUBPDZ128rmbk, {1, Unknown}},
@@ -13546,10 +13546,10 @@ static constexpr const_addl_instr_info::value_type MapData[] = {
     {X86::VSUBPDZrrbkz, {0, Unknown}},
     {X86::VSUBPDZrrk, {0, Unknown}},
     {X86::VSUBPDZrrkz, {0, Unknown}},
-    {X86::VSUBPDrm, {0, Unknown}},
-    {X86::VSUBPDrr, {0, Unknown}},
-    {X86::VSUBPSYrm, {0, Unknown}},
-    {X86::VSUBPSYrr, {0, Unknown}},
+    {X86::VSUBPDrm, {16, SSE_PACKED_OP}},
+    {X86::VSUBPDrr, {0, SSE_PACKED_OP}},
+    {X86::VSUBPSYrm, {32, SSE_PACKED_OP}},
+    {X86::VSUBPSYrr, {0, SSE_PACKED_OP}},
     {X86::VSUBPSZ128rm, {1, Unknown}},
     {X86::VSUBPSZ128rmb, {1, Unknown}},
     {X86::VSUBPSZ128rmbk, {1, Unknown}},
@@ -13580,8 +13580,8 @@ static constexpr const_addl_instr_info::value_type MapData[] = {
     {X86::VSUBPSZrrbkz, {0, Unknown}},
     {X86::VSUBPSZrrk, {0, Unknown}},
     {X86::VSUBPSZrrkz, {0, Unknown}},
-    {X86::VSUBPSrm, {0, Unknown}},
-    {X86::VSUBPSrr, {0, Unknown}},
+    {X86::VSUBPSrm, {16, SSE_PACKED_OP}},
+    {X86::VSUBPSrr, {0, SSE_PACKED_OP}},
     {X86::VSUBSDZrm, {0, Unknown}},
     {X86::VSUBSDZrm_Int, {0, Unknown}},
     {X86::VSUBSDZrm_Intk, {0, Unknown}},
@@ -13638,8 +13638,8 @@ static constexpr const_addl_instr_info::value_type MapData[] = {
     {X86::VUCOMISSrm_Int, {0, Unknown}},
     {X86::VUCOMISSrr, {0, Unknown}},
     {X86::VUCOMISSrr_Int, {0, Unknown}},
-    {X86::VUNPCKHPDYrm, {0, Unknown}},
-    {X86::VUNPCKHPDYrr, {0, Unknown}},
+    {X86::VUNPCKHPDYrm, {32, SSE_PACKED_OP}},
+    {X86::VUNPCKHPDYrr, {0, SSE_PACKED_OP}},
     {X86::VUNPCKHPDZ128rm, {1, Unknown}},
     {X86::VUNPCKHPDZ128rmb, {1, Unknown}},
     {X86::VUNPCKHPDZ128rmbk, {1, Unknown}},
@@ -13667,10 +13667,10 @@ static constexpr const_addl_instr_info::value_type MapData[] = {
     {X86::VUNPCKHPDZrr, {0, Unknown}},
     {X86::VUNPCKHPDZrrk, {0, Unknown}},
     {X86::VUNPCKHPDZrrkz, {0, Unknown}},
-    {X86::VUNPCKHPDrm, {0, Unknown}},
-    {X86::VUNPCKHPDrr, {0, Unknown}},
-    {X86::VUNPCKHPSYrm, {0, Unknown}},
-    {X86::VUNPCKHPSYrr, {0, Unknown}},
+    {X86::VUNPCKHPDrm, {16, SSE_PACKED_OP}},
+    {X86::VUNPCKHPDrr, {0, SSE_PACKED_OP}},
+    {X86::VUNPCKHPSYrm, {32, SSE_PACKED_OP}},
+    {X86::VUNPCKHPSYrr, {0, SSE_PACKED_OP}},
     {X86::VUNPCKHPSZ128rm, {1, Unknown}},
     {X86::VUNPCKHPSZ128rmb, {1, Unknown}},
     {X86::VUNPCKHPSZ128rmbk, {1, Unknown}},
@@ -13698,10 +13698,10 @@ static constexpr const_addl_instr_info::value_type MapData[] = {
     {X86::VUNPCKHPSZrr, {0, Unknown}},
     {X86::VUNPCKHPSZrrk, {0, Unknown}},
     {X86::VUNPCKHPSZrrkz, {0, Unknown}},
-    {X86::VUNPCKHPSrm, {0, Unknown}},
-    {X86::VUNPCKHPSrr, {0, Unknown}},
-    {X86::VUNPCKLPDYrm, {0, Unknown}},
-    {X86::VUNPCKLPDYrr, {0, Unknown}},
+    {X86::VUNPCKHPSrm, {16, SSE_PACKED_OP}},
+    {X86::VUNPCKHPSrr, {0, SSE_PACKED_OP}},
+    {X86::VUNPCKLPDYrm, {32, SSE_PACKED_OP}},
+    {X86::VUNPCKLPDYrr, {0, SSE_PACKED_OP}},
     {X86::VUNPCKLPDZ128rm, {1, Unknown}},
     {X86::VUNPCKLPDZ128rmb, {1, Unknown}},
     {X86::VUNPCKLPDZ128rmbk, {1, Unknown}},
@@ -13729,10 +13729,10 @@ static constexpr const_addl_instr_info::value_type MapData[] = {
     {X86::VUNPCKLPDZrr, {0, Unknown}},
     {X86::VUNPCKLPDZrrk, {0, Unknown}},
     {X86::VUNPCKLPDZrrkz, {0, Unknown}},
-    {X86::VUNPCKLPDrm, {0, Unknown}},
-    {X86::VUNPCKLPDrr, {0, Unknown}},
-    {X86::VUNPCKLPSYrm, {0, Unknown}},
-    {X86::VUNPCKLPSYrr, {0, Unknown}},
+    {X86::VUNPCKLPDrm, {16, SSE_PACKED_OP}},
+    {X86::VUNPCKLPDrr, {0, SSE_PACKED_OP}},
+    {X86::VUNPCKLPSYrm, {32, SSE_PACKED_OP}},
+    {X86::VUNPCKLPSYrr, {0, SSE_PACKED_OP}},
     {X86::VUNPCKLPSZ128rm, {1, Unknown}},
     {X86::VUNPCKLPSZ128rmb, {1, Unknown}},
     {X86::VUNPCKLPSZ128rmbk, {1, Unknown}},
@@ -13760,10 +13760,10 @@ static constexpr const_addl_instr_info::value_type MapData[] = {
     {X86::VUNPCKLPSZrr, {0, Unknown}},
     {X86::VUNPCKLPSZrrk, {0, Unknown}},
     {X86::VUNPCKLPSZrrkz, {0, Unknown}},
-    {X86::VUNPCKLPSrm, {0, Unknown}},
-    {X86::VUNPCKLPSrr, {0, Unknown}},
-    {X86::VXORPDYrm, {0, Unknown}},
-    {X86::VXORPDYrr, {0, Unknown}},
+    {X86::VUNPCKLPSrm, {16, SSE_PACKED_OP}},
+    {X86::VUNPCKLPSrr, {0, SSE_PACKED_OP}},
+    {X86::VXORPDYrm, {32, SSE_PACKED_OP}},
+    {X86::VXORPDYrr, {0, SSE_PACKED_OP}},
     {X86::VXORPDZ128rm, {1, Unknown}},
     {X86::VXORPDZ128rmb, {1, Unknown}},
     {X86::VXORPDZ128rmbk, {1, Unknown}},
@@ -13791,10 +13791,10 @@ static constexpr const_addl_instr_info::value_type MapData[] = {
     {X86::VXORPDZrr, {0, Unknown}},
     {X86::VXORPDZrrk, {0, Unknown}},
     {X86::VXORPDZrrkz, {0, Unknown}},
-    {X86::VXORPDrm, {0, Unknown}},
-    {X86::VXORPDrr, {0, Unknown}},
-    {X86::VXORPSYrm, {0, Unknown}},
-    {X86::VXORPSYrr, {0, Unknown}},
+    {X86::VXORPDrm, {16, SSE_PACKED_OP}},
+    {X86::VXORPDrr, {0, SSE_PACKED_OP}},
+    {X86::VXORPSYrm, {32, SSE_PACKED_OP}},
+    {X86::VXORPSYrr, {0, SSE_PACKED_OP}},
     {X86::VXORPSZ128rm, {1, Unknown}},
     {X86::VXORPSZ128rmb, {1, Unknown}},
     {X86::VXORPSZ128rmbk, {1, Unknown}},
@@ -13822,10 +13822,10 @@ static constexpr const_addl_instr_info::value_type MapData[] = {
     {X86::VXORPSZrr, {0, Unknown}},
     {X86::VXORPSZrrk, {0, Unknown}},
     {X86::VXORPSZrrkz, {0, Unknown}},
-    {X86::VXORPSrm, {0, Unknown}},
-    {X86::VXORPSrr, {0, Unknown}},
+    {X86::VXORPSrm, {16, SSE_PACKED_OP}},
+    {X86::VXORPSrr, {0, SSE_PACKED_OP}},
     {X86::VZEROALL, {0, Unknown}},
-    {X86::VZEROUPPER, {0, Unknown}},
+    {X86::VZEROUPPER, {0, NOOP}},
     {X86::V_SET0, {0, Unknown}},
     {X86::V_SETALLONES, {0, Unknown}},
     {X86::WAIT, {0, Unknown}},
@@ -13845,29 +13845,29 @@ static constexpr const_addl_instr_info::value_type MapData[] = {
     {X86::XABORT, {0, Unknown}},
     {X86::XABORT_DEF, {0, Unknown}},
     {X86::XACQUIRE_PREFIX, {0, Unknown}},
-    {X86::XADD16rm, {2, Unknown}},
+    {X86::XADD16rm, {2, ATOMIC_MEM_OP}},
     {X86::XADD16rr, {0, Unknown}},
-    {X86::XADD32rm, {4, Unknown}},
+    {X86::XADD32rm, {4, ATOMIC_MEM_OP}},
     {X86::XADD32rr, {0, Unknown}},
-    {X86::XADD64rm, {8, Unknown}},
+    {X86::XADD64rm, {8, ATOMIC_MEM_OP}},
     {X86::XADD64rr, {0, Unknown}},
-    {X86::XADD8rm, {1, Unknown}},
+    {X86::XADD8rm, {1, ATOMIC_MEM_OP}},
     {X86::XADD8rr, {0, Unknown}},
     {X86::XBEGIN, {0, Unknown}},
     {X86::XBEGIN_2, {0, Unknown}},
     {X86::XBEGIN_4, {0, Unknown}},
     {X86::XCHG16ar, {0, Unknown}},
-    {X86::XCHG16rm, {2, Unknown}},
+    {X86::XCHG16rm, {2, ATOMIC_MEM_OP}},
     {X86::XCHG16rr, {0, Unknown}},
     {X86::XCHG32ar, {0, Unknown}},
-    {X86::XCHG32rm, {4, Unknown}},
+    {X86::XCHG32rm, {4, ATOMIC_MEM_OP}},
     {X86::XCHG32rr, {0, Unknown}},
     {X86::XCHG64ar, {0, Unknown}},
-    {X86::XCHG64rm, {8, Unknown}},
+    {X86::XCHG64rm, {8, ATOMIC_MEM_OP}},
     {X86::XCHG64rr, {0, Unknown}},
-    {X86::XCHG8rm, {1, Unknown}},
+    {X86::XCHG8rm, {1, ATOMIC_MEM_OP}},
     {X86::XCHG8rr, {0, Unknown}},
-    {X86::XCH_F, {0, Unknown}},
+    {X86::XCH_F, {0, FPU_REG_OP}},
     {X86::XCRYPTCBC, {0, Unknown}},
     {X86::XCRYPTCFB, {0, Unknown}},
     {X86::XCRYPTCTR, {0, Unknown}},
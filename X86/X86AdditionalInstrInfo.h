@@ -48,6 +48,10 @@ enum InstructionKind : uint8_t {
   SETCC,
   BIT_TEST_OP,
   STORE_FPU_REG,
+  STRING_OP,
+  ATOMIC_MEM_OP,
+  FENCE,
+  BIT_MANIP_OP,
   SSE_KIND_BEGIN,
   SSE_MOV_TO_MEM,
   SSE_MOV_FROM_MEM,
@@ -56,14 +60,15 @@ enum InstructionKind : uint8_t {
   SSE_COMPARE_RM,
   SSE_CONVERT_RR,
   SSE_CONVERT_RM,
+  SSE_PACKED_OP,
   SSE_KIND_END,
   INSTR_KIND_END
 };
 
 struct X86AdditionalInstrInfo {
-  // A vaue of 8 or 4 or 2 or 1 indicates the size of memory an instruction
-  // operates on. A value of 0 indicates that the instruction does not have
-  // memory operands.
+  // A vaue of 32 or 16 or 8 or 4 or 2 or 1 indicates the size of memory an
+  // instruction operates on. A value of 0 indicates that the instruction does
+  // not have memory operands.
   uint8_t MemOpSize;
   // Instruction kind
   InstructionKind InstKind;
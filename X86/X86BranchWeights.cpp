@@ -0,0 +1,147 @@
+//===-- X86BranchWeights.cpp -------------------------------------*- C++-*-===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+//
+// This file contains the implementation of functions of
+// X86MachineInstructionRaiser class that annotate raised conditional branches
+// with branch weights and raised functions with entry counts, for use by
+// llvm-mctoll.
+//
+// If a branch profile of the binary is given, the weights are the sampled
+// counts of the branch being taken and falling through. Otherwise, they are
+// inferred from static heuristics: branches to blocks that do not return
+// (e.g., that call abort or __cxa_throw) are unlikely and backward branches,
+// i.e., loop back edges, are likely. Of other branches, the fall-through
+// successor, laid out next by the compiler, is slightly more likely.
+//
+//===----------------------------------------------------------------------===//
+
+#include "BranchProfile.h"
+#include "X86MachineInstructionRaiser.h"
+#include "llvm/ADT/STLExtras.h"
+#include "llvm/IR/MDBuilder.h"
+#include "llvm/Support/Debug.h"
+#include <algorithm>
+
+#define DEBUG_TYPE "mctoll"
+
+using namespace llvm;
+using namespace llvm::mctoll;
+
+// Weights of the successors of a branch, as used by BranchProbabilityInfo for
+// successors that do not return and for loop back edges
+static const uint32_t NoReturnTakenWeight = 1;
+static const uint32_t NoReturnNotTakenWeight = (1 << 20) - 1;
+static const uint32_t BackEdgeTakenWeight = 124;
+static const uint32_t BackEdgeNotTakenWeight = 4;
+static const uint32_t ForwardTakenWeight = 2;
+static const uint32_t FallThroughWeight = 3;
+
+// Functions that do not return and are called on error paths
+static const StringRef ColdFunctions[] = {
+    "abort",          "exit",           "_exit",
+    "_Exit",          "__assert_fail",  "__stack_chk_fail",
+    "__cxa_throw",    "__cxa_rethrow",  "_Unwind_Resume",
+    "__cxa_bad_cast", "_ZSt9terminatev"};
+
+// Maximum number of blocks on a straight-line path looked at for a call to a
+// cold function
+static const unsigned ColdPathLength = 4;
+
+bool X86MachineInstructionRaiser::isColdBlock(int64_t MBBNo) const {
+  const MachineBasicBlock *MBB = MF.getBlockNumbered(MBBNo);
+  for (unsigned Len = 0; (MBB != nullptr) && (Len < ColdPathLength); Len++) {
+    auto Iter = mbbToBBMap.find(MBB->getNumber());
+    if (Iter == mbbToBBMap.end())
+      return false;
+    for (Instruction &I : *Iter->second) {
+      if (isa<UnreachableInst>(I))
+        return true;
+      const CallInst *Call = dyn_cast<CallInst>(&I);
+      if (Call == nullptr)
+        continue;
+      const Function *Callee = Call->getCalledFunction();
+      if ((Callee != nullptr) &&
+          (Callee->hasFnAttribute(Attribute::NoReturn) ||
+           Callee->hasFnAttribute(Attribute::Cold) ||
+           is_contained(ColdFunctions, Callee->getName())))
+        return true;
+    }
+    // Follow a path that is only entered from the block before it.
+    if ((MBB->succ_size() != 1) ||
+        ((*MBB->succ_begin())->pred_size() != 1))
+      return false;
+    MBB = *MBB->succ_begin();
+  }
+  return false;
+}
+
+void X86MachineInstructionRaiser::setBranchWeights(BranchInst *CondBr,
+                                                   const MachineInstr &MI,
+                                                   int64_t TgtMBBNo,
+                                                   int64_t FTMBBNo) {
+  MCInstRaiser *MCIR = getMCInstRaiser();
+  uint64_t BranchOffset = MCIR->getMCInstIndex(MI);
+  int64_t TgtOffset = MCIR->getMCInstOffsetOfMBBNumber(TgtMBBNo);
+  uint32_t TakenWeight = 0;
+  uint32_t NotTakenWeight = 0;
+
+  const BranchProfile *Profile = MR->getBranchProfile();
+  if ((Profile != nullptr) && (TgtOffset != -1)) {
+    uint64_t SecAddr = MCIR->getTextSectionAddress();
+    uint64_t Taken =
+        Profile->getBranchCount(SecAddr + BranchOffset, SecAddr + TgtOffset);
+    uint64_t NotTaken = Profile->getFallThroughCount(SecAddr + BranchOffset);
+    // Scale the counts down to 32-bit weights.
+    uint64_t Scale = std::max(Taken, NotTaken) / UINT32_MAX + 1;
+    TakenWeight = Taken / Scale;
+    NotTakenWeight = NotTaken / Scale;
+  }
+
+  // Infer weights of branches that were not sampled.
+  if ((TakenWeight == 0) && (NotTakenWeight == 0)) {
+    bool ColdTgt = isColdBlock(TgtMBBNo);
+    bool ColdFT = isColdBlock(FTMBBNo);
+    if (ColdTgt && ColdFT)
+      return;
+    if (ColdTgt || ColdFT) {
+      TakenWeight = ColdTgt ? NoReturnTakenWeight : NoReturnNotTakenWeight;
+      NotTakenWeight = ColdTgt ? NoReturnNotTakenWeight : NoReturnTakenWeight;
+    } else if ((TgtOffset != -1) && ((uint64_t)TgtOffset <= BranchOffset)) {
+      TakenWeight = BackEdgeTakenWeight;
+      NotTakenWeight = BackEdgeNotTakenWeight;
+    } else {
+      TakenWeight = ForwardTakenWeight;
+      NotTakenWeight = FallThroughWeight;
+    }
+  }
+
+  MDBuilder MDB(CondBr->getContext());
+  CondBr->setMetadata(LLVMContext::MD_prof,
+                      MDB.createBranchWeights(TakenWeight, NotTakenWeight));
+}
+
+void X86MachineInstructionRaiser::setFunctionEntryCount() {
+  const BranchProfile *Profile = MR->getBranchProfile();
+  if (Profile == nullptr)
+    return;
+  MCInstRaiser *MCIR = getMCInstRaiser();
+  uint64_t SecAddr = MCIR->getTextSectionAddress();
+  uint64_t Start = SecAddr + MCIR->getFuncStart();
+  uint64_t End = SecAddr + MCIR->getFuncEnd();
+  // Functions that were not sampled keep weights of static heuristics. Their
+  // entry count is unknown.
+  if (!Profile->hasSamples(Start, End))
+    return;
+  uint64_t EntryCount = Profile->getTargetCount(Start);
+  LLVM_DEBUG(dbgs() << "Entry count of " << MF.getName() << " : "
+                    << EntryCount << "\n");
+  getRaisedFunction()->setEntryCount(
+      Function::ProfileCount(EntryCount, Function::PCT_Real));
+}
+
+#undef DEBUG_TYPE
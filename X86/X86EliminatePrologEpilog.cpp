@@ -0,0 +1,156 @@
+//===-- X86EliminatePrologEpilog.cpp -----------------------------*- C++-*-===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+//
+// This file contains the implementation of the function of
+// X86MachineInstructionRaiser class that eliminates the saves and restores of
+// callee-saved registers in the prolog and epilogs of x86-64 functions, for
+// use by llvm-mctoll.
+//
+// Callee-saved registers pushed at the entry of a function and popped in the
+// reverse order before each return (or tail call) have no manifestation in
+// the raised function. Raising them would store unknown register values to
+// the stack frame and keep the frame from being optimized. The push and pop
+// instructions, as well as the set up of the frame pointer, are removed from
+// the function before its instructions are raised.
+//
+//===----------------------------------------------------------------------===//
+
+#include "X86AdditionalInstrInfo.h"
+#include "X86MachineInstructionRaiser.h"
+#include "llvm/ADT/STLExtras.h"
+#include "llvm/ADT/SmallVector.h"
+#include "llvm/Support/Debug.h"
+
+#define DEBUG_TYPE "mctoll"
+
+using namespace llvm;
+using namespace llvm::mctoll;
+
+// Registers preserved across calls in the System V x86-64 ABI
+static const Register CalleeSavedRegs[] = {X86::RBX, X86::RBP, X86::R12,
+                                           X86::R13, X86::R14, X86::R15};
+
+// Return true if MI sets up the frame pointer i.e., is mov %rsp, %rbp.
+static bool isFramePointerSetup(const MachineInstr &MI) {
+  unsigned Opc = MI.getOpcode();
+  return ((Opc == X86::MOV64rr) || (Opc == X86::MOV64rr_REV)) &&
+         (MI.getOperand(0).getReg() == X86::RBP) &&
+         (MI.getOperand(1).getReg() == X86::RSP);
+}
+
+// Return true if MI reads or writes the stack pointer or any of Regs.
+static bool referencesStackOrRegs(const MachineInstr &MI,
+                                  ArrayRef<Register> Regs,
+                                  const TargetRegisterInfo *TRI) {
+  if (MI.readsRegister(X86::RSP, TRI) || MI.modifiesRegister(X86::RSP, TRI))
+    return true;
+  return any_of(Regs, [&MI, TRI](Register Reg) {
+    return MI.readsRegister(Reg, TRI) || MI.modifiesRegister(Reg, TRI);
+  });
+}
+
+void X86MachineInstructionRaiser::eliminatePrologEpilog() {
+  if (MF.empty())
+    return;
+
+  MachineBasicBlock &EntryMBB = MF.front();
+  // The prolog is executed once only if the entry block is not a branch
+  // target.
+  if (!EntryMBB.pred_empty())
+    return;
+
+  // Collect the pushes of callee-saved registers at the entry, in order.
+  // Instructions scheduled in between that neither access the stack nor any
+  // callee-saved register are skipped.
+  SmallVector<MachineInstr *, 8> Saves;
+  MachineInstr *FramePtrSetup = nullptr;
+  unsigned FramePtrSaveIdx = 0;
+  for (MachineInstr &MI : EntryMBB) {
+    unsigned Opc = MI.getOpcode();
+    if (isNoop(Opc) || (Opc == X86::ENDBR64))
+      continue;
+    if ((Opc == X86::PUSH64r) &&
+        is_contained(CalleeSavedRegs, MI.getOperand(0).getReg())) {
+      Saves.push_back(&MI);
+      continue;
+    }
+    // mov %rsp, %rbp immediately following push %rbp
+    if ((FramePtrSetup == nullptr) && !Saves.empty() &&
+        (Saves.back()->getOperand(0).getReg() == X86::RBP) &&
+        (Saves.back()->getNextNode() == &MI) && isFramePointerSetup(MI)) {
+      FramePtrSetup = &MI;
+      FramePtrSaveIdx = Saves.size() - 1;
+      continue;
+    }
+    if (MI.isTerminator() ||
+        referencesStackOrRegs(MI, CalleeSavedRegs, x86RegisterInfo))
+      break;
+  }
+
+  if (Saves.empty())
+    return;
+
+  // Collect the restores of the saved registers in each block that returns
+  // or tail calls. Restores are collected from the return backwards, so the
+  // restore at index I is expected to correspond to the save at index I. The
+  // number of saves that are restored on all paths are eliminated.
+  // Instructions scheduled in between that neither access the stack nor any
+  // register restored before them are skipped.
+  SmallVector<SmallVector<MachineInstr *, 8>, 4> RestoresOfExits;
+  unsigned NumBalanced = Saves.size();
+  for (MachineBasicBlock &MBB : MF) {
+    if (!MBB.succ_empty())
+      continue;
+    auto MIIter = MBB.rbegin();
+    while ((MIIter != MBB.rend()) &&
+           (isNoop(MIIter->getOpcode()) || (MIIter->getOpcode() == X86::INT3)))
+      MIIter++;
+    // Blocks ending with calls to functions that do not return or with
+    // traps do not restore the saved registers.
+    if ((MIIter == MBB.rend()) ||
+        !(MIIter->isReturn() || MIIter->isBranch()))
+      continue;
+
+    SmallVector<MachineInstr *, 8> Restores;
+    for (MIIter++; (MIIter != MBB.rend()) && (Restores.size() < NumBalanced);
+         MIIter++) {
+      Register SavedReg = Saves[Restores.size()]->getOperand(0).getReg();
+      unsigned Opc = MIIter->getOpcode();
+      bool IsRestore =
+          ((Opc == X86::POP64r) &&
+           (MIIter->getOperand(0).getReg() == SavedReg)) ||
+          ((Opc == X86::LEAVE64) && (SavedReg == X86::RBP) &&
+           (FramePtrSetup != nullptr));
+      if (IsRestore) {
+        Restores.push_back(&*MIIter);
+        continue;
+      }
+      SmallVector<Register, 8> PendingRegs;
+      for (MachineInstr *Save : drop_begin(Saves, Restores.size()))
+        PendingRegs.push_back(Save->getOperand(0).getReg());
+      if (referencesStackOrRegs(*MIIter, PendingRegs, x86RegisterInfo))
+        break;
+    }
+    NumBalanced = Restores.size();
+    RestoresOfExits.push_back(Restores);
+  }
+
+  LLVM_DEBUG(dbgs() << "Eliminating " << NumBalanced << " of " << Saves.size()
+                    << " callee-saved register saves of "
+                    << MF.getName() << "\n");
+
+  for (auto &Restores : RestoresOfExits)
+    for (unsigned Idx = 0; Idx < NumBalanced; Idx++)
+      Restores[Idx]->eraseFromParent();
+  if ((FramePtrSetup != nullptr) && (FramePtrSaveIdx < NumBalanced))
+    FramePtrSetup->eraseFromParent();
+  for (unsigned Idx = 0; Idx < NumBalanced; Idx++)
+    Saves[Idx]->eraseFromParent();
+}
+
+#undef DEBUG_TYPE
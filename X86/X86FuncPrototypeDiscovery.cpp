@@ -91,7 +91,8 @@ int X86MachineInstructionRaiser::getArgumentNumber(unsigned PReg) {
   } else if (isSSE2Reg(PReg)) {
     int Diff = std::distance(
         SSEArgRegs64Bit.begin(),
-        std::find(SSEArgRegs64Bit.begin(), SSEArgRegs64Bit.end(), PReg));
+        std::find(SSEArgRegs64Bit.begin(), SSEArgRegs64Bit.end(),
+                  find64BitSuperReg(PReg)));
     if ((Diff >= 0) && (Diff < (int)SSEArgRegs64Bit.size())) {
       Pos = Diff + 1;
     }
@@ -162,6 +163,12 @@ Type *X86MachineInstructionRaiser::getFunctionReturnType() {
     }
   }
 
+  // Values of type x86_fp80 are returned in ST(0). The function returns such
+  // a value if the FPU register stack is not empty at return.
+  if (!WorkList.empty() && computeFPUStackTops() &&
+      (getFPUStackTopAt(WorkList.back()->back()) != 0))
+    return Type::getX86_FP80Ty(MF.getFunction().getContext());
+
   while (!WorkList.empty() && ReturnType == nullptr) {
     MachineBasicBlock *MBB = WorkList.pop_back_val();
     ReturnType = getReachingReturnType(*MBB);
@@ -226,7 +233,8 @@ FunctionType *X86MachineInstructionRaiser::getRaisedFunctionPrototype() {
       auto OpType = TermInst.getOperand(0).getType();
       assert(
           ((OpType == MachineOperand::MachineOperandType::MO_Immediate) ||
-           (OpType == MachineOperand::MachineOperandType::MO_JumpTableIndex)) &&
+           (OpType == MachineOperand::MachineOperandType::MO_JumpTableIndex) ||
+           TermInst.isIndirectBranch()) &&
           "Unexpected block terminator found");
     }
 
@@ -300,7 +308,8 @@ FunctionType *X86MachineInstructionRaiser::getRaisedFunctionPrototype() {
         // it is correct to just overwrite the size information.
         MBBDefRegs[find64BitSuperReg(DestReg)] =
             getPhysRegSizeInBits(DestReg) / 8;
-      } else if (MI.isCall() || MI.isUnconditionalBranch()) {
+      } else if (MI.isCall() || MI.isUnconditionalBranch() ||
+                 (MI.isIndirectBranch() && !MI.getOperand(0).isJTI())) {
         // If this is an unconditional branch, check if it is a tail call.
         if (MI.isUnconditionalBranch()) {
           if ((MI.getNumOperands() > 0) && MI.getOperand(0).isImm()) {
@@ -330,6 +339,9 @@ FunctionType *X86MachineInstructionRaiser::getRaisedFunctionPrototype() {
               }
             }
           }
+        } else if (MI.isIndirectBranch()) {
+          // An indirect branch not through a jump table may be a tail call
+          IsTailCall = (MI.getNextNode() == nullptr) && isIndirectTailCall(MI);
         }
 
         // If the instruction is a call or a potential tail call,
@@ -339,7 +351,11 @@ FunctionType *X86MachineInstructionRaiser::getRaisedFunctionPrototype() {
           // arguments of a call or a tail-call.
           unsigned int Opcode = MI.getOpcode();
           if ((Opcode == X86::CALL64pcrel32) || (Opcode == X86::JMP_4) ||
-              (Opcode == X86::JMP_1)) {
+              (Opcode == X86::JMP_1) || (Opcode == X86::CALL64r) ||
+              (Opcode == X86::CALL64m) || (Opcode == X86::JMP64r) ||
+              (Opcode == X86::JMP64m)) {
+            // The target of indirect calls and jumps is known only if it can
+            // be resolved from register or GOT dataflow.
             Function *CalledFunc = getCalledFunction(MI);
             // If the called function is found, consider argument
             // registers as use registers.
@@ -355,7 +371,9 @@ FunctionType *X86MachineInstructionRaiser::getRaisedFunctionPrototype() {
               // Check for return type and set return register as a
               // defined register
               Type *RetTy = CalledFunc->getReturnType();
-              if (!RetTy->isVoidTy()) {
+              // Values of type x86_fp80 are returned in ST(0), which is not
+              // tracked as a register.
+              if (!RetTy->isVoidTy() && !RetTy->isX86_FP80Ty()) {
                 unsigned RetReg = X86::NoRegister;
                 unsigned RetRegSizeInBits = 0;
                 assert((RetTy->isIntOrPtrTy() || RetTy->isFloatingPointTy() ||
@@ -405,9 +423,7 @@ FunctionType *X86MachineInstructionRaiser::getRaisedFunctionPrototype() {
               if (IsTailCall)
                 DiscoveredRetType = RetTy;
             }
-          } else if (Opcode != X86::CALL64r && Opcode != X86::CALL64m) {
-            // Not possible to statically determine the target of register-based
-            // indirect call. Need to handle differently.
+          } else {
             assert(false && "Unhandled call or branch found");
           }
         }
@@ -467,6 +483,31 @@ FunctionType *X86MachineInstructionRaiser::getRaisedFunctionPrototype() {
   if (ReturnType == nullptr)
     return nullptr;
 
+  createRaisedFunction(
+      FunctionType::get(ReturnType, ArgTypeVector, false /* isVarArg*/));
+  return RaisedFunction->getFunctionType();
+}
+
+// Construct the raised function with prototype FT discovered by an earlier
+// run. The cleanup of MF done before discovery is done all the same, since
+// raising relies on it.
+bool X86MachineInstructionRaiser::setRaisedFunctionPrototype(
+    FunctionType *FT) {
+  // Raise the jumptable
+  raiseMachineJumpTable();
+
+  if (RaisedFunction != nullptr)
+    return RaisedFunction->getFunctionType() == FT;
+
+  deleteNOOPInstrMF();
+  unlinkEmptyMBBs();
+  MF.getRegInfo().freezeReservedRegs(MF);
+
+  createRaisedFunction(FT);
+  return true;
+}
+
+void X86MachineInstructionRaiser::createRaisedFunction(FunctionType *FT) {
   // The Function object associated with current MachineFunction object
   // is only a place holder. It was created to facilitate creation of
   // MachineFunction object with a prototype void functionName(void).
@@ -483,15 +524,11 @@ FunctionType *X86MachineInstructionRaiser::getRaisedFunctionPrototype() {
   Function *TempFunctionPtr = Mod->getFunction(FunctionName);
   assert(TempFunctionPtr != nullptr && "Function not found in module list");
 
-  // 4. Delete the tempFunc from module list to allow for the creation of the
+  // 3. Delete the tempFunc from module list to allow for the creation of the
   //    real function to add the correct one to FunctionList of the module.
   Mod->getFunctionList().remove(TempFunctionPtr);
 
-  // 3. Create a function type using the discovered arguments and return value.
-  FunctionType *FT =
-      FunctionType::get(ReturnType, ArgTypeVector, false /* isVarArg*/);
-
-  // 4. Create the real Function now that we have discovered the arguments.
+  // 4. Create the real Function now that the prototype is known.
   RaisedFunction =
       Function::Create(FT, GlobalValue::ExternalLinkage, FunctionName, Mod);
 
@@ -515,8 +552,6 @@ FunctionType *X86MachineInstructionRaiser::getRaisedFunctionPrototype() {
   // Insert the map of raised function to tempFunctionPointer.
   const_cast<ModuleRaiser *>(MR)->insertPlaceholderRaisedFunctionMap(
       RaisedFunction, TempFunctionPtr);
-
-  return RaisedFunction->getFunctionType();
 }
 
 // Discover and return the type of return register (viz., RAX or its
@@ -824,12 +859,17 @@ X86MachineInstructionRaiser::getCalledFunction(const MachineInstr &MI) {
     // Compute the MCInst index of the call target
     MCInstRaiser *MCIR = getMCInstRaiser();
     assert(MCIR != nullptr && "MCInstRaiser not initialized");
+    // Sections of a relocatable object file all start at address 0. So, use
+    // the relocation of the call instruction to get the called function.
+    if (MR->getObjectFile()->isRelocatableObject())
+      return getTargetFunctionOfTextReloc(MI);
+
     // Get MCInst offset of the corresponding call instruction in the binary.
     uint64_t MCInstOffset = MCIR->getMCInstIndex(MI);
     uint64_t MCInstSize = MCIR->getMCInstSize(MCInstOffset);
     // First check if PC-relative call target embedded in the call
     // instruction can be used to get called function.
-    int64_t CallTargetIndex = MCInstOffset + MR->getTextSectionAddress() +
+    int64_t CallTargetIndex = MCInstOffset + MCIR->getTextSectionAddress() +
                               MCInstSize + RelCallTargetOffset;
     // Get the function at index CalltargetIndex
     CalledFunc = MR->getRaisedFunctionAt(CallTargetIndex);
@@ -846,12 +886,22 @@ X86MachineInstructionRaiser::getCalledFunction(const MachineInstr &MI) {
     // call target function.
     if (CalledFunc == nullptr)
       CalledFunc =
-          MR->getCalledFunctionUsingTextReloc(MCInstOffset, MCInstSize);
+          MR->getCalledFunctionUsingTextReloc(MCInstOffset, MCInstSize,
+                                              MCIR->getTextSectionIndex());
 
     // Look up the PLT to find called function
     if (CalledFunc == nullptr)
       CalledFunc = getTargetFunctionAtPLTOffset(MI, CallTargetIndex);
   } break;
+  case X86::CALL64r:
+  case X86::CALL64m:
+  case X86::JMP64r:
+  case X86::JMP64m:
+    // Indirect jumps through jump tables do not transfer control to a
+    // function.
+    if (!MI.getOperand(0).isJTI())
+      CalledFunc = getIndirectTransferTarget(MI);
+    break;
   }
 
   return CalledFunc;
@@ -30,9 +30,9 @@ bool X86MachineInstructionRaiser::raiseMachineJumpTable() {
   // A vector to record MBBS that need be erased upon jump table creation.
   std::vector<MachineBasicBlock *> MBBsToBeErased;
 
-  // Address of text section.
-  int64_t TextSectionAddress = MR->getTextSectionAddress();
   MCInstRaiser *MCIR = getMCInstRaiser();
+  // Address of text section.
+  int64_t TextSectionAddress = MCIR->getTextSectionAddress();
 
   // Get the MIs which potentially load the jumptable base address.
   for (MachineBasicBlock &JmpTblBaseCalcMBB : MF) {
@@ -31,6 +31,7 @@
 #include "llvm/IR/Instructions.h"
 #include "llvm/IR/LegacyPassManager.h"
 #include "llvm/Support/Debug.h"
+#include "llvm/Support/TimeProfiler.h"
 #include "llvm/Support/raw_ostream.h"
 #include "llvm/Target/TargetMachine.h"
 #include "llvm/Transforms/Utils/BasicBlockUtils.h"
@@ -57,8 +58,11 @@ X86MachineInstructionRaiser::X86MachineInstructionRaiser(MachineFunction &MF,
   x86RegisterInfo = x86TargetInfo.getRegisterInfo();
 
   FPUStack.TOP = 0;
-  for (int Idx = 0; Idx < FPUSTACK_SZ; Idx++)
+  FPUStack.RaisedBB = nullptr;
+  for (int Idx = 0; Idx < FPUSTACK_SZ; Idx++) {
     FPUStack.Regs[Idx] = nullptr;
+    FPURegSlots[Idx] = nullptr;
+  }
 
   raisedValues = nullptr;
 }
@@ -1291,52 +1295,6 @@ bool X86MachineInstructionRaiser::raiseBinaryOpRegToRegMachineInstr(
       raisedValues->setPhysRegSSAValue(DstReg, MBBNo, DstValue);
     }
   } break;
-  case X86::POPCNT16rr:
-  case X86::POPCNT32rr:
-  case X86::POPCNT64rr: {
-    const MachineOperand &DestOp = MI.getOperand(DestOpIndex);
-    assert(DestOp.isReg() && "Expecting destination of popcnt instruction to "
-                             "be a register operand");
-    assert((MCID.getNumDefs() == 1) &&
-           MCID.hasImplicitDefOfPhysReg(X86::EFLAGS) &&
-           "Unexpected defines in a popcnt instruction");
-    DstReg = DestOp.getReg();
-    Value *SrcValue = ExplicitSrcValues.at(0);
-
-    Module *M = MR->getModule();
-    Function *IntrinsicFunc =
-        Intrinsic::getDeclaration(M, Intrinsic::ctpop, SrcValue->getType());
-    Value *IntrinsicCallArgs[] = {SrcValue};
-    Instruction *BinOpInst =
-        CallInst::Create(IntrinsicFunc, ArrayRef<Value *>(IntrinsicCallArgs));
-
-    // Add the intrinsic call instruction
-    // Copy any necessary rodata related metadata
-    raisedValues->setInstMetadataRODataIndex(SrcValue, BinOpInst);
-    RaisedBB->getInstList().push_back(BinOpInst);
-    DstValue = BinOpInst;
-
-    raisedValues->setPhysRegSSAValue(DstReg, MBBNo, DstValue);
-
-    // OF, SF, ZF, AF, CF, PF are all cleared. ZF is set if SRC = 0, otherwise
-    // ZF is cleared.
-    raisedValues->setEflagBoolean(EFLAGS::OF, MBBNo, false);
-    raisedValues->setEflagBoolean(EFLAGS::SF, MBBNo, false);
-    raisedValues->setEflagBoolean(EFLAGS::AF, MBBNo, false);
-    raisedValues->setEflagBoolean(EFLAGS::CF, MBBNo, false);
-    raisedValues->setEflagBoolean(EFLAGS::PF, MBBNo, false);
-
-    // Test if SrcValue is Zero
-    Value *ZeroValue =
-        ConstantInt::get(SrcValue->getType(), 0, false /* isSigned */);
-    Instruction *ZFTest = new ICmpInst(CmpInst::Predicate::ICMP_EQ, SrcValue,
-                                       ZeroValue, "ZeroFlag");
-    RaisedBB->getInstList().push_back(ZFTest);
-    // ZF = (SrcValue==0).
-    raisedValues->setPhysRegSSAValue(X86RegisterUtils::EFLAGS::ZF, MBBNo,
-                                     ZFTest);
-
-  } break;
   case X86::SUBSSrr_Int:
   case X86::SUBSDrr_Int:
   case X86::ADDSSrr_Int:
@@ -2301,224 +2259,6 @@ bool X86MachineInstructionRaiser::raiseBinaryOpMemToRegInstr(
   return true;
 }
 
-bool X86MachineInstructionRaiser::raiseLoadIntToFloatRegInstr(
-    const MachineInstr &MI, Value *MemRefValue) {
-
-  const unsigned int Opcode = MI.getOpcode();
-  const MCInstrDesc &MIDesc = MI.getDesc();
-  // Get index of memory reference in the instruction.
-  int MemoryRefOpIndex = getMemoryRefOpIndex(MI);
-  assert(MemoryRefOpIndex == 0 && "Expect memory operand of floating-point "
-                                  "load instruction at index 0");
-  assert(MIDesc.getNumDefs() == 0 &&
-         "Expect no defs in floating-point load instruction");
-
-  // Get the BasicBlock corresponding to MachineBasicBlock of MI.
-  // Raised instruction is added to this BasicBlock.
-  BasicBlock *RaisedBB = getRaisedBasicBlock(MI.getParent());
-
-  X86AddressMode MemRef = llvm::getAddressFromInstr(&MI, MemoryRefOpIndex);
-  uint64_t BaseSupReg = find64BitSuperReg(MemRef.Base.Reg);
-  bool IsPCRelMemRef = (BaseSupReg == X86::RIP);
-
-  // Load the value from memory location of memRefValue.
-  // memRefVal is either an AllocaInst (stack access) or GlobalValue (global
-  // data access) or an effective address value.
-  assert((isa<AllocaInst>(MemRefValue) || isEffectiveAddrValue(MemRefValue) ||
-          isa<GlobalValue>(MemRefValue) || isa<ConstantExpr>(MemRefValue) ||
-          MemRefValue->getType()->isPointerTy()) &&
-         "Unexpected type of memory reference in FPU load op instruction");
-
-  LLVMContext &Ctx(MF.getFunction().getContext());
-  if (IsPCRelMemRef) {
-    // If it is a PC-relative mem ref, memRefValue is a
-    // global value loaded from PC-relative memory location. If it is a
-    // derived type value, get its element pointer.
-    Type *MemRefValueTy = MemRefValue->getType();
-    if (!MemRefValueTy->isFloatingPointTy()) {
-      assert(MemRefValueTy->isPointerTy() &&
-             "Unhandled non-pointer type found while attempting to push value "
-             "to FPU register stack.");
-      Type *MemRefValPtrElementTy = getPointerElementType(MemRefValue);
-      switch (MemRefValPtrElementTy->getTypeID()) {
-      case Type::ArrayTyID: {
-        // Make sure the array element type is integer or floating point type.
-        Type *ArrElemTy = MemRefValPtrElementTy->getArrayElementType();
-        assert((ArrElemTy->isIntegerTy() || ArrElemTy->isFloatingPointTy()) &&
-               "Unexpected type of data referenced in FPU register stack "
-               "load instruction");
-        // Get the element
-        Value *IndexOne = ConstantInt::get(Ctx, APInt(32, 1));
-        Instruction *GetElem = GetElementPtrInst::CreateInBounds(
-            ArrElemTy, MemRefValue, {IndexOne, IndexOne}, "", RaisedBB);
-        MemRefValue = GetElem;
-      } break;
-      // Primitive types that need not be reached into.
-      case Type::IntegerTyID:
-        break;
-      default: {
-        assert(false && "Encountered value with type whose cast to float is "
-                        "not yet handled");
-      } break;
-      }
-    }
-  }
-  // If it is non-pointer value, convert it to a pointer type.
-  if (!MemRefValue->getType()->isPointerTy()) {
-    PointerType *PtrTy = MemRefValue->getType()->getPointerTo(0);
-    Instruction *CInst = CastInst::Create(
-        CastInst::getCastOpcode(MemRefValue, true, PtrTy, true), MemRefValue,
-        PtrTy);
-    RaisedBB->getInstList().push_back(CInst);
-    MemRefValue = CInst;
-  }
-  assert(MemRefValue->getType()->isPointerTy() &&
-         "Pointer type expected in load instruction");
-  // Load the value from memory location
-  auto MemAlignment =
-      Align(getPointerElementType(MemRefValue)->getPrimitiveSizeInBits() / 8);
-  LoadInst *LdInst =
-      new LoadInst(getPointerElementType(MemRefValue), MemRefValue, "", false,
-                   MemAlignment, RaisedBB);
-
-  switch (Opcode) {
-  default: {
-    assert(false && "Unhandled load floating-point register instruction");
-  } break;
-  case X86::ILD_F32m:
-  case X86::ILD_F64m: {
-    Type *FloatTy = Type::getFloatTy(Ctx);
-    assert(LdInst->getType()->isIntegerTy() &&
-           "Unexpected non-integter type of source in fild instruction");
-    // Cast source to float
-    Instruction *CInst = CastInst::Create(
-        CastInst::getCastOpcode(LdInst, true, FloatTy, true), LdInst, FloatTy);
-    RaisedBB->getInstList().push_back(CInst);
-    // Push value to top of FPU register stack
-    pushFPURegisterStack(CInst);
-  } break;
-  case X86::LD_F32m:
-  case X86::LD_F64m: {
-    Type *FloatTy = Type::getFloatTy(Ctx);
-    // Cast source to float
-    Instruction *CInst = CastInst::Create(
-        CastInst::getCastOpcode(LdInst, true, FloatTy, true), LdInst, FloatTy);
-    RaisedBB->getInstList().push_back(CInst);
-    // Push value to top of FPU register stack
-    pushFPURegisterStack(CInst);
-  }
-  }
-  return true;
-}
-
-bool X86MachineInstructionRaiser::raiseStoreIntToFloatRegInstr(
-    const MachineInstr &MI, Value *MemRefValue) {
-
-  const unsigned int Opcode = MI.getOpcode();
-  const MCInstrDesc &MIDesc = MI.getDesc();
-  // Get index of memory reference in the instruction.
-  int MemoryRefOpIndex = getMemoryRefOpIndex(MI);
-  assert(MemoryRefOpIndex == 0 && "Expect memory operand of floating-point "
-                                  "load instruction at index 0");
-  assert(MIDesc.getNumDefs() == 0 &&
-         "Expect no defs in floating-point load instruction");
-
-  // Get the BasicBlock corresponding to MachineBasicBlock of MI.
-  // Raised instruction is added to this BasicBlock.
-  BasicBlock *RaisedBB = getRaisedBasicBlock(MI.getParent());
-
-  X86AddressMode MemRef = llvm::getAddressFromInstr(&MI, MemoryRefOpIndex);
-  uint64_t BaseSupReg = find64BitSuperReg(MemRef.Base.Reg);
-  bool IsPCRelMemRef = (BaseSupReg == X86::RIP);
-
-  // Load the value from memory location of memRefValue.
-  // memRefVal is either an AllocaInst (stack access) or GlobalValue (global
-  // data access) or an effective address value.
-  assert((isa<AllocaInst>(MemRefValue) || isEffectiveAddrValue(MemRefValue) ||
-          isa<GlobalValue>(MemRefValue) ||
-          MemRefValue->getType()->isPointerTy()) &&
-         "Unexpected type of memory reference in FPU store op instruction");
-
-  LLVMContext &Ctx(MF.getFunction().getContext());
-  if (IsPCRelMemRef) {
-    // If it is a PC-relative mem ref, MemRefValue is a global value loaded
-    // from PC-relative memory location. If it is a derived type value, get
-    // its element pointer.
-    assert(isa<GlobalValue>(MemRefValue) && "MemRefValue is not GlobalValue");
-    Type *MemRefValueTy = MemRefValue->getType();
-    if (!MemRefValueTy->isFloatingPointTy()) {
-      assert(MemRefValueTy->isPointerTy() &&
-             "Unhandled non-pointer type found while attempting to load value "
-             "from FPU register stack.");
-      Type *MemRefValPtrElementTy = getPointerElementType(MemRefValue);
-      switch (MemRefValPtrElementTy->getTypeID()) {
-      case Type::ArrayTyID: {
-        assert(MemRefValPtrElementTy->getArrayNumElements() == 1 &&
-               "Unexpected number of array elements in value being cast to "
-               "float");
-        // Make sure the array element type is integer or floating point
-        // type.
-        Type *ArrElemTy = MemRefValPtrElementTy->getArrayElementType();
-        assert((ArrElemTy->isIntegerTy() || ArrElemTy->isFloatingPointTy()) &&
-               "Unexpected type of data referenced in FPU register stack "
-               "store instruction");
-        // Get the element
-        Value *IndexOne = ConstantInt::get(Ctx, APInt(32, 1));
-        Instruction *GetElem = GetElementPtrInst::CreateInBounds(
-            ArrElemTy, MemRefValue, {IndexOne, IndexOne}, "", RaisedBB);
-        MemRefValue = GetElem;
-      } break;
-      // Primitive types that need not be reached into.
-      case Type::IntegerTyID:
-        break;
-      default: {
-        assert(false && "Encountered value with type whose cast to float is "
-                        "not yet handled");
-      } break;
-      }
-    }
-  }
-  // Ensure MemRefValue is of pointer type
-  Type *MRTy = MemRefValue->getType();
-  if (!MRTy->isPointerTy()) {
-    PointerType *PtrTy = MRTy->getPointerTo(0);
-    Instruction *CInst = CastInst::Create(
-        CastInst::getCastOpcode(MemRefValue, true, PtrTy, true), MemRefValue,
-        PtrTy);
-    RaisedBB->getInstList().push_back(CInst);
-    MemRefValue = CInst;
-  }
-
-  switch (Opcode) {
-  default: {
-    assert(false && "Unhandled store floating-point register instruction");
-  } break;
-  case X86::ST_FP32m:
-  case X86::ST_FP64m: {
-    Value *ST0Val = topFPURegisterStack();
-    Type *SrcTy = ST0Val->getType();
-    // The value in ST0 is converted to single-precision or double precision
-    // floating-point format. So, cast the MemRefValue to the PointerType of
-    // SrcTy.
-    Type *DestElemTy = getPointerElementType(MemRefValue);
-    if (DestElemTy != SrcTy) {
-      PointerType *SrcPtrTy = SrcTy->getPointerTo(0);
-      Instruction *CInst = CastInst::Create(
-          CastInst::getCastOpcode(MemRefValue, true, SrcPtrTy, true),
-          MemRefValue, SrcPtrTy);
-      RaisedBB->getInstList().push_back(CInst);
-      MemRefValue = CInst;
-    }
-    // Create the store
-    new StoreInst(ST0Val, MemRefValue, RaisedBB);
-
-    // Pop value to top of FPU register stack
-    popFPURegisterStack();
-  }
-  }
-  return true;
-}
-
 bool X86MachineInstructionRaiser::raiseMoveFromMemInstr(const MachineInstr &MI,
                                                         Value *MemRefValue) {
   const unsigned int Opcode = MI.getOpcode();
@@ -3603,8 +3343,19 @@ bool X86MachineInstructionRaiser::raiseMemRefMachineInstr(
     return raisePopInstruction(MI);
   }
 
+  // String instructions address memory through RDI and RSI rather than a
+  // memory operand.
+  InstructionKind Kind = getInstructionKind(MI.getOpcode());
+  if ((Kind == InstructionKind::STRING_OP) || (Kind == InstructionKind::FENCE))
+    return getKindRaiser(Kind, true /* IsMemRef */)(*this, MI, nullptr);
+
   Value *MemoryRefValue = getMemoryRefValue(MI);
 
+  // Raise an instruction with a lock prefix as an atomic operation
+  if ((getInstrPrefixes(MI) & X86::IP_HAS_LOCK) &&
+      (Kind != InstructionKind::ATOMIC_MEM_OP))
+    return raiseLockedMemOpInstr(MI, MemoryRefValue);
+
   // Raise a memory compare instruction
   if (MI.isCompare())
     return raiseCompareMachineInstr(MI, true /* isMemRef */, MemoryRefValue);
@@ -3612,39 +3363,13 @@ bool X86MachineInstructionRaiser::raiseMemRefMachineInstr(
   // Now that we have all necessary information about memory reference and
   // the load/store operand, we can raise the memory referencing instruction
   // according to the opcode.
-
-  switch (getInstructionKind(MI.getOpcode())) {
-    // Move register or immediate to memory
-  case InstructionKind::MOV_TO_MEM:
-  case InstructionKind::SSE_MOV_TO_MEM:
-    return raiseMoveToMemInstr(MI, MemoryRefValue);
-  case InstructionKind::INPLACE_MEM_OP:
-    return raiseInplaceMemOpInstr(MI, MemoryRefValue);
-  // Move register from memory
-  case InstructionKind::MOV_FROM_MEM:
-  case InstructionKind::SSE_MOV_FROM_MEM:
-    return raiseMoveFromMemInstr(MI, MemoryRefValue);
-  case InstructionKind::BINARY_OP_RM:
-    return raiseBinaryOpMemToRegInstr(MI, MemoryRefValue);
-  case InstructionKind::DIVIDE_MEM_OP:
-    return raiseDivideFromMemInstr(MI, MemoryRefValue);
-  case InstructionKind::LOAD_FPU_REG:
-    return raiseLoadIntToFloatRegInstr(MI, MemoryRefValue);
-  case InstructionKind::STORE_FPU_REG:
-    return raiseStoreIntToFloatRegInstr(MI, MemoryRefValue);
-  case InstructionKind::SSE_COMPARE_RM:
-    return raiseSSECompareFromMemMachineInstr(MI, MemoryRefValue);
-  case InstructionKind::SSE_CONVERT_RM:
-    return raiseSSEConvertPrecisionFromMemMachineInstr(MI, MemoryRefValue);
-  case InstructionKind::BIT_TEST_OP:
-    return raiseBitTestMachineInstr(MI, MemoryRefValue, true);
-  case InstructionKind::SETCC:
-    return raiseSetCCMachineInstr(MI, MemoryRefValue);
-  default:
+  KindRaiser Raiser = getKindRaiser(Kind, true /* IsMemRef */);
+  if (Raiser == nullptr) {
     LLVM_DEBUG(MI.dump());
     assert(false && "Unhandled memory referencing instruction");
+    return false;
   }
-  return false;
+  return Raiser(*this, MI, MemoryRefValue);
 }
 
 bool X86MachineInstructionRaiser::raiseSetCCMachineInstr(
@@ -4514,6 +4239,7 @@ bool X86MachineInstructionRaiser::raiseIndirectBranchMachineInstr(
   } else {
     assert(false && "Support to raise indirect branches to non-jumptable "
                     "location not yet implemented");
+    return false;
   }
   return true;
 }
@@ -4823,6 +4549,7 @@ bool X86MachineInstructionRaiser::raiseDirectBranchMachineInstr(
     // Create branch instruction
     BranchInst *CondBr = BranchInst::Create(TgtBB, FTBB, BranchCond);
     CandBB->getInstList().push_back(CondBr);
+    setBranchWeights(CondBr, *MI, TgtMBBNo, FTMBBNum);
     CTRec->Raised = true;
   } else {
     assert(false && "Unhandled type of branch instruction");
@@ -4833,72 +4560,182 @@ bool X86MachineInstructionRaiser::raiseDirectBranchMachineInstr(
 // Raise a generic instruction. This is the catch all MachineInstr raiser
 bool X86MachineInstructionRaiser::raiseGenericMachineInstr(
     const MachineInstr &MI) {
-  unsigned int Opcode = MI.getOpcode();
-  bool Success = false;
-
   // Now raise the instruction according to the opcode kind
-  switch (getInstructionKind(Opcode)) {
+  KindRaiser Raiser =
+      getKindRaiser(getInstructionKind(MI.getOpcode()), false /* IsMemRef */);
+  if (Raiser == nullptr) {
+    dbgs() << "*** Generic instruction not raised : " << MF.getName().data()
+           << "\n\t";
+    MI.print(dbgs());
+    return false;
+  }
+  return Raiser(*this, MI, nullptr);
+}
+
+// Raisers of the kinds of instructions, shared by the instruction raiser and
+// the classification of instructions by X86ModuleRaiser, so that instructions
+// are reported as supported exactly if they are dispatched to a raiser.
+X86MachineInstructionRaiser::KindRaiser
+X86MachineInstructionRaiser::getKindRaiser(InstructionKind Kind,
+                                           bool IsMemRef) {
+  using XMIR = X86MachineInstructionRaiser;
+  if (IsMemRef) {
+    switch (Kind) {
+    // Move register or immediate to memory
+    case InstructionKind::MOV_TO_MEM:
+    case InstructionKind::SSE_MOV_TO_MEM:
+      return [](XMIR &R, const MachineInstr &MI, Value *MemRef) {
+        return R.raiseMoveToMemInstr(MI, MemRef);
+      };
+    case InstructionKind::INPLACE_MEM_OP:
+      return [](XMIR &R, const MachineInstr &MI, Value *MemRef) {
+        return R.raiseInplaceMemOpInstr(MI, MemRef);
+      };
+    // Move register from memory
+    case InstructionKind::MOV_FROM_MEM:
+    case InstructionKind::SSE_MOV_FROM_MEM:
+      return [](XMIR &R, const MachineInstr &MI, Value *MemRef) {
+        return R.raiseMoveFromMemInstr(MI, MemRef);
+      };
+    case InstructionKind::BINARY_OP_RM:
+      return [](XMIR &R, const MachineInstr &MI, Value *MemRef) {
+        return R.raiseBinaryOpMemToRegInstr(MI, MemRef);
+      };
+    case InstructionKind::DIVIDE_MEM_OP:
+      return [](XMIR &R, const MachineInstr &MI, Value *MemRef) {
+        return R.raiseDivideFromMemInstr(MI, MemRef);
+      };
+    case InstructionKind::LOAD_FPU_REG:
+    case InstructionKind::STORE_FPU_REG:
+      return [](XMIR &R, const MachineInstr &MI, Value *MemRef) {
+        return R.raiseFPUMachineInstr(MI, MemRef);
+      };
+    case InstructionKind::STRING_OP:
+      return [](XMIR &R, const MachineInstr &MI, Value *) {
+        return R.raiseStringMachineInstr(MI);
+      };
+    case InstructionKind::ATOMIC_MEM_OP:
+      return [](XMIR &R, const MachineInstr &MI, Value *MemRef) {
+        return R.raiseAtomicMemOpInstr(MI, MemRef);
+      };
+    case InstructionKind::FENCE:
+      return [](XMIR &R, const MachineInstr &MI, Value *) {
+        return R.raiseFenceMachineInstr(MI);
+      };
+    case InstructionKind::SSE_COMPARE_RM:
+      return [](XMIR &R, const MachineInstr &MI, Value *MemRef) {
+        return R.raiseSSECompareFromMemMachineInstr(MI, MemRef);
+      };
+    case InstructionKind::SSE_CONVERT_RM:
+      return [](XMIR &R, const MachineInstr &MI, Value *MemRef) {
+        return R.raiseSSEConvertPrecisionFromMemMachineInstr(MI, MemRef);
+      };
+    case InstructionKind::SSE_PACKED_OP:
+      return [](XMIR &R, const MachineInstr &MI, Value *MemRef) {
+        return R.raisePackedMachineInstr(MI, MemRef);
+      };
+    case InstructionKind::BIT_MANIP_OP:
+      return [](XMIR &R, const MachineInstr &MI, Value *MemRef) {
+        return R.raiseBitManipMachineInstr(MI, MemRef);
+      };
+    case InstructionKind::BIT_TEST_OP:
+      return [](XMIR &R, const MachineInstr &MI, Value *MemRef) {
+        return R.raiseBitTestMachineInstr(MI, MemRef, true);
+      };
+    case InstructionKind::SETCC:
+      return [](XMIR &R, const MachineInstr &MI, Value *MemRef) {
+        return R.raiseSetCCMachineInstr(MI, MemRef);
+      };
+    default:
+      return nullptr;
+    }
+  }
+
+  switch (Kind) {
   case InstructionKind::BINARY_OP_WITH_IMM:
-    Success = raiseBinaryOpImmToRegMachineInstr(MI);
-    break;
+    return [](XMIR &R, const MachineInstr &MI, Value *) {
+      return R.raiseBinaryOpImmToRegMachineInstr(MI);
+    };
   case InstructionKind::BINARY_OP_MRI_OR_MRC:
-    Success = raiseBinaryOpMRIOrMRCEncodedMachineInstr(MI);
-    break;
+    return [](XMIR &R, const MachineInstr &MI, Value *) {
+      return R.raiseBinaryOpMRIOrMRCEncodedMachineInstr(MI);
+    };
   case InstructionKind::CONVERT_BWWDDQ:
-    Success = raiseConvertBWWDDQMachineInstr(MI);
-    break;
+    return [](XMIR &R, const MachineInstr &MI, Value *) {
+      return R.raiseConvertBWWDDQMachineInstr(MI);
+    };
   case InstructionKind::CONVERT_WDDQQO:
-    Success = raiseConvertWDDQQOMachineInstr(MI);
-    break;
+    return [](XMIR &R, const MachineInstr &MI, Value *) {
+      return R.raiseConvertWDDQQOMachineInstr(MI);
+    };
   case InstructionKind::LEA_OP:
-    Success = raiseLEAMachineInstr(MI);
-    break;
+    return [](XMIR &R, const MachineInstr &MI, Value *) {
+      return R.raiseLEAMachineInstr(MI);
+    };
   case InstructionKind::MOV_RR:
-    Success = raiseMoveRegToRegMachineInstr(MI);
-    break;
+    return [](XMIR &R, const MachineInstr &MI, Value *) {
+      return R.raiseMoveRegToRegMachineInstr(MI);
+    };
   case InstructionKind::MOV_RI:
-    Success = raiseMoveImmToRegMachineInstr(MI);
-    break;
+    return [](XMIR &R, const MachineInstr &MI, Value *) {
+      return R.raiseMoveImmToRegMachineInstr(MI);
+    };
   case InstructionKind::BINARY_OP_RR:
-    Success = raiseBinaryOpRegToRegMachineInstr(MI);
-    break;
+    return [](XMIR &R, const MachineInstr &MI, Value *) {
+      return R.raiseBinaryOpRegToRegMachineInstr(MI);
+    };
   case InstructionKind::SETCC:
-    Success = raiseSetCCMachineInstr(MI);
-    break;
+    return [](XMIR &R, const MachineInstr &MI, Value *) {
+      return R.raiseSetCCMachineInstr(MI);
+    };
   case InstructionKind::COMPARE:
-    Success = raiseCompareMachineInstr(MI, false, nullptr);
-    break;
+    return [](XMIR &R, const MachineInstr &MI, Value *) {
+      return R.raiseCompareMachineInstr(MI, false, nullptr);
+    };
   case InstructionKind::FPU_REG_OP:
-    Success = raiseFPURegisterOpInstr(MI);
-    break;
-  case InstructionKind::DIVIDE_REG_OP: {
-    const MachineOperand &SrcOp = MI.getOperand(0);
-    assert(SrcOp.isReg() &&
-           "Expect register source operand of a div instruction");
-    Value *SrcVal =
-        getRegOrArgValue(SrcOp.getReg(), MI.getParent()->getNumber());
-    Success = raiseDivideInstr(MI, SrcVal);
-  } break;
+    return [](XMIR &R, const MachineInstr &MI, Value *) {
+      return R.raiseFPUMachineInstr(MI, nullptr);
+    };
+  case InstructionKind::DIVIDE_REG_OP:
+    return [](XMIR &R, const MachineInstr &MI, Value *) {
+      const MachineOperand &SrcOp = MI.getOperand(0);
+      assert(SrcOp.isReg() &&
+             "Expect register source operand of a div instruction");
+      Value *SrcVal =
+          R.getRegOrArgValue(SrcOp.getReg(), MI.getParent()->getNumber());
+      return R.raiseDivideInstr(MI, SrcVal);
+    };
   case InstructionKind::BIT_TEST_OP:
-    Success = raiseBitTestMachineInstr(MI, nullptr, false);
-    break;
+    return [](XMIR &R, const MachineInstr &MI, Value *) {
+      return R.raiseBitTestMachineInstr(MI, nullptr, false);
+    };
   case InstructionKind::SSE_MOV_RR:
-    Success = raiseSSEMoveRegToRegMachineInstr(MI);
-    break;
+    return [](XMIR &R, const MachineInstr &MI, Value *) {
+      return R.raiseSSEMoveRegToRegMachineInstr(MI);
+    };
   case InstructionKind::SSE_COMPARE_RR:
-    Success = raiseSSECompareMachineInstr(MI);
-    break;
+    return [](XMIR &R, const MachineInstr &MI, Value *) {
+      return R.raiseSSECompareMachineInstr(MI);
+    };
   case InstructionKind::SSE_CONVERT_RR:
-    Success = raiseSSEConvertPrecisionMachineInstr(MI);
-    break;
-  default: {
-    dbgs() << "*** Generic instruction not raised : " << MF.getName().data()
-           << "\n\t";
-    MI.print(dbgs());
-    Success = false;
-  }
+    return [](XMIR &R, const MachineInstr &MI, Value *) {
+      return R.raiseSSEConvertPrecisionMachineInstr(MI);
+    };
+  case InstructionKind::SSE_PACKED_OP:
+    return [](XMIR &R, const MachineInstr &MI, Value *) {
+      return R.raisePackedMachineInstr(MI, nullptr);
+    };
+  case InstructionKind::BIT_MANIP_OP:
+    return [](XMIR &R, const MachineInstr &MI, Value *) {
+      return R.raiseBitManipMachineInstr(MI, nullptr);
+    };
+  case InstructionKind::FENCE:
+    return [](XMIR &R, const MachineInstr &MI, Value *) {
+      return R.raiseFenceMachineInstr(MI);
+    };
+  default:
+    return nullptr;
   }
-  return Success;
 }
 
 // Raise a return instruction.
@@ -4912,7 +4749,10 @@ bool X86MachineInstructionRaiser::raiseReturnMachineInstr(
   BasicBlock *RaisedBB = getRaisedBasicBlock(MI.getParent());
 
   unsigned int RetReg = X86::NoRegister;
-  if (!RetType->isVoidTy()) {
+  if (RetType->isX86_FP80Ty()) {
+    // Values of type x86_fp80 are returned in ST(0)
+    RetValue = topFPURegisterStack();
+  } else if (!RetType->isVoidTy()) {
     if (RetType->isPointerTy())
       RetReg = X86::RAX;
     else if (RetType->isIntegerTy()) {
@@ -4988,6 +4828,8 @@ bool X86MachineInstructionRaiser::raiseBranchMachineInstrs() {
   LLVM_DEBUG(dbgs() << "CFG : Before Raising Terminator Instructions\n");
   LLVM_DEBUG(RaisedFunction->dump());
 
+  setFunctionEntryCount();
+
   // Raise branch instructions with control transfer records
   bool Success = true;
   for (ControlTransferInfo *CTRec : CTInfo) {
@@ -5004,6 +4846,8 @@ bool X86MachineInstructionRaiser::raiseBranchMachineInstrs() {
         Success &= raiseIndirectBranchMachineInstr(CTRec);
         assert(Success && "Failed to raise indirect branch instruction");
       }
+      if (DebugSP != nullptr)
+        setDebugLocations(*MI);
     }
   }
 
@@ -5058,67 +4902,7 @@ bool X86MachineInstructionRaiser::raiseBranchMachineInstrs() {
   LLVM_DEBUG(dbgs() << "CFG : After Raising Terminator Instructions\n");
   LLVM_DEBUG(RaisedFunction->dump());
 
-  return true;
-}
-
-// Raise FPU instructions
-bool X86MachineInstructionRaiser::raiseFPURegisterOpInstr(
-    const MachineInstr &MI) {
-
-  // Get the BasicBlock corresponding to MachineBasicBlock of MI.
-  // Raised instruction is added to this BasicBlock.
-  BasicBlock *RaisedBB = getRaisedBasicBlock(MI.getParent());
-
-  // Construct the appropriate instruction
-  unsigned Opcode = MI.getOpcode();
-  switch (Opcode) {
-  case X86::ADD_FPrST0:
-  case X86::MUL_FPrST0:
-  case X86::DIV_FPrST0: {
-    Value *St0Val = getFPURegisterStackValueAt(0);
-    assert((St0Val != nullptr) && "Failed to get ST(0) value");
-    Type *St0ValTy = St0Val->getType();
-    assert(St0ValTy->isFloatingPointTy() &&
-           "Unexpected non-FP value on FPU register stack");
-    assert((MI.getNumExplicitOperands() == 1) &&
-           "Unexpected number of operands in FP register op instruction "
-           "format");
-    const MachineOperand &StRegOp = MI.getOperand(0);
-    assert(StRegOp.isReg() &&
-           "Unexpected non-register operand of FP register op instruction");
-    int8_t FPRegIndex = StRegOp.getReg() - X86::ST0;
-    assert((FPRegIndex >= 0) && (FPRegIndex < FPUSTACK_SZ) &&
-           "Unexpected FPU register stack index computed");
-    Value *StVal = getFPURegisterStackValueAt(FPRegIndex);
-    assert((StVal != nullptr) && "Failed to get value of FPU register");
-    if (StVal->getType() != St0ValTy) {
-      CastInst *CInst = CastInst::Create(
-          CastInst::getCastOpcode(StVal, false, St0ValTy, false), StVal,
-          St0ValTy);
-      RaisedBB->getInstList().push_back(CInst);
-      StVal = CInst;
-    }
-    // Create fp operation
-    Instruction *FPRegOpInstr = nullptr;
-    if (Opcode == X86::MUL_FPrST0) {
-      FPRegOpInstr = BinaryOperator::CreateFMul(StVal, St0Val);
-    } else if (Opcode == X86::DIV_FPrST0) {
-      FPRegOpInstr = BinaryOperator::CreateFDiv(StVal, St0Val);
-    } else if (Opcode == X86::ADD_FPrST0) {
-      FPRegOpInstr = BinaryOperator::CreateFAdd(StVal, St0Val);
-    }
-    RaisedBB->getInstList().push_back(FPRegOpInstr);
-    // Update the FP register FPRegIndex with FPRegOpInstr
-    setFPURegisterStackValueAt(FPRegIndex, FPRegOpInstr);
-    // Pop FPU register stack
-    popFPURegisterStack();
-  } break;
-  default: {
-    assert(false && "Unhandled FPU instruction");
-  } break;
-  }
-
-  return true;
+  return Success;
 }
 
 // Raise Call instruction
@@ -5130,6 +4914,25 @@ bool X86MachineInstructionRaiser::raiseCallMachineInstr(
   // Raised instruction is added to this BasicBlock.
   BasicBlock *RaisedBB = getRaisedBasicBlock(MI.getParent());
 
+  // Raise an indirect call or jump whose target is resolved from register or
+  // GOT dataflow as a direct call to the prototype of the target.
+  Function *ResolvedFunc = nullptr;
+  if ((Opcode == X86::CALL64r) || (Opcode == X86::CALL64m) ||
+      (Opcode == X86::JMP64r) || (Opcode == X86::JMP64m)) {
+    ResolvedFunc = getCalledFunction(MI);
+    if ((ResolvedFunc == nullptr) && !MI.mayLoad()) {
+      // The register may hold a value raised from the function address
+      Value *TargetVal = getRegOrArgValue(MI.getOperand(0).getReg(),
+                                          MI.getParent()->getNumber());
+      if (auto *PtrToInt = dyn_cast_or_null<PtrToIntOperator>(TargetVal))
+        TargetVal = PtrToInt->getPointerOperand();
+      if (TargetVal != nullptr)
+        ResolvedFunc = dyn_cast<Function>(TargetVal->stripPointerCasts());
+    }
+    if (ResolvedFunc != nullptr)
+      Opcode = X86::CALL64pcrel32;
+  }
+
   bool Success = false;
   switch (Opcode) {
     // case X86::CALLpcrel16   :
@@ -5137,10 +4940,14 @@ bool X86MachineInstructionRaiser::raiseCallMachineInstr(
   case X86::CALL64pcrel32:
   case X86::JMP_1:
   case X86::JMP_4: {
-    Function *CalledFunc = getCalledFunction(MI);
+    Function *CalledFunc =
+        (ResolvedFunc != nullptr) ? ResolvedFunc : getCalledFunction(MI);
     LLVMContext &Ctx(MF.getFunction().getContext());
 
-    assert(CalledFunc != nullptr && "Failed to detect call target");
+    // The call target is unknown, e.g., since the prototype of the called
+    // external function is not known.
+    if (CalledFunc == nullptr)
+      return false;
     std::vector<Value *> CallInstFuncArgs;
     unsigned NumGPArgs = CalledFunc->arg_size();
     Argument *CalledFuncArgs = CalledFunc->arg_begin();
@@ -5356,7 +5163,10 @@ bool X86MachineInstructionRaiser::raiseCallMachineInstr(
     // A function call with a non-void return will modify
     // RAX (or its sub-register).
     Type *RetType = CalledFunc->getReturnType();
-    if (!RetType->isVoidTy()) {
+    if (RetType->isX86_FP80Ty()) {
+      // Values of type x86_fp80 are returned in ST(0)
+      pushFPURegisterStack(CInst);
+    } else if (!RetType->isVoidTy()) {
       unsigned int RetReg = X86::NoRegister;
       if (RetType->isPointerTy()) {
         // Cast pointer return type to 64-bit type
@@ -5441,7 +5251,9 @@ bool X86MachineInstructionRaiser::raiseCallMachineInstr(
     Success = true;
   } break;
   case X86::CALL64m:
-  case X86::CALL64r: {
+  case X86::CALL64r:
+  case X86::JMP64m:
+  case X86::JMP64r: {
     LLVMContext &Ctxt(MF.getFunction().getContext());
     BasicBlock *RaisedBB = getRaisedBasicBlock(MI.getParent());
     const MachineBasicBlock *MBB = MI.getParent();
@@ -5477,8 +5289,12 @@ bool X86MachineInstructionRaiser::raiseCallMachineInstr(
     // Find if return register is used before the end of the block with call
     // instruction. If so, consider that to indicate the return value of the
     // called function.
+    // An indirect tail call returns the value returned by the called
+    // function.
     bool BlockHasCall;
-    Type *ReturnType = getReturnTypeFromMBB(*MBB, BlockHasCall /* ignored*/);
+    Type *ReturnType =
+        MI.isBranch() ? RaisedFunction->getReturnType()
+                      : getReturnTypeFromMBB(*MBB, BlockHasCall /* ignored*/);
 
     // If return type not found, consider it to be void type
     if (ReturnType == nullptr) {
@@ -5490,7 +5306,7 @@ bool X86MachineInstructionRaiser::raiseCallMachineInstr(
 
     Value *Func;
     // Get function pointer address.
-    if (Opcode == X86::CALL64r) {
+    if (!MI.mayLoad()) {
       Register CallReg = MI.getOperand(0).getReg();
       Func = getRegOrArgValue(CallReg, MBBNo);
     } else {
@@ -5554,6 +5370,18 @@ bool X86MachineInstructionRaiser::raiseCallMachineInstr(
     // A function call with a non-void return will modify RAX.
     if (ReturnType && !ReturnType->isVoidTy())
       raisedValues->setPhysRegSSAValue(X86::RAX, MBBNo, CallInst);
+    if (MI.isBranch()) {
+      // An indirect jump to another function is a tail call. It is
+      // guaranteed to be raised as one only if the prototype of the called
+      // function is that of the raised function.
+      CallInst->setTailCallKind(FT == RaisedFunction->getFunctionType()
+                                    ? CallInst::TCK_MustTail
+                                    : CallInst::TCK_Tail);
+      ReturnInst *RetInstr = ReturnType->isVoidTy()
+                                 ? ReturnInst::Create(Ctxt)
+                                 : ReturnInst::Create(Ctxt, CallInst);
+      RaisedBB->getInstList().push_back(RetInstr);
+    }
     Success = true;
   } break;
   default: {
@@ -5572,6 +5400,14 @@ bool X86MachineInstructionRaiser::raiseMachineInstr(MachineInstr &MI) {
   const MCInstrDesc &MIDesc = MI.getDesc();
   bool Success = false;
 
+  // A legacy SSE instruction writing an xmm register keeps the upper half of
+  // its ymm register.
+  unsigned int LegacySSEDefReg = getLegacySSEDefReg(MI);
+  Value *PrevYMMVal = nullptr;
+  if (LegacySSEDefReg != X86::NoRegister)
+    PrevYMMVal =
+        getRegOrArgValue(LegacySSEDefReg, MI.getParent()->getNumber());
+
   if (MIDesc.mayLoad() || MIDesc.mayStore()) {
     Success = raiseMemRefMachineInstr(MI);
   } else if (MIDesc.isReturn()) {
@@ -5579,6 +5415,10 @@ bool X86MachineInstructionRaiser::raiseMachineInstr(MachineInstr &MI) {
   } else {
     Success = raiseGenericMachineInstr(MI);
   }
+
+  if (Success && (PrevYMMVal != nullptr))
+    mergeUpperYMMHalf(LegacySSEDefReg, MI.getParent()->getNumber(),
+                      PrevYMMVal);
   return Success;
 }
 
@@ -5600,6 +5440,23 @@ bool X86MachineInstructionRaiser::raiseMachineFunction() {
     // raisedValues->setPhysRegSSAValue(b, 0, Zero1BitValue);
     raisedValues->setEflagBoolean(EFBit, 0, false);
 
+  std::string FuncDesc = getFunctionDescription();
+  {
+    TimeTraceScope Scope("EliminatePrologEpilog", FuncDesc);
+    eliminatePrologEpilog();
+  }
+
+  if (MR->debugAddresses()) {
+    MCInstRaiser *MCIR = getMCInstRaiser();
+    DebugSP = const_cast<ModuleRaiser *>(MR)->createAddressSubprogram(
+        CurFunction->getName(),
+        MCIR->getTextSectionAddress() + MCIR->getFuncStart());
+  }
+
+  // Compute the FPU register stack top at entry of each block
+  if (!computeFPUStackTops())
+    return false;
+
   // Set values of some registers that appear to be used in main function to
   // 0.
   if (CurFunction->getName().equals("main")) {
@@ -5613,59 +5470,88 @@ bool X86MachineInstructionRaiser::raiseMachineFunction() {
 
   // Raise all non control transfer MachineInstrs of each MachineBasicBlocks
   // of MachineFunction, except branch instructions.
-  LoopTraversal Traversal;
-  LoopTraversal::TraversalOrder TraversedMBBOrder = Traversal.traverse(MF);
-  for (LoopTraversal::TraversedMBBInfo TraversedMBB : TraversedMBBOrder) {
-    // Only perform the primary pass as we do not want to translate one
-    // block more than once.
-    if (!TraversedMBB.PrimaryPass)
-      continue;
-    MachineBasicBlock &MBB = *(TraversedMBB.MBB);
-    // Get the number of MachineBasicBlock being looked at.
-    int MBBNo = MBB.getNumber();
-    // Name of the corresponding BasicBlock to be created
-    std::string BBName = MBBNo == 0 ? "entry" : "bb." + std::to_string(MBBNo);
-    // Create a BasicBlock instance corresponding to MBB being looked at.
-    // The raised form of MachineInstr of MBB will be added to curBlock.
-    // Do not use CurFunction here, as CurFunction might change if it's return
-    // type is changed
-    BasicBlock *CurIBB = BasicBlock::Create(Ctx, BBName, getRaisedFunction());
-    // Record the mapping of the number of MBB to corresponding BasicBlock.
-    // This information is used to raise branch instructions, if any, of the
-    // MBB in a later walk of MachineBasicBlocks of MF.
-    mbbToBBMap.insert(std::make_pair(MBBNo, CurIBB));
-    // Walk MachineInsts of the MachineBasicBlock
-    for (MachineInstr &MI : MBB.instrs()) {
-      // Ignore padding instructions. ld uses nop and lld uses int3 for
-      // alignment padding in text section.
-      // TODO : For now ignore ENDBR instructions. These can be used as clues
-      // for functions that are indirect branch targets.
-      auto Opcode = MI.getOpcode();
-      if (isNoop(Opcode) || (Opcode == X86::INT3) || (Opcode == X86::ENDBR32) ||
-          (Opcode == X86::ENDBR64)) {
-        continue;
-      }
-      // If this is a terminator instruction, record
-      // necessary information to raise it in a later pass.
-      if (MI.isTerminator() && !MI.isReturn()) {
-        recordMachineInstrInfo(MI);
+  {
+    TimeTraceScope RaiseInstrsScope("RaiseMachineInstrs", FuncDesc);
+    LoopTraversal Traversal;
+    LoopTraversal::TraversalOrder TraversedMBBOrder = Traversal.traverse(MF);
+    for (LoopTraversal::TraversedMBBInfo TraversedMBB : TraversedMBBOrder) {
+      // Only perform the primary pass as we do not want to translate one
+      // block more than once.
+      if (!TraversedMBB.PrimaryPass)
         continue;
-      }
-      if (MI.isCall()) {
-        if (!raiseCallMachineInstr(MI)) {
+      MachineBasicBlock &MBB = *(TraversedMBB.MBB);
+      MR->checkFunctionBudget();
+      // Get the number of MachineBasicBlock being looked at.
+      int MBBNo = MBB.getNumber();
+      // Name of the corresponding BasicBlock to be created
+      std::string BBName = MBBNo == 0 ? "entry" : "bb." + std::to_string(MBBNo);
+      // Create a BasicBlock instance corresponding to MBB being looked at.
+      // The raised form of MachineInstr of MBB will be added to curBlock.
+      // Do not use CurFunction here, as CurFunction might change if it's return
+      // type is changed
+      BasicBlock *CurIBB = BasicBlock::Create(Ctx, BBName, getRaisedFunction());
+      // Record the mapping of the number of MBB to corresponding BasicBlock.
+      // This information is used to raise branch instructions, if any, of the
+      // MBB in a later walk of MachineBasicBlocks of MF.
+      mbbToBBMap.insert(std::make_pair(MBBNo, CurIBB));
+      initFPURegisterStack(MBB);
+      // Walk MachineInsts of the MachineBasicBlock
+      for (MachineInstr &MI : MBB.instrs()) {
+        // Ignore padding instructions. ld uses nop and lld uses int3 for
+        // alignment padding in text section.
+        // TODO : For now ignore ENDBR instructions. These can be used as clues
+        // for functions that are indirect branch targets.
+        auto Opcode = MI.getOpcode();
+        if (isNoop(Opcode) || (Opcode == X86::INT3) ||
+            (Opcode == X86::ENDBR32) || (Opcode == X86::ENDBR64)) {
+          continue;
+        }
+        // If this is a terminator instruction, record
+        // necessary information to raise it in a later pass.
+        if (MI.isTerminator() && !MI.isReturn()) {
+          if (!recordMachineInstrInfo(MI))
+            return false;
+          if (DebugSP != nullptr)
+            setDebugLocations(MI);
+          continue;
+        }
+        if (MI.isCall()) {
+          if (!raiseCallMachineInstr(MI)) {
+            return false;
+          }
+        } else if (!raiseMachineInstr(MI)) {
           return false;
         }
-      } else if (!raiseMachineInstr(MI)) {
-        return false;
+        if (DebugSP != nullptr)
+          setDebugLocations(MI);
       }
     }
   }
-  return createFunctionStackFrame() && raiseBranchMachineInstrs() &&
-         handleUnpromotedReachingDefs() && handleUnterminatedBlocks();
+  {
+    TimeTraceScope Scope("CreateFunctionStackFrame", FuncDesc);
+    if (!createFunctionStackFrame())
+      return false;
+  }
+  {
+    TimeTraceScope Scope("RaiseBranchMachineInstrs", FuncDesc);
+    if (!raiseBranchMachineInstrs())
+      return false;
+  }
+  {
+    TimeTraceScope Scope("HandleUnpromotedReachingDefs", FuncDesc);
+    if (!handleUnpromotedReachingDefs())
+      return false;
+  }
+  TimeTraceScope Scope("HandleUnterminatedBlocks", FuncDesc);
+  return handleUnterminatedBlocks();
 }
 
 bool X86MachineInstructionRaiser::raise() {
-  bool Success = raiseMachineFunction();
+  bool Success;
+  {
+    TimeTraceScope Scope("RaiseMachineFunction", getFunctionDescription());
+    Success = raiseMachineFunction();
+  }
   if (Success) {
     // Delete empty basic blocks with no predecessors
     SmallVector<BasicBlock *, 4> UnConnectedBEmptyBs;
@@ -5680,6 +5566,9 @@ bool X86MachineInstructionRaiser::raise() {
     legacy::PassManager PM;
     PM.add(createUnifyFunctionExitNodesPass());
     PM.run(*(RaisedFunction->getParent()));
+
+    if (DebugSP != nullptr)
+      finishDebugLocations();
   }
   return Success;
 }
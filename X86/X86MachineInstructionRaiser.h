@@ -17,6 +17,7 @@
 #include "Raiser/MachineInstructionRaiser.h"
 #include "X86AdditionalInstrInfo.h"
 #include "llvm/IR/Instructions.h"
+#include "llvm/Object/ELFObjectFile.h"
 
 namespace llvm {
 
@@ -62,6 +63,8 @@ public:
   Type *getPhysRegType(unsigned int PhysReg);
   // Return type of the floating point physical register
   Type *getPhysSSERegType(unsigned int PhysReg, uint8_t BitPrecision);
+  // Return the type of stack slots holding promoted SSE register values
+  Type *getSSERegSlotType();
 
   bool insertAllocaInEntryBlock(Instruction *Alloca, int StackOffset,
                                 int MFIndex);
@@ -72,8 +75,22 @@ public:
   int getArgumentNumber(unsigned PReg) override;
   auto getRegisterInfo() const { return x86RegisterInfo; }
   bool instrNameStartsWith(const MachineInstr &MI, StringRef Name) const;
+  // Return the prefixes (X86::IP_*) of the instruction MI was raised from.
+  unsigned getInstrPrefixes(const MachineInstr &MI);
   X86RaisedValueTracker *getRaisedValues() { return raisedValues; }
 
+  // Raiser of instructions of a kind, given the value of the memory reference
+  // of instructions referencing memory and nullptr otherwise.
+  using KindRaiser = bool (*)(X86MachineInstructionRaiser &,
+                              const MachineInstr &, Value *);
+  // Return the raiser of instructions of kind Kind that reference memory if
+  // IsMemRef is true, and that do not otherwise; nullptr if instructions of
+  // the kind are not raised.
+  static KindRaiser getKindRaiser(InstructionKind Kind, bool IsMemRef);
+  // Return true if the instruction named InstrName is raised as an atomic
+  // read-modify-write operation when it has a lock prefix.
+  static bool isRaisedLockedMemOp(StringRef InstrName);
+
 private:
   X86RaisedValueTracker *raisedValues;
 
@@ -85,15 +102,32 @@ private:
   // at the exit of the MBB.
   std::map<int, MCPhysRegSizeMap> PerMBBDefinedPhysRegMap;
 
+  // FPU register stack of the block being raised. Regs holds the values of
+  // the physical FPU registers defined or used in the block.
   static const uint8_t FPUSTACK_SZ = 8;
   struct {
     int8_t TOP;
     Value *Regs[FPUSTACK_SZ];
+    BasicBlock *RaisedBB;
   } FPUStack;
+  // Stack slots holding the values of the physical FPU registers across
+  // blocks, created on first use.
+  AllocaInst *FPURegSlots[FPUSTACK_SZ];
+  // A map of MBB number to the index of the FPU register stack top at the
+  // entry of the MBB.
+  std::map<int, int8_t> FPUStackTopAtMBBEntry;
+
+  // Type of stack slots holding promoted SSE register values, computed on
+  // first use.
+  Type *SSERegSlotTy = nullptr;
 
   // A map of MachineFunctionBlock number to BasicBlock *
   MBBNumToBBMap mbbToBBMap;
 
+  // Subprogram of the raised function, if debug locations with the addresses
+  // of raised instructions are emitted
+  DISubprogram *DebugSP = nullptr;
+
   // Since MachineFrameInfo does not represent stack object ordering, we
   // maintain a shadow stack indexed and sorted by descending order of stack
   // offset of objects allocated on the stack.
@@ -110,7 +144,18 @@ private:
   Value *getRegOrArgValue(unsigned PReg, int MBBNo) override;
 
   bool raiseMachineFunction();
+  // Remove balanced saves and restores of callee-saved registers
+  void eliminatePrologEpilog();
+  // Annotate raised conditional branches and the raised function with
+  // profiled or statically inferred execution frequencies
+  void setBranchWeights(BranchInst *, const MachineInstr &, int64_t TgtMBBNo,
+                        int64_t FTMBBNo);
+  void setFunctionEntryCount();
+  bool isColdBlock(int64_t MBBNo) const;
   FunctionType *getRaisedFunctionPrototype() override;
+  bool setRaisedFunctionPrototype(FunctionType *FT) override;
+  // Replace the placeholder function of MF with a function of type FT
+  void createRaisedFunction(FunctionType *FT);
   // This raises MachineInstr to MachineInstruction
   bool raiseMachineInstr(MachineInstr &);
 
@@ -141,9 +186,11 @@ private:
   bool raiseDivideFromMemInstr(const MachineInstr &, Value *);
   bool raiseDivideInstr(const MachineInstr &, Value *);
   bool raiseBitTestMachineInstr(const MachineInstr &, Value *, bool);
-  bool raiseLoadIntToFloatRegInstr(const MachineInstr &, Value *);
-  bool raiseStoreIntToFloatRegInstr(const MachineInstr &, Value *);
-  bool raiseFPURegisterOpInstr(const MachineInstr &);
+  bool raiseFPUMachineInstr(const MachineInstr &, Value *);
+  bool raiseStringMachineInstr(const MachineInstr &);
+  bool raiseAtomicMemOpInstr(const MachineInstr &, Value *);
+  bool raiseLockedMemOpInstr(const MachineInstr &, Value *);
+  bool raiseFenceMachineInstr(const MachineInstr &);
   bool raiseSSECompareMachineInstr(const MachineInstr &);
   bool raiseSSECompareFromMemMachineInstr(const MachineInstr &, Value *);
   bool raiseSSECompareMachineInstr(const MachineInstr &, Value *CmpOpVal1,
@@ -152,6 +199,10 @@ private:
   bool raiseSSEConvertPrecisionFromMemMachineInstr(const MachineInstr &,
                                                    Value *);
   bool raiseSSEMoveRegToRegMachineInstr(const MachineInstr &);
+  bool raisePackedMachineInstr(const MachineInstr &, Value *);
+  unsigned int getLegacySSEDefReg(const MachineInstr &);
+  void mergeUpperYMMHalf(unsigned int XMMReg, int MBBNo, Value *PrevYMMVal);
+  bool raiseBitManipMachineInstr(const MachineInstr &, Value *);
 
   bool raiseBranchMachineInstrs();
   bool raiseDirectBranchMachineInstr(ControlTransferInfo *);
@@ -169,10 +220,16 @@ private:
   bool unlinkEmptyMBBs();
   // Adjust sizes of stack allocated objects
   bool createFunctionStackFrame();
+  bool isStackObjectIsolated(std::map<int64_t, int>::const_iterator);
 
   // Method to record information that is used in a second pass
   // to raise control transfer instructions in a second pass.
   bool recordMachineInstrInfo(const MachineInstr &);
+  // Set debug locations of instructions raised from MachineInstr to its
+  // address, and of all other raised instructions to that of the instruction
+  // before them.
+  void setDebugLocations(const MachineInstr &);
+  void finishDebugLocations();
 
   // Raise Machine Jumptable
   bool raiseMachineJumpTable();
@@ -185,11 +242,21 @@ private:
   Value *getFPURegisterStackValueAt(int8_t);
   void setFPURegisterStackValueAt(int8_t, Value *);
   Value *topFPURegisterStack();
+  AllocaInst *getFPURegisterSlot(int8_t);
+  void initFPURegisterStack(const MachineBasicBlock &);
+  bool computeFPUStackTops();
+  int8_t getFPUStackTopAfter(const MachineInstr &, int8_t);
+  int8_t getFPUStackTopAt(const MachineInstr &);
 
   int getMemoryRefOpIndex(const MachineInstr &);
   Value *getGlobalVariableValueAt(const MachineInstr &, uint64_t);
   Value *getOrCreateGlobalRODataValueAtOffset(int64_t Offset,
                                               BasicBlock *InsertBlock);
+  Value *getOrCreateSectionDataValueAtOffset(const SectionRef &Sec,
+                                             uint64_t DataOffset);
+  Value *getOrCreateGlobalValueOfRelocSymbol(const MachineInstr &MI,
+                                             const ELFSymbolRef &Sym,
+                                             int64_t SymOffset);
   Value *getMemoryAddressExprValue(const MachineInstr &);
   Value *createPCRelativeAccesssValue(const MachineInstr &);
 
@@ -201,6 +268,13 @@ private:
   Type *getReachingReturnType(const MachineBasicBlock &MBB);
   Type *getReturnTypeFromMBB(const MachineBasicBlock &MBB, bool &HasCall);
   Function *getTargetFunctionAtPLTOffset(const MachineInstr &, uint64_t);
+  Function *getTargetFunctionOfDynReloc(const RelocationRef &);
+  Function *getFunctionAtAddress(const MachineInstr &, uint64_t);
+  Function *getFunctionInRegister(unsigned int Reg, const MachineInstr &);
+  Function *getIndirectTransferTarget(const MachineInstr &);
+  bool isIndirectTailCall(const MachineInstr &);
+  int64_t getPCRelativeMemRefAddress(const MachineInstr &, unsigned int);
+  Function *getTargetFunctionOfTextReloc(const MachineInstr &);
   Value *getStackAllocatedValue(const MachineInstr &, X86AddressMode &, bool);
   Value *getRegOperandValue(const MachineInstr &MI, unsigned OperandIndex);
 
@@ -0,0 +1,287 @@
+//===-- X86MachineInstructionRaiserAtomic.cpp --------------------*- C++-*-===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+//
+// This file contains implementation of functions to raise atomic instructions
+// (XCHG, XADD and CMPXCHG with a memory operand, LOCK-prefixed instructions
+// and fences) declared in X86MachineInstructionRaiser class for use by
+// llvm-mctoll.
+//
+//===----------------------------------------------------------------------===//
+
+#include "X86AdditionalInstrInfo.h"
+#include "X86InstrBuilder.h"
+#include "X86MachineInstructionRaiser.h"
+#include "X86RaisedValueTracker.h"
+#include "X86RegisterUtils.h"
+#include "llvm/ADT/STLExtras.h"
+#include "llvm/IR/Intrinsics.h"
+#include "llvm/Support/Debug.h"
+
+#define DEBUG_TYPE "mctoll"
+
+using namespace llvm;
+using namespace llvm::mctoll;
+using namespace llvm::mctoll::X86RegisterUtils;
+
+// All locked instructions are sequentially consistent.
+static const AtomicOrdering LockOrdering =
+    AtomicOrdering::SequentiallyConsistent;
+
+// Atomic read-modify-write operations that locked instructions are raised
+// as, by the prefix of the instruction name. inc and dec add and subtract 1;
+// not xors with all ones.
+static const struct {
+  StringRef NamePrefix;
+  AtomicRMWInst::BinOp Op;
+  Instruction::BinaryOps ResultOp;
+} LockedMemOps[] = {
+    {"ADD", AtomicRMWInst::Add, Instruction::Add},
+    {"INC", AtomicRMWInst::Add, Instruction::Add},
+    {"SUB", AtomicRMWInst::Sub, Instruction::Sub},
+    {"DEC", AtomicRMWInst::Sub, Instruction::Sub},
+    {"AND", AtomicRMWInst::And, Instruction::And},
+    {"OR", AtomicRMWInst::Or, Instruction::Or},
+    {"XOR", AtomicRMWInst::Xor, Instruction::Xor},
+    {"NOT", AtomicRMWInst::Xor, Instruction::Xor}};
+
+bool X86MachineInstructionRaiser::isRaisedLockedMemOp(StringRef InstrName) {
+  return any_of(LockedMemOps, [InstrName](const auto &LockedOp) {
+    return InstrName.startswith(LockedOp.NamePrefix);
+  });
+}
+
+// Cast MemRefVal, the memory operand of MI, to a pointer to an integer of the
+// memory access size of MI.
+static Value *getAtomicPointer(const MachineInstr &MI, Value *MemRefVal,
+                               X86RaisedValueTracker *RaisedValues,
+                               BasicBlock *RaisedBB) {
+  LLVMContext &Ctx = RaisedBB->getContext();
+  unsigned int MemOpSize = getInstructionMemOpSize(MI.getOpcode());
+  assert(MemOpSize != 0 && "Expected mem op size to be > 0");
+  Type *DataTy = Type::getIntNTy(Ctx, MemOpSize * 8);
+  return RaisedValues->castValue(MemRefVal, DataTy->getPointerTo(), RaisedBB);
+}
+
+// Raise XCHG, XADD and CMPXCHG with a memory operand. XCHG is atomic with or
+// without a LOCK prefix. XADD and CMPXCHG are raised as atomic operations
+// even without one; this is at most stronger than the original code.
+//   - xchg reg, mem      -> reg = atomicrmw xchg mem, reg
+//   - xadd mem, reg      -> reg = atomicrmw add mem, reg
+//   - cmpxchg mem, reg   -> {acc, ZF} = cmpxchg mem, acc, reg
+bool X86MachineInstructionRaiser::raiseAtomicMemOpInstr(const MachineInstr &MI,
+                                                        Value *MemRefVal) {
+  BasicBlock *RaisedBB = getRaisedBasicBlock(MI.getParent());
+  int MBBNo = MI.getParent()->getNumber();
+  unsigned int MemOpSize = getInstructionMemOpSize(MI.getOpcode());
+  Value *Ptr = getAtomicPointer(MI, MemRefVal, raisedValues, RaisedBB);
+  Type *DataTy = Type::getIntNTy(RaisedBB->getContext(), MemOpSize * 8);
+
+  // The register operand is the one following the memory operand in
+  // CMPXCHG, and the (tied) use operand preceding it in XCHG and XADD.
+  int MemRefOpIndex = getMemoryRefOpIndex(MI);
+  assert(MemRefOpIndex != -1 && "Unable to find memory reference operand of "
+                                "atomic instruction");
+  unsigned int RegOpIndex =
+      (MemRefOpIndex == 0) ? X86::AddrNumOperands : MemRefOpIndex - 1;
+  const MachineOperand &RegOp = MI.getOperand(RegOpIndex);
+  assert(RegOp.isReg() && "Expected register operand of atomic instruction");
+  Value *RegVal = getRegOperandValue(MI, RegOpIndex);
+  if (RegVal == nullptr) {
+    LLVM_DEBUG(MI.dump());
+    LLVM_DEBUG(dbgs() << "Unable to find value of atomic operand\n");
+    return false;
+  }
+  RegVal = raisedValues->castValue(RegVal, DataTy, RaisedBB);
+
+  if (instrNameStartsWith(MI, "XCHG")) {
+    Value *Old =
+        new AtomicRMWInst(AtomicRMWInst::Xchg, Ptr, RegVal, Align(MemOpSize),
+                          LockOrdering, SyncScope::System, RaisedBB);
+    raisedValues->setPhysRegSSAValue(RegOp.getReg(), MBBNo, Old);
+    return true;
+  }
+
+  if (instrNameStartsWith(MI, "XADD")) {
+    Value *Old =
+        new AtomicRMWInst(AtomicRMWInst::Add, Ptr, RegVal, Align(MemOpSize),
+                          LockOrdering, SyncScope::System, RaisedBB);
+    // Flags are those of the sum stored to memory. As for add, CF is the
+    // unsigned and OF the signed overflow of the sum.
+    Instruction *Sum = BinaryOperator::CreateAdd(Old, RegVal, "", RaisedBB);
+    Module *M = MR->getModule();
+    Function *UAddF = Intrinsic::getDeclaration(
+        M, Intrinsic::uadd_with_overflow, DataTy);
+    CallInst *UAdd = CallInst::Create(UAddF, {Old, RegVal}, "", RaisedBB);
+    raisedValues->setEflagValue(
+        EFLAGS::CF, MBBNo, ExtractValueInst::Create(UAdd, 1, "CF", RaisedBB));
+    Function *SAddF = Intrinsic::getDeclaration(
+        M, Intrinsic::sadd_with_overflow, DataTy);
+    CallInst *SAdd = CallInst::Create(SAddF, {Old, RegVal}, "", RaisedBB);
+    raisedValues->setEflagValue(
+        EFLAGS::OF, MBBNo, ExtractValueInst::Create(SAdd, 1, "OF", RaisedBB));
+    raisedValues->testAndSetEflagSSAValue(EFLAGS::ZF, MI, Sum);
+    raisedValues->testAndSetEflagSSAValue(EFLAGS::SF, MI, Sum);
+    raisedValues->testAndSetEflagSSAValue(EFLAGS::PF, MI, Sum);
+    raisedValues->setPhysRegSSAValue(RegOp.getReg(), MBBNo, Old);
+    return true;
+  }
+
+  assert(instrNameStartsWith(MI, "CMPXCHG") &&
+         "Unhandled atomic memory instruction");
+  // The accumulator of the size of the access holds the expected value.
+  unsigned int AccReg = (MemOpSize == 1)   ? X86::AL
+                        : (MemOpSize == 2) ? X86::AX
+                        : (MemOpSize == 4) ? X86::EAX
+                                           : X86::RAX;
+  Value *AccVal = getRegOrArgValue(AccReg, MBBNo);
+  if (AccVal == nullptr) {
+    LLVM_DEBUG(MI.dump());
+    LLVM_DEBUG(dbgs() << "Unable to find value of cmpxchg accumulator\n");
+    return false;
+  }
+  AccVal = raisedValues->castValue(AccVal, DataTy, RaisedBB);
+  auto *CmpXchg = new AtomicCmpXchgInst(Ptr, AccVal, RegVal, Align(MemOpSize),
+                                        LockOrdering, LockOrdering,
+                                        SyncScope::System, RaisedBB);
+  Value *Old = ExtractValueInst::Create(CmpXchg, 0, "", RaisedBB);
+  Value *Success = ExtractValueInst::Create(CmpXchg, 1, "", RaisedBB);
+
+  // Flags are those of comparing the accumulator with the old value, except
+  // for ZF, which is the success of the exchange.
+  Instruction *Diff = BinaryOperator::CreateSub(AccVal, Old, "", RaisedBB);
+  raisedValues->testAndSetEflagSSAValue(EFLAGS::CF, MI, Diff);
+  raisedValues->testAndSetEflagSSAValue(EFLAGS::SF, MI, Diff);
+  raisedValues->testAndSetEflagSSAValue(EFLAGS::OF, MI, Diff);
+  raisedValues->testAndSetEflagSSAValue(EFLAGS::PF, MI, Diff);
+  raisedValues->setEflagValue(EFLAGS::ZF, MBBNo, Success);
+  // The accumulator is loaded with the old value if the exchange failed, and
+  // already holds it otherwise.
+  raisedValues->setPhysRegSSAValue(AccReg, MBBNo, Old);
+  return true;
+}
+
+// Raise a LOCK-prefixed read-modify-write instruction as an atomicrmw.
+// Flags are computed from the value stored to memory. Locked instructions
+// without an atomicrmw equivalent are not raised, rather than being raised
+// as a racy load, operation and store.
+bool X86MachineInstructionRaiser::raiseLockedMemOpInstr(const MachineInstr &MI,
+                                                        Value *MemRefVal) {
+  BasicBlock *RaisedBB = getRaisedBasicBlock(MI.getParent());
+  int MBBNo = MI.getParent()->getNumber();
+  unsigned int MemOpSize = getInstructionMemOpSize(MI.getOpcode());
+  if (MemOpSize == 0) {
+    LLVM_DEBUG(MI.dump());
+    LLVM_DEBUG(dbgs() << "Unhandled locked instruction\n");
+    return false;
+  }
+  Type *DataTy = Type::getIntNTy(RaisedBB->getContext(), MemOpSize * 8);
+
+  bool IsAdd = instrNameStartsWith(MI, "ADD");
+  bool IsSub = instrNameStartsWith(MI, "SUB");
+  bool IsInc = instrNameStartsWith(MI, "INC");
+  bool IsDec = instrNameStartsWith(MI, "DEC");
+  bool IsNot = instrNameStartsWith(MI, "NOT");
+
+  const auto *LockedOp = find_if(LockedMemOps, [&](const auto &LockedOp) {
+    return instrNameStartsWith(MI, LockedOp.NamePrefix);
+  });
+  if (LockedOp == std::end(LockedMemOps)) {
+    LLVM_DEBUG(MI.dump());
+    LLVM_DEBUG(dbgs() << "Unhandled locked instruction\n");
+    return false;
+  }
+  AtomicRMWInst::BinOp Op = LockedOp->Op;
+  Instruction::BinaryOps ResultOp = LockedOp->ResultOp;
+
+  // Get the operand combined with memory: 1 for inc and dec, all ones for
+  // not, and the register or immediate following the memory operand
+  // otherwise.
+  Value *SrcVal = nullptr;
+  if (IsInc || IsDec) {
+    SrcVal = ConstantInt::get(DataTy, 1);
+  } else if (IsNot) {
+    SrcVal = ConstantInt::getAllOnesValue(DataTy);
+  } else {
+    int MemRefOpIndex = getMemoryRefOpIndex(MI);
+    assert(MemRefOpIndex != -1 && "Unable to find memory reference operand "
+                                  "of locked instruction");
+    unsigned int SrcOpIndex = MemRefOpIndex + X86::AddrNumOperands;
+    const MachineOperand &SrcOp = MI.getOperand(SrcOpIndex);
+    if (SrcOp.isImm()) {
+      SrcVal = ConstantInt::get(DataTy, SrcOp.getImm());
+    } else {
+      assert(SrcOp.isReg() && "Unexpected operand of locked instruction");
+      SrcVal = getRegOperandValue(MI, SrcOpIndex);
+      if (SrcVal == nullptr) {
+        LLVM_DEBUG(MI.dump());
+        LLVM_DEBUG(dbgs() << "Unable to find value of locked operand\n");
+        return false;
+      }
+      SrcVal = raisedValues->castValue(SrcVal, DataTy, RaisedBB);
+    }
+  }
+
+  Value *Ptr = getAtomicPointer(MI, MemRefVal, raisedValues, RaisedBB);
+  Value *Old = new AtomicRMWInst(Op, Ptr, SrcVal, Align(MemOpSize),
+                                 LockOrdering, SyncScope::System, RaisedBB);
+  if (IsNot)
+    // not does not affect flags.
+    return true;
+
+  Instruction *Result =
+      BinaryOperator::Create(ResultOp, Old, SrcVal, "", RaisedBB);
+  if (IsAdd || IsSub) {
+    raisedValues->testAndSetEflagSSAValue(EFLAGS::CF, MI, Result);
+    raisedValues->testAndSetEflagSSAValue(EFLAGS::OF, MI, Result);
+  } else if (IsInc || IsDec) {
+    // OF is the signed overflow of adding or subtracting 1. inc and dec do
+    // not affect CF.
+    Function *OverflowF = Intrinsic::getDeclaration(
+        MR->getModule(),
+        IsInc ? Intrinsic::sadd_with_overflow : Intrinsic::ssub_with_overflow,
+        DataTy);
+    CallInst *Overflow =
+        CallInst::Create(OverflowF, {Old, SrcVal}, "", RaisedBB);
+    raisedValues->setEflagValue(
+        EFLAGS::OF, MBBNo,
+        ExtractValueInst::Create(Overflow, 1, "OF", RaisedBB));
+  } else {
+    // Logical operations clear CF and OF.
+    raisedValues->setEflagBoolean(EFLAGS::CF, MBBNo, false);
+    raisedValues->setEflagBoolean(EFLAGS::OF, MBBNo, false);
+  }
+  raisedValues->testAndSetEflagSSAValue(EFLAGS::ZF, MI, Result);
+  raisedValues->testAndSetEflagSSAValue(EFLAGS::SF, MI, Result);
+  raisedValues->testAndSetEflagSSAValue(EFLAGS::PF, MI, Result);
+  return true;
+}
+
+// Raise mfence, lfence and sfence as fences. lfence and sfence only order
+// loads and stores respectively, which acquire and release fences cover.
+bool X86MachineInstructionRaiser::raiseFenceMachineInstr(
+    const MachineInstr &MI) {
+  BasicBlock *RaisedBB = getRaisedBasicBlock(MI.getParent());
+  AtomicOrdering Ordering;
+  switch (MI.getOpcode()) {
+  case X86::MFENCE:
+    Ordering = AtomicOrdering::SequentiallyConsistent;
+    break;
+  case X86::LFENCE:
+    Ordering = AtomicOrdering::Acquire;
+    break;
+  case X86::SFENCE:
+    Ordering = AtomicOrdering::Release;
+    break;
+  default:
+    llvm_unreachable("Unhandled fence instruction");
+  }
+  new FenceInst(RaisedBB->getContext(), Ordering, SyncScope::System, RaisedBB);
+  return true;
+}
+
+#undef DEBUG_TYPE
@@ -0,0 +1,413 @@
+//===-- X86MachineInstructionRaiserBitManip.cpp ------------------*- C++-*-===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+//
+// This file contains implementation of functions to raise bit manipulation
+// and checksum instructions to LLVM intrinsics, declared in
+// X86MachineInstructionRaiser class for use by llvm-mctoll.
+//
+//===----------------------------------------------------------------------===//
+
+#include "X86AdditionalInstrInfo.h"
+#include "X86InstrBuilder.h"
+#include "X86MachineInstructionRaiser.h"
+#include "X86RaisedValueTracker.h"
+#include "X86RegisterUtils.h"
+#include "llvm/ADT/DenseMap.h"
+#include "llvm/IR/IRBuilder.h"
+#include "llvm/IR/IntrinsicsX86.h"
+#include "llvm/Support/Debug.h"
+
+#define DEBUG_TYPE "mctoll"
+
+using namespace llvm;
+using namespace llvm::mctoll;
+using namespace llvm::mctoll::X86RegisterUtils;
+
+namespace {
+
+// Operation performed by a bit manipulation instruction
+enum class BitManipOp : uint8_t {
+  PopCount,
+  LeadingZeros,
+  TrailingZeros,
+  BitScanForward,
+  BitScanReverse,
+  ByteSwap,
+  RotateLeft,
+  RotateRight,
+  AndNot,
+  ResetLowest,
+  IsolateLowest,
+  MaskUpToLowest,
+  ZeroHighBits,
+  ParallelExtract,
+  ParallelDeposit,
+  CRC32
+};
+
+} // end anonymous namespace
+
+static constexpr std::pair<uint16_t, BitManipOp> BitManipInstrData[] = {
+    {X86::POPCNT16rm, BitManipOp::PopCount},
+    {X86::POPCNT16rr, BitManipOp::PopCount},
+    {X86::POPCNT32rm, BitManipOp::PopCount},
+    {X86::POPCNT32rr, BitManipOp::PopCount},
+    {X86::POPCNT64rm, BitManipOp::PopCount},
+    {X86::POPCNT64rr, BitManipOp::PopCount},
+    {X86::LZCNT16rm, BitManipOp::LeadingZeros},
+    {X86::LZCNT16rr, BitManipOp::LeadingZeros},
+    {X86::LZCNT32rm, BitManipOp::LeadingZeros},
+    {X86::LZCNT32rr, BitManipOp::LeadingZeros},
+    {X86::LZCNT64rm, BitManipOp::LeadingZeros},
+    {X86::LZCNT64rr, BitManipOp::LeadingZeros},
+    {X86::TZCNT16rm, BitManipOp::TrailingZeros},
+    {X86::TZCNT16rr, BitManipOp::TrailingZeros},
+    {X86::TZCNT32rm, BitManipOp::TrailingZeros},
+    {X86::TZCNT32rr, BitManipOp::TrailingZeros},
+    {X86::TZCNT64rm, BitManipOp::TrailingZeros},
+    {X86::TZCNT64rr, BitManipOp::TrailingZeros},
+    {X86::BSF16rm, BitManipOp::BitScanForward},
+    {X86::BSF16rr, BitManipOp::BitScanForward},
+    {X86::BSF32rm, BitManipOp::BitScanForward},
+    {X86::BSF32rr, BitManipOp::BitScanForward},
+    {X86::BSF64rm, BitManipOp::BitScanForward},
+    {X86::BSF64rr, BitManipOp::BitScanForward},
+    {X86::BSR16rm, BitManipOp::BitScanReverse},
+    {X86::BSR16rr, BitManipOp::BitScanReverse},
+    {X86::BSR32rm, BitManipOp::BitScanReverse},
+    {X86::BSR32rr, BitManipOp::BitScanReverse},
+    {X86::BSR64rm, BitManipOp::BitScanReverse},
+    {X86::BSR64rr, BitManipOp::BitScanReverse},
+    {X86::BSWAP32r, BitManipOp::ByteSwap},
+    {X86::BSWAP64r, BitManipOp::ByteSwap},
+    {X86::ROL8rCL, BitManipOp::RotateLeft},
+    {X86::ROL16rCL, BitManipOp::RotateLeft},
+    {X86::ROL32rCL, BitManipOp::RotateLeft},
+    {X86::ROL64rCL, BitManipOp::RotateLeft},
+    {X86::ROR8rCL, BitManipOp::RotateRight},
+    {X86::ROR16rCL, BitManipOp::RotateRight},
+    {X86::ROR32rCL, BitManipOp::RotateRight},
+    {X86::ROR64rCL, BitManipOp::RotateRight},
+    {X86::RORX32ri, BitManipOp::RotateRight},
+    {X86::RORX32mi, BitManipOp::RotateRight},
+    {X86::RORX64ri, BitManipOp::RotateRight},
+    {X86::RORX64mi, BitManipOp::RotateRight},
+    {X86::ANDN32rm, BitManipOp::AndNot},
+    {X86::ANDN32rr, BitManipOp::AndNot},
+    {X86::ANDN64rm, BitManipOp::AndNot},
+    {X86::ANDN64rr, BitManipOp::AndNot},
+    {X86::BLSR32rm, BitManipOp::ResetLowest},
+    {X86::BLSR32rr, BitManipOp::ResetLowest},
+    {X86::BLSR64rm, BitManipOp::ResetLowest},
+    {X86::BLSR64rr, BitManipOp::ResetLowest},
+    {X86::BLSI32rm, BitManipOp::IsolateLowest},
+    {X86::BLSI32rr, BitManipOp::IsolateLowest},
+    {X86::BLSI64rm, BitManipOp::IsolateLowest},
+    {X86::BLSI64rr, BitManipOp::IsolateLowest},
+    {X86::BLSMSK32rm, BitManipOp::MaskUpToLowest},
+    {X86::BLSMSK32rr, BitManipOp::MaskUpToLowest},
+    {X86::BLSMSK64rm, BitManipOp::MaskUpToLowest},
+    {X86::BLSMSK64rr, BitManipOp::MaskUpToLowest},
+    {X86::BZHI32rm, BitManipOp::ZeroHighBits},
+    {X86::BZHI32rr, BitManipOp::ZeroHighBits},
+    {X86::BZHI64rm, BitManipOp::ZeroHighBits},
+    {X86::BZHI64rr, BitManipOp::ZeroHighBits},
+    {X86::PEXT32rm, BitManipOp::ParallelExtract},
+    {X86::PEXT32rr, BitManipOp::ParallelExtract},
+    {X86::PEXT64rm, BitManipOp::ParallelExtract},
+    {X86::PEXT64rr, BitManipOp::ParallelExtract},
+    {X86::PDEP32rm, BitManipOp::ParallelDeposit},
+    {X86::PDEP32rr, BitManipOp::ParallelDeposit},
+    {X86::PDEP64rm, BitManipOp::ParallelDeposit},
+    {X86::PDEP64rr, BitManipOp::ParallelDeposit},
+    {X86::CRC32r32m8, BitManipOp::CRC32},
+    {X86::CRC32r32m16, BitManipOp::CRC32},
+    {X86::CRC32r32m32, BitManipOp::CRC32},
+    {X86::CRC32r32r8, BitManipOp::CRC32},
+    {X86::CRC32r32r16, BitManipOp::CRC32},
+    {X86::CRC32r32r32, BitManipOp::CRC32},
+    {X86::CRC32r64m8, BitManipOp::CRC32},
+    {X86::CRC32r64m64, BitManipOp::CRC32},
+    {X86::CRC32r64r8, BitManipOp::CRC32},
+    {X86::CRC32r64r64, BitManipOp::CRC32},
+};
+
+static const DenseMap<uint16_t, BitManipOp>
+    BitManipInstrMap(std::begin(BitManipInstrData),
+                     std::end(BitManipInstrData));
+
+// Return the target feature needed to lower the raised operation to a single
+// instruction, as in the binary. Operations on generic intrinsics are
+// otherwise expanded, while x86-specific intrinsics fail to lower.
+static StringRef getBitManipFeature(BitManipOp Op, bool IsRORX) {
+  switch (Op) {
+  case BitManipOp::PopCount:
+    return "+popcnt";
+  case BitManipOp::LeadingZeros:
+    return "+lzcnt";
+  case BitManipOp::TrailingZeros:
+  case BitManipOp::AndNot:
+  case BitManipOp::ResetLowest:
+  case BitManipOp::IsolateLowest:
+  case BitManipOp::MaskUpToLowest:
+    return "+bmi";
+  case BitManipOp::ZeroHighBits:
+  case BitManipOp::ParallelExtract:
+  case BitManipOp::ParallelDeposit:
+    return "+bmi2";
+  case BitManipOp::RotateRight:
+    return IsRORX ? "+bmi2" : "";
+  case BitManipOp::CRC32:
+    return "+crc32";
+  default:
+    return "";
+  }
+}
+
+// Add Feature to the target features of F, unless already present
+static void addTargetFeature(Function *F, StringRef Feature) {
+  if (Feature.empty())
+    return;
+  StringRef Features = F->getFnAttribute("target-features").getValueAsString();
+  SmallVector<StringRef, 8> FeatureList;
+  Features.split(FeatureList, ',', -1, false);
+  if (is_contained(FeatureList, Feature))
+    return;
+  std::string NewFeatures = Features.str();
+  if (!NewFeatures.empty())
+    NewFeatures += ",";
+  NewFeatures += Feature.str();
+  F->addFnAttr("target-features", NewFeatures);
+}
+
+// Raise a bit manipulation or checksum instruction as a call to the LLVM
+// intrinsic that computes its result. MemRefValue is the memory operand of
+// the instruction, if any. Flags that are defined by the instruction are
+// set; those left undefined are not.
+bool X86MachineInstructionRaiser::raiseBitManipMachineInstr(
+    const MachineInstr &MI, Value *MemRefValue) {
+  auto InfoIter = BitManipInstrMap.find(MI.getOpcode());
+  assert(InfoIter != BitManipInstrMap.end() &&
+         "Unhandled bit manipulation instruction");
+  BitManipOp Op = InfoIter->second;
+  int MBBNo = MI.getParent()->getNumber();
+  BasicBlock *RaisedBB = getRaisedBasicBlock(MI.getParent());
+  IRBuilder<> Builder(RaisedBB);
+  Module *M = MR->getModule();
+
+  int MemRefOpIndex = getMemoryRefOpIndex(MI);
+  if ((MemRefOpIndex != -1) && (MemRefValue == nullptr)) {
+    LLVM_DEBUG(MI.dump());
+    LLVM_DEBUG(dbgs() << "Unable to find memory operand of bit manipulation "
+                         "instruction\n");
+    return false;
+  }
+
+  const MachineOperand &DstOp = MI.getOperand(0);
+  assert(DstOp.isReg() && "Expected destination register of bit manipulation "
+                          "instruction");
+  Register DstReg = DstOp.getReg();
+  Type *DstTy = getPhysRegOperandType(MI, 0);
+
+  // Collect the values of the source operands following the destination, in
+  // order. A memory operand is loaded as an integer of its access size.
+  SmallVector<Value *, 3> SrcValues;
+  for (unsigned int OpIndex = 1; OpIndex < MI.getNumExplicitOperands();
+       OpIndex++) {
+    Value *Val = nullptr;
+    const MachineOperand &MO = MI.getOperand(OpIndex);
+    if ((int)OpIndex == MemRefOpIndex) {
+      unsigned int MemOpSize = getInstructionMemOpSize(MI.getOpcode());
+      Type *MemTy = Type::getIntNTy(M->getContext(), MemOpSize * 8);
+      Val = loadMemoryRefValue(MI, MemRefValue, OpIndex, MemTy);
+      OpIndex += X86::AddrNumOperands - 1;
+    } else if (MO.isImm()) {
+      Val = ConstantInt::get(DstTy, MO.getImm());
+    } else {
+      Val = getRegOperandValue(MI, OpIndex);
+    }
+    if (Val == nullptr) {
+      LLVM_DEBUG(MI.dump());
+      LLVM_DEBUG(dbgs() << "Unable to find value of bit manipulation "
+                           "operand\n");
+      return false;
+    }
+    SrcValues.push_back(Val);
+  }
+  assert(!SrcValues.empty() && "Expected source operands of bit manipulation "
+                               "instruction");
+  // All operations other than crc32 are on values of the destination type
+  if (Op != BitManipOp::CRC32)
+    for (Value *&Val : SrcValues)
+      Val = raisedValues->castValue(Val, DstTy, RaisedBB);
+
+  Value *Src = SrcValues[0];
+  Value *Zero = ConstantInt::get(DstTy, 0);
+  Value *One = ConstantInt::get(DstTy, 1);
+  Value *Result = nullptr;
+  // Flags defined as the comparison of the source with zero
+  auto setFlagIfSrcZero = [&](unsigned int FlagBit) {
+    raisedValues->setEflagValue(FlagBit, MBBNo,
+                                Builder.CreateICmpEQ(Src, Zero));
+  };
+  // Flags defined by the result of logical operations
+  auto setLogicalOpFlags = [&]() {
+    raisedValues->testAndSetEflagSSAValue(EFLAGS::ZF, MI, Result);
+    raisedValues->testAndSetEflagSSAValue(EFLAGS::SF, MI, Result);
+    raisedValues->setEflagBoolean(EFLAGS::OF, MBBNo, false);
+  };
+
+  switch (Op) {
+  case BitManipOp::PopCount:
+    Result = Builder.CreateUnaryIntrinsic(Intrinsic::ctpop, Src);
+    // OF, SF, AF, CF and PF are cleared. ZF is set if the source is 0.
+    raisedValues->setEflagBoolean(EFLAGS::OF, MBBNo, false);
+    raisedValues->setEflagBoolean(EFLAGS::SF, MBBNo, false);
+    raisedValues->setEflagBoolean(EFLAGS::AF, MBBNo, false);
+    raisedValues->setEflagBoolean(EFLAGS::CF, MBBNo, false);
+    raisedValues->setEflagBoolean(EFLAGS::PF, MBBNo, false);
+    setFlagIfSrcZero(EFLAGS::ZF);
+    break;
+  case BitManipOp::LeadingZeros:
+  case BitManipOp::TrailingZeros:
+    // The result is the operand size for a source of 0, which is what ctlz
+    // and cttz with a defined zero result compute.
+    Result = Builder.CreateBinaryIntrinsic(
+        (Op == BitManipOp::LeadingZeros) ? Intrinsic::ctlz : Intrinsic::cttz,
+        Src, Builder.getFalse());
+    setFlagIfSrcZero(EFLAGS::CF);
+    raisedValues->testAndSetEflagSSAValue(EFLAGS::ZF, MI, Result);
+    break;
+  case BitManipOp::BitScanForward:
+  case BitManipOp::BitScanReverse: {
+    // The destination is left unchanged for a source of 0. ZF is set in that
+    // case.
+    unsigned int NumBits = DstTy->getIntegerBitWidth();
+    if (Op == BitManipOp::BitScanForward) {
+      Result = Builder.CreateBinaryIntrinsic(Intrinsic::cttz, Src,
+                                             Builder.getFalse());
+    } else {
+      // Index of the most significant set bit, as (NumBits - 1) ^ ctlz so
+      // that the usual xor with NumBits - 1 that follows folds to ctlz.
+      Value *LZ = Builder.CreateBinaryIntrinsic(Intrinsic::ctlz, Src,
+                                                Builder.getFalse());
+      Result = Builder.CreateXor(LZ, ConstantInt::get(DstTy, NumBits - 1));
+    }
+    Value *SrcIsZero = Builder.CreateICmpEQ(Src, Zero);
+    Value *OldDst = getRegOrArgValue(DstReg, MBBNo);
+    if (OldDst != nullptr)
+      Result = Builder.CreateSelect(
+          SrcIsZero, raisedValues->castValue(OldDst, DstTy, RaisedBB), Result);
+    raisedValues->setEflagValue(EFLAGS::ZF, MBBNo, SrcIsZero);
+  } break;
+  case BitManipOp::ByteSwap:
+    // No flags are affected
+    Result = Builder.CreateUnaryIntrinsic(Intrinsic::bswap, Src);
+    break;
+  case BitManipOp::RotateLeft:
+  case BitManipOp::RotateRight: {
+    // The count is taken from CL for rotates other than RORX. The funnel
+    // shift intrinsics rotate by the count modulo the operand size, as the
+    // instructions do.
+    Value *Count = nullptr;
+    bool IsRORX = (SrcValues.size() == 2);
+    if (IsRORX) {
+      Count = SrcValues[1];
+    } else {
+      Value *CLVal = getRegOrArgValue(X86::CL, MBBNo);
+      if (CLVal == nullptr) {
+        LLVM_DEBUG(MI.dump());
+        LLVM_DEBUG(dbgs() << "Unable to find value of rotate count\n");
+        return false;
+      }
+      Count = raisedValues->castValue(CLVal, DstTy, RaisedBB);
+    }
+    Result = Builder.CreateIntrinsic(
+        (Op == BitManipOp::RotateLeft) ? Intrinsic::fshl : Intrinsic::fshr,
+        DstTy, {Src, Src, Count});
+    // RORX does not affect flags. CF receives the last bit rotated; it is
+    // not modeled as unchanged for a count of 0.
+    if (!IsRORX)
+      raisedValues->testAndSetEflagSSAValue(EFLAGS::CF, MI, Result);
+  } break;
+  case BitManipOp::AndNot:
+    Result = Builder.CreateAnd(Builder.CreateNot(Src), SrcValues[1]);
+    setLogicalOpFlags();
+    raisedValues->setEflagBoolean(EFLAGS::CF, MBBNo, false);
+    break;
+  case BitManipOp::ResetLowest:
+    Result = Builder.CreateAnd(Src, Builder.CreateSub(Src, One));
+    setLogicalOpFlags();
+    setFlagIfSrcZero(EFLAGS::CF);
+    break;
+  case BitManipOp::IsolateLowest:
+    Result = Builder.CreateAnd(Src, Builder.CreateNeg(Src));
+    setLogicalOpFlags();
+    raisedValues->setEflagValue(EFLAGS::CF, MBBNo,
+                                Builder.CreateICmpNE(Src, Zero));
+    break;
+  case BitManipOp::MaskUpToLowest:
+    Result = Builder.CreateXor(Src, Builder.CreateSub(Src, One));
+    setLogicalOpFlags();
+    raisedValues->setEflagBoolean(EFLAGS::ZF, MBBNo, false);
+    setFlagIfSrcZero(EFLAGS::CF);
+    break;
+  case BitManipOp::ZeroHighBits: {
+    bool Is64Bit = (DstTy->getIntegerBitWidth() == 64);
+    Result = Builder.CreateIntrinsic(Is64Bit ? Intrinsic::x86_bmi_bzhi_64
+                                             : Intrinsic::x86_bmi_bzhi_32,
+                                     {}, {Src, SrcValues[1]});
+    setLogicalOpFlags();
+    // CF is set if the index in bits 7:0 is beyond the operand size
+    Value *Index =
+        Builder.CreateAnd(SrcValues[1], ConstantInt::get(DstTy, 0xff));
+    raisedValues->setEflagValue(
+        EFLAGS::CF, MBBNo,
+        Builder.CreateICmpUGE(
+            Index, ConstantInt::get(DstTy, DstTy->getIntegerBitWidth())));
+  } break;
+  case BitManipOp::ParallelExtract:
+  case BitManipOp::ParallelDeposit: {
+    // No flags are affected
+    bool Is64Bit = (DstTy->getIntegerBitWidth() == 64);
+    Intrinsic::ID IID;
+    if (Op == BitManipOp::ParallelExtract)
+      IID = Is64Bit ? Intrinsic::x86_bmi_pext_64 : Intrinsic::x86_bmi_pext_32;
+    else
+      IID = Is64Bit ? Intrinsic::x86_bmi_pdep_64 : Intrinsic::x86_bmi_pdep_32;
+    Result = Builder.CreateIntrinsic(IID, {}, {Src, SrcValues[1]});
+  } break;
+  case BitManipOp::CRC32: {
+    // The accumulator is the tied source. crc32 with a 64-bit accumulator and
+    // an 8-bit source computes the 32-bit checksum, zero extended. No flags
+    // are affected.
+    assert(SrcValues.size() == 2 && "Unexpected operands of crc32");
+    Value *Data = SrcValues[1];
+    unsigned int DataSzInBits = Data->getType()->getIntegerBitWidth();
+    Intrinsic::ID IID = Intrinsic::x86_sse42_crc32_32_32;
+    if (DataSzInBits == 8)
+      IID = Intrinsic::x86_sse42_crc32_32_8;
+    else if (DataSzInBits == 16)
+      IID = Intrinsic::x86_sse42_crc32_32_16;
+    else if (DataSzInBits == 64)
+      IID = Intrinsic::x86_sse42_crc32_64_64;
+    Type *AccTy = (DataSzInBits == 64) ? Builder.getInt64Ty()
+                                       : Builder.getInt32Ty();
+    Value *Acc = raisedValues->castValue(Src, AccTy, RaisedBB);
+    Result = Builder.CreateIntrinsic(IID, {}, {Acc, Data});
+    Result = Builder.CreateZExtOrTrunc(Result, DstTy);
+  } break;
+  }
+
+  addTargetFeature(getRaisedFunction(),
+                   getBitManipFeature(Op, instrNameStartsWith(MI, "RORX")));
+  raisedValues->setPhysRegSSAValue(DstReg, MBBNo, Result);
+  return true;
+}
+
+#undef DEBUG_TYPE
@@ -0,0 +1,517 @@
+//===-- X86MachineInstructionRaiserFPU.cpp -----------------------*- C++-*-===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+//
+// This file contains implementation of functions to raise x87 FPU
+// instructions to operations on x86_fp80 values, declared in
+// X86MachineInstructionRaiser class for use by llvm-mctoll.
+//
+// The FPU register stack is modeled by the eight physical FPU registers, each
+// held in a stack slot of type x86_fp80 across blocks. The index of the stack
+// top at the entry of each block is computed ahead of raising, so that every
+// access to ST(i) is raised as an access to a fixed physical register. The
+// stack slots are promoted to SSA values by mem2reg.
+//
+//===----------------------------------------------------------------------===//
+
+#include "X86AdditionalInstrInfo.h"
+#include "X86InstrBuilder.h"
+#include "X86MachineInstructionRaiser.h"
+#include "X86RaisedValueTracker.h"
+#include "llvm/ADT/DenseMap.h"
+#include "llvm/IR/IRBuilder.h"
+#include "llvm/Support/Debug.h"
+
+#define DEBUG_TYPE "mctoll"
+
+using namespace llvm;
+using namespace llvm::mctoll;
+
+namespace {
+
+// Operation performed by an x87 instruction
+enum class X87Op : uint8_t {
+  // Push the memory operand, a constant or ST(i)
+  Load,
+  LoadConst,
+  LoadReg,
+  // Store ST(0) to the memory operand, rounding to the nearest integer or
+  // towards zero for integer operands
+  Store,
+  StoreTrunc,
+  // Copy ST(0) to ST(i)
+  StoreReg,
+  // Exchange ST(0) and ST(i)
+  Exchange,
+  Add,
+  Sub,
+  SubR,
+  Mul,
+  Div,
+  DivR,
+  Neg,
+  Abs,
+  Sqrt,
+  Round,
+  // Compare ST(0) and ST(i) setting ZF, PF and CF
+  Compare
+};
+
+// Type of the memory operand of an x87 instruction
+enum class X87Mem : uint8_t { None, F32, F64, F80, I16, I32, I64 };
+
+struct X87InstrInfo {
+  X87Op Op;
+  X87Mem Mem;
+  // Result of arithmetic operations on registers is written to ST(i), rather
+  // than to ST(0)
+  bool DstIsSTi;
+  // Number of values popped off the FPU register stack after the operation
+  uint8_t Pops;
+};
+
+} // end anonymous namespace
+
+// x87 instructions raised by raiseFPUMachineInstr. Pseudo instructions used
+// by instruction selection (e.g., ADD_Fp80) are not expected in raised code.
+static constexpr std::pair<uint16_t, X87InstrInfo> X87InstrData[] = {
+    {X86::LD_F32m, {X87Op::Load, X87Mem::F32, false, 0}},
+    {X86::LD_F64m, {X87Op::Load, X87Mem::F64, false, 0}},
+    {X86::LD_F80m, {X87Op::Load, X87Mem::F80, false, 0}},
+    {X86::ILD_F16m, {X87Op::Load, X87Mem::I16, false, 0}},
+    {X86::ILD_F32m, {X87Op::Load, X87Mem::I32, false, 0}},
+    {X86::ILD_F64m, {X87Op::Load, X87Mem::I64, false, 0}},
+    {X86::LD_F0, {X87Op::LoadConst, X87Mem::None, false, 0}},
+    {X86::LD_F1, {X87Op::LoadConst, X87Mem::None, false, 0}},
+    {X86::FLDPI, {X87Op::LoadConst, X87Mem::None, false, 0}},
+    {X86::FLDL2E, {X87Op::LoadConst, X87Mem::None, false, 0}},
+    {X86::FLDL2T, {X87Op::LoadConst, X87Mem::None, false, 0}},
+    {X86::FLDLG2, {X87Op::LoadConst, X87Mem::None, false, 0}},
+    {X86::FLDLN2, {X87Op::LoadConst, X87Mem::None, false, 0}},
+    {X86::LD_Frr, {X87Op::LoadReg, X87Mem::None, false, 0}},
+    {X86::ST_F32m, {X87Op::Store, X87Mem::F32, false, 0}},
+    {X86::ST_F64m, {X87Op::Store, X87Mem::F64, false, 0}},
+    {X86::ST_FP32m, {X87Op::Store, X87Mem::F32, false, 1}},
+    {X86::ST_FP64m, {X87Op::Store, X87Mem::F64, false, 1}},
+    {X86::ST_FP80m, {X87Op::Store, X87Mem::F80, false, 1}},
+    {X86::IST_F16m, {X87Op::Store, X87Mem::I16, false, 0}},
+    {X86::IST_F32m, {X87Op::Store, X87Mem::I32, false, 0}},
+    {X86::IST_FP16m, {X87Op::Store, X87Mem::I16, false, 1}},
+    {X86::IST_FP32m, {X87Op::Store, X87Mem::I32, false, 1}},
+    {X86::IST_FP64m, {X87Op::Store, X87Mem::I64, false, 1}},
+    {X86::ISTT_FP16m, {X87Op::StoreTrunc, X87Mem::I16, false, 1}},
+    {X86::ISTT_FP32m, {X87Op::StoreTrunc, X87Mem::I32, false, 1}},
+    {X86::ISTT_FP64m, {X87Op::StoreTrunc, X87Mem::I64, false, 1}},
+    {X86::ST_Frr, {X87Op::StoreReg, X87Mem::None, false, 0}},
+    {X86::ST_FPrr, {X87Op::StoreReg, X87Mem::None, false, 1}},
+    {X86::XCH_F, {X87Op::Exchange, X87Mem::None, false, 0}},
+    {X86::ADD_F32m, {X87Op::Add, X87Mem::F32, false, 0}},
+    {X86::ADD_F64m, {X87Op::Add, X87Mem::F64, false, 0}},
+    {X86::ADD_FI16m, {X87Op::Add, X87Mem::I16, false, 0}},
+    {X86::ADD_FI32m, {X87Op::Add, X87Mem::I32, false, 0}},
+    {X86::ADD_FST0r, {X87Op::Add, X87Mem::None, false, 0}},
+    {X86::ADD_FrST0, {X87Op::Add, X87Mem::None, true, 0}},
+    {X86::ADD_FPrST0, {X87Op::Add, X87Mem::None, true, 1}},
+    {X86::SUB_F32m, {X87Op::Sub, X87Mem::F32, false, 0}},
+    {X86::SUB_F64m, {X87Op::Sub, X87Mem::F64, false, 0}},
+    {X86::SUB_FI16m, {X87Op::Sub, X87Mem::I16, false, 0}},
+    {X86::SUB_FI32m, {X87Op::Sub, X87Mem::I32, false, 0}},
+    {X86::SUB_FST0r, {X87Op::Sub, X87Mem::None, false, 0}},
+    {X86::SUB_FrST0, {X87Op::Sub, X87Mem::None, true, 0}},
+    {X86::SUB_FPrST0, {X87Op::Sub, X87Mem::None, true, 1}},
+    {X86::SUBR_F32m, {X87Op::SubR, X87Mem::F32, false, 0}},
+    {X86::SUBR_F64m, {X87Op::SubR, X87Mem::F64, false, 0}},
+    {X86::SUBR_FI16m, {X87Op::SubR, X87Mem::I16, false, 0}},
+    {X86::SUBR_FI32m, {X87Op::SubR, X87Mem::I32, false, 0}},
+    {X86::SUBR_FST0r, {X87Op::SubR, X87Mem::None, false, 0}},
+    {X86::SUBR_FrST0, {X87Op::SubR, X87Mem::None, true, 0}},
+    {X86::SUBR_FPrST0, {X87Op::SubR, X87Mem::None, true, 1}},
+    {X86::MUL_F32m, {X87Op::Mul, X87Mem::F32, false, 0}},
+    {X86::MUL_F64m, {X87Op::Mul, X87Mem::F64, false, 0}},
+    {X86::MUL_FI16m, {X87Op::Mul, X87Mem::I16, false, 0}},
+    {X86::MUL_FI32m, {X87Op::Mul, X87Mem::I32, false, 0}},
+    {X86::MUL_FST0r, {X87Op::Mul, X87Mem::None, false, 0}},
+    {X86::MUL_FrST0, {X87Op::Mul, X87Mem::None, true, 0}},
+    {X86::MUL_FPrST0, {X87Op::Mul, X87Mem::None, true, 1}},
+    {X86::DIV_F32m, {X87Op::Div, X87Mem::F32, false, 0}},
+    {X86::DIV_F64m, {X87Op::Div, X87Mem::F64, false, 0}},
+    {X86::DIV_FI16m, {X87Op::Div, X87Mem::I16, false, 0}},
+    {X86::DIV_FI32m, {X87Op::Div, X87Mem::I32, false, 0}},
+    {X86::DIV_FST0r, {X87Op::Div, X87Mem::None, false, 0}},
+    {X86::DIV_FrST0, {X87Op::Div, X87Mem::None, true, 0}},
+    {X86::DIV_FPrST0, {X87Op::Div, X87Mem::None, true, 1}},
+    {X86::DIVR_F32m, {X87Op::DivR, X87Mem::F32, false, 0}},
+    {X86::DIVR_F64m, {X87Op::DivR, X87Mem::F64, false, 0}},
+    {X86::DIVR_FI16m, {X87Op::DivR, X87Mem::I16, false, 0}},
+    {X86::DIVR_FI32m, {X87Op::DivR, X87Mem::I32, false, 0}},
+    {X86::DIVR_FST0r, {X87Op::DivR, X87Mem::None, false, 0}},
+    {X86::DIVR_FrST0, {X87Op::DivR, X87Mem::None, true, 0}},
+    {X86::DIVR_FPrST0, {X87Op::DivR, X87Mem::None, true, 1}},
+    {X86::CHS_F, {X87Op::Neg, X87Mem::None, false, 0}},
+    {X86::ABS_F, {X87Op::Abs, X87Mem::None, false, 0}},
+    {X86::SQRT_F, {X87Op::Sqrt, X87Mem::None, false, 0}},
+    {X86::FRNDINT, {X87Op::Round, X87Mem::None, false, 0}},
+    {X86::UCOM_FIr, {X87Op::Compare, X87Mem::None, false, 0}},
+    {X86::UCOM_FIPr, {X87Op::Compare, X87Mem::None, false, 1}},
+    {X86::COM_FIr, {X87Op::Compare, X87Mem::None, false, 0}},
+    {X86::COM_FIPr, {X87Op::Compare, X87Mem::None, false, 1}},
+};
+
+static const DenseMap<uint16_t, X87InstrInfo>
+    X87InstrMap(std::begin(X87InstrData), std::end(X87InstrData));
+
+static Type *getX87MemType(X87Mem Mem, LLVMContext &Ctx) {
+  switch (Mem) {
+  case X87Mem::None:
+    return nullptr;
+  case X87Mem::F32:
+    return Type::getFloatTy(Ctx);
+  case X87Mem::F64:
+    return Type::getDoubleTy(Ctx);
+  case X87Mem::F80:
+    return Type::getX86_FP80Ty(Ctx);
+  case X87Mem::I16:
+    return Type::getInt16Ty(Ctx);
+  case X87Mem::I32:
+    return Type::getInt32Ty(Ctx);
+  case X87Mem::I64:
+    return Type::getInt64Ty(Ctx);
+  }
+  llvm_unreachable("Unhandled x87 memory operand type");
+}
+
+// Return the constant pushed by the x87 instruction with Opcode
+static StringRef getX87Constant(unsigned int Opcode) {
+  switch (Opcode) {
+  case X86::LD_F0:
+    return "0.0";
+  case X86::LD_F1:
+    return "1.0";
+  case X86::FLDPI:
+    return "3.14159265358979323846264338327950288";
+  case X86::FLDL2E:
+    return "1.44269504088896340735992468100189214";
+  case X86::FLDL2T:
+    return "3.32192809488736234787031942948939018";
+  case X86::FLDLG2:
+    return "0.301029995663981195213738894724493027";
+  case X86::FLDLN2:
+    return "0.693147180559945309417232121458176568";
+  default:
+    llvm_unreachable("Unhandled x87 constant load instruction");
+  }
+}
+
+// FPU Access functions
+void X86MachineInstructionRaiser::pushFPURegisterStack(Value *Val) {
+  assert((FPUStack.TOP < FPUSTACK_SZ) && (FPUStack.TOP >= 0) &&
+         "Incorrect initial FPU Register Stack top in push");
+
+  FPUStack.TOP = (FPUSTACK_SZ + FPUStack.TOP - 1) % FPUSTACK_SZ;
+  setFPURegisterStackValueAt(0, Val);
+}
+
+void X86MachineInstructionRaiser::popFPURegisterStack() {
+  assert((FPUStack.TOP < FPUSTACK_SZ) && (FPUStack.TOP >= 0) &&
+         "Incorrect initial FPU Register Stack top in pop");
+
+  // The value at current TOP is no longer live
+  FPUStack.Regs[FPUStack.TOP] = nullptr;
+  FPUStack.TOP = (FPUStack.TOP + 1) % FPUSTACK_SZ;
+}
+
+// Get value at index. Values not defined or used in the block being raised
+// are loaded from the stack slot of the physical register.
+Value *X86MachineInstructionRaiser::getFPURegisterStackValueAt(int8_t Index) {
+  assert((FPUStack.TOP < FPUSTACK_SZ) && (FPUStack.TOP >= 0) &&
+         "Incorrect initial FPU Register Stack top in FPU register access");
+
+  int8_t AccessIndex = (FPUSTACK_SZ + FPUStack.TOP + Index) % FPUSTACK_SZ;
+  if (FPUStack.Regs[AccessIndex] == nullptr) {
+    AllocaInst *Slot = getFPURegisterSlot(AccessIndex);
+    FPUStack.Regs[AccessIndex] =
+        new LoadInst(Slot->getAllocatedType(), Slot, "", false,
+                     Slot->getAlign(), FPUStack.RaisedBB);
+  }
+  return FPUStack.Regs[AccessIndex];
+}
+
+// Set value at index to Val. Val is also stored to the stack slot of the
+// physical register, to be available in the successor blocks.
+void X86MachineInstructionRaiser::setFPURegisterStackValueAt(int8_t Index,
+                                                             Value *Val) {
+  assert(Val->getType()->isX86_FP80Ty() &&
+         "Attempt to insert non-x86_fp80 value in FPU register stack");
+  assert((FPUStack.TOP < FPUSTACK_SZ) && (FPUStack.TOP >= 0) &&
+         "Incorrect initial FPU Register Stack top in FPU register access");
+
+  int8_t AccessIndex = (FPUSTACK_SZ + FPUStack.TOP + Index) % FPUSTACK_SZ;
+  FPUStack.Regs[AccessIndex] = Val;
+  AllocaInst *Slot = getFPURegisterSlot(AccessIndex);
+  new StoreInst(Val, Slot, false, Slot->getAlign(), FPUStack.RaisedBB);
+}
+
+Value *X86MachineInstructionRaiser::topFPURegisterStack() {
+  return getFPURegisterStackValueAt(0);
+}
+
+// Return the stack slot of the physical FPU register RegIndex, creating it in
+// the entry block on first use.
+AllocaInst *X86MachineInstructionRaiser::getFPURegisterSlot(int8_t RegIndex) {
+  if (FPURegSlots[RegIndex] == nullptr) {
+    LLVMContext &Ctx(MF.getFunction().getContext());
+    const DataLayout &DL = MR->getModule()->getDataLayout();
+    Type *SlotTy = Type::getX86_FP80Ty(Ctx);
+    FPURegSlots[RegIndex] = new AllocaInst(
+        SlotTy, DL.getAllocaAddrSpace(), nullptr, DL.getPrefTypeAlign(SlotTy),
+        "FPR" + std::to_string(RegIndex) + "-SKT-LOC");
+    getRaisedFunction()->getEntryBlock().getInstList().push_front(
+        FPURegSlots[RegIndex]);
+  }
+  return FPURegSlots[RegIndex];
+}
+
+// Set up the FPU register stack to raise the instructions of MBB. No values
+// are known at block entry; they are loaded from the stack slots on use.
+void X86MachineInstructionRaiser::initFPURegisterStack(
+    const MachineBasicBlock &MBB) {
+  auto Iter = FPUStackTopAtMBBEntry.find(MBB.getNumber());
+  FPUStack.TOP = (Iter == FPUStackTopAtMBBEntry.end()) ? 0 : Iter->second;
+  FPUStack.RaisedBB = getRaisedBasicBlock(&MBB);
+  for (int Idx = 0; Idx < FPUSTACK_SZ; Idx++)
+    FPUStack.Regs[Idx] = nullptr;
+}
+
+// Return the index of the FPU register stack top after MI, given the index
+// Top before MI. The FPU register stack is empty at calls. Called functions
+// return values of type x86_fp80 in ST(0).
+int8_t X86MachineInstructionRaiser::getFPUStackTopAfter(const MachineInstr &MI,
+                                                        int8_t Top) {
+  if (MI.isCall()) {
+    Function *CalledFunc = getCalledFunction(MI);
+    bool ReturnsFP80 = (CalledFunc != nullptr) &&
+                       CalledFunc->getReturnType()->isX86_FP80Ty();
+    return ReturnsFP80 ? FPUSTACK_SZ - 1 : 0;
+  }
+
+  auto InfoIter = X87InstrMap.find(MI.getOpcode());
+  if (InfoIter == X87InstrMap.end())
+    return Top;
+  X87Op Op = InfoIter->second.Op;
+  int Pushes = ((Op == X87Op::Load) || (Op == X87Op::LoadConst) ||
+                (Op == X87Op::LoadReg))
+                   ? 1
+                   : 0;
+  return (FPUSTACK_SZ + Top - Pushes + InfoIter->second.Pops) % FPUSTACK_SZ;
+}
+
+// Return the index of the FPU register stack top just before MI
+int8_t X86MachineInstructionRaiser::getFPUStackTopAt(const MachineInstr &MI) {
+  const MachineBasicBlock *MBB = MI.getParent();
+  auto Iter = FPUStackTopAtMBBEntry.find(MBB->getNumber());
+  int8_t Top = (Iter == FPUStackTopAtMBBEntry.end()) ? 0 : Iter->second;
+  for (const MachineInstr &PrevMI : MBB->instrs()) {
+    if (&PrevMI == &MI)
+      break;
+    Top = getFPUStackTopAfter(PrevMI, Top);
+  }
+  return Top;
+}
+
+// Compute the index of the FPU register stack top at the entry of each block
+// of MF, propagating the index at function entry, where the stack is empty,
+// along the CFG. Return false if the index differs between the predecessors
+// of a block. Nothing is computed for functions without x87 instructions.
+bool X86MachineInstructionRaiser::computeFPUStackTops() {
+  FPUStackTopAtMBBEntry.clear();
+
+  bool HasX87Instr = false;
+  for (const MachineBasicBlock &MBB : MF)
+    for (const MachineInstr &MI : MBB.instrs())
+      HasX87Instr |= (X87InstrMap.count(MI.getOpcode()) != 0);
+  if (!HasX87Instr || MF.empty())
+    return true;
+
+  SmallVector<const MachineBasicBlock *, 8> WorkList;
+  FPUStackTopAtMBBEntry.emplace(MF.front().getNumber(), 0);
+  WorkList.push_back(&MF.front());
+  while (!WorkList.empty()) {
+    const MachineBasicBlock *MBB = WorkList.pop_back_val();
+    int8_t Top = FPUStackTopAtMBBEntry[MBB->getNumber()];
+    for (const MachineInstr &MI : MBB->instrs())
+      Top = getFPUStackTopAfter(MI, Top);
+    for (const MachineBasicBlock *Succ : MBB->successors()) {
+      auto Entry = FPUStackTopAtMBBEntry.emplace(Succ->getNumber(), Top);
+      if (Entry.second) {
+        WorkList.push_back(Succ);
+      } else if (Entry.first->second != Top) {
+        LLVM_DEBUG(dbgs() << "FPU register stack depth differs at entry of "
+                          << Succ->getFullName() << "\n");
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+// Raise an x87 instruction as an operation on the x86_fp80 values of the FPU
+// registers. MemRefValue is the memory operand of the instruction, if any.
+// Values loaded from memory are converted to x86_fp80 and values stored to
+// memory are converted from x86_fp80 to the type of the memory operand.
+bool X86MachineInstructionRaiser::raiseFPUMachineInstr(const MachineInstr &MI,
+                                                       Value *MemRefValue) {
+  auto InfoIter = X87InstrMap.find(MI.getOpcode());
+  if (InfoIter == X87InstrMap.end()) {
+    LLVM_DEBUG(MI.dump());
+    LLVM_DEBUG(dbgs() << "Unhandled x87 instruction\n");
+    return false;
+  }
+  const X87InstrInfo &Info = InfoIter->second;
+  int MBBNo = MI.getParent()->getNumber();
+  BasicBlock *RaisedBB = getRaisedBasicBlock(MI.getParent());
+  LLVMContext &Ctx(MF.getFunction().getContext());
+  IRBuilder<> Builder(RaisedBB);
+  Type *FP80Ty = Type::getX86_FP80Ty(Ctx);
+  Type *MemTy = getX87MemType(Info.Mem, Ctx);
+  assert(((MemTy == nullptr) == (MemRefValue == nullptr)) &&
+         "Unexpected memory operand of x87 instruction");
+
+  // Index i of the register operand ST(i), if any
+  int8_t STIndex = 0;
+  if ((MemTy == nullptr) && (MI.getNumExplicitOperands() > 0) &&
+      MI.getOperand(0).isReg()) {
+    STIndex = MI.getOperand(0).getReg() - X86::ST0;
+    assert((STIndex >= 0) && (STIndex < FPUSTACK_SZ) &&
+           "Unexpected FPU register stack index computed");
+  }
+
+  // Return the value of the memory operand converted to x86_fp80
+  auto getMemOperandValue = [&]() -> Value * {
+    Value *Val =
+        loadMemoryRefValue(MI, MemRefValue, getMemoryRefOpIndex(MI), MemTy);
+    // Global values with an initializer are returned as is
+    if (Val->getType()->isPointerTy()) {
+      Value *Ptr = raisedValues->castValue(Val, MemTy->getPointerTo(),
+                                           RaisedBB);
+      Val = Builder.CreateAlignedLoad(MemTy, Ptr, Align());
+    } else if (Val->getType() != MemTy) {
+      Val = Builder.CreateBitCast(Val, MemTy);
+    }
+    return MemTy->isIntegerTy() ? Builder.CreateSIToFP(Val, FP80Ty)
+                                : Builder.CreateFPExt(Val, FP80Ty);
+  };
+
+  switch (Info.Op) {
+  case X87Op::Load:
+    pushFPURegisterStack(getMemOperandValue());
+    break;
+  case X87Op::LoadConst:
+    pushFPURegisterStack(
+        ConstantFP::get(FP80Ty, getX87Constant(MI.getOpcode())));
+    break;
+  case X87Op::LoadReg:
+    pushFPURegisterStack(getFPURegisterStackValueAt(STIndex));
+    break;
+  case X87Op::Store:
+  case X87Op::StoreTrunc: {
+    Value *Val = topFPURegisterStack();
+    if (MemTy->isIntegerTy()) {
+      // Without changes to the FPU control word, values are rounded to the
+      // nearest integer.
+      if (Info.Op == X87Op::Store)
+        Val = Builder.CreateUnaryIntrinsic(Intrinsic::rint, Val);
+      Val = Builder.CreateFPToSI(Val, MemTy);
+    } else {
+      Val = Builder.CreateFPTrunc(Val, MemTy);
+    }
+    Value *Ptr =
+        raisedValues->castValue(MemRefValue, MemTy->getPointerTo(), RaisedBB);
+    Builder.CreateAlignedStore(Val, Ptr, Align());
+  } break;
+  case X87Op::StoreReg:
+    setFPURegisterStackValueAt(STIndex, topFPURegisterStack());
+    break;
+  case X87Op::Exchange: {
+    Value *St0Val = topFPURegisterStack();
+    Value *StVal = getFPURegisterStackValueAt(STIndex);
+    setFPURegisterStackValueAt(0, StVal);
+    setFPURegisterStackValueAt(STIndex, St0Val);
+  } break;
+  case X87Op::Add:
+  case X87Op::Sub:
+  case X87Op::SubR:
+  case X87Op::Mul:
+  case X87Op::Div:
+  case X87Op::DivR: {
+    // The destination is ST(0) for memory operands and ST(0) or ST(i) for
+    // register operands. The other source is the memory operand or the other
+    // register.
+    int8_t DstIndex = Info.DstIsSTi ? STIndex : 0;
+    Value *DstVal = getFPURegisterStackValueAt(DstIndex);
+    Value *SrcVal = (MemTy != nullptr) ? getMemOperandValue()
+                    : Info.DstIsSTi    ? topFPURegisterStack()
+                                       : getFPURegisterStackValueAt(STIndex);
+    Value *Result = nullptr;
+    switch (Info.Op) {
+    case X87Op::Add:
+      Result = Builder.CreateFAdd(DstVal, SrcVal);
+      break;
+    case X87Op::Sub:
+      Result = Builder.CreateFSub(DstVal, SrcVal);
+      break;
+    case X87Op::SubR:
+      Result = Builder.CreateFSub(SrcVal, DstVal);
+      break;
+    case X87Op::Mul:
+      Result = Builder.CreateFMul(DstVal, SrcVal);
+      break;
+    case X87Op::Div:
+      Result = Builder.CreateFDiv(DstVal, SrcVal);
+      break;
+    default:
+      Result = Builder.CreateFDiv(SrcVal, DstVal);
+      break;
+    }
+    setFPURegisterStackValueAt(DstIndex, Result);
+  } break;
+  case X87Op::Neg:
+    setFPURegisterStackValueAt(0, Builder.CreateFNeg(topFPURegisterStack()));
+    break;
+  case X87Op::Abs:
+  case X87Op::Sqrt:
+  case X87Op::Round: {
+    Intrinsic::ID IID = (Info.Op == X87Op::Abs)    ? Intrinsic::fabs
+                        : (Info.Op == X87Op::Sqrt) ? Intrinsic::sqrt
+                                                   : Intrinsic::rint;
+    setFPURegisterStackValueAt(
+        0, Builder.CreateUnaryIntrinsic(IID, topFPURegisterStack()));
+  } break;
+  case X87Op::Compare: {
+    // Same setting of ZF, PF and CF as that of ucomiss viz.,
+    //    Unordered:    ZF,PF,CF <- 111
+    //    Greater-than: ZF,PF,CF <- 000
+    //    Less-than:    ZF,PF,CF <- 001
+    //    equal:        ZF,PF,CF <- 100
+    Value *St0Val = topFPURegisterStack();
+    Value *StVal = getFPURegisterStackValueAt(STIndex);
+    raisedValues->setEflagBoolean(EFLAGS::OF, MBBNo, false);
+    raisedValues->setEflagBoolean(EFLAGS::SF, MBBNo, false);
+    raisedValues->setEflagValue(EFLAGS::CF, MBBNo,
+                                Builder.CreateFCmpULT(St0Val, StVal));
+    raisedValues->setEflagValue(EFLAGS::ZF, MBBNo,
+                                Builder.CreateFCmpUEQ(St0Val, StVal));
+    raisedValues->setEflagValue(EFLAGS::PF, MBBNo,
+                                Builder.CreateFCmpUNO(St0Val, StVal));
+  } break;
+  }
+
+  for (int Idx = 0; Idx < Info.Pops; Idx++)
+    popFPURegisterStack();
+  return true;
+}
+
+#undef DEBUG_TYPE
@@ -660,7 +660,11 @@ bool X86MachineInstructionRaiser::raiseSSEMoveRegToRegMachineInstr(
   case X86::MOV64toPQIrr:
   case X86::MOVDI2PDIrr:
   case X86::MOVPDI2DIrr:
-  case X86::MOVPQIto64rr: {
+  case X86::MOVPQIto64rr:
+  case X86::VMOV64toPQIrr:
+  case X86::VMOVDI2PDIrr:
+  case X86::VMOVPDI2DIrr:
+  case X86::VMOVPQIto64rr: {
     Type *DstType;
     if (isSSE2Reg(DstPReg)) {
       // Since for SSE2 registers, DstPRegSize will always be 128, look at
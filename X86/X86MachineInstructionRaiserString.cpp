@@ -0,0 +1,309 @@
+//===-- X86MachineInstructionRaiserString.cpp --------------------*- C++-*-===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+//
+// This file contains implementation of functions to raise string instructions
+// (MOVS, STOS and CMPS, with or without a REP prefix) declared in
+// X86MachineInstructionRaiser class for use by llvm-mctoll.
+//
+//===----------------------------------------------------------------------===//
+
+#include "X86AdditionalInstrInfo.h"
+#include "X86InstrBuilder.h"
+#include "X86MachineInstructionRaiser.h"
+#include "X86RaisedValueTracker.h"
+#include "X86RegisterUtils.h"
+#include "llvm/IR/IRBuilder.h"
+#include "llvm/Support/Debug.h"
+
+#define DEBUG_TYPE "mctoll"
+
+using namespace llvm;
+using namespace llvm::mctoll;
+using namespace llvm::mctoll::X86RegisterUtils;
+
+// Return the function that stores Value to Count consecutive elements of
+// the type of Value, starting at Dst. It raises rep stos{w,l,q} whose value
+// is not a repeated byte, which llvm.memset cannot represent.
+//
+//   void mctoll.rep.stos.iN(iN* Dst, iN Value, iM Count)
+static Function *getStoreStringFunction(Module *M, Type *ElemTy,
+                                        Type *CountTy) {
+  std::string Name = "mctoll.rep.stos.i" +
+                     std::to_string(ElemTy->getIntegerBitWidth()) + ".i" +
+                     std::to_string(CountTy->getIntegerBitWidth());
+  if (Function *F = M->getFunction(Name))
+    return F;
+
+  LLVMContext &Ctx = M->getContext();
+  Type *ElemPtrTy = PointerType::get(ElemTy, 0);
+  FunctionType *FT = FunctionType::get(Type::getVoidTy(Ctx),
+                                       {ElemPtrTy, ElemTy, CountTy}, false);
+  Function *F = Function::Create(FT, GlobalValue::InternalLinkage, Name, M);
+  Argument *Dst = F->getArg(0);
+  Argument *Val = F->getArg(1);
+  Argument *Count = F->getArg(2);
+
+  BasicBlock *Entry = BasicBlock::Create(Ctx, "entry", F);
+  BasicBlock *Loop = BasicBlock::Create(Ctx, "loop", F);
+  BasicBlock *Exit = BasicBlock::Create(Ctx, "exit", F);
+  IRBuilder<> Builder(Entry);
+  Value *Zero = ConstantInt::get(CountTy, 0);
+  Builder.CreateCondBr(Builder.CreateICmpEQ(Count, Zero), Exit, Loop);
+
+  Builder.SetInsertPoint(Loop);
+  PHINode *Index = Builder.CreatePHI(CountTy, 2);
+  Index->addIncoming(Zero, Entry);
+  Builder.CreateStore(Val, Builder.CreateGEP(ElemTy, Dst, Index));
+  Value *Next = Builder.CreateAdd(Index, ConstantInt::get(CountTy, 1));
+  Index->addIncoming(Next, Loop);
+  Builder.CreateCondBr(Builder.CreateICmpEQ(Next, Count), Exit, Loop);
+
+  Builder.SetInsertPoint(Exit);
+  Builder.CreateRetVoid();
+  return F;
+}
+
+// Return the function that compares the Count consecutive elements of type
+// ElemTy at Src with those at Dst, as long as they are equal (or unequal, if
+// IsRepeatWhileEqual is false). It returns the number of element pairs
+// compared, including the pair that ended the comparison, and the last pair
+// compared. No element is loaded if Count is 0; the pair returned is 0 then.
+//
+//   {iM, iN, iN} mctoll.repe.cmps.iN(iN* Src, iN* Dst, iM Count)
+//   {iM, iN, iN} mctoll.repne.cmps.iN(iN* Src, iN* Dst, iM Count)
+static Function *getCompareStringFunction(Module *M, Type *ElemTy,
+                                          Type *CountTy,
+                                          bool IsRepeatWhileEqual) {
+  std::string Name = std::string(IsRepeatWhileEqual ? "mctoll.repe.cmps.i"
+                                                    : "mctoll.repne.cmps.i") +
+                     std::to_string(ElemTy->getIntegerBitWidth()) + ".i" +
+                     std::to_string(CountTy->getIntegerBitWidth());
+  if (Function *F = M->getFunction(Name))
+    return F;
+
+  LLVMContext &Ctx = M->getContext();
+  Type *ElemPtrTy = PointerType::get(ElemTy, 0);
+  Type *ResultTy = StructType::get(Ctx, {CountTy, ElemTy, ElemTy});
+  FunctionType *FT =
+      FunctionType::get(ResultTy, {ElemPtrTy, ElemPtrTy, CountTy}, false);
+  Function *F = Function::Create(FT, GlobalValue::InternalLinkage, Name, M);
+  Argument *Src = F->getArg(0);
+  Argument *Dst = F->getArg(1);
+  Argument *Count = F->getArg(2);
+
+  BasicBlock *Entry = BasicBlock::Create(Ctx, "entry", F);
+  BasicBlock *Loop = BasicBlock::Create(Ctx, "loop", F);
+  BasicBlock *Exit = BasicBlock::Create(Ctx, "exit", F);
+  IRBuilder<> Builder(Entry);
+  Value *Zero = ConstantInt::get(CountTy, 0);
+  Builder.CreateCondBr(Builder.CreateICmpEQ(Count, Zero), Exit, Loop);
+
+  Builder.SetInsertPoint(Loop);
+  PHINode *Index = Builder.CreatePHI(CountTy, 2);
+  Index->addIncoming(Zero, Entry);
+  Value *SrcElem =
+      Builder.CreateLoad(ElemTy, Builder.CreateGEP(ElemTy, Src, Index));
+  Value *DstElem =
+      Builder.CreateLoad(ElemTy, Builder.CreateGEP(ElemTy, Dst, Index));
+  Value *Next = Builder.CreateAdd(Index, ConstantInt::get(CountTy, 1));
+  Index->addIncoming(Next, Loop);
+  Value *Repeat = IsRepeatWhileEqual ? Builder.CreateICmpEQ(SrcElem, DstElem)
+                                     : Builder.CreateICmpNE(SrcElem, DstElem);
+  Repeat = Builder.CreateAnd(Repeat, Builder.CreateICmpNE(Next, Count));
+  Builder.CreateCondBr(Repeat, Loop, Exit);
+
+  Builder.SetInsertPoint(Exit);
+  PHINode *Compared = Builder.CreatePHI(CountTy, 2);
+  Compared->addIncoming(Zero, Entry);
+  Compared->addIncoming(Next, Loop);
+  Value *ZeroElem = ConstantInt::get(ElemTy, 0);
+  PHINode *LastSrcElem = Builder.CreatePHI(ElemTy, 2);
+  LastSrcElem->addIncoming(ZeroElem, Entry);
+  LastSrcElem->addIncoming(SrcElem, Loop);
+  PHINode *LastDstElem = Builder.CreatePHI(ElemTy, 2);
+  LastDstElem->addIncoming(ZeroElem, Entry);
+  LastDstElem->addIncoming(DstElem, Loop);
+  Value *Result = UndefValue::get(ResultTy);
+  Result = Builder.CreateInsertValue(Result, Compared, 0);
+  Result = Builder.CreateInsertValue(Result, LastSrcElem, 1);
+  Result = Builder.CreateInsertValue(Result, LastDstElem, 2);
+  Builder.CreateRet(Result);
+  return F;
+}
+
+// Raise a string instruction viz., MOVS, STOS or CMPS, with an optional REP,
+// REPE or REPNE prefix.
+//   - rep movs is raised as a call to llvm.memmove,
+//   - rep stos is raised as a call to llvm.memset, if the stored value is a
+//     repeated byte, and as a call to a store loop otherwise, and
+//   - repe/repne cmps is raised as a call to a compare loop. Flags are set
+//     according to the last pair of elements compared.
+// The effect on RDI, RSI and RCX is modelled. The direction flag is assumed
+// to be clear, as the ABI requires at function boundaries, so strings are
+// processed upwards.
+bool X86MachineInstructionRaiser::raiseStringMachineInstr(
+    const MachineInstr &MI) {
+  unsigned int Opcode = MI.getOpcode();
+  int MBBNo = MI.getParent()->getNumber();
+  LLVMContext &Ctx(MF.getFunction().getContext());
+  Module *M = MR->getModule();
+  BasicBlock *RaisedBB = getRaisedBasicBlock(MI.getParent());
+
+  bool IsMove = instrNameStartsWith(MI, "MOVS");
+  bool IsStore = instrNameStartsWith(MI, "STOS");
+  bool IsCompare = instrNameStartsWith(MI, "CMPS");
+  assert((IsMove || IsStore || IsCompare) && "Unhandled string instruction");
+
+  unsigned int ElemSize = getInstructionMemOpSize(Opcode);
+  assert(ElemSize != 0 && "Expected string element size to be > 0");
+  Type *ElemTy = Type::getIntNTy(Ctx, ElemSize * 8);
+  Type *BytePtrTy = Type::getInt8PtrTy(Ctx);
+  Type *ElemPtrTy = PointerType::get(ElemTy, 0);
+
+  unsigned PrefixFlags = getInstrPrefixes(MI);
+  bool IsRepeated =
+      (PrefixFlags & (X86::IP_HAS_REPEAT | X86::IP_HAS_REPEAT_NE)) != 0;
+
+  // The destination string is addressed by the first operand (RDI or EDI)
+  // and the source string by the second (RSI or ESI). The width of the
+  // address register determines that of the count register.
+  unsigned int DstReg = MI.getOperand(0).getReg();
+  unsigned int SrcReg = IsStore ? X86::NoRegister : MI.getOperand(1).getReg();
+  unsigned int AddrSize = getPhysRegSizeInBits(DstReg);
+  Type *AddrTy = Type::getIntNTy(Ctx, AddrSize);
+  unsigned int CountReg = (AddrSize == 64) ? X86::RCX : X86::ECX;
+
+  Value *DstVal = getRegOrArgValue(DstReg, MBBNo);
+  Value *SrcVal = IsStore ? nullptr : getRegOrArgValue(SrcReg, MBBNo);
+  Value *CountVal = IsRepeated ? getRegOrArgValue(CountReg, MBBNo)
+                               : ConstantInt::get(AddrTy, 1);
+  if (DstVal == nullptr || (!IsStore && SrcVal == nullptr) ||
+      CountVal == nullptr) {
+    LLVM_DEBUG(dbgs() << "Unable to find values of string operation "
+                         "registers\n");
+    LLVM_DEBUG(MI.dump());
+    return false;
+  }
+  CountVal = raisedValues->castValue(CountVal, AddrTy, RaisedBB);
+
+  IRBuilder<> Builder(RaisedBB);
+  Value *DstAddr = raisedValues->castValue(DstVal, AddrTy, RaisedBB);
+  Value *SrcAddr =
+      IsStore ? nullptr : raisedValues->castValue(SrcVal, AddrTy, RaisedBB);
+
+  // Number of elements processed; all of them, except for compares, which
+  // end at the first element pair that does not satisfy the prefix.
+  Value *DoneVal = CountVal;
+
+  if (IsMove) {
+    Value *NumBytes = Builder.CreateMul(CountVal,
+                                        ConstantInt::get(AddrTy, ElemSize));
+    Builder.CreateMemMove(Builder.CreateIntToPtr(DstAddr, BytePtrTy),
+                          MaybeAlign(),
+                          Builder.CreateIntToPtr(SrcAddr, BytePtrTy),
+                          MaybeAlign(), NumBytes);
+  } else if (IsStore) {
+    // The stored value is in AL, AX, EAX or RAX.
+    unsigned int AccReg = (ElemSize == 1)   ? X86::AL
+                          : (ElemSize == 2) ? X86::AX
+                          : (ElemSize == 4) ? X86::EAX
+                                            : X86::RAX;
+    Value *AccVal = getRegOrArgValue(AccReg, MBBNo);
+    if (AccVal == nullptr) {
+      LLVM_DEBUG(dbgs() << "Unable to find value of stored register\n");
+      LLVM_DEBUG(MI.dump());
+      return false;
+    }
+    AccVal = raisedValues->castValue(AccVal, ElemTy, RaisedBB);
+
+    // llvm.memset stores a byte. Use it if each byte of the stored value is
+    // known to be the same.
+    Value *ByteVal = nullptr;
+    if (ElemSize == 1) {
+      ByteVal = AccVal;
+    } else if (auto *CI = dyn_cast<ConstantInt>(AccVal)) {
+      const APInt &Bits = CI->getValue();
+      APInt Byte = Bits.trunc(8);
+      if (APInt::getSplat(ElemSize * 8, Byte) == Bits)
+        ByteVal = ConstantInt::get(Type::getInt8Ty(Ctx), Byte);
+    }
+
+    if (ByteVal != nullptr) {
+      Value *NumBytes = Builder.CreateMul(CountVal,
+                                          ConstantInt::get(AddrTy, ElemSize));
+      Builder.CreateMemSet(Builder.CreateIntToPtr(DstAddr, BytePtrTy), ByteVal,
+                           NumBytes, MaybeAlign());
+    } else {
+      Function *StoreF = getStoreStringFunction(M, ElemTy, AddrTy);
+      Builder.CreateCall(
+          StoreF,
+          {Builder.CreateIntToPtr(DstAddr, ElemPtrTy), AccVal, CountVal});
+    }
+  } else {
+    // CMPS compares the element at RSI with the element at RDI.
+    Value *SrcPtr = Builder.CreateIntToPtr(SrcAddr, ElemPtrTy);
+    Value *DstPtr = Builder.CreateIntToPtr(DstAddr, ElemPtrTy);
+    const unsigned int CmpFlags[] = {EFLAGS::CF, EFLAGS::ZF, EFLAGS::SF,
+                                     EFLAGS::OF, EFLAGS::PF};
+    Value *SrcElem = nullptr;
+    Value *DstElem = nullptr;
+    Value *IsNoneDone = nullptr;
+    std::map<unsigned int, Value *> PrevFlags;
+    if (IsRepeated) {
+      // The compare loop loads no element if the count is 0.
+      bool IsRepeatWhileEqual = (PrefixFlags & X86::IP_HAS_REPEAT) != 0;
+      Function *CompareF =
+          getCompareStringFunction(M, ElemTy, AddrTy, IsRepeatWhileEqual);
+      Value *Result = Builder.CreateCall(CompareF, {SrcPtr, DstPtr, CountVal});
+      DoneVal = Builder.CreateExtractValue(Result, 0);
+      SrcElem = Builder.CreateExtractValue(Result, 1);
+      DstElem = Builder.CreateExtractValue(Result, 2);
+      // A repeated compare with a count of 0 compares nothing and leaves the
+      // flags unchanged.
+      IsNoneDone = Builder.CreateICmpEQ(DoneVal, ConstantInt::get(AddrTy, 0));
+      for (unsigned int Flag : CmpFlags)
+        PrevFlags[Flag] = raisedValues->getEflagReachingDef(Flag, MBBNo);
+    } else {
+      SrcElem = Builder.CreateLoad(ElemTy, SrcPtr);
+      DstElem = Builder.CreateLoad(ElemTy, DstPtr);
+    }
+    Value *CmpInst = Builder.CreateSub(SrcElem, DstElem);
+
+    raisedValues->setEflagBoolean(EFLAGS::OF, MBBNo, false);
+    raisedValues->setEflagBoolean(EFLAGS::CF, MBBNo, false);
+    for (unsigned int Flag : CmpFlags)
+      raisedValues->testAndSetEflagSSAValue(Flag, MI, CmpInst);
+    if (IsRepeated)
+      for (unsigned int Flag : CmpFlags) {
+        Value *PrevFlag = PrevFlags[Flag];
+        if (PrevFlag == nullptr)
+          continue;
+        Value *NewFlag = raisedValues->getEflagReachingDef(Flag, MBBNo);
+        raisedValues->setEflagValue(
+            Flag, MBBNo, Builder.CreateSelect(IsNoneDone, PrevFlag, NewFlag));
+      }
+  }
+
+  // Advance the string registers past the elements processed, and count
+  // them down.
+  Value *DoneBytes =
+      Builder.CreateMul(DoneVal, ConstantInt::get(AddrTy, ElemSize));
+  raisedValues->setPhysRegSSAValue(DstReg, MBBNo,
+                                   Builder.CreateAdd(DstAddr, DoneBytes));
+  if (!IsStore)
+    raisedValues->setPhysRegSSAValue(SrcReg, MBBNo,
+                                     Builder.CreateAdd(SrcAddr, DoneBytes));
+  if (IsRepeated)
+    raisedValues->setPhysRegSSAValue(
+        CountReg, MBBNo,
+        IsCompare ? Builder.CreateSub(CountVal, DoneVal)
+                  : ConstantInt::get(AddrTy, 0));
+  return true;
+}
+
+#undef DEBUG_TYPE
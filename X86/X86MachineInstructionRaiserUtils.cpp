@@ -20,6 +20,7 @@
 #include "llvm/CodeGen/MachineDominators.h"
 #include "llvm/Object/ELF.h"
 #include "llvm/Object/ELFObjectFile.h"
+#include "llvm/Support/Process.h"
 #include "llvm/Transforms/Utils/BasicBlockUtils.h"
 #include <X86InstrBuilder.h>
 #include <X86Subtarget.h>
@@ -68,6 +69,7 @@ Value *X86MachineInstructionRaiser::getMemoryRefValue(const MachineInstr &MI) {
       case InstructionKind::LOAD_FPU_REG:
       case InstructionKind::SSE_COMPARE_RM:
       case InstructionKind::BIT_TEST_OP:
+      case InstructionKind::BRANCH_MEM_OP:
         break;
       default:
         MI.print(errs());
@@ -144,12 +146,8 @@ Value *X86MachineInstructionRaiser::getMemoryRefValue(const MachineInstr &MI) {
             getRaisedValues()->castValue(AddInst, MemRefValTy, RaisedBB);
       }
     }
-    // Handle PC-relative addressing.
-
-    // NOTE: This tool now raises only shared libraries and executables -
-    // NOT object files. So, instructions with 0 register (which typically
-    // are seen in a relocatable object file for the linker to patch) are
-    // not expected to be encountered.
+    // Handle PC-relative addressing. In relocatable object files, the
+    // referenced value is given by the relocation of the displacement.
     else if (BaseSupReg == X86::RIP) {
       MemoryRefValue = createPCRelativeAccesssValue(MI);
     }
@@ -326,6 +324,26 @@ Type *X86MachineInstructionRaiser::getPhysRegType(unsigned int PReg) {
   return nullptr;
 }
 
+// Return the type of the stack slots that values of SSE registers are
+// promoted to. Slots are wide enough to hold a ymm register if the function
+// uses any.
+Type *X86MachineInstructionRaiser::getSSERegSlotType() {
+  if (SSERegSlotTy != nullptr)
+    return SSERegSlotTy;
+
+  unsigned int SlotSzInBits = 128;
+  for (const MachineBasicBlock &MBB : MF)
+    for (const MachineInstr &MI : MBB)
+      for (const MachineOperand &MO : MI.operands())
+        if (MO.isReg() && is256BitSSE2Reg(MO.getReg()))
+          SlotSzInBits = 256;
+
+  LLVMContext &Ctx(MF.getFunction().getContext());
+  SSERegSlotTy =
+      VectorType::get(Type::getInt32Ty(Ctx), SlotSzInBits / 32, false);
+  return SSERegSlotTy;
+}
+
 Type *X86MachineInstructionRaiser::getPhysSSERegType(unsigned int PhysReg,
                                                      uint8_t BitPrecision) {
   LLVMContext &Ctx(MF.getFunction().getContext());
@@ -475,68 +493,6 @@ const MachineInstr *X86MachineInstructionRaiser::getPhysRegDefiningInstInBlock(
   return nullptr;
 }
 
-// FPU Access functions
-void X86MachineInstructionRaiser::pushFPURegisterStack(Value *Val) {
-  assert(Val->getType()->isFloatingPointTy() &&
-         "Attempt to push non-FP type value on FPU register stack");
-  assert((FPUStack.TOP < FPUSTACK_SZ) && (FPUStack.TOP >= 0) &&
-         "Incorrect initial FPU Register Stack top in push");
-
-  int8_t PushIndex = (FPUSTACK_SZ + FPUStack.TOP - 1) % FPUSTACK_SZ;
-
-  assert((PushIndex < FPUSTACK_SZ) && (PushIndex >= 0) &&
-         "Incorrect FPU Register Stack index computed in push");
-  FPUStack.Regs[PushIndex] = Val;
-  FPUStack.TOP = PushIndex;
-}
-
-void X86MachineInstructionRaiser::popFPURegisterStack() {
-  assert((FPUStack.TOP < FPUSTACK_SZ) && (FPUStack.TOP >= 0) &&
-         "Incorrect initial FPU Register Stack top in pop");
-
-  int8_t PostPopIndex = (FPUSTACK_SZ + FPUStack.TOP + 1) % FPUSTACK_SZ;
-
-  assert((PostPopIndex < FPUSTACK_SZ) && (PostPopIndex >= 0) &&
-         "Incorrect FPU Register Stack index computed in pop");
-  // Clear the value at current TOP
-  FPUStack.Regs[FPUStack.TOP] = nullptr;
-  // Adjust TOP value
-  FPUStack.TOP = PostPopIndex;
-}
-
-// Get value at index
-Value *X86MachineInstructionRaiser::getFPURegisterStackValueAt(int8_t Index) {
-  assert((FPUStack.TOP < FPUSTACK_SZ) && (FPUStack.TOP >= 0) &&
-         "Incorrect initial FPU Register Stack top in FPU register access");
-
-  int8_t AccessIndex = (FPUSTACK_SZ + FPUStack.TOP + Index) % FPUSTACK_SZ;
-
-  assert((AccessIndex < FPUSTACK_SZ) && (AccessIndex >= 0) &&
-         "Incorrect FPU Register Stack index computed in FPU register access");
-
-  return FPUStack.Regs[AccessIndex];
-}
-
-// Set value at index to val
-void X86MachineInstructionRaiser::setFPURegisterStackValueAt(int8_t Index,
-                                                             Value *Val) {
-  assert(Val->getType()->isFloatingPointTy() &&
-         "Attempt to insert non-FP type value in FPU register stack");
-  assert((FPUStack.TOP < FPUSTACK_SZ) && (FPUStack.TOP >= 0) &&
-         "Incorrect initial FPU Register Stack top in FPU register access");
-
-  int8_t AccessIndex = (FPUSTACK_SZ + FPUStack.TOP + Index) % FPUSTACK_SZ;
-
-  assert((AccessIndex < FPUSTACK_SZ) && (AccessIndex >= 0) &&
-         "Incorrect FPU Register Stack index computed in FPU register access");
-
-  FPUStack.Regs[AccessIndex] = Val;
-}
-
-Value *X86MachineInstructionRaiser::topFPURegisterStack() {
-  return getFPURegisterStackValueAt(0);
-}
-
 unsigned int
 X86MachineInstructionRaiser::find64BitSuperReg(unsigned int PhysReg) {
 
@@ -562,6 +518,10 @@ X86MachineInstructionRaiser::find64BitSuperReg(unsigned int PhysReg) {
   if (is64BitSSE2Reg(PhysReg))
     return PhysReg;
 
+  // Values of ymm registers are tracked with those of their xmm sub-registers
+  if (is256BitSSE2Reg(PhysReg))
+    return x86RegisterInfo->getSubReg(PhysReg, X86::sub_xmm);
+
   // The return value.
   unsigned int SuperReg;
 
@@ -646,13 +606,13 @@ Value *X86MachineInstructionRaiser::createPCRelativeAccesssValue(
          "instruction");
 
   // 1. Get the text section address
-  int64_t TextSectionAddress = MR->getTextSectionAddress();
+  MCInstRaiser *MCIRaiser = getMCInstRaiser();
+  int64_t TextSectionAddress = MCIRaiser->getTextSectionAddress();
 
   assert(TextSectionAddress >= 0 && "Failed to find text section address");
 
   // 2. Get MCInst offset - the offset of machine instruction in the binary
   // and instruction size
-  MCInstRaiser *MCIRaiser = getMCInstRaiser();
   uint64_t MCInstOffset = MCIRaiser->getMCInstIndex(MI);
   uint64_t MCInstSz = MCIRaiser->getMCInstSize(MCInstOffset);
 
@@ -781,121 +741,67 @@ Value *X86MachineInstructionRaiser::createPCRelativeAccesssValue(
       MemrefValue = getGlobalVariableValueAt(MI, PCOffset);
     }
   } else if (EType == ELF::ET_REL) {
+    // In a relocatable object file, the referenced symbol and the offset into
+    // it are given by the relocation of the displacement.
     const RelocationRef *TextReloc =
-        MR->getTextRelocAtOffset(MCInstOffset, MCInstSz);
+        MR->getTextRelocAtOffset(MCInstOffset, MCInstSz,
+                                 MCIRaiser->getTextSectionIndex());
 
     assert(TextReloc &&
-           "Failed to get dynamic relocation for pc-relative offset");
-
-    if (TextReloc->getType() == ELF::R_X86_64_32S) {
-      Expected<StringRef> Symname = TextReloc->getSymbol()->getName();
-      assert(Symname &&
-             "Failed to find symbol associated with text relocation.");
-      // Find if a global value associated with symbol name is already
-      // created
-      for (GlobalVariable &GV : MR->getModule()->globals()) {
-        if (GV.getName().compare(Symname.get()) == 0) {
-          MemrefValue = &GV;
-        }
-      }
-      if (MemrefValue == nullptr) {
-        // Get all necessary information about the text relocation symbol
-        // which is most likely global.
-
-        llvm::LLVMContext &Ctx(MF.getFunction().getContext());
-        DataRefImpl SymbImpl = TextReloc->getSymbol()->getRawDataRefImpl();
-        // get symbol
-        auto SymbOrErr = Elf64LEObjFile->getSymbol(SymbImpl);
-        assert(SymbOrErr && "PC-relative access: Relocation symbol not found");
-        // get symbol size
-        auto *Symb = SymbOrErr.get();
-        uint64_t SymSize = Symb->st_size;
-        GlobalValue::LinkageTypes Lnkg;
-        switch (Symb->getBinding()) {
-        case ELF::STB_GLOBAL:
-          Lnkg = GlobalValue::ExternalLinkage;
-          break;
-        default:
-          assert(false && "Unhandled dynamic symbol");
-        }
-
-        // get symbol value - this is the offset from the beginning of the
-        // section st_shndex identifies.
-        uint64_t SymVal = Symb->st_value;
-
-        uint64_t SymValSecIndex = Symb->st_shndx;
-        uint8_t SymAlignment = 0;
-        uint64_t SymInitVal = 0;
-        if (((SymValSecIndex >= ELF::SHN_LORESERVE) &&
-             (SymValSecIndex <= ELF::SHN_HIRESERVE)) ||
-            (SymValSecIndex == ELF::SHN_UNDEF)) {
-          if (SymValSecIndex == ELF::SHN_COMMON) {
-            // st_value holds symbol alignment constraints
-            SymAlignment = SymVal;
-            Lnkg = GlobalValue::CommonLinkage;
-          }
-        } else {
-          // get the initial value of the global data symbol at offset symVal
-          // in section with index symValSecIndex
-
-          for (section_iterator SecIter : Elf64LEObjFile->sections()) {
-            if (SecIter->getIndex() == SymValSecIndex) {
-              StringRef SecData = unwrapOrError(
-                  SecIter->getContents(), MR->getObjectFile()->getFileName());
-              const unsigned char *Begin = SecData.bytes_begin() + SymVal;
-              char Shift = 0;
-              while (SymSize-- > 0) {
-                // We know this is little-endian
-                SymInitVal = ((*Begin++) << Shift) | SymInitVal;
-                Shift += 8;
-              }
-              break;
-            }
-          }
-          // REVISIT : Set symbol alignment to be the same as symbol size
-          // NOTE : Do not use symSize since it has been modified in the while
-          // loop above.
-          SymAlignment = Symb->st_size;
-        }
-        Type *GlobalValTy = nullptr;
-
-        switch (SymAlignment) {
-        case 8:
-          GlobalValTy = Type::getInt64Ty(Ctx);
-          break;
-        case 4:
-          GlobalValTy = Type::getInt32Ty(Ctx);
-          break;
-        case 2:
-          GlobalValTy = Type::getInt16Ty(Ctx);
-          break;
-        case 1:
-          GlobalValTy = Type::getInt8Ty(Ctx);
-          break;
-        default:
-          assert(false && "Unexpected symbol size");
-        }
-
-        Constant *GlobalInit;
-        if (IncludedFileInfo::isExternalVariable(Symname->str())) {
-          GlobalInit = nullptr;
-          Lnkg = GlobalValue::ExternalLinkage;
-        } else {
-          GlobalInit = ConstantInt::get(GlobalValTy, SymInitVal);
-        }
-
-        auto *GlobalVal = new GlobalVariable(*(MR->getModule()), GlobalValTy,
-                                             false /* isConstant */, Lnkg,
-                                             GlobalInit, Symname->data());
-        // Don't use symSize as it was modified.
-        GlobalVal->setAlignment(MaybeAlign(SymAlignment));
-        GlobalVal->setDSOLocal(true);
-        MemrefValue = GlobalVal;
-      }
-    } else {
+           "Failed to get text relocation for pc-relative offset");
+
+    int64_t Addend = unwrapOrError(ELFRelocationRef(*TextReloc).getAddend(),
+                                   MR->getObjectFile()->getFileName());
+    int64_t SymOffset = 0;
+    bool IsGOTReloc = false;
+    switch (TextReloc->getType()) {
+    case ELF::R_X86_64_GOTPCREL:
+    case ELF::R_X86_64_GOTPCRELX:
+    case ELF::R_X86_64_REX_GOTPCRELX:
+      IsGOTReloc = true;
+      LLVM_FALLTHROUGH;
+    case ELF::R_X86_64_PC32:
+      // The displacement S + A - P is relative to the end of the instruction.
+      SymOffset =
+          Addend + (MCInstOffset + MCInstSz) - (int64_t)TextReloc->getOffset();
+      break;
+    case ELF::R_X86_64_32:
+    case ELF::R_X86_64_32S:
+      SymOffset = Addend;
+      break;
+    default:
       assert(false && "Unexpected relocation type referenced in PC-relative "
                       "memory access instruction.");
     }
+
+    symbol_iterator RelocSym = TextReloc->getSymbol();
+    assert(RelocSym != Elf64LEObjFile->symbol_end() &&
+           "Failed to find symbol associated with text relocation.");
+    MemrefValue = getOrCreateGlobalValueOfRelocSymbol(
+        MI, ELFSymbolRef(*RelocSym), SymOffset);
+
+    if (IsGOTReloc) {
+      // The instruction accesses the GOT entry that holds the address of the
+      // symbol. Represent the entry as a constant global initialized with the
+      // address.
+      llvm::LLVMContext &Ctx(MF.getFunction().getContext());
+      StringRef SymName = unwrapOrError(RelocSym->getName(),
+                                        MR->getObjectFile()->getFileName());
+      std::string GOTEntryName = (SymName + ".got").str();
+      if (SymOffset != 0)
+        GOTEntryName += "." + std::to_string(SymOffset);
+      GlobalVariable *GOTEntry =
+          MR->getModule()->getGlobalVariable(GOTEntryName, true);
+      if (GOTEntry == nullptr) {
+        Constant *SymAddr = ConstantExpr::getPtrToInt(
+            cast<Constant>(MemrefValue), Type::getInt64Ty(Ctx));
+        GOTEntry = new GlobalVariable(
+            *(MR->getModule()), SymAddr->getType(), true /* isConstant */,
+            GlobalValue::PrivateLinkage, SymAddr, GOTEntryName);
+        GOTEntry->setAlignment(MaybeAlign(8));
+      }
+      MemrefValue = GOTEntry;
+    }
   } else {
     assert(false && "Unhandled binary type. Only object files and shared "
                     "libraries supported");
@@ -924,7 +830,8 @@ StoreInst *X86MachineInstructionRaiser::promotePhysregToStackSlot(
   // Get the size of defined physical register
   int DefinedPhysRegSzInBits =
       raisedValues->getInBlockPhysRegSize(PhysReg, DefiningMBBNo);
-  assert(((DefinedPhysRegSzInBits == 128) || (DefinedPhysRegSzInBits == 64) ||
+  assert(((DefinedPhysRegSzInBits == 256) ||
+          (DefinedPhysRegSzInBits == 128) || (DefinedPhysRegSzInBits == 64) ||
           (DefinedPhysRegSzInBits == 32) || (DefinedPhysRegSzInBits == 16) ||
           (DefinedPhysRegSzInBits == 8) || (DefinedPhysRegSzInBits == 1)) &&
          "Unexpected physical register size of reaching definition ");
@@ -938,10 +845,10 @@ StoreInst *X86MachineInstructionRaiser::promotePhysregToStackSlot(
     StackLocTy = Type::getIntNTy(Ctxt, StackLocSzInBits);
   } else if (ReachingValue->getType()->isFloatingPointTy() ||
              ReachingValue->getType()->isVectorTy()) {
-    assert(
-        StackLocSzInBits == 128 &&
-        "Expected FP types and vectors to be stored in 128 bit stack location");
-    StackLocTy = VectorType::get(Type::getInt32Ty(Ctxt), 4, false);
+    StackLocTy = getSSERegSlotType();
+    assert(StackLocSzInBits == (int)StackLocTy->getPrimitiveSizeInBits() &&
+           "Expected FP types and vectors to be stored in SSE register sized "
+           "stack location");
   } else {
     llvm_unreachable("Unhandled type");
   }
@@ -1094,6 +1001,58 @@ bool X86MachineInstructionRaiser::handleUnterminatedBlocks() {
   return true;
 }
 
+// Return true if the stack slot allocated by Alloca, of SlotSize bytes, is
+// only accessed by loads and stores that lie within the slot. The address of
+// such a slot does not escape (e.g., to a call, as the value of a register,
+// or to be offset to reach an adjacent slot), so the slot need not be part of
+// the stack frame that preserves the stack layout of the binary.
+static bool isStackSlotIsolated(AllocaInst *Alloca, uint64_t SlotSize,
+                                const DataLayout &DL) {
+  SmallVector<Value *, 8> WorkList{Alloca};
+  while (!WorkList.empty()) {
+    Value *Ptr = WorkList.pop_back_val();
+    for (User *U : Ptr->users()) {
+      if (auto *Cast = dyn_cast<BitCastInst>(U)) {
+        WorkList.push_back(Cast);
+      } else if (auto *Load = dyn_cast<LoadInst>(U)) {
+        if (DL.getTypeStoreSize(Load->getType()) > SlotSize)
+          return false;
+      } else if (auto *Store = dyn_cast<StoreInst>(U)) {
+        if ((Store->getValueOperand() == Ptr) ||
+            (DL.getTypeStoreSize(Store->getValueOperand()->getType()) >
+             SlotSize))
+          return false;
+      } else {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+// Return true if the stack object of the shadow stack entry at SSIter is an
+// isolated stack slot that does not overlap the next stack object and whose
+// address is not the value of a register at the end of a block.
+bool X86MachineInstructionRaiser::isStackObjectIsolated(
+    std::map<int64_t, int>::const_iterator SSIter) {
+  MachineFrameInfo &MFrameInfo = MF.getFrameInfo();
+  const DataLayout &DL = MR->getModule()->getDataLayout();
+  int64_t Offset = SSIter->first;
+  int ObjIndex = SSIter->second;
+  uint64_t ObjSize = MFrameInfo.getObjectSize(ObjIndex);
+  auto NextIter = std::next(SSIter);
+  if ((NextIter != ShadowStackIndexedByOffset.end()) &&
+      (Offset + (int64_t)ObjSize > NextIter->first))
+    return false;
+
+  AllocaInst *Alloca =
+      const_cast<AllocaInst *>(MFrameInfo.getObjectAllocation(ObjIndex));
+  for (auto RDToPromote : reachingDefsToPromote)
+    if (std::get<2>(RDToPromote) == Alloca)
+      return false;
+  return isStackSlotIsolated(Alloca, ObjSize, DL);
+}
+
 // Create a single stack frame based on stack allocations of the Function.
 // The single stack frame thus created is expected to preserve the frame layout
 // of the source binary - as represented by the various stack allocations. This
@@ -1104,6 +1063,12 @@ bool X86MachineInstructionRaiser::handleUnterminatedBlocks() {
 // fracturing aggregate data. This function abstracts all stack objects into
 // a single frame to ensures the stack layout in source binary is preserved and
 // prevent aggregate data fractures on the stack.
+// If the stack frame is split, stack objects at the top of the stack that are
+// isolated (i.e., whose address is not taken and that do not overlap other
+// objects) are left as separate allocas, which SROA and mem2reg can promote
+// to registers. The frame starts at the first object that is not isolated,
+// since any object above an object whose address is taken (e.g., elements of
+// an array) may be accessed through that address.
 bool X86MachineInstructionRaiser::createFunctionStackFrame() {
   // If there are stack objects allocated
   if (ShadowStackIndexedByOffset.size() > 1) {
@@ -1121,8 +1086,11 @@ bool X86MachineInstructionRaiser::createFunctionStackFrame() {
     int StackTopObjIndex;
     while (StackOffsetToIndexMapIter != ShadowStackIndexedByOffset.end()) {
       StackTopObjIndex = StackOffsetToIndexMapIter->second;
-      // Stop search at the first non-spill stack object
-      if (!MFrameInfo.isSpillSlotObjectIndex(StackTopObjIndex))
+      // Stop search at the first non-spill stack object, or the first one
+      // that is not isolated if the stack frame is split.
+      if (!MFrameInfo.isSpillSlotObjectIndex(StackTopObjIndex) &&
+          !(MR->splitStackFrame() &&
+            isStackObjectIsolated(StackOffsetToIndexMapIter)))
         break;
       // Go to next stack object
       StackOffsetToIndexMapIter++;
@@ -1276,8 +1244,17 @@ Value *X86MachineInstructionRaiser::getStackAllocatedValue(
     auto SSERegSzInBits = StackObjectSize * 8;
     MemOpTy =
         getRaisedValues()->getSSEInstructionType(MI, SSERegSzInBits, Context);
+  } else if ((InstrKind == InstructionKind::SSE_PACKED_OP) &&
+             (StackObjectSize >= 16)) {
+    // Packed instructions access whole xmm or ymm register sized vectors
+    MemOpTy = VectorType::get(Type::getInt32Ty(Context), StackObjectSize / 4,
+                              false);
   } else {
     switch (StackObjectSize) {
+    case 10:
+      // Extended precision values accessed by x87 instructions
+      MemOpTy = Type::getX86_FP80Ty(Context);
+      break;
     case 8:
       MemOpTy = Type::getInt64Ty(Context);
       break;
@@ -1407,6 +1384,187 @@ Value *X86MachineInstructionRaiser::getStackAllocatedValue(
   return Alloca;
 }
 
+// Return the Function * called by MI in a relocatable object file. The callee
+// is given by the text relocation of the call instruction; calls to local
+// functions in the same section are resolved by the assembler and have no
+// relocation.
+Function *X86MachineInstructionRaiser::getTargetFunctionOfTextReloc(
+    const MachineInstr &MI) {
+  const ObjectFile *Obj = MR->getObjectFile();
+  MCInstRaiser *MCIR = getMCInstRaiser();
+  uint64_t MCInstOffset = MCIR->getMCInstIndex(MI);
+  uint64_t MCInstSize = MCIR->getMCInstSize(MCInstOffset);
+  int64_t SecIdx = MCIR->getTextSectionIndex();
+
+  const RelocationRef *TextReloc =
+      MR->getTextRelocAtOffset(MCInstOffset, MCInstSize, SecIdx);
+  if (TextReloc == nullptr) {
+    int64_t RelCallTargetOffset = MI.getOperand(0).getImm();
+    return MR->getRaisedFunctionAt(
+        MCInstOffset + MCInstSize + RelCallTargetOffset, SecIdx);
+  }
+
+  // Direct calls and jumps are relocated relative to the PC. Report other
+  // relocations, so that the function fails to raise.
+  if ((TextReloc->getType() != ELF::R_X86_64_PLT32) &&
+      (TextReloc->getType() != ELF::R_X86_64_PC32)) {
+    errs() << "Unsupported relocation "
+           << object::getELFRelocationTypeName(ELF::EM_X86_64,
+                                               TextReloc->getType())
+           << " of call instruction at offset 0x"
+           << Twine::utohexstr(MCInstOffset) << " in " << MF.getName()
+           << "\n";
+    return nullptr;
+  }
+  symbol_iterator CalledFuncSym = TextReloc->getSymbol();
+  if (CalledFuncSym == Obj->symbol_end()) {
+    errs() << "No symbol in relocation of call instruction at offset 0x"
+           << Twine::utohexstr(MCInstOffset) << " in " << MF.getName()
+           << "\n";
+    return nullptr;
+  }
+  section_iterator CalledFuncSec =
+      unwrapOrError(CalledFuncSym->getSection(), Obj->getFileName());
+
+  // Callee is defined in this object, possibly referenced via the symbol of
+  // its section.
+  if (CalledFuncSec != Obj->section_end()) {
+    int64_t Addend = unwrapOrError(ELFRelocationRef(*TextReloc).getAddend(),
+                                   Obj->getFileName());
+    uint64_t SymVal =
+        unwrapOrError(CalledFuncSym->getValue(), Obj->getFileName());
+    uint64_t CallTargetOffset = SymVal + Addend + (MCInstOffset + MCInstSize) -
+                                TextReloc->getOffset();
+    return MR->getRaisedFunctionAt(CallTargetOffset, CalledFuncSec->getIndex());
+  }
+
+  // This is an undefined function symbol. Look through the list of user
+  // provided function prototypes and construct a Function accordingly. A
+  // function without prototype is reported, and the call fails to raise.
+  StringRef CalledFuncSymName =
+      unwrapOrError(CalledFuncSym->getName(), Obj->getFileName());
+  return IncludedFileInfo::CreateFunction(CalledFuncSymName,
+                                          *const_cast<ModuleRaiser *>(MR));
+}
+
+// Return the value of the symbol Sym of a relocation in a relocatable object
+// file, offset by SymOffset bytes. Section symbols denote data of the section
+// (e.g., string literals or static variables), function symbols denote raised
+// or external functions, and other symbols denote global variables, which are
+// created as needed.
+Value *X86MachineInstructionRaiser::getOrCreateGlobalValueOfRelocSymbol(
+    const MachineInstr &MI, const ELFSymbolRef &Sym, int64_t SymOffset) {
+  const ObjectFile *Obj = MR->getObjectFile();
+  Module *M = MR->getModule();
+  LLVMContext &Ctx(MF.getFunction().getContext());
+
+  section_iterator SymSec =
+      unwrapOrError(Sym.getSection(), Obj->getFileName());
+  bool IsDefined = (SymSec != Obj->section_end());
+  uint64_t SymVal = unwrapOrError(Sym.getValue(), Obj->getFileName());
+
+  if (Sym.getELFType() == ELF::STT_SECTION) {
+    assert(IsDefined && "Section symbol without section");
+    return getOrCreateSectionDataValueAtOffset(*SymSec, SymVal + SymOffset);
+  }
+
+  StringRef SymName = unwrapOrError(Sym.getName(), Obj->getFileName());
+  if ((Sym.getELFType() == ELF::STT_FUNC) ||
+      (!IsDefined &&
+       IncludedFileInfo::ExternalFunctions.count(SymName.str()))) {
+    Function *Func =
+        IsDefined ? MR->getRaisedFunctionAt(SymVal, SymSec->getIndex())
+                  : IncludedFileInfo::CreateFunction(
+                        SymName, *const_cast<ModuleRaiser *>(MR));
+    assert(Func != nullptr && "Failed to find function of relocation symbol");
+    return Func;
+  }
+
+  GlobalVariable *GlobalVal = M->getGlobalVariable(SymName, true);
+  if (GlobalVal == nullptr) {
+    uint64_t SymSize = Sym.getSize();
+    bool IsCommon = unwrapOrError(Sym.getFlags(), Obj->getFileName()) &
+                    SymbolRef::SF_Common;
+    GlobalValue::LinkageTypes Lnkg = GlobalValue::ExternalLinkage;
+    switch (Sym.getBinding()) {
+    case ELF::STB_GLOBAL:
+      break;
+    case ELF::STB_LOCAL:
+      Lnkg = GlobalValue::InternalLinkage;
+      break;
+    case ELF::STB_WEAK:
+      Lnkg = GlobalValue::WeakAnyLinkage;
+      break;
+    default:
+      assert(false && "Unhandled global symbol binding type");
+    }
+
+    Type *GlobalValTy = nullptr;
+    Constant *GlobalInit = nullptr;
+    MaybeAlign GlobalAlign;
+    if (IncludedFileInfo::isExternalVariable(SymName.str()) ||
+        (!IsDefined && !IsCommon)) {
+      // Declaration of a variable defined elsewhere. Its type is that of the
+      // memory access.
+      unsigned MemAccessSizeInBytes = getInstructionMemOpSize(MI.getOpcode());
+      GlobalValTy = Type::getIntNTy(
+          Ctx, (MemAccessSizeInBytes ? MemAccessSizeInBytes : 1) * 8);
+      Lnkg = GlobalValue::ExternalLinkage;
+    } else {
+      if ((SymSize == 1) || (SymSize == 2) || (SymSize == 4) ||
+          (SymSize == 8))
+        GlobalValTy = Type::getIntNTy(Ctx, SymSize * 8);
+      else
+        GlobalValTy = ArrayType::get(Type::getInt8Ty(Ctx), SymSize);
+
+      if (IsCommon) {
+        // st_value holds symbol alignment constraints
+        Lnkg = GlobalValue::CommonLinkage;
+        GlobalAlign = MaybeAlign(SymVal);
+      } else {
+        GlobalAlign = MaybeAlign(SymSec->getAlignment());
+      }
+
+      if (IsCommon || SymSec->isBSS()) {
+        GlobalInit = Constant::getNullValue(GlobalValTy);
+      } else {
+        // In a relocatable object file, st_value holds the offset of the
+        // symbol in its section.
+        StringRef SecData =
+            unwrapOrError(SymSec->getContents(), Obj->getFileName());
+        ArrayRef<uint8_t> SymBytes(SecData.bytes_begin() + SymVal, SymSize);
+        if (GlobalValTy->isIntegerTy()) {
+          uint64_t SymInitVal = 0;
+          // We know this is little-endian
+          for (unsigned Idx = 0; Idx < SymSize; Idx++)
+            SymInitVal |= (uint64_t)SymBytes[Idx] << (Idx * 8);
+          GlobalInit = ConstantInt::get(GlobalValTy, SymInitVal);
+        } else {
+          GlobalInit = ConstantDataArray::get(Ctx, SymBytes);
+        }
+      }
+    }
+
+    GlobalVal = new GlobalVariable(*M, GlobalValTy, false /* isConstant */,
+                                   Lnkg, GlobalInit, SymName);
+    if (GlobalAlign)
+      GlobalVal->setAlignment(GlobalAlign);
+    GlobalVal->setDSOLocal(true);
+  }
+
+  if (SymOffset == 0)
+    return GlobalVal;
+
+  // Reference into the symbol (e.g., to an element of an array or a field of
+  // a structure).
+  Constant *SymBytePtr =
+      ConstantExpr::getBitCast(GlobalVal, Type::getInt8PtrTy(Ctx));
+  Constant *ElemPtr = ConstantExpr::getInBoundsGetElementPtr(
+      Type::getInt8Ty(Ctx), SymBytePtr,
+      ConstantInt::get(Type::getInt64Ty(Ctx), SymOffset));
+  return ConstantExpr::getBitCast(ElemPtr, GlobalVal->getType());
+}
+
 // Return the Function * referenced by the PLT entry at offset
 Function *X86MachineInstructionRaiser::getTargetFunctionAtPLTOffset(
     const MachineInstr &MI, uint64_t PltEntOff) {
@@ -1538,20 +1696,14 @@ Function *X86MachineInstructionRaiser::getTargetFunctionAtPLTOffset(
       assert(CalledFuncSymName &&
              "Failed to find symbol associated with dynamic "
              "relocation of PLT jmp target.");
-      Expected<uint64_t> CalledFuncSymAddr = CalledFuncSym->getAddress();
-      assert(CalledFuncSymAddr &&
-             "Failed to get called function address of PLT entry");
-      CalledFunc = MR->getRaisedFunctionAt(CalledFuncSymAddr.get());
+      CalledFunc = getTargetFunctionOfDynReloc(*GotPltReloc);
 
+      // This is an undefined function symbol without a user provided
+      // prototype. Report it and bail out.
       if (CalledFunc == nullptr) {
-        // This is an undefined function symbol. Look through the list of
-        // user provided function prototypes and construct a Function
-        // accordingly.
-        CalledFunc = IncludedFileInfo::CreateFunction(
-            *CalledFuncSymName, *const_cast<ModuleRaiser *>(MR));
-        // Bail out if function prototype is not available
-        if (!CalledFunc)
-          exit(-1);
+        IncludedFileInfo::CreateFunction(*CalledFuncSymName,
+                                         *const_cast<ModuleRaiser *>(MR));
+        sys::Process::Exit(-1);
       }
       // Found the section we are looking for
       break;
@@ -1560,6 +1712,183 @@ Function *X86MachineInstructionRaiser::getTargetFunctionAtPLTOffset(
   return CalledFunc;
 }
 
+// Return the function that the GOT slot relocated by the dynamic relocation
+// Reloc is resolved to, or nullptr if it does not hold the address of a
+// function. Functions not defined in the binary are constructed from the user
+// provided function prototypes, if available.
+Function *X86MachineInstructionRaiser::getTargetFunctionOfDynReloc(
+    const RelocationRef &Reloc) {
+  symbol_iterator Sym = Reloc.getSymbol();
+  if (Sym == MR->getObjectFile()->symbol_end()) {
+    // A slot holding the address of a function defined in a position
+    // independent binary is relocated relative to the load address.
+    if (Reloc.getType() != ELF::R_X86_64_RELATIVE)
+      return nullptr;
+    Expected<int64_t> Addend = ELFRelocationRef(Reloc).getAddend();
+    if (!Addend) {
+      consumeError(Addend.takeError());
+      return nullptr;
+    }
+    return MR->getRaisedFunctionAt(*Addend);
+  }
+
+  // GLOB_DAT relocations also resolve slots holding addresses of data
+  Expected<SymbolRef::Type> SymType = Sym->getType();
+  if (!SymType) {
+    consumeError(SymType.takeError());
+    return nullptr;
+  }
+  if (*SymType == SymbolRef::ST_Data)
+    return nullptr;
+  Expected<StringRef> SymName = Sym->getName();
+  if (!SymName) {
+    consumeError(SymName.takeError());
+    return nullptr;
+  }
+  Expected<uint64_t> SymAddr = Sym->getAddress();
+  if (!SymAddr) {
+    consumeError(SymAddr.takeError());
+    return nullptr;
+  }
+  Function *Func = MR->getRaisedFunctionAt(*SymAddr);
+  // This is an undefined function symbol. Look through the list of user
+  // provided function prototypes and construct a Function accordingly.
+  if ((Func == nullptr) &&
+      IncludedFileInfo::ExternalFunctions.count(SymName->str()))
+    Func = IncludedFileInfo::CreateFunction(*SymName,
+                                            *const_cast<ModuleRaiser *>(MR));
+  return Func;
+}
+
+// Return the function at address Addr, which is either the start of a raised
+// function or a PLT entry. Return nullptr if there is no function at Addr.
+Function *
+X86MachineInstructionRaiser::getFunctionAtAddress(const MachineInstr &MI,
+                                                  uint64_t Addr) {
+  Function *Func = MR->getRaisedFunctionAt(Addr);
+  if (Func == nullptr)
+    Func = getTargetFunctionAtPLTOffset(MI, Addr);
+  return Func;
+}
+
+// Return the address referenced by the memory operand of MI at MemRefOpIndex
+// if it is PC-relative, -1 otherwise.
+int64_t X86MachineInstructionRaiser::getPCRelativeMemRefAddress(
+    const MachineInstr &MI, unsigned int MemRefOpIndex) {
+  X86AddressMode MemRef = llvm::getAddressFromInstr(&MI, MemRefOpIndex);
+  if ((MemRef.BaseType != X86AddressMode::RegBase) ||
+      (MemRef.Base.Reg != X86::RIP) || (MemRef.IndexReg != X86::NoRegister))
+    return -1;
+
+  MCInstRaiser *MCIR = getMCInstRaiser();
+  uint64_t MCInstOffset = MCIR->getMCInstIndex(MI);
+  return MCIR->getTextSectionAddress() + MCInstOffset +
+         MCIR->getMCInstSize(MCInstOffset) + MemRef.Disp;
+}
+
+// Return the function whose address register Reg is known to hold just before
+// MI, or nullptr if it is not known. The definition of Reg is looked for in
+// the block of MI and in its predecessors as long as there is only one. Reg
+// is known to hold the address of a function if it is loaded with the
+// address of the function or with the content of its GOT slot.
+Function *
+X86MachineInstructionRaiser::getFunctionInRegister(unsigned int Reg,
+                                                   const MachineInstr &MI) {
+  SmallPtrSet<const MachineBasicBlock *, 4> VisitedMBBs;
+  const MachineBasicBlock *MBB = MI.getParent();
+  const MachineInstr *DefMI = MI.getPrevNode();
+  VisitedMBBs.insert(MBB);
+  while (true) {
+    if (DefMI == nullptr) {
+      if (MBB->pred_size() != 1)
+        return nullptr;
+      MBB = *MBB->pred_begin();
+      if (!VisitedMBBs.insert(MBB).second || MBB->empty())
+        return nullptr;
+      DefMI = &MBB->back();
+      continue;
+    }
+    // Calls do not preserve values of caller-saved registers
+    if (DefMI->isCall() && (Reg != X86::RBX) && (Reg != X86::RBP) &&
+        (Reg != X86::R12) && (Reg != X86::R13) && (Reg != X86::R14) &&
+        (Reg != X86::R15))
+      return nullptr;
+    if (!DefMI->modifiesRegister(Reg, x86RegisterInfo)) {
+      DefMI = DefMI->getPrevNode();
+      continue;
+    }
+
+    switch (DefMI->getOpcode()) {
+    case X86::MOV64rr:
+      // Look for the definition of the copied register
+      Reg = DefMI->getOperand(1).getReg();
+      DefMI = DefMI->getPrevNode();
+      continue;
+    case X86::MOV32ri:
+    case X86::MOV64ri:
+    case X86::MOV64ri32:
+      return getFunctionAtAddress(MI, DefMI->getOperand(1).getImm());
+    case X86::LEA64r: {
+      int64_t Addr = getPCRelativeMemRefAddress(*DefMI, 1);
+      return (Addr < 0) ? nullptr : getFunctionAtAddress(MI, Addr);
+    }
+    case X86::MOV64rm: {
+      int64_t SlotAddr = getPCRelativeMemRefAddress(*DefMI, 1);
+      if (SlotAddr < 0)
+        return nullptr;
+      const RelocationRef *SlotReloc = MR->getDynRelocAtOffset(SlotAddr);
+      return (SlotReloc == nullptr) ? nullptr
+                                    : getTargetFunctionOfDynReloc(*SlotReloc);
+    }
+    default:
+      return nullptr;
+    }
+  }
+}
+
+// Return the function that the indirect call or jump MI transfers control
+// to, if it is known. The target is known if the register operand of MI
+// holds the address of a function or if the memory operand of MI is a GOT
+// slot relocated to a function.
+Function *X86MachineInstructionRaiser::getIndirectTransferTarget(
+    const MachineInstr &MI) {
+  // Sections of relocatable object files are not at their final addresses
+  if (MR->getObjectFile()->isRelocatableObject())
+    return nullptr;
+
+  const MachineOperand &TargetOp = MI.getOperand(0);
+  if (!MI.mayLoad())
+    return TargetOp.isReg() ? getFunctionInRegister(
+                                  find64BitSuperReg(TargetOp.getReg()), MI)
+                            : nullptr;
+
+  int64_t SlotAddr = getPCRelativeMemRefAddress(MI, 0);
+  if (SlotAddr < 0)
+    return nullptr;
+  const RelocationRef *SlotReloc = MR->getDynRelocAtOffset(SlotAddr);
+  return (SlotReloc == nullptr) ? nullptr
+                                : getTargetFunctionOfDynReloc(*SlotReloc);
+}
+
+// Return true if the indirect branch MI, which does not go through a jump
+// table, is a tail call. It is one if its target resolves to a function, or
+// if it can not transfer control within the function, i.e., if its block has
+// no successors and every block other than the entry block is reached from
+// a predecessor. Blocks without predecessors are reached through indirect
+// branches (e.g., of computed gotos or of jump tables that were not
+// discovered).
+bool X86MachineInstructionRaiser::isIndirectTailCall(const MachineInstr &MI) {
+  assert(MI.isIndirectBranch() && !MI.getOperand(0).isJTI() &&
+         "Expected indirect branch not through a jump table");
+  if (getIndirectTransferTarget(MI) != nullptr)
+    return true;
+  if (!MI.getParent()->succ_empty())
+    return false;
+  return llvm::none_of(MF, [this](const MachineBasicBlock &MBB) {
+    return (&MBB != &MF.front()) && MBB.pred_empty();
+  });
+}
+
 // Return the element pointer to global rodata array corresponding at Offset.
 // This returns a Value of type GetElementPtrConstantExpr. However, this type
 // can not be used explicitly since it is private to Constants.cpp (See comment
@@ -1571,69 +1900,75 @@ Value *X86MachineInstructionRaiser::getOrCreateGlobalRODataValueAtOffset(
   if (Offset < 0) {
     return nullptr;
   }
-  Value *RODataValue = nullptr;
   const ELF64LEObjectFile *Elf64LEObjFile =
       dyn_cast<ELF64LEObjectFile>(MR->getObjectFile());
   assert(Elf64LEObjFile != nullptr &&
          "Only 64-bit ELF binaries supported at present.");
-  LLVMContext &Context(MF.getFunction().getContext());
   // Check if this is an address in .rodata
   for (section_iterator SecIter : Elf64LEObjFile->sections()) {
     uint64_t SecStart = SecIter->getAddress();
     uint64_t SecEnd = SecStart + SecIter->getSize();
     // We know that Offset is a positive value. So, casting it is OK.
     if ((SecStart <= (uint64_t)Offset) && (SecEnd >= (uint64_t)Offset)) {
-      if (SecIter->isData()) {
-        // Get the associated global value if one exists
-        uint64_t SecIndex = SecIter->getIndex();
-        std::string RODataSecValueName;
-        if (auto NameOrErr = SecIter->getName())
-          // Drop the leading '.' from section name
-          RODataSecValueName.append((*NameOrErr).substr(1).data());
-        else {
-          consumeError(NameOrErr.takeError());
-          RODataSecValueName.append("AnonDataSec");
-        }
-
-        RODataSecValueName.append("_").append(std::to_string(SecIndex));
-        GlobalVariable *RODataSecValue = MR->getModule()->getGlobalVariable(
-            RODataSecValueName, true /* AllowInternal */);
-        // If ROData Value representing the contents of this section was not
-        // materialized yet, create one.
-        if (RODataSecValue == nullptr) {
-          // Create the global variable corresponding to the content of
-          // .rodata
-          StringRef SecData = unwrapOrError(SecIter->getContents(),
-                                            MR->getObjectFile()->getFileName());
-          unsigned DataSize = SecIter->getSize();
-          auto DataStr = makeArrayRef(SecData.bytes_begin(), DataSize);
-          Constant *StrConstant = ConstantDataArray::get(Context, DataStr);
-          auto *GlobalStrConstVal = new GlobalVariable(
-              *(MR->getModule()), StrConstant->getType(), true /* isConstant */,
-              GlobalValue::PrivateLinkage, StrConstant, RODataSecValueName);
-          GlobalStrConstVal->setAlignment(MaybeAlign(SecIter->getAlignment()));
-          // Address is not significant
-          GlobalStrConstVal->setUnnamedAddr(GlobalValue::UnnamedAddr::Global);
-          // Add metadata that indicates the section start
-          getRaisedValues()->setGVMetadataRODataInfo(GlobalStrConstVal,
-                                                     SecStart);
-          RODataSecValue = GlobalStrConstVal;
-        }
-        unsigned DataOffset = (Offset - SecStart);
-        // Construct index array for a GEP instruction that accesses
-        // byte array
-        Value *Zero32Value = ConstantInt::get(Type::getInt32Ty(Context), 0);
-        Value *DataOffsetIndex =
-            ConstantInt::get(Type::getInt32Ty(Context), DataOffset);
-        Constant *GetElem = ConstantExpr::getInBoundsGetElementPtr(
-            getPointerElementType(RODataSecValue), RODataSecValue,
-            {Zero32Value, DataOffsetIndex});
-        RODataValue = GetElem;
-      }
+      if (SecIter->isData())
+        return getOrCreateSectionDataValueAtOffset(*SecIter,
+                                                   Offset - SecStart);
       break;
     }
   }
-  return RODataValue;
+  return nullptr;
+}
+
+// Return the element pointer at DataOffset of the global byte array
+// representing the contents of data section Sec. The global is created if it
+// was not materialized yet.
+Value *X86MachineInstructionRaiser::getOrCreateSectionDataValueAtOffset(
+    const SectionRef &Sec, uint64_t DataOffset) {
+  LLVMContext &Context(MF.getFunction().getContext());
+  // Get the associated global value if one exists
+  std::string RODataSecValueName = ModuleRaiser::getSectionDataName(Sec);
+  GlobalVariable *RODataSecValue = MR->getModule()->getGlobalVariable(
+      RODataSecValueName, true /* AllowInternal */);
+  // If ROData Value representing the contents of this section was not
+  // materialized yet, create one.
+  if (RODataSecValue == nullptr) {
+    unsigned DataSize = Sec.getSize();
+    Constant *SecConstant = nullptr;
+    if (Sec.isBSS()) {
+      // Contents of .bss are zero-initialized and not present in the binary.
+      SecConstant = ConstantAggregateZero::get(
+          ArrayType::get(Type::getInt8Ty(Context), DataSize));
+    } else {
+      // Create the global variable corresponding to the content of
+      // .rodata
+      StringRef SecData = unwrapOrError(Sec.getContents(),
+                                        MR->getObjectFile()->getFileName());
+      auto DataStr = makeArrayRef(SecData.bytes_begin(), DataSize);
+      SecConstant = ConstantDataArray::get(Context, DataStr);
+    }
+    // Contents of writable sections (e.g., .data of a relocatable object
+    // referenced via its section symbol) may be modified.
+    bool IsConstant = !(ELFSectionRef(Sec).getFlags() & ELF::SHF_WRITE);
+    auto *GlobalStrConstVal = new GlobalVariable(
+        *(MR->getModule()), SecConstant->getType(), IsConstant,
+        GlobalValue::PrivateLinkage, SecConstant, RODataSecValueName);
+    GlobalStrConstVal->setAlignment(MaybeAlign(Sec.getAlignment()));
+    // Address is not significant
+    if (IsConstant)
+      GlobalStrConstVal->setUnnamedAddr(GlobalValue::UnnamedAddr::Global);
+    // Add metadata that indicates the section start
+    getRaisedValues()->setGVMetadataRODataInfo(GlobalStrConstVal,
+                                               Sec.getAddress());
+    RODataSecValue = GlobalStrConstVal;
+  }
+  // Construct index array for a GEP instruction that accesses
+  // byte array
+  Value *Zero32Value = ConstantInt::get(Type::getInt32Ty(Context), 0);
+  Value *DataOffsetIndex =
+      ConstantInt::get(Type::getInt32Ty(Context), DataOffset);
+  return ConstantExpr::getInBoundsGetElementPtr(
+      getPointerElementType(RODataSecValue), RODataSecValue,
+      {Zero32Value, DataOffsetIndex});
 }
 
 // Return a value corresponding to global symbol at Offset referenced in
@@ -2458,11 +2793,19 @@ bool X86MachineInstructionRaiser::recordMachineInstrInfo(
             MCIR->getMBBNumberOfMCInstOffset(BranchTargetOffset, MF);
 
         // If the target is not a known target basic block, attempt to raise
-        // this instruction as a call.
+        // this instruction as a call. The function fails to raise if the
+        // called function is not known.
         if (TgtMBBNo == -1) {
           TailCall = raiseCallMachineInstr(MI);
+          if (!TailCall)
+            return false;
         }
       }
+    } else if (MI.isIndirectBranch() && !MI.getOperand(0).isJTI() &&
+               isIndirectTailCall(MI)) {
+      // An indirect branch that is not through a jump table may transfer
+      // control to another function.
+      TailCall = raiseCallMachineInstr(MI);
     }
   }
   // If the instruction is not a tail-call record instruction info for
@@ -2502,9 +2845,57 @@ bool X86MachineInstructionRaiser::recordMachineInstrInfo(
   return true;
 }
 
+// Instructions raised from MI are appended to the raised block of MI. Set the
+// location of those without one to the address of MI.
+void X86MachineInstructionRaiser::setDebugLocations(const MachineInstr &MI) {
+  MCInstRaiser *MCIR = getMCInstRaiser();
+  DILocation *Loc = ModuleRaiser::getAddressLocation(
+      DebugSP, MCIR->getTextSectionAddress() + MCIR->getMCInstIndex(MI));
+  for (Instruction &I : reverse(*getRaisedBasicBlock(MI.getParent()))) {
+    if (I.getDebugLoc())
+      break;
+    I.setDebugLoc(Loc);
+  }
+}
+
+// Instructions inserted elsewhere (e.g., stack allocations and stores of
+// reaching definitions) take the location of the instruction before them,
+// or of the first instruction of their block, so that all calls have a
+// location as required in functions with a subprogram.
+void X86MachineInstructionRaiser::finishDebugLocations() {
+  MCInstRaiser *MCIR = getMCInstRaiser();
+  DebugLoc FuncLoc = ModuleRaiser::getAddressLocation(
+      DebugSP, MCIR->getTextSectionAddress() + MCIR->getFuncStart());
+  for (BasicBlock &BB : *RaisedFunction) {
+    auto FirstLocIter =
+        find_if(BB, [](const Instruction &I) { return bool(I.getDebugLoc()); });
+    DebugLoc Loc =
+        (FirstLocIter != BB.end()) ? FirstLocIter->getDebugLoc() : FuncLoc;
+    for (Instruction &I : BB) {
+      if (I.getDebugLoc())
+        Loc = I.getDebugLoc();
+      else
+        I.setDebugLoc(Loc);
+    }
+  }
+  RaisedFunction->setSubprogram(DebugSP);
+}
+
 bool X86MachineInstructionRaiser::instrNameStartsWith(const MachineInstr &MI,
                                                       StringRef Name) const {
   return x86InstrInfo->getName(MI.getOpcode()).startswith(Name);
 }
 
+// Prefixes are recorded as flags of the MCInst, but are not carried over to
+// the MachineInstr raised from it.
+unsigned
+X86MachineInstructionRaiser::getInstrPrefixes(const MachineInstr &MI) {
+  MCInstRaiser *MCIR = getMCInstRaiser();
+  assert(MCIR != nullptr && "MCInstRaiser not initialized");
+  auto MCIter = MCIR->getMCInstAt(MCIR->getMCInstIndex(MI));
+  assert(MCIter != MCIR->const_mcinstr_end() &&
+         "Failed to find instruction raised to MachineInstr");
+  return MCIter->second.getMCInst().getFlags();
+}
+
 #undef DEBUG_TYPE
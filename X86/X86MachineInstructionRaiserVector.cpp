@@ -0,0 +1,1158 @@
+//===-- X86MachineInstructionRaiserVector.cpp --------------------*- C++-*-===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+//
+// This file contains implementation of functions to raise packed SSE and AVX
+// instructions to operations on LLVM vector types, declared in
+// X86MachineInstructionRaiser class for use by llvm-mctoll.
+//
+//===----------------------------------------------------------------------===//
+
+#include "X86AdditionalInstrInfo.h"
+#include "X86InstrBuilder.h"
+#include "X86MachineInstructionRaiser.h"
+#include "X86RaisedValueTracker.h"
+#include "X86RegisterUtils.h"
+#include "llvm/ADT/DenseMap.h"
+#include "llvm/IR/IRBuilder.h"
+#include "llvm/Support/Debug.h"
+
+#define DEBUG_TYPE "mctoll"
+
+using namespace llvm;
+using namespace llvm::mctoll;
+using namespace llvm::mctoll::X86RegisterUtils;
+
+namespace {
+
+// Operation performed by a packed instruction on its vector operands
+enum class PackedOp : uint8_t {
+  Move,
+  Broadcast,
+  Extract128,
+  Insert128,
+  FAdd,
+  FSub,
+  FMul,
+  FDiv,
+  FMin,
+  FMax,
+  FSqrt,
+  FCmp,
+  Add,
+  Sub,
+  MulLo,
+  AddSatS,
+  AddSatU,
+  SubSatS,
+  SubSatU,
+  SMin,
+  SMax,
+  UMin,
+  UMax,
+  Abs,
+  CmpEq,
+  CmpGt,
+  And,
+  AndNot,
+  Or,
+  Xor,
+  ShlImm,
+  LShrImm,
+  AShrImm,
+  ShlVar,
+  LShrVar,
+  AShrVar,
+  Shuffle,
+  ShuffleD,
+  UnpackLo,
+  UnpackHi,
+  ByteShuffle,
+  Permute,
+  PermuteVar,
+  Permute2x128,
+  MoveMask
+};
+
+// Type of the elements of the vector operands of a packed instruction
+enum class PackedElem : uint8_t { I8, I16, I32, I64, F32, F64 };
+
+struct PackedInstrInfo {
+  PackedOp Op;
+  PackedElem Elem;
+};
+
+} // end anonymous namespace
+
+// Packed instructions raised by raisePackedMachineInstr. The width of the
+// vectors is that of the xmm or ymm register operands.
+static constexpr std::pair<uint16_t, PackedInstrInfo> PackedInstrData[] = {
+    {X86::CMPPDrmi, {PackedOp::FCmp, PackedElem::F64}},
+    {X86::CMPPDrri, {PackedOp::FCmp, PackedElem::F64}},
+    {X86::CMPPSrmi, {PackedOp::FCmp, PackedElem::F32}},
+    {X86::CMPPSrri, {PackedOp::FCmp, PackedElem::F32}},
+    {X86::MAXPDrm, {PackedOp::FMax, PackedElem::F64}},
+    {X86::MAXPDrr, {PackedOp::FMax, PackedElem::F64}},
+    {X86::MAXPSrm, {PackedOp::FMax, PackedElem::F32}},
+    {X86::MAXPSrr, {PackedOp::FMax, PackedElem::F32}},
+    {X86::MINPDrm, {PackedOp::FMin, PackedElem::F64}},
+    {X86::MINPDrr, {PackedOp::FMin, PackedElem::F64}},
+    {X86::MINPSrm, {PackedOp::FMin, PackedElem::F32}},
+    {X86::MINPSrr, {PackedOp::FMin, PackedElem::F32}},
+    {X86::MOVMSKPDrr, {PackedOp::MoveMask, PackedElem::F64}},
+    {X86::MOVMSKPSrr, {PackedOp::MoveMask, PackedElem::F32}},
+    {X86::MOVNTDQmr, {PackedOp::Move, PackedElem::I32}},
+    {X86::MOVNTPDmr, {PackedOp::Move, PackedElem::F64}},
+    {X86::MOVNTPSmr, {PackedOp::Move, PackedElem::F32}},
+    {X86::PABSBrm, {PackedOp::Abs, PackedElem::I8}},
+    {X86::PABSBrr, {PackedOp::Abs, PackedElem::I8}},
+    {X86::PABSDrm, {PackedOp::Abs, PackedElem::I32}},
+    {X86::PABSDrr, {PackedOp::Abs, PackedElem::I32}},
+    {X86::PABSWrm, {PackedOp::Abs, PackedElem::I16}},
+    {X86::PABSWrr, {PackedOp::Abs, PackedElem::I16}},
+    {X86::PADDUSBrm, {PackedOp::AddSatU, PackedElem::I8}},
+    {X86::PADDUSBrr, {PackedOp::AddSatU, PackedElem::I8}},
+    {X86::PADDUSWrm, {PackedOp::AddSatU, PackedElem::I16}},
+    {X86::PADDUSWrr, {PackedOp::AddSatU, PackedElem::I16}},
+    {X86::PMOVMSKBrr, {PackedOp::MoveMask, PackedElem::I8}},
+    {X86::PMULLDrm, {PackedOp::MulLo, PackedElem::I32}},
+    {X86::PMULLDrr, {PackedOp::MulLo, PackedElem::I32}},
+    {X86::PMULLWrm, {PackedOp::MulLo, PackedElem::I16}},
+    {X86::PMULLWrr, {PackedOp::MulLo, PackedElem::I16}},
+    {X86::PSHUFBrm, {PackedOp::ByteShuffle, PackedElem::I8}},
+    {X86::PSHUFBrr, {PackedOp::ByteShuffle, PackedElem::I8}},
+    {X86::PSLLDri, {PackedOp::ShlImm, PackedElem::I32}},
+    {X86::PSLLQri, {PackedOp::ShlImm, PackedElem::I64}},
+    {X86::PSLLWri, {PackedOp::ShlImm, PackedElem::I16}},
+    {X86::PSRADri, {PackedOp::AShrImm, PackedElem::I32}},
+    {X86::PSRAWri, {PackedOp::AShrImm, PackedElem::I16}},
+    {X86::PSRLDri, {PackedOp::LShrImm, PackedElem::I32}},
+    {X86::PSRLQri, {PackedOp::LShrImm, PackedElem::I64}},
+    {X86::PSRLWri, {PackedOp::LShrImm, PackedElem::I16}},
+    {X86::PSUBUSBrm, {PackedOp::SubSatU, PackedElem::I8}},
+    {X86::PSUBUSBrr, {PackedOp::SubSatU, PackedElem::I8}},
+    {X86::PSUBUSWrm, {PackedOp::SubSatU, PackedElem::I16}},
+    {X86::PSUBUSWrr, {PackedOp::SubSatU, PackedElem::I16}},
+    {X86::PUNPCKHBWrm, {PackedOp::UnpackHi, PackedElem::I8}},
+    {X86::PUNPCKHBWrr, {PackedOp::UnpackHi, PackedElem::I8}},
+    {X86::PUNPCKHDQrm, {PackedOp::UnpackHi, PackedElem::I32}},
+    {X86::PUNPCKHDQrr, {PackedOp::UnpackHi, PackedElem::I32}},
+    {X86::PUNPCKHQDQrm, {PackedOp::UnpackHi, PackedElem::I64}},
+    {X86::PUNPCKHQDQrr, {PackedOp::UnpackHi, PackedElem::I64}},
+    {X86::PUNPCKHWDrm, {PackedOp::UnpackHi, PackedElem::I16}},
+    {X86::PUNPCKHWDrr, {PackedOp::UnpackHi, PackedElem::I16}},
+    {X86::PUNPCKLBWrm, {PackedOp::UnpackLo, PackedElem::I8}},
+    {X86::PUNPCKLBWrr, {PackedOp::UnpackLo, PackedElem::I8}},
+    {X86::PUNPCKLDQrm, {PackedOp::UnpackLo, PackedElem::I32}},
+    {X86::PUNPCKLDQrr, {PackedOp::UnpackLo, PackedElem::I32}},
+    {X86::PUNPCKLQDQrm, {PackedOp::UnpackLo, PackedElem::I64}},
+    {X86::PUNPCKLQDQrr, {PackedOp::UnpackLo, PackedElem::I64}},
+    {X86::PUNPCKLWDrm, {PackedOp::UnpackLo, PackedElem::I16}},
+    {X86::PUNPCKLWDrr, {PackedOp::UnpackLo, PackedElem::I16}},
+    {X86::SHUFPDrmi, {PackedOp::Shuffle, PackedElem::F64}},
+    {X86::SHUFPDrri, {PackedOp::Shuffle, PackedElem::F64}},
+    {X86::SHUFPSrmi, {PackedOp::Shuffle, PackedElem::F32}},
+    {X86::SHUFPSrri, {PackedOp::Shuffle, PackedElem::F32}},
+    {X86::SQRTPDm, {PackedOp::FSqrt, PackedElem::F64}},
+    {X86::SQRTPDr, {PackedOp::FSqrt, PackedElem::F64}},
+    {X86::SQRTPSm, {PackedOp::FSqrt, PackedElem::F32}},
+    {X86::SQRTPSr, {PackedOp::FSqrt, PackedElem::F32}},
+    {X86::UNPCKHPDrm, {PackedOp::UnpackHi, PackedElem::F64}},
+    {X86::UNPCKHPDrr, {PackedOp::UnpackHi, PackedElem::F64}},
+    {X86::UNPCKHPSrm, {PackedOp::UnpackHi, PackedElem::F32}},
+    {X86::UNPCKHPSrr, {PackedOp::UnpackHi, PackedElem::F32}},
+    {X86::VADDPDYrm, {PackedOp::FAdd, PackedElem::F64}},
+    {X86::VADDPDYrr, {PackedOp::FAdd, PackedElem::F64}},
+    {X86::VADDPDrm, {PackedOp::FAdd, PackedElem::F64}},
+    {X86::VADDPDrr, {PackedOp::FAdd, PackedElem::F64}},
+    {X86::VADDPSYrm, {PackedOp::FAdd, PackedElem::F32}},
+    {X86::VADDPSYrr, {PackedOp::FAdd, PackedElem::F32}},
+    {X86::VADDPSrm, {PackedOp::FAdd, PackedElem::F32}},
+    {X86::VADDPSrr, {PackedOp::FAdd, PackedElem::F32}},
+    {X86::VANDNPDYrm, {PackedOp::AndNot, PackedElem::I64}},
+    {X86::VANDNPDYrr, {PackedOp::AndNot, PackedElem::I64}},
+    {X86::VANDNPDrm, {PackedOp::AndNot, PackedElem::I64}},
+    {X86::VANDNPDrr, {PackedOp::AndNot, PackedElem::I64}},
+    {X86::VANDNPSYrm, {PackedOp::AndNot, PackedElem::I32}},
+    {X86::VANDNPSYrr, {PackedOp::AndNot, PackedElem::I32}},
+    {X86::VANDNPSrm, {PackedOp::AndNot, PackedElem::I32}},
+    {X86::VANDNPSrr, {PackedOp::AndNot, PackedElem::I32}},
+    {X86::VANDPDYrm, {PackedOp::And, PackedElem::I64}},
+    {X86::VANDPDYrr, {PackedOp::And, PackedElem::I64}},
+    {X86::VANDPDrm, {PackedOp::And, PackedElem::I64}},
+    {X86::VANDPDrr, {PackedOp::And, PackedElem::I64}},
+    {X86::VANDPSYrm, {PackedOp::And, PackedElem::I32}},
+    {X86::VANDPSYrr, {PackedOp::And, PackedElem::I32}},
+    {X86::VANDPSrm, {PackedOp::And, PackedElem::I32}},
+    {X86::VANDPSrr, {PackedOp::And, PackedElem::I32}},
+    {X86::VBROADCASTSDYrm, {PackedOp::Broadcast, PackedElem::F64}},
+    {X86::VBROADCASTSDYrr, {PackedOp::Broadcast, PackedElem::F64}},
+    {X86::VBROADCASTSSYrm, {PackedOp::Broadcast, PackedElem::F32}},
+    {X86::VBROADCASTSSYrr, {PackedOp::Broadcast, PackedElem::F32}},
+    {X86::VBROADCASTSSrm, {PackedOp::Broadcast, PackedElem::F32}},
+    {X86::VBROADCASTSSrr, {PackedOp::Broadcast, PackedElem::F32}},
+    {X86::VCMPPDYrmi, {PackedOp::FCmp, PackedElem::F64}},
+    {X86::VCMPPDYrri, {PackedOp::FCmp, PackedElem::F64}},
+    {X86::VCMPPDrmi, {PackedOp::FCmp, PackedElem::F64}},
+    {X86::VCMPPDrri, {PackedOp::FCmp, PackedElem::F64}},
+    {X86::VCMPPSYrmi, {PackedOp::FCmp, PackedElem::F32}},
+    {X86::VCMPPSYrri, {PackedOp::FCmp, PackedElem::F32}},
+    {X86::VCMPPSrmi, {PackedOp::FCmp, PackedElem::F32}},
+    {X86::VCMPPSrri, {PackedOp::FCmp, PackedElem::F32}},
+    {X86::VDIVPDYrm, {PackedOp::FDiv, PackedElem::F64}},
+    {X86::VDIVPDYrr, {PackedOp::FDiv, PackedElem::F64}},
+    {X86::VDIVPDrm, {PackedOp::FDiv, PackedElem::F64}},
+    {X86::VDIVPDrr, {PackedOp::FDiv, PackedElem::F64}},
+    {X86::VDIVPSYrm, {PackedOp::FDiv, PackedElem::F32}},
+    {X86::VDIVPSYrr, {PackedOp::FDiv, PackedElem::F32}},
+    {X86::VDIVPSrm, {PackedOp::FDiv, PackedElem::F32}},
+    {X86::VDIVPSrr, {PackedOp::FDiv, PackedElem::F32}},
+    {X86::VEXTRACTF128rr, {PackedOp::Extract128, PackedElem::I32}},
+    {X86::VEXTRACTI128rr, {PackedOp::Extract128, PackedElem::I32}},
+    {X86::VINSERTF128rm, {PackedOp::Insert128, PackedElem::I32}},
+    {X86::VINSERTF128rr, {PackedOp::Insert128, PackedElem::I32}},
+    {X86::VINSERTI128rm, {PackedOp::Insert128, PackedElem::I32}},
+    {X86::VINSERTI128rr, {PackedOp::Insert128, PackedElem::I32}},
+    {X86::VMAXPDYrm, {PackedOp::FMax, PackedElem::F64}},
+    {X86::VMAXPDYrr, {PackedOp::FMax, PackedElem::F64}},
+    {X86::VMAXPDrm, {PackedOp::FMax, PackedElem::F64}},
+    {X86::VMAXPDrr, {PackedOp::FMax, PackedElem::F64}},
+    {X86::VMAXPSYrm, {PackedOp::FMax, PackedElem::F32}},
+    {X86::VMAXPSYrr, {PackedOp::FMax, PackedElem::F32}},
+    {X86::VMAXPSrm, {PackedOp::FMax, PackedElem::F32}},
+    {X86::VMAXPSrr, {PackedOp::FMax, PackedElem::F32}},
+    {X86::VMINPDYrm, {PackedOp::FMin, PackedElem::F64}},
+    {X86::VMINPDYrr, {PackedOp::FMin, PackedElem::F64}},
+    {X86::VMINPDrm, {PackedOp::FMin, PackedElem::F64}},
+    {X86::VMINPDrr, {PackedOp::FMin, PackedElem::F64}},
+    {X86::VMINPSYrm, {PackedOp::FMin, PackedElem::F32}},
+    {X86::VMINPSYrr, {PackedOp::FMin, PackedElem::F32}},
+    {X86::VMINPSrm, {PackedOp::FMin, PackedElem::F32}},
+    {X86::VMINPSrr, {PackedOp::FMin, PackedElem::F32}},
+    {X86::VMOVAPDYmr, {PackedOp::Move, PackedElem::F64}},
+    {X86::VMOVAPDYrm, {PackedOp::Move, PackedElem::F64}},
+    {X86::VMOVAPDYrr, {PackedOp::Move, PackedElem::F64}},
+    {X86::VMOVAPDYrr_REV, {PackedOp::Move, PackedElem::F64}},
+    {X86::VMOVAPDmr, {PackedOp::Move, PackedElem::F64}},
+    {X86::VMOVAPDrm, {PackedOp::Move, PackedElem::F64}},
+    {X86::VMOVAPDrr, {PackedOp::Move, PackedElem::F64}},
+    {X86::VMOVAPDrr_REV, {PackedOp::Move, PackedElem::F64}},
+    {X86::VMOVAPSYmr, {PackedOp::Move, PackedElem::F32}},
+    {X86::VMOVAPSYrm, {PackedOp::Move, PackedElem::F32}},
+    {X86::VMOVAPSYrr, {PackedOp::Move, PackedElem::F32}},
+    {X86::VMOVAPSYrr_REV, {PackedOp::Move, PackedElem::F32}},
+    {X86::VMOVAPSmr, {PackedOp::Move, PackedElem::F32}},
+    {X86::VMOVAPSrm, {PackedOp::Move, PackedElem::F32}},
+    {X86::VMOVAPSrr, {PackedOp::Move, PackedElem::F32}},
+    {X86::VMOVAPSrr_REV, {PackedOp::Move, PackedElem::F32}},
+    {X86::VMOVDQAYmr, {PackedOp::Move, PackedElem::I32}},
+    {X86::VMOVDQAYrm, {PackedOp::Move, PackedElem::I32}},
+    {X86::VMOVDQAYrr, {PackedOp::Move, PackedElem::I32}},
+    {X86::VMOVDQAYrr_REV, {PackedOp::Move, PackedElem::I32}},
+    {X86::VMOVDQAmr, {PackedOp::Move, PackedElem::I32}},
+    {X86::VMOVDQArm, {PackedOp::Move, PackedElem::I32}},
+    {X86::VMOVDQArr, {PackedOp::Move, PackedElem::I32}},
+    {X86::VMOVDQArr_REV, {PackedOp::Move, PackedElem::I32}},
+    {X86::VMOVDQUYmr, {PackedOp::Move, PackedElem::I32}},
+    {X86::VMOVDQUYrm, {PackedOp::Move, PackedElem::I32}},
+    {X86::VMOVDQUYrr, {PackedOp::Move, PackedElem::I32}},
+    {X86::VMOVDQUYrr_REV, {PackedOp::Move, PackedElem::I32}},
+    {X86::VMOVDQUmr, {PackedOp::Move, PackedElem::I32}},
+    {X86::VMOVDQUrm, {PackedOp::Move, PackedElem::I32}},
+    {X86::VMOVDQUrr, {PackedOp::Move, PackedElem::I32}},
+    {X86::VMOVDQUrr_REV, {PackedOp::Move, PackedElem::I32}},
+    {X86::VMOVMSKPDYrr, {PackedOp::MoveMask, PackedElem::F64}},
+    {X86::VMOVMSKPDrr, {PackedOp::MoveMask, PackedElem::F64}},
+    {X86::VMOVMSKPSYrr, {PackedOp::MoveMask, PackedElem::F32}},
+    {X86::VMOVMSKPSrr, {PackedOp::MoveMask, PackedElem::F32}},
+    {X86::VMOVNTDQYmr, {PackedOp::Move, PackedElem::I32}},
+    {X86::VMOVNTDQmr, {PackedOp::Move, PackedElem::I32}},
+    {X86::VMOVNTPDYmr, {PackedOp::Move, PackedElem::F64}},
+    {X86::VMOVNTPDmr, {PackedOp::Move, PackedElem::F64}},
+    {X86::VMOVNTPSYmr, {PackedOp::Move, PackedElem::F32}},
+    {X86::VMOVNTPSmr, {PackedOp::Move, PackedElem::F32}},
+    {X86::VMOVUPDYmr, {PackedOp::Move, PackedElem::F64}},
+    {X86::VMOVUPDYrm, {PackedOp::Move, PackedElem::F64}},
+    {X86::VMOVUPDYrr, {PackedOp::Move, PackedElem::F64}},
+    {X86::VMOVUPDYrr_REV, {PackedOp::Move, PackedElem::F64}},
+    {X86::VMOVUPDmr, {PackedOp::Move, PackedElem::F64}},
+    {X86::VMOVUPDrm, {PackedOp::Move, PackedElem::F64}},
+    {X86::VMOVUPDrr, {PackedOp::Move, PackedElem::F64}},
+    {X86::VMOVUPDrr_REV, {PackedOp::Move, PackedElem::F64}},
+    {X86::VMOVUPSYmr, {PackedOp::Move, PackedElem::F32}},
+    {X86::VMOVUPSYrm, {PackedOp::Move, PackedElem::F32}},
+    {X86::VMOVUPSYrr, {PackedOp::Move, PackedElem::F32}},
+    {X86::VMOVUPSYrr_REV, {PackedOp::Move, PackedElem::F32}},
+    {X86::VMOVUPSmr, {PackedOp::Move, PackedElem::F32}},
+    {X86::VMOVUPSrm, {PackedOp::Move, PackedElem::F32}},
+    {X86::VMOVUPSrr, {PackedOp::Move, PackedElem::F32}},
+    {X86::VMOVUPSrr_REV, {PackedOp::Move, PackedElem::F32}},
+    {X86::VMULPDYrm, {PackedOp::FMul, PackedElem::F64}},
+    {X86::VMULPDYrr, {PackedOp::FMul, PackedElem::F64}},
+    {X86::VMULPDrm, {PackedOp::FMul, PackedElem::F64}},
+    {X86::VMULPDrr, {PackedOp::FMul, PackedElem::F64}},
+    {X86::VMULPSYrm, {PackedOp::FMul, PackedElem::F32}},
+    {X86::VMULPSYrr, {PackedOp::FMul, PackedElem::F32}},
+    {X86::VMULPSrm, {PackedOp::FMul, PackedElem::F32}},
+    {X86::VMULPSrr, {PackedOp::FMul, PackedElem::F32}},
+    {X86::VORPDYrm, {PackedOp::Or, PackedElem::I64}},
+    {X86::VORPDYrr, {PackedOp::Or, PackedElem::I64}},
+    {X86::VORPDrm, {PackedOp::Or, PackedElem::I64}},
+    {X86::VORPDrr, {PackedOp::Or, PackedElem::I64}},
+    {X86::VORPSYrm, {PackedOp::Or, PackedElem::I32}},
+    {X86::VORPSYrr, {PackedOp::Or, PackedElem::I32}},
+    {X86::VORPSrm, {PackedOp::Or, PackedElem::I32}},
+    {X86::VORPSrr, {PackedOp::Or, PackedElem::I32}},
+    {X86::VPABSBYrm, {PackedOp::Abs, PackedElem::I8}},
+    {X86::VPABSBYrr, {PackedOp::Abs, PackedElem::I8}},
+    {X86::VPABSBrm, {PackedOp::Abs, PackedElem::I8}},
+    {X86::VPABSBrr, {PackedOp::Abs, PackedElem::I8}},
+    {X86::VPABSDYrm, {PackedOp::Abs, PackedElem::I32}},
+    {X86::VPABSDYrr, {PackedOp::Abs, PackedElem::I32}},
+    {X86::VPABSDrm, {PackedOp::Abs, PackedElem::I32}},
+    {X86::VPABSDrr, {PackedOp::Abs, PackedElem::I32}},
+    {X86::VPABSWYrm, {PackedOp::Abs, PackedElem::I16}},
+    {X86::VPABSWYrr, {PackedOp::Abs, PackedElem::I16}},
+    {X86::VPABSWrm, {PackedOp::Abs, PackedElem::I16}},
+    {X86::VPABSWrr, {PackedOp::Abs, PackedElem::I16}},
+    {X86::VPADDBYrm, {PackedOp::Add, PackedElem::I8}},
+    {X86::VPADDBYrr, {PackedOp::Add, PackedElem::I8}},
+    {X86::VPADDBrm, {PackedOp::Add, PackedElem::I8}},
+    {X86::VPADDBrr, {PackedOp::Add, PackedElem::I8}},
+    {X86::VPADDDYrm, {PackedOp::Add, PackedElem::I32}},
+    {X86::VPADDDYrr, {PackedOp::Add, PackedElem::I32}},
+    {X86::VPADDDrm, {PackedOp::Add, PackedElem::I32}},
+    {X86::VPADDDrr, {PackedOp::Add, PackedElem::I32}},
+    {X86::VPADDQYrm, {PackedOp::Add, PackedElem::I64}},
+    {X86::VPADDQYrr, {PackedOp::Add, PackedElem::I64}},
+    {X86::VPADDQrm, {PackedOp::Add, PackedElem::I64}},
+    {X86::VPADDQrr, {PackedOp::Add, PackedElem::I64}},
+    {X86::VPADDSBYrm, {PackedOp::AddSatS, PackedElem::I8}},
+    {X86::VPADDSBYrr, {PackedOp::AddSatS, PackedElem::I8}},
+    {X86::VPADDSBrm, {PackedOp::AddSatS, PackedElem::I8}},
+    {X86::VPADDSBrr, {PackedOp::AddSatS, PackedElem::I8}},
+    {X86::VPADDSWYrm, {PackedOp::AddSatS, PackedElem::I16}},
+    {X86::VPADDSWYrr, {PackedOp::AddSatS, PackedElem::I16}},
+    {X86::VPADDSWrm, {PackedOp::AddSatS, PackedElem::I16}},
+    {X86::VPADDSWrr, {PackedOp::AddSatS, PackedElem::I16}},
+    {X86::VPADDUSBYrm, {PackedOp::AddSatU, PackedElem::I8}},
+    {X86::VPADDUSBYrr, {PackedOp::AddSatU, PackedElem::I8}},
+    {X86::VPADDUSBrm, {PackedOp::AddSatU, PackedElem::I8}},
+    {X86::VPADDUSBrr, {PackedOp::AddSatU, PackedElem::I8}},
+    {X86::VPADDUSWYrm, {PackedOp::AddSatU, PackedElem::I16}},
+    {X86::VPADDUSWYrr, {PackedOp::AddSatU, PackedElem::I16}},
+    {X86::VPADDUSWrm, {PackedOp::AddSatU, PackedElem::I16}},
+    {X86::VPADDUSWrr, {PackedOp::AddSatU, PackedElem::I16}},
+    {X86::VPADDWYrm, {PackedOp::Add, PackedElem::I16}},
+    {X86::VPADDWYrr, {PackedOp::Add, PackedElem::I16}},
+    {X86::VPADDWrm, {PackedOp::Add, PackedElem::I16}},
+    {X86::VPADDWrr, {PackedOp::Add, PackedElem::I16}},
+    {X86::VPANDNYrm, {PackedOp::AndNot, PackedElem::I64}},
+    {X86::VPANDNYrr, {PackedOp::AndNot, PackedElem::I64}},
+    {X86::VPANDNrm, {PackedOp::AndNot, PackedElem::I64}},
+    {X86::VPANDNrr, {PackedOp::AndNot, PackedElem::I64}},
+    {X86::VPANDYrm, {PackedOp::And, PackedElem::I64}},
+    {X86::VPANDYrr, {PackedOp::And, PackedElem::I64}},
+    {X86::VPANDrm, {PackedOp::And, PackedElem::I64}},
+    {X86::VPANDrr, {PackedOp::And, PackedElem::I64}},
+    {X86::VPBROADCASTBYrm, {PackedOp::Broadcast, PackedElem::I8}},
+    {X86::VPBROADCASTBYrr, {PackedOp::Broadcast, PackedElem::I8}},
+    {X86::VPBROADCASTBrm, {PackedOp::Broadcast, PackedElem::I8}},
+    {X86::VPBROADCASTBrr, {PackedOp::Broadcast, PackedElem::I8}},
+    {X86::VPBROADCASTDYrm, {PackedOp::Broadcast, PackedElem::I32}},
+    {X86::VPBROADCASTDYrr, {PackedOp::Broadcast, PackedElem::I32}},
+    {X86::VPBROADCASTDrm, {PackedOp::Broadcast, PackedElem::I32}},
+    {X86::VPBROADCASTDrr, {PackedOp::Broadcast, PackedElem::I32}},
+    {X86::VPBROADCASTQYrm, {PackedOp::Broadcast, PackedElem::I64}},
+    {X86::VPBROADCASTQYrr, {PackedOp::Broadcast, PackedElem::I64}},
+    {X86::VPBROADCASTQrm, {PackedOp::Broadcast, PackedElem::I64}},
+    {X86::VPBROADCASTQrr, {PackedOp::Broadcast, PackedElem::I64}},
+    {X86::VPBROADCASTWYrm, {PackedOp::Broadcast, PackedElem::I16}},
+    {X86::VPBROADCASTWYrr, {PackedOp::Broadcast, PackedElem::I16}},
+    {X86::VPBROADCASTWrm, {PackedOp::Broadcast, PackedElem::I16}},
+    {X86::VPBROADCASTWrr, {PackedOp::Broadcast, PackedElem::I16}},
+    {X86::VPCMPEQBYrm, {PackedOp::CmpEq, PackedElem::I8}},
+    {X86::VPCMPEQBYrr, {PackedOp::CmpEq, PackedElem::I8}},
+    {X86::VPCMPEQBrm, {PackedOp::CmpEq, PackedElem::I8}},
+    {X86::VPCMPEQBrr, {PackedOp::CmpEq, PackedElem::I8}},
+    {X86::VPCMPEQDYrm, {PackedOp::CmpEq, PackedElem::I32}},
+    {X86::VPCMPEQDYrr, {PackedOp::CmpEq, PackedElem::I32}},
+    {X86::VPCMPEQDrm, {PackedOp::CmpEq, PackedElem::I32}},
+    {X86::VPCMPEQDrr, {PackedOp::CmpEq, PackedElem::I32}},
+    {X86::VPCMPEQQYrm, {PackedOp::CmpEq, PackedElem::I64}},
+    {X86::VPCMPEQQYrr, {PackedOp::CmpEq, PackedElem::I64}},
+    {X86::VPCMPEQQrm, {PackedOp::CmpEq, PackedElem::I64}},
+    {X86::VPCMPEQQrr, {PackedOp::CmpEq, PackedElem::I64}},
+    {X86::VPCMPEQWYrm, {PackedOp::CmpEq, PackedElem::I16}},
+    {X86::VPCMPEQWYrr, {PackedOp::CmpEq, PackedElem::I16}},
+    {X86::VPCMPEQWrm, {PackedOp::CmpEq, PackedElem::I16}},
+    {X86::VPCMPEQWrr, {PackedOp::CmpEq, PackedElem::I16}},
+    {X86::VPCMPGTBYrm, {PackedOp::CmpGt, PackedElem::I8}},
+    {X86::VPCMPGTBYrr, {PackedOp::CmpGt, PackedElem::I8}},
+    {X86::VPCMPGTBrm, {PackedOp::CmpGt, PackedElem::I8}},
+    {X86::VPCMPGTBrr, {PackedOp::CmpGt, PackedElem::I8}},
+    {X86::VPCMPGTDYrm, {PackedOp::CmpGt, PackedElem::I32}},
+    {X86::VPCMPGTDYrr, {PackedOp::CmpGt, PackedElem::I32}},
+    {X86::VPCMPGTDrm, {PackedOp::CmpGt, PackedElem::I32}},
+    {X86::VPCMPGTDrr, {PackedOp::CmpGt, PackedElem::I32}},
+    {X86::VPCMPGTQYrm, {PackedOp::CmpGt, PackedElem::I64}},
+    {X86::VPCMPGTQYrr, {PackedOp::CmpGt, PackedElem::I64}},
+    {X86::VPCMPGTQrm, {PackedOp::CmpGt, PackedElem::I64}},
+    {X86::VPCMPGTQrr, {PackedOp::CmpGt, PackedElem::I64}},
+    {X86::VPCMPGTWYrm, {PackedOp::CmpGt, PackedElem::I16}},
+    {X86::VPCMPGTWYrr, {PackedOp::CmpGt, PackedElem::I16}},
+    {X86::VPCMPGTWrm, {PackedOp::CmpGt, PackedElem::I16}},
+    {X86::VPCMPGTWrr, {PackedOp::CmpGt, PackedElem::I16}},
+    {X86::VPERM2F128rm, {PackedOp::Permute2x128, PackedElem::I64}},
+    {X86::VPERM2F128rr, {PackedOp::Permute2x128, PackedElem::I64}},
+    {X86::VPERM2I128rm, {PackedOp::Permute2x128, PackedElem::I64}},
+    {X86::VPERM2I128rr, {PackedOp::Permute2x128, PackedElem::I64}},
+    {X86::VPERMDYrm, {PackedOp::PermuteVar, PackedElem::I32}},
+    {X86::VPERMDYrr, {PackedOp::PermuteVar, PackedElem::I32}},
+    {X86::VPERMPDYmi, {PackedOp::Permute, PackedElem::F64}},
+    {X86::VPERMPDYri, {PackedOp::Permute, PackedElem::F64}},
+    {X86::VPERMPSYrm, {PackedOp::PermuteVar, PackedElem::F32}},
+    {X86::VPERMPSYrr, {PackedOp::PermuteVar, PackedElem::F32}},
+    {X86::VPERMQYmi, {PackedOp::Permute, PackedElem::I64}},
+    {X86::VPERMQYri, {PackedOp::Permute, PackedElem::I64}},
+    {X86::VPMAXSBYrm, {PackedOp::SMax, PackedElem::I8}},
+    {X86::VPMAXSBYrr, {PackedOp::SMax, PackedElem::I8}},
+    {X86::VPMAXSBrm, {PackedOp::SMax, PackedElem::I8}},
+    {X86::VPMAXSBrr, {PackedOp::SMax, PackedElem::I8}},
+    {X86::VPMAXSDYrm, {PackedOp::SMax, PackedElem::I32}},
+    {X86::VPMAXSDYrr, {PackedOp::SMax, PackedElem::I32}},
+    {X86::VPMAXSDrm, {PackedOp::SMax, PackedElem::I32}},
+    {X86::VPMAXSDrr, {PackedOp::SMax, PackedElem::I32}},
+    {X86::VPMAXSWYrm, {PackedOp::SMax, PackedElem::I16}},
+    {X86::VPMAXSWYrr, {PackedOp::SMax, PackedElem::I16}},
+    {X86::VPMAXSWrm, {PackedOp::SMax, PackedElem::I16}},
+    {X86::VPMAXSWrr, {PackedOp::SMax, PackedElem::I16}},
+    {X86::VPMAXUBYrm, {PackedOp::UMax, PackedElem::I8}},
+    {X86::VPMAXUBYrr, {PackedOp::UMax, PackedElem::I8}},
+    {X86::VPMAXUBrm, {PackedOp::UMax, PackedElem::I8}},
+    {X86::VPMAXUBrr, {PackedOp::UMax, PackedElem::I8}},
+    {X86::VPMAXUDYrm, {PackedOp::UMax, PackedElem::I32}},
+    {X86::VPMAXUDYrr, {PackedOp::UMax, PackedElem::I32}},
+    {X86::VPMAXUDrm, {PackedOp::UMax, PackedElem::I32}},
+    {X86::VPMAXUDrr, {PackedOp::UMax, PackedElem::I32}},
+    {X86::VPMAXUWYrm, {PackedOp::UMax, PackedElem::I16}},
+    {X86::VPMAXUWYrr, {PackedOp::UMax, PackedElem::I16}},
+    {X86::VPMAXUWrm, {PackedOp::UMax, PackedElem::I16}},
+    {X86::VPMAXUWrr, {PackedOp::UMax, PackedElem::I16}},
+    {X86::VPMINSBYrm, {PackedOp::SMin, PackedElem::I8}},
+    {X86::VPMINSBYrr, {PackedOp::SMin, PackedElem::I8}},
+    {X86::VPMINSBrm, {PackedOp::SMin, PackedElem::I8}},
+    {X86::VPMINSBrr, {PackedOp::SMin, PackedElem::I8}},
+    {X86::VPMINSDYrm, {PackedOp::SMin, PackedElem::I32}},
+    {X86::VPMINSDYrr, {PackedOp::SMin, PackedElem::I32}},
+    {X86::VPMINSDrm, {PackedOp::SMin, PackedElem::I32}},
+    {X86::VPMINSDrr, {PackedOp::SMin, PackedElem::I32}},
+    {X86::VPMINSWYrm, {PackedOp::SMin, PackedElem::I16}},
+    {X86::VPMINSWYrr, {PackedOp::SMin, PackedElem::I16}},
+    {X86::VPMINSWrm, {PackedOp::SMin, PackedElem::I16}},
+    {X86::VPMINSWrr, {PackedOp::SMin, PackedElem::I16}},
+    {X86::VPMINUBYrm, {PackedOp::UMin, PackedElem::I8}},
+    {X86::VPMINUBYrr, {PackedOp::UMin, PackedElem::I8}},
+    {X86::VPMINUBrm, {PackedOp::UMin, PackedElem::I8}},
+    {X86::VPMINUBrr, {PackedOp::UMin, PackedElem::I8}},
+    {X86::VPMINUDYrm, {PackedOp::UMin, PackedElem::I32}},
+    {X86::VPMINUDYrr, {PackedOp::UMin, PackedElem::I32}},
+    {X86::VPMINUDrm, {PackedOp::UMin, PackedElem::I32}},
+    {X86::VPMINUDrr, {PackedOp::UMin, PackedElem::I32}},
+    {X86::VPMINUWYrm, {PackedOp::UMin, PackedElem::I16}},
+    {X86::VPMINUWYrr, {PackedOp::UMin, PackedElem::I16}},
+    {X86::VPMINUWrm, {PackedOp::UMin, PackedElem::I16}},
+    {X86::VPMINUWrr, {PackedOp::UMin, PackedElem::I16}},
+    {X86::VPMOVMSKBYrr, {PackedOp::MoveMask, PackedElem::I8}},
+    {X86::VPMOVMSKBrr, {PackedOp::MoveMask, PackedElem::I8}},
+    {X86::VPMULLDYrm, {PackedOp::MulLo, PackedElem::I32}},
+    {X86::VPMULLDYrr, {PackedOp::MulLo, PackedElem::I32}},
+    {X86::VPMULLDrm, {PackedOp::MulLo, PackedElem::I32}},
+    {X86::VPMULLDrr, {PackedOp::MulLo, PackedElem::I32}},
+    {X86::VPMULLWYrm, {PackedOp::MulLo, PackedElem::I16}},
+    {X86::VPMULLWYrr, {PackedOp::MulLo, PackedElem::I16}},
+    {X86::VPMULLWrm, {PackedOp::MulLo, PackedElem::I16}},
+    {X86::VPMULLWrr, {PackedOp::MulLo, PackedElem::I16}},
+    {X86::VPORYrm, {PackedOp::Or, PackedElem::I64}},
+    {X86::VPORYrr, {PackedOp::Or, PackedElem::I64}},
+    {X86::VPORrm, {PackedOp::Or, PackedElem::I64}},
+    {X86::VPORrr, {PackedOp::Or, PackedElem::I64}},
+    {X86::VPSHUFBYrm, {PackedOp::ByteShuffle, PackedElem::I8}},
+    {X86::VPSHUFBYrr, {PackedOp::ByteShuffle, PackedElem::I8}},
+    {X86::VPSHUFBrm, {PackedOp::ByteShuffle, PackedElem::I8}},
+    {X86::VPSHUFBrr, {PackedOp::ByteShuffle, PackedElem::I8}},
+    {X86::VPSHUFDYmi, {PackedOp::ShuffleD, PackedElem::I32}},
+    {X86::VPSHUFDYri, {PackedOp::ShuffleD, PackedElem::I32}},
+    {X86::VPSHUFDmi, {PackedOp::ShuffleD, PackedElem::I32}},
+    {X86::VPSHUFDri, {PackedOp::ShuffleD, PackedElem::I32}},
+    {X86::VPSLLDYri, {PackedOp::ShlImm, PackedElem::I32}},
+    {X86::VPSLLDri, {PackedOp::ShlImm, PackedElem::I32}},
+    {X86::VPSLLQYri, {PackedOp::ShlImm, PackedElem::I64}},
+    {X86::VPSLLQri, {PackedOp::ShlImm, PackedElem::I64}},
+    {X86::VPSLLVDYrm, {PackedOp::ShlVar, PackedElem::I32}},
+    {X86::VPSLLVDYrr, {PackedOp::ShlVar, PackedElem::I32}},
+    {X86::VPSLLVDrm, {PackedOp::ShlVar, PackedElem::I32}},
+    {X86::VPSLLVDrr, {PackedOp::ShlVar, PackedElem::I32}},
+    {X86::VPSLLVQYrm, {PackedOp::ShlVar, PackedElem::I64}},
+    {X86::VPSLLVQYrr, {PackedOp::ShlVar, PackedElem::I64}},
+    {X86::VPSLLVQrm, {PackedOp::ShlVar, PackedElem::I64}},
+    {X86::VPSLLVQrr, {PackedOp::ShlVar, PackedElem::I64}},
+    {X86::VPSLLWYri, {PackedOp::ShlImm, PackedElem::I16}},
+    {X86::VPSLLWri, {PackedOp::ShlImm, PackedElem::I16}},
+    {X86::VPSRADYri, {PackedOp::AShrImm, PackedElem::I32}},
+    {X86::VPSRADri, {PackedOp::AShrImm, PackedElem::I32}},
+    {X86::VPSRAVDYrm, {PackedOp::AShrVar, PackedElem::I32}},
+    {X86::VPSRAVDYrr, {PackedOp::AShrVar, PackedElem::I32}},
+    {X86::VPSRAVDrm, {PackedOp::AShrVar, PackedElem::I32}},
+    {X86::VPSRAVDrr, {PackedOp::AShrVar, PackedElem::I32}},
+    {X86::VPSRAWYri, {PackedOp::AShrImm, PackedElem::I16}},
+    {X86::VPSRAWri, {PackedOp::AShrImm, PackedElem::I16}},
+    {X86::VPSRLDYri, {PackedOp::LShrImm, PackedElem::I32}},
+    {X86::VPSRLDri, {PackedOp::LShrImm, PackedElem::I32}},
+    {X86::VPSRLQYri, {PackedOp::LShrImm, PackedElem::I64}},
+    {X86::VPSRLQri, {PackedOp::LShrImm, PackedElem::I64}},
+    {X86::VPSRLVDYrm, {PackedOp::LShrVar, PackedElem::I32}},
+    {X86::VPSRLVDYrr, {PackedOp::LShrVar, PackedElem::I32}},
+    {X86::VPSRLVDrm, {PackedOp::LShrVar, PackedElem::I32}},
+    {X86::VPSRLVDrr, {PackedOp::LShrVar, PackedElem::I32}},
+    {X86::VPSRLVQYrm, {PackedOp::LShrVar, PackedElem::I64}},
+    {X86::VPSRLVQYrr, {PackedOp::LShrVar, PackedElem::I64}},
+    {X86::VPSRLVQrm, {PackedOp::LShrVar, PackedElem::I64}},
+    {X86::VPSRLVQrr, {PackedOp::LShrVar, PackedElem::I64}},
+    {X86::VPSRLWYri, {PackedOp::LShrImm, PackedElem::I16}},
+    {X86::VPSRLWri, {PackedOp::LShrImm, PackedElem::I16}},
+    {X86::VPSUBBYrm, {PackedOp::Sub, PackedElem::I8}},
+    {X86::VPSUBBYrr, {PackedOp::Sub, PackedElem::I8}},
+    {X86::VPSUBBrm, {PackedOp::Sub, PackedElem::I8}},
+    {X86::VPSUBBrr, {PackedOp::Sub, PackedElem::I8}},
+    {X86::VPSUBDYrm, {PackedOp::Sub, PackedElem::I32}},
+    {X86::VPSUBDYrr, {PackedOp::Sub, PackedElem::I32}},
+    {X86::VPSUBDrm, {PackedOp::Sub, PackedElem::I32}},
+    {X86::VPSUBDrr, {PackedOp::Sub, PackedElem::I32}},
+    {X86::VPSUBQYrm, {PackedOp::Sub, PackedElem::I64}},
+    {X86::VPSUBQYrr, {PackedOp::Sub, PackedElem::I64}},
+    {X86::VPSUBQrm, {PackedOp::Sub, PackedElem::I64}},
+    {X86::VPSUBQrr, {PackedOp::Sub, PackedElem::I64}},
+    {X86::VPSUBSBYrm, {PackedOp::SubSatS, PackedElem::I8}},
+    {X86::VPSUBSBYrr, {PackedOp::SubSatS, PackedElem::I8}},
+    {X86::VPSUBSBrm, {PackedOp::SubSatS, PackedElem::I8}},
+    {X86::VPSUBSBrr, {PackedOp::SubSatS, PackedElem::I8}},
+    {X86::VPSUBSWYrm, {PackedOp::SubSatS, PackedElem::I16}},
+    {X86::VPSUBSWYrr, {PackedOp::SubSatS, PackedElem::I16}},
+    {X86::VPSUBSWrm, {PackedOp::SubSatS, PackedElem::I16}},
+    {X86::VPSUBSWrr, {PackedOp::SubSatS, PackedElem::I16}},
+    {X86::VPSUBUSBYrm, {PackedOp::SubSatU, PackedElem::I8}},
+    {X86::VPSUBUSBYrr, {PackedOp::SubSatU, PackedElem::I8}},
+    {X86::VPSUBUSBrm, {PackedOp::SubSatU, PackedElem::I8}},
+    {X86::VPSUBUSBrr, {PackedOp::SubSatU, PackedElem::I8}},
+    {X86::VPSUBUSWYrm, {PackedOp::SubSatU, PackedElem::I16}},
+    {X86::VPSUBUSWYrr, {PackedOp::SubSatU, PackedElem::I16}},
+    {X86::VPSUBUSWrm, {PackedOp::SubSatU, PackedElem::I16}},
+    {X86::VPSUBUSWrr, {PackedOp::SubSatU, PackedElem::I16}},
+    {X86::VPSUBWYrm, {PackedOp::Sub, PackedElem::I16}},
+    {X86::VPSUBWYrr, {PackedOp::Sub, PackedElem::I16}},
+    {X86::VPSUBWrm, {PackedOp::Sub, PackedElem::I16}},
+    {X86::VPSUBWrr, {PackedOp::Sub, PackedElem::I16}},
+    {X86::VPUNPCKHBWYrm, {PackedOp::UnpackHi, PackedElem::I8}},
+    {X86::VPUNPCKHBWYrr, {PackedOp::UnpackHi, PackedElem::I8}},
+    {X86::VPUNPCKHBWrm, {PackedOp::UnpackHi, PackedElem::I8}},
+    {X86::VPUNPCKHBWrr, {PackedOp::UnpackHi, PackedElem::I8}},
+    {X86::VPUNPCKHDQYrm, {PackedOp::UnpackHi, PackedElem::I32}},
+    {X86::VPUNPCKHDQYrr, {PackedOp::UnpackHi, PackedElem::I32}},
+    {X86::VPUNPCKHDQrm, {PackedOp::UnpackHi, PackedElem::I32}},
+    {X86::VPUNPCKHDQrr, {PackedOp::UnpackHi, PackedElem::I32}},
+    {X86::VPUNPCKHQDQYrm, {PackedOp::UnpackHi, PackedElem::I64}},
+    {X86::VPUNPCKHQDQYrr, {PackedOp::UnpackHi, PackedElem::I64}},
+    {X86::VPUNPCKHQDQrm, {PackedOp::UnpackHi, PackedElem::I64}},
+    {X86::VPUNPCKHQDQrr, {PackedOp::UnpackHi, PackedElem::I64}},
+    {X86::VPUNPCKHWDYrm, {PackedOp::UnpackHi, PackedElem::I16}},
+    {X86::VPUNPCKHWDYrr, {PackedOp::UnpackHi, PackedElem::I16}},
+    {X86::VPUNPCKHWDrm, {PackedOp::UnpackHi, PackedElem::I16}},
+    {X86::VPUNPCKHWDrr, {PackedOp::UnpackHi, PackedElem::I16}},
+    {X86::VPUNPCKLBWYrm, {PackedOp::UnpackLo, PackedElem::I8}},
+    {X86::VPUNPCKLBWYrr, {PackedOp::UnpackLo, PackedElem::I8}},
+    {X86::VPUNPCKLBWrm, {PackedOp::UnpackLo, PackedElem::I8}},
+    {X86::VPUNPCKLBWrr, {PackedOp::UnpackLo, PackedElem::I8}},
+    {X86::VPUNPCKLDQYrm, {PackedOp::UnpackLo, PackedElem::I32}},
+    {X86::VPUNPCKLDQYrr, {PackedOp::UnpackLo, PackedElem::I32}},
+    {X86::VPUNPCKLDQrm, {PackedOp::UnpackLo, PackedElem::I32}},
+    {X86::VPUNPCKLDQrr, {PackedOp::UnpackLo, PackedElem::I32}},
+    {X86::VPUNPCKLQDQYrm, {PackedOp::UnpackLo, PackedElem::I64}},
+    {X86::VPUNPCKLQDQYrr, {PackedOp::UnpackLo, PackedElem::I64}},
+    {X86::VPUNPCKLQDQrm, {PackedOp::UnpackLo, PackedElem::I64}},
+    {X86::VPUNPCKLQDQrr, {PackedOp::UnpackLo, PackedElem::I64}},
+    {X86::VPUNPCKLWDYrm, {PackedOp::UnpackLo, PackedElem::I16}},
+    {X86::VPUNPCKLWDYrr, {PackedOp::UnpackLo, PackedElem::I16}},
+    {X86::VPUNPCKLWDrm, {PackedOp::UnpackLo, PackedElem::I16}},
+    {X86::VPUNPCKLWDrr, {PackedOp::UnpackLo, PackedElem::I16}},
+    {X86::VPXORYrm, {PackedOp::Xor, PackedElem::I64}},
+    {X86::VPXORYrr, {PackedOp::Xor, PackedElem::I64}},
+    {X86::VPXORrm, {PackedOp::Xor, PackedElem::I64}},
+    {X86::VPXORrr, {PackedOp::Xor, PackedElem::I64}},
+    {X86::VSHUFPDYrmi, {PackedOp::Shuffle, PackedElem::F64}},
+    {X86::VSHUFPDYrri, {PackedOp::Shuffle, PackedElem::F64}},
+    {X86::VSHUFPDrmi, {PackedOp::Shuffle, PackedElem::F64}},
+    {X86::VSHUFPDrri, {PackedOp::Shuffle, PackedElem::F64}},
+    {X86::VSHUFPSYrmi, {PackedOp::Shuffle, PackedElem::F32}},
+    {X86::VSHUFPSYrri, {PackedOp::Shuffle, PackedElem::F32}},
+    {X86::VSHUFPSrmi, {PackedOp::Shuffle, PackedElem::F32}},
+    {X86::VSHUFPSrri, {PackedOp::Shuffle, PackedElem::F32}},
+    {X86::VSQRTPDYm, {PackedOp::FSqrt, PackedElem::F64}},
+    {X86::VSQRTPDYr, {PackedOp::FSqrt, PackedElem::F64}},
+    {X86::VSQRTPDm, {PackedOp::FSqrt, PackedElem::F64}},
+    {X86::VSQRTPDr, {PackedOp::FSqrt, PackedElem::F64}},
+    {X86::VSQRTPSYm, {PackedOp::FSqrt, PackedElem::F32}},
+    {X86::VSQRTPSYr, {PackedOp::FSqrt, PackedElem::F32}},
+    {X86::VSQRTPSm, {PackedOp::FSqrt, PackedElem::F32}},
+    {X86::VSQRTPSr, {PackedOp::FSqrt, PackedElem::F32}},
+    {X86::VSUBPDYrm, {PackedOp::FSub, PackedElem::F64}},
+    {X86::VSUBPDYrr, {PackedOp::FSub, PackedElem::F64}},
+    {X86::VSUBPDrm, {PackedOp::FSub, PackedElem::F64}},
+    {X86::VSUBPDrr, {PackedOp::FSub, PackedElem::F64}},
+    {X86::VSUBPSYrm, {PackedOp::FSub, PackedElem::F32}},
+    {X86::VSUBPSYrr, {PackedOp::FSub, PackedElem::F32}},
+    {X86::VSUBPSrm, {PackedOp::FSub, PackedElem::F32}},
+    {X86::VSUBPSrr, {PackedOp::FSub, PackedElem::F32}},
+    {X86::VUNPCKHPDYrm, {PackedOp::UnpackHi, PackedElem::F64}},
+    {X86::VUNPCKHPDYrr, {PackedOp::UnpackHi, PackedElem::F64}},
+    {X86::VUNPCKHPDrm, {PackedOp::UnpackHi, PackedElem::F64}},
+    {X86::VUNPCKHPDrr, {PackedOp::UnpackHi, PackedElem::F64}},
+    {X86::VUNPCKHPSYrm, {PackedOp::UnpackHi, PackedElem::F32}},
+    {X86::VUNPCKHPSYrr, {PackedOp::UnpackHi, PackedElem::F32}},
+    {X86::VUNPCKHPSrm, {PackedOp::UnpackHi, PackedElem::F32}},
+    {X86::VUNPCKHPSrr, {PackedOp::UnpackHi, PackedElem::F32}},
+    {X86::VUNPCKLPDYrm, {PackedOp::UnpackLo, PackedElem::F64}},
+    {X86::VUNPCKLPDYrr, {PackedOp::UnpackLo, PackedElem::F64}},
+    {X86::VUNPCKLPDrm, {PackedOp::UnpackLo, PackedElem::F64}},
+    {X86::VUNPCKLPDrr, {PackedOp::UnpackLo, PackedElem::F64}},
+    {X86::VUNPCKLPSYrm, {PackedOp::UnpackLo, PackedElem::F32}},
+    {X86::VUNPCKLPSYrr, {PackedOp::UnpackLo, PackedElem::F32}},
+    {X86::VUNPCKLPSrm, {PackedOp::UnpackLo, PackedElem::F32}},
+    {X86::VUNPCKLPSrr, {PackedOp::UnpackLo, PackedElem::F32}},
+    {X86::VXORPDYrm, {PackedOp::Xor, PackedElem::I64}},
+    {X86::VXORPDYrr, {PackedOp::Xor, PackedElem::I64}},
+    {X86::VXORPDrm, {PackedOp::Xor, PackedElem::I64}},
+    {X86::VXORPDrr, {PackedOp::Xor, PackedElem::I64}},
+    {X86::VXORPSYrm, {PackedOp::Xor, PackedElem::I32}},
+    {X86::VXORPSYrr, {PackedOp::Xor, PackedElem::I32}},
+    {X86::VXORPSrm, {PackedOp::Xor, PackedElem::I32}},
+    {X86::VXORPSrr, {PackedOp::Xor, PackedElem::I32}},
+};
+
+static const DenseMap<uint16_t, PackedInstrInfo>
+    PackedInstrMap(std::begin(PackedInstrData), std::end(PackedInstrData));
+
+static Type *getPackedElemType(PackedElem Elem, LLVMContext &Ctx) {
+  switch (Elem) {
+  case PackedElem::I8:
+    return Type::getInt8Ty(Ctx);
+  case PackedElem::I16:
+    return Type::getInt16Ty(Ctx);
+  case PackedElem::I32:
+    return Type::getInt32Ty(Ctx);
+  case PackedElem::I64:
+    return Type::getInt64Ty(Ctx);
+  case PackedElem::F32:
+    return Type::getFloatTy(Ctx);
+  case PackedElem::F64:
+    return Type::getDoubleTy(Ctx);
+  }
+  llvm_unreachable("Unhandled packed element type");
+}
+
+// Return the fcmp predicate of the comparison encoded in the immediate of
+// CMPPS and CMPPD. Predicates 16-31 of the VEX encoded forms only differ from
+// 0-15 in signalling on QNaN operands.
+static CmpInst::Predicate getPackedFCmpPredicate(int64_t Imm) {
+  static const CmpInst::Predicate Preds[] = {
+      CmpInst::FCMP_OEQ,   CmpInst::FCMP_OLT, CmpInst::FCMP_OLE,
+      CmpInst::FCMP_UNO,   CmpInst::FCMP_UNE, CmpInst::FCMP_UGE,
+      CmpInst::FCMP_UGT,   CmpInst::FCMP_ORD, CmpInst::FCMP_UEQ,
+      CmpInst::FCMP_ULT,   CmpInst::FCMP_ULE, CmpInst::FCMP_FALSE,
+      CmpInst::FCMP_ONE,   CmpInst::FCMP_OGE, CmpInst::FCMP_OGT,
+      CmpInst::FCMP_TRUE};
+  return Preds[Imm & 0xf];
+}
+
+// Raise a packed SSE, AVX or AVX2 instruction as an operation on vector
+// values. xmm registers hold 128-bit and ymm registers 256-bit vectors whose
+// element type is given by the instruction. MemRefValue is the memory operand
+// of the instruction, if any. Operations that work within 128-bit lanes
+// (shuffles and unpacks) are raised per lane for ymm registers.
+bool X86MachineInstructionRaiser::raisePackedMachineInstr(
+    const MachineInstr &MI, Value *MemRefValue) {
+  auto InfoIter = PackedInstrMap.find(MI.getOpcode());
+  assert(InfoIter != PackedInstrMap.end() && "Unhandled packed instruction");
+  PackedOp Op = InfoIter->second.Op;
+  int MBBNo = MI.getParent()->getNumber();
+  BasicBlock *RaisedBB = getRaisedBasicBlock(MI.getParent());
+  LLVMContext &Ctx(MF.getFunction().getContext());
+  IRBuilder<> Builder(RaisedBB);
+
+  int MemRefOpIndex = getMemoryRefOpIndex(MI);
+  if ((MemRefOpIndex != -1) && (MemRefValue == nullptr)) {
+    LLVM_DEBUG(MI.dump());
+    LLVM_DEBUG(dbgs() << "Unable to find memory operand of packed "
+                         "instruction\n");
+    return false;
+  }
+  bool IsStore = (MemRefOpIndex == 0);
+  // The data register of a store follows its memory operand
+  unsigned int DataOpIndex = IsStore ? X86::AddrNumOperands : 0;
+  // Vector width is that of the widest vector register operand, element type
+  // that of the instruction.
+  unsigned int VecSzInBits = 128;
+  for (const MachineOperand &MO : MI.explicit_operands())
+    if (MO.isReg() && is256BitSSE2Reg(MO.getReg()))
+      VecSzInBits = 256;
+  Type *ElemTy = getPackedElemType(InfoIter->second.Elem, Ctx);
+  unsigned int ElemSzInBits = ElemTy->getScalarSizeInBits();
+  unsigned int NumElems = VecSzInBits / ElemSzInBits;
+  auto *VecTy = FixedVectorType::get(ElemTy, NumElems);
+  auto *IntVecTy =
+      FixedVectorType::get(Type::getIntNTy(Ctx, ElemSzInBits), NumElems);
+  int64_t Imm = 0;
+  const MachineOperand &LastOp = MI.getOperand(MI.getNumExplicitOperands() - 1);
+  if (LastOp.isImm())
+    Imm = LastOp.getImm();
+
+  // Return the value of the register or memory operand at OpIndex as a value
+  // of type Ty, or nullptr if the register is not defined.
+  auto getOperandValue = [&](unsigned int OpIndex, Type *Ty) -> Value * {
+    if ((int)OpIndex == MemRefOpIndex) {
+      Value *Val = loadMemoryRefValue(MI, MemRefValue, OpIndex, Ty);
+      if (Val->getType() != Ty &&
+          Val->getType()->getPrimitiveSizeInBits() ==
+              Ty->getPrimitiveSizeInBits())
+        Val = Builder.CreateBitCast(Val, Ty);
+      return (Val->getType() == Ty) ? Val : nullptr;
+    }
+    const MachineOperand &MO = MI.getOperand(OpIndex);
+    assert(MO.isReg() && "Expected register operand of packed instruction");
+    Value *Val = getRegOrArgValue(MO.getReg(), MBBNo);
+    if (Val == nullptr)
+      return nullptr;
+    return raisedValues->reinterpretSSERegValue(Val, Ty, RaisedBB);
+  };
+
+  if (IsStore) {
+    assert(Op == PackedOp::Move && "Unexpected packed store instruction");
+    Value *Val = getOperandValue(DataOpIndex, VecTy);
+    if (Val == nullptr) {
+      LLVM_DEBUG(MI.dump());
+      LLVM_DEBUG(dbgs() << "Unable to find value of packed store operand\n");
+      return false;
+    }
+    Value *Ptr = raisedValues->castValue(MemRefValue, VecTy->getPointerTo(),
+                                         RaisedBB);
+    StoreInst *Store = Builder.CreateAlignedStore(Val, Ptr, Align());
+    // Non-temporal stores bypass the cache
+    if (instrNameStartsWith(MI, "MOVNT") || instrNameStartsWith(MI, "VMOVNT"))
+      Store->setMetadata(LLVMContext::MD_nontemporal,
+                         MDNode::get(Ctx, ConstantAsMetadata::get(
+                                              Builder.getInt32(1))));
+    return true;
+  }
+
+  Register DstReg = MI.getOperand(0).getReg();
+  // Source operands of instructions with two sources follow the destination.
+  // Instructions with a single source only have the first.
+  unsigned int Src1Index = 1, Src2Index = 2;
+  Value *Result = nullptr;
+
+  // Instructions with identical register sources that are idioms for
+  // setting a register to all zeros or ones do not use the value of their
+  // sources.
+  bool SameRegSources =
+      (MemRefOpIndex == -1) && (MI.getNumExplicitOperands() > Src2Index) &&
+      MI.getOperand(Src2Index).isReg() &&
+      (MI.getOperand(Src1Index).getReg() == MI.getOperand(Src2Index).getReg());
+  if (SameRegSources) {
+    switch (Op) {
+    case PackedOp::Xor:
+    case PackedOp::AndNot:
+    case PackedOp::Sub:
+    case PackedOp::SubSatS:
+    case PackedOp::SubSatU:
+    case PackedOp::CmpGt:
+      Result = Constant::getNullValue(IntVecTy);
+      break;
+    case PackedOp::CmpEq:
+      Result = Constant::getAllOnesValue(IntVecTy);
+      break;
+    default:
+      break;
+    }
+  }
+
+  if (Result == nullptr) {
+    switch (Op) {
+    case PackedOp::Move:
+      Result = getOperandValue(Src1Index, VecTy);
+      break;
+    case PackedOp::Broadcast: {
+      Value *Elem;
+      if (MemRefOpIndex == -1) {
+        // The source register holds the element in its lowest lane
+        Value *Src = getOperandValue(Src1Index, VecTy);
+        Elem = (Src == nullptr) ? nullptr : Builder.CreateExtractElement(
+                                                Src, Builder.getInt64(0));
+      } else {
+        Elem = getOperandValue(Src1Index, ElemTy);
+      }
+      if (Elem != nullptr)
+        Result = Builder.CreateVectorSplat(NumElems, Elem);
+    } break;
+    case PackedOp::Extract128: {
+      // The source is a ymm register, the destination an xmm register
+      Value *Src = getOperandValue(Src1Index, VecTy);
+      if (Src == nullptr)
+        break;
+      SmallVector<int, 8> Mask;
+      for (unsigned int I = 0; I < NumElems / 2; I++)
+        Mask.push_back((Imm & 1) * (NumElems / 2) + I);
+      Result = Builder.CreateShuffleVector(Src, Mask);
+    } break;
+    case PackedOp::Insert128: {
+      Value *Src1 = getOperandValue(Src1Index, VecTy);
+      Value *Src2 = getOperandValue(
+          Src2Index, FixedVectorType::get(ElemTy, NumElems / 2));
+      if ((Src1 == nullptr) || (Src2 == nullptr))
+        break;
+      SmallVector<int, 8> WidenMask, Mask;
+      for (unsigned int I = 0; I < NumElems; I++) {
+        WidenMask.push_back((I < NumElems / 2) ? I : -1);
+        Mask.push_back(((I / (NumElems / 2)) == (Imm & 1))
+                           ? NumElems + (I % (NumElems / 2))
+                           : I);
+      }
+      Value *WideSrc2 = Builder.CreateShuffleVector(Src2, WidenMask);
+      Result = Builder.CreateShuffleVector(Src1, WideSrc2, Mask);
+    } break;
+    case PackedOp::FSqrt:
+    case PackedOp::Abs: {
+      Value *Src = getOperandValue(Src1Index, VecTy);
+      if (Src == nullptr)
+        break;
+      if (Op == PackedOp::FSqrt)
+        Result = Builder.CreateUnaryIntrinsic(Intrinsic::sqrt, Src);
+      else
+        Result = Builder.CreateBinaryIntrinsic(Intrinsic::abs, Src,
+                                               Builder.getFalse());
+    } break;
+    case PackedOp::ShlImm:
+    case PackedOp::LShrImm:
+    case PackedOp::AShrImm: {
+      Value *Src = getOperandValue(Src1Index, VecTy);
+      if (Src == nullptr)
+        break;
+      // Logical shifts by the element size or more clear all bits, while
+      // arithmetic shifts fill elements with their sign bits.
+      if ((uint64_t)Imm >= ElemSzInBits) {
+        if (Op != PackedOp::AShrImm) {
+          Result = Constant::getNullValue(VecTy);
+          break;
+        }
+        Imm = ElemSzInBits - 1;
+      }
+      Value *Amt = ConstantInt::get(VecTy, Imm);
+      if (Op == PackedOp::ShlImm)
+        Result = Builder.CreateShl(Src, Amt);
+      else if (Op == PackedOp::LShrImm)
+        Result = Builder.CreateLShr(Src, Amt);
+      else
+        Result = Builder.CreateAShr(Src, Amt);
+    } break;
+    case PackedOp::ShuffleD: {
+      // Each element of a lane is selected from that lane by 2 bits of Imm
+      Value *Src = getOperandValue(Src1Index, VecTy);
+      if (Src == nullptr)
+        break;
+      SmallVector<int, 8> Mask;
+      for (unsigned int I = 0; I < NumElems; I++)
+        Mask.push_back((I & ~3U) + ((Imm >> ((I % 4) * 2)) & 3));
+      Result = Builder.CreateShuffleVector(Src, Mask);
+    } break;
+    case PackedOp::Permute: {
+      // Each quadword is selected from all of the source by 2 bits of Imm
+      Value *Src = getOperandValue(Src1Index, VecTy);
+      if (Src == nullptr)
+        break;
+      SmallVector<int, 4> Mask;
+      for (unsigned int I = 0; I < NumElems; I++)
+        Mask.push_back((Imm >> (I * 2)) & 3);
+      Result = Builder.CreateShuffleVector(Src, Mask);
+    } break;
+    case PackedOp::PermuteVar: {
+      // Each element of the second source is selected by the low 3 bits of
+      // the corresponding element of the first.
+      Value *Indices = getOperandValue(Src1Index, IntVecTy);
+      Value *Src = getOperandValue(Src2Index, VecTy);
+      if ((Indices == nullptr) || (Src == nullptr))
+        break;
+      Indices =
+          Builder.CreateAnd(Indices, ConstantInt::get(IntVecTy, NumElems - 1));
+      Result = UndefValue::get(VecTy);
+      for (unsigned int I = 0; I < NumElems; I++) {
+        Value *Index = Builder.CreateExtractElement(Indices, I);
+        Result = Builder.CreateInsertElement(
+            Result, Builder.CreateExtractElement(Src, Index), I);
+      }
+    } break;
+    case PackedOp::Permute2x128: {
+      // Each 128-bit lane is selected from the four lanes of the sources by
+      // the low 2 bits of a nibble of Imm, or cleared if bit 3 of the nibble
+      // is set.
+      Value *Src1 = getOperandValue(Src1Index, VecTy);
+      Value *Src2 = getOperandValue(Src2Index, VecTy);
+      if ((Src1 == nullptr) || (Src2 == nullptr))
+        break;
+      unsigned int LaneElems = NumElems / 2;
+      SmallVector<int, 4> Mask, ZeroMask;
+      bool ClearsLane = false;
+      for (unsigned int I = 0; I < NumElems; I++) {
+        int64_t Sel = Imm >> ((I / LaneElems) * 4);
+        bool Clear = (Sel & 8) != 0;
+        ClearsLane |= Clear;
+        Mask.push_back(Clear ? -1 : (Sel & 3) * LaneElems + I % LaneElems);
+        ZeroMask.push_back(Clear ? NumElems + I : I);
+      }
+      Result = Builder.CreateShuffleVector(Src1, Src2, Mask);
+      if (ClearsLane)
+        Result = Builder.CreateShuffleVector(
+            Result, Constant::getNullValue(VecTy), ZeroMask);
+    } break;
+    case PackedOp::MoveMask: {
+      // Gather the sign bits of the elements of the source into the low bits
+      // of the destination general purpose register.
+      Value *Src = getOperandValue(Src1Index, IntVecTy);
+      if (Src == nullptr)
+        break;
+      Value *Signs =
+          Builder.CreateICmpSLT(Src, Constant::getNullValue(IntVecTy));
+      Value *Bits = Builder.CreateBitCast(Signs, Builder.getIntNTy(NumElems));
+      Result = Builder.CreateZExt(Bits, getPhysRegType(DstReg));
+    } break;
+    default: {
+      // Remaining operations have two sources
+      Value *Src1 = getOperandValue(Src1Index, VecTy);
+      Value *Src2 = getOperandValue(Src2Index, VecTy);
+      if ((Src1 == nullptr) || (Src2 == nullptr))
+        break;
+      switch (Op) {
+      case PackedOp::FAdd:
+        Result = Builder.CreateFAdd(Src1, Src2);
+        break;
+      case PackedOp::FSub:
+        Result = Builder.CreateFSub(Src1, Src2);
+        break;
+      case PackedOp::FMul:
+        Result = Builder.CreateFMul(Src1, Src2);
+        break;
+      case PackedOp::FDiv:
+        Result = Builder.CreateFDiv(Src1, Src2);
+        break;
+      // MIN and MAX return the second source if either source is NaN or both
+      // are zeros, which is what selecting on an ordered compare does.
+      case PackedOp::FMin:
+        Result = Builder.CreateSelect(Builder.CreateFCmpOLT(Src1, Src2), Src1,
+                                      Src2);
+        break;
+      case PackedOp::FMax:
+        Result = Builder.CreateSelect(Builder.CreateFCmpOGT(Src1, Src2), Src1,
+                                      Src2);
+        break;
+      case PackedOp::FCmp:
+        Result = Builder.CreateSExt(
+            Builder.CreateFCmp(getPackedFCmpPredicate(Imm), Src1, Src2),
+            IntVecTy);
+        break;
+      case PackedOp::Add:
+        Result = Builder.CreateAdd(Src1, Src2);
+        break;
+      case PackedOp::Sub:
+        Result = Builder.CreateSub(Src1, Src2);
+        break;
+      case PackedOp::MulLo:
+        Result = Builder.CreateMul(Src1, Src2);
+        break;
+      case PackedOp::AddSatS:
+        Result = Builder.CreateBinaryIntrinsic(Intrinsic::sadd_sat, Src1, Src2);
+        break;
+      case PackedOp::AddSatU:
+        Result = Builder.CreateBinaryIntrinsic(Intrinsic::uadd_sat, Src1, Src2);
+        break;
+      case PackedOp::SubSatS:
+        Result = Builder.CreateBinaryIntrinsic(Intrinsic::ssub_sat, Src1, Src2);
+        break;
+      case PackedOp::SubSatU:
+        Result = Builder.CreateBinaryIntrinsic(Intrinsic::usub_sat, Src1, Src2);
+        break;
+      case PackedOp::SMin:
+        Result = Builder.CreateBinaryIntrinsic(Intrinsic::smin, Src1, Src2);
+        break;
+      case PackedOp::SMax:
+        Result = Builder.CreateBinaryIntrinsic(Intrinsic::smax, Src1, Src2);
+        break;
+      case PackedOp::UMin:
+        Result = Builder.CreateBinaryIntrinsic(Intrinsic::umin, Src1, Src2);
+        break;
+      case PackedOp::UMax:
+        Result = Builder.CreateBinaryIntrinsic(Intrinsic::umax, Src1, Src2);
+        break;
+      case PackedOp::CmpEq:
+        Result = Builder.CreateSExt(Builder.CreateICmpEQ(Src1, Src2), VecTy);
+        break;
+      case PackedOp::CmpGt:
+        Result = Builder.CreateSExt(Builder.CreateICmpSGT(Src1, Src2), VecTy);
+        break;
+      case PackedOp::And:
+        Result = Builder.CreateAnd(Src1, Src2);
+        break;
+      case PackedOp::AndNot:
+        Result = Builder.CreateAnd(Builder.CreateNot(Src1), Src2);
+        break;
+      case PackedOp::Or:
+        Result = Builder.CreateOr(Src1, Src2);
+        break;
+      case PackedOp::Xor:
+        Result = Builder.CreateXor(Src1, Src2);
+        break;
+      case PackedOp::ShlVar:
+      case PackedOp::LShrVar: {
+        // Logical shifts by the element size or more clear the element
+        Value *InRange =
+            Builder.CreateICmpULT(Src2, ConstantInt::get(VecTy, ElemSzInBits));
+        Value *Shifted = (Op == PackedOp::ShlVar)
+                             ? Builder.CreateShl(Src1, Src2)
+                             : Builder.CreateLShr(Src1, Src2);
+        Result = Builder.CreateSelect(InRange, Shifted,
+                                      Constant::getNullValue(VecTy));
+      } break;
+      case PackedOp::AShrVar:
+        // Arithmetic shifts by the element size or more fill the element
+        // with its sign bit.
+        Result = Builder.CreateAShr(
+            Src1, Builder.CreateBinaryIntrinsic(
+                      Intrinsic::umin, Src2,
+                      ConstantInt::get(VecTy, ElemSzInBits - 1)));
+        break;
+      case PackedOp::ByteShuffle: {
+        // Each byte of a lane of the first source is selected from that
+        // lane by the low 4 bits of the corresponding byte of the second,
+        // or cleared if the sign bit of that byte is set.
+        SmallVector<Constant *, 32> LaneBases;
+        for (unsigned int I = 0; I < NumElems; I++)
+          LaneBases.push_back(Builder.getInt8(I & ~15U));
+        Value *Indices = Builder.CreateAnd(Src2, ConstantInt::get(VecTy, 15));
+        Indices = Builder.CreateOr(Indices, ConstantVector::get(LaneBases));
+        Value *Bytes = UndefValue::get(VecTy);
+        for (unsigned int I = 0; I < NumElems; I++) {
+          Value *Index = Builder.CreateExtractElement(Indices, I);
+          Bytes = Builder.CreateInsertElement(
+              Bytes, Builder.CreateExtractElement(Src1, Index), I);
+        }
+        Value *Clear =
+            Builder.CreateICmpSLT(Src2, Constant::getNullValue(VecTy));
+        Result = Builder.CreateSelect(Clear, Constant::getNullValue(VecTy),
+                                      Bytes);
+      } break;
+      case PackedOp::Shuffle: {
+        // The low half of each lane is selected from the first source and
+        // the high half from the second, by log2(elements per lane) bits of
+        // Imm each.
+        unsigned int LaneElems = 128 / ElemSzInBits;
+        unsigned int SelBits = (LaneElems == 4) ? 2 : 1;
+        SmallVector<int, 8> Mask;
+        for (unsigned int I = 0; I < NumElems; I++) {
+          unsigned int Lane = I / LaneElems, Pos = I % LaneElems;
+          unsigned int SelIndex = (LaneElems == 4) ? Pos : I;
+          int Sel = (Imm >> (SelIndex * SelBits)) & (LaneElems - 1);
+          int Base = (Pos < LaneElems / 2) ? 0 : NumElems;
+          Mask.push_back(Base + Lane * LaneElems + Sel);
+        }
+        Result = Builder.CreateShuffleVector(Src1, Src2, Mask);
+      } break;
+      case PackedOp::UnpackLo:
+      case PackedOp::UnpackHi: {
+        // Interleave the elements of the low or high halves of each lane of
+        // the sources.
+        unsigned int LaneElems = 128 / ElemSzInBits;
+        unsigned int Half = (Op == PackedOp::UnpackLo) ? 0 : LaneElems / 2;
+        SmallVector<int, 32> Mask;
+        for (unsigned int Lane = 0; Lane < NumElems / LaneElems; Lane++)
+          for (unsigned int I = 0; I < LaneElems / 2; I++) {
+            Mask.push_back(Lane * LaneElems + Half + I);
+            Mask.push_back(NumElems + Lane * LaneElems + Half + I);
+          }
+        Result = Builder.CreateShuffleVector(Src1, Src2, Mask);
+      } break;
+      default:
+        llvm_unreachable("Unhandled packed operation");
+      }
+    } break;
+    }
+  }
+
+  if (Result == nullptr) {
+    LLVM_DEBUG(MI.dump());
+    LLVM_DEBUG(dbgs() << "Unable to find values of packed instruction "
+                         "operands\n");
+    return false;
+  }
+  raisedValues->setPhysRegSSAValue(DstReg, MBBNo, Result);
+  return true;
+}
+
+// Return the xmm register written by MI if MI is a legacy (i.e., not VEX
+// encoded) SSE instruction of a function that uses ymm registers; NoRegister
+// otherwise. Values of ymm registers are tracked with those of their xmm
+// sub-registers, and values narrower than the ymm register are zero-extended
+// when it is read, as VEX encoded instructions writing an xmm register clear
+// bits 255:128 of its ymm register. Legacy SSE instructions leave them
+// unchanged instead.
+unsigned int
+X86MachineInstructionRaiser::getLegacySSEDefReg(const MachineInstr &MI) {
+  const MCInstrDesc &MIDesc = MI.getDesc();
+  if (((MIDesc.TSFlags & X86II::EncodingMask) != X86II::Legacy) ||
+      (MIDesc.getNumDefs() == 0) || !MI.getOperand(0).isReg())
+    return X86::NoRegister;
+  unsigned int DefReg = MI.getOperand(0).getReg();
+  if (!isSSE2Reg(DefReg) || is256BitSSE2Reg(DefReg) ||
+      (getSSERegSlotType()->getPrimitiveSizeInBits() != 256))
+    return X86::NoRegister;
+  return DefReg;
+}
+
+// Merge bits 255:128 of PrevYMMVal, the value of the ymm register of XMMReg
+// before it was written by a legacy SSE instruction, into the value written.
+void X86MachineInstructionRaiser::mergeUpperYMMHalf(unsigned int XMMReg,
+                                                    int MBBNo,
+                                                    Value *PrevYMMVal) {
+  unsigned int YMMReg = X86::NoRegister;
+  for (MCSuperRegIterator SuperReg(XMMReg, x86RegisterInfo);
+       SuperReg.isValid(); ++SuperReg)
+    if (is256BitSSE2Reg(*SuperReg))
+      YMMReg = *SuperReg;
+  Value *NewVal = getRegOrArgValue(XMMReg, MBBNo);
+  if ((YMMReg == X86::NoRegister) || (NewVal == nullptr))
+    return;
+
+  BasicBlock *RaisedBB = getRaisedBasicBlock(MF.getBlockNumbered(MBBNo));
+  Type *YMMTy = getSSERegSlotType();
+  Value *NewYMMVal =
+      raisedValues->reinterpretSSERegValue(NewVal, YMMTy, RaisedBB);
+  Value *OldYMMVal =
+      raisedValues->reinterpretSSERegValue(PrevYMMVal, YMMTy, RaisedBB);
+  // The low 4 elements of the <8 x i32> slot type hold bits 127:0.
+  IRBuilder<> Builder(RaisedBB);
+  Value *Merged = Builder.CreateShuffleVector(NewYMMVal, OldYMMVal,
+                                              {0, 1, 2, 3, 12, 13, 14, 15});
+  raisedValues->setPhysRegSSAValue(YMMReg, MBBNo, Merged);
+}
+
+#undef DEBUG_TYPE
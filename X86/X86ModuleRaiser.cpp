@@ -12,6 +12,10 @@
 //===----------------------------------------------------------------------===//
 
 #include "X86ModuleRaiser.h"
+#include "X86AdditionalInstrInfo.h"
+#include "X86MachineInstructionRaiser.h"
+#include "llvm/MC/MCInst.h"
+#include "llvm/MC/MCInstrInfo.h"
 #include "llvm/Object/ELFObjectFile.h"
 
 using namespace llvm;
@@ -34,6 +38,43 @@ bool X86ModuleRaiser::collectDynamicRelocations() {
   return true;
 }
 
+// Classify Inst the way X86MachineInstructionRaiser dispatches the
+// corresponding MachineInstr: by the raiser of its instruction kind, separately
+// for memory referencing instructions.
+ModuleRaiser::InstrSupport
+X86ModuleRaiser::classifyInstruction(const MCInst &Inst) const {
+  unsigned int Opcode = Inst.getOpcode();
+  const MCInstrDesc &Desc = MII->get(Opcode);
+
+  // Padding and ENDBR instructions are not raised. Calls, returns and
+  // branches are raised by dedicated handlers.
+  if (isNoop(Opcode) || (Opcode == X86::INT3) || (Opcode == X86::ENDBR32) ||
+      (Opcode == X86::ENDBR64))
+    return InstrSupport::Supported;
+  if (Desc.isCall() || Desc.isReturn() || Desc.isTerminator())
+    return InstrSupport::Supported;
+
+  InstructionKind Kind = getInstructionKind(Opcode);
+  bool IsMemRef = Desc.mayLoad() || Desc.mayStore();
+  if (IsMemRef && (Kind != InstructionKind::STRING_OP) &&
+      (Kind != InstructionKind::FENCE)) {
+    StringRef Name = MII->getName(Opcode);
+    if (Name.startswith("PUSH") || Name.startswith("ENTER") ||
+        Name.startswith("POP") || Name.startswith("LEAVE") || Desc.isCompare())
+      return InstrSupport::Supported;
+    // Locked instructions are raised as atomic read-modify-write operations
+    if ((Inst.getFlags() & X86::IP_HAS_LOCK) &&
+        (Kind != InstructionKind::ATOMIC_MEM_OP))
+      return X86MachineInstructionRaiser::isRaisedLockedMemOp(Name)
+                 ? InstrSupport::Supported
+                 : InstrSupport::Unsupported;
+  }
+
+  return (X86MachineInstructionRaiser::getKindRaiser(Kind, IsMemRef) != nullptr)
+             ? InstrSupport::Supported
+             : InstrSupport::Unsupported;
+}
+
 void registerX86ModuleRaiser() {
   registerModuleRaiser(new X86ModuleRaiser());
 }
@@ -362,9 +362,9 @@ Value *X86RaisedValueTracker::getReachingDef(unsigned int PhysReg, int MBBNo,
           AllocTy = Ty;
       } else if (RD.second->getType()->isFloatingPointTy() ||
                  RD.second->getType()->isVectorTy()) {
-        // We know that FP types are stored in a 128 bit stack slot, so we don't
-        // need to further process the reaching value list
-        AllocTy = VectorType::get(Type::getInt32Ty(Ctxt), 4, false);
+        // We know that FP types are stored in an SSE register sized stack
+        // slot, so we don't need to further process the reaching value list
+        AllocTy = X86MIRaiser->getSSERegSlotType();
         break;
       } else {
         HasUnknownReachingDef = true;
@@ -481,8 +481,11 @@ Value *X86RaisedValueTracker::getReachingDef(unsigned int PhysReg, int MBBNo,
       if (RegType != LdReachingValType) {
         auto *BB = X86MIRaiser->getRaisedBasicBlock(MF.getBlockNumbered(MBBNo));
         if (isSSE2Reg(PhysReg)) {
-          assert(LdReachingValType->getPrimitiveSizeInBits() == 128 &&
-                 "Expected FP/vector types to be stored in 128 bit stack slot");
+          assert(LdReachingValType->getPrimitiveSizeInBits() ==
+                     X86MIRaiser->getSSERegSlotType()
+                         ->getPrimitiveSizeInBits() &&
+                 "Expected FP/vector types to be stored in SSE register sized "
+                 "stack slot");
         } else {
           // Create cast instruction
           Instruction *CInst = CastInst::Create(
@@ -94,6 +94,10 @@ bool X86RegisterUtils::is64BitSSE2Reg(unsigned int PReg) {
   return X86MCRegisterClasses[X86::FR64RegClassID].contains(PReg);
 }
 
+bool X86RegisterUtils::is256BitSSE2Reg(unsigned int PReg) {
+  return X86MCRegisterClasses[X86::VR256RegClassID].contains(PReg);
+}
+
 bool X86RegisterUtils::is64BitPhysReg(unsigned int PReg) {
   return X86MCRegisterClasses[X86::GR64RegClassID].contains(PReg);
 }
@@ -111,6 +115,8 @@ bool X86RegisterUtils::is8BitPhysReg(unsigned int PReg) {
 }
 
 unsigned int X86RegisterUtils::getPhysRegSizeInBits(unsigned int PReg) {
+  if (X86RegisterUtils::is256BitSSE2Reg(PReg))
+    return 256;
   if (X86RegisterUtils::is64BitPhysReg(PReg) || X86RegisterUtils::is64BitSSE2Reg(PReg))
     return 64;
   if (X86RegisterUtils::is32BitPhysReg(PReg) || X86RegisterUtils::is32BitSSE2Reg(PReg))
@@ -126,7 +132,8 @@ unsigned int X86RegisterUtils::getPhysRegSizeInBits(unsigned int PReg) {
 }
 
 bool X86RegisterUtils::isSSE2Reg(unsigned int PReg) {
-  return (X86RegisterUtils::is32BitSSE2Reg(PReg) || X86RegisterUtils::is64BitSSE2Reg(PReg));
+  return (X86RegisterUtils::is32BitSSE2Reg(PReg) || X86RegisterUtils::is64BitSSE2Reg(PReg) ||
+          X86RegisterUtils::is256BitSSE2Reg(PReg));
 }
 
 bool X86RegisterUtils::isGPReg(unsigned int PReg) {
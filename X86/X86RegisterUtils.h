@@ -66,6 +66,7 @@ bool is16BitPhysReg(unsigned int PReg);
 bool is8BitPhysReg(unsigned int PReg);
 bool is32BitSSE2Reg(unsigned int PReg);
 bool is64BitSSE2Reg(unsigned int PReg);
+bool is256BitSSE2Reg(unsigned int PReg);
 bool isGPReg(unsigned int PReg);
 bool isSSE2Reg(unsigned int PReg);
 unsigned getPhysRegSizeInBits(unsigned int PReg);
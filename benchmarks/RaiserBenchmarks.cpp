@@ -0,0 +1,335 @@
+//===-- RaiserBenchmarks.cpp ------------------------------------*- C++ -*-===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+//
+// This file contains microbenchmarks of the building blocks of the raiser.
+// Each benchmark drives a single component on synthetic input so that it is
+// measured in isolation from decoding and from the rest of the raising
+// pipeline.
+//
+//===----------------------------------------------------------------------===//
+
+#include "MCTargetDesc/X86MCTargetDesc.h"
+#include "Raiser/FunctionFilter.h"
+#include "Raiser/MachineFunctionRaiser.h"
+#include "X86AdditionalInstrInfo.h"
+#include "X86MachineInstructionRaiser.h"
+#include "X86ModuleRaiser.h"
+#include "X86RaisedValueTracker.h"
+#include "benchmark/benchmark.h"
+#include "llvm/CodeGen/MachineModuleInfo.h"
+#include "llvm/IR/LLVMContext.h"
+#include "llvm/IR/Module.h"
+#include "llvm/MC/MCInstBuilder.h"
+#include "llvm/MC/MCInstrAnalysis.h"
+#include "llvm/MC/MCInstrInfo.h"
+#include "llvm/MC/MCRegisterInfo.h"
+#include "llvm/MC/TargetRegistry.h"
+#include "llvm/Support/ErrorHandling.h"
+#include "llvm/Support/TargetSelect.h"
+#include "llvm/Target/TargetMachine.h"
+#include "llvm/Target/TargetOptions.h"
+#include <memory>
+#include <set>
+#include <vector>
+
+using namespace llvm;
+using namespace llvm::mctoll;
+
+namespace {
+
+const char *const TripleName = "x86_64-unknown-linux-gnu";
+
+// Target information shared by all benchmarks.
+struct X86TargetInfo {
+  std::unique_ptr<TargetMachine> TM;
+  std::unique_ptr<const MCInstrInfo> MII;
+  std::unique_ptr<const MCRegisterInfo> MRI;
+  std::unique_ptr<const MCInstrAnalysis> MIA;
+
+  X86TargetInfo() {
+    LLVMInitializeX86TargetInfo();
+    LLVMInitializeX86Target();
+    LLVMInitializeX86TargetMC();
+
+    std::string Error;
+    const Target *TheTarget = TargetRegistry::lookupTarget(TripleName, Error);
+    if (TheTarget == nullptr)
+      report_fatal_error(Twine(Error));
+    TM.reset(TheTarget->createTargetMachine(TripleName, "", "",
+                                            TargetOptions(), None));
+    MII.reset(TheTarget->createMCInstrInfo());
+    MRI.reset(TheTarget->createMCRegInfo(TripleName));
+    MIA.reset(TheTarget->createMCInstrAnalysis(MII.get()));
+  }
+
+  static X86TargetInfo &get() {
+    static X86TargetInfo Info;
+    return Info;
+  }
+};
+
+// A sequence of instructions of a synthetic function along with the size of
+// each instruction.
+using InstSequence = std::vector<std::pair<MCInst, uint64_t>>;
+
+// Instruction sizes used to lay out synthetic functions.
+constexpr uint64_t MovSize = 5;
+constexpr uint64_t TestSize = 2;
+constexpr uint64_t JccSize = 6;
+constexpr uint64_t JmpSize = 5;
+constexpr uint64_t RetSize = 1;
+
+void addMov(InstSequence &Insts, unsigned Reg, int64_t Imm) {
+  Insts.emplace_back(MCInstBuilder(X86::MOV32ri).addReg(Reg).addImm(Imm),
+                     MovSize);
+}
+
+void addTest(InstSequence &Insts, unsigned Reg) {
+  Insts.emplace_back(MCInstBuilder(X86::TEST32rr).addReg(Reg).addReg(Reg),
+                     TestSize);
+}
+
+void addJcc(InstSequence &Insts, int64_t Rel, X86::CondCode CC) {
+  Insts.emplace_back(MCInstBuilder(X86::JCC_4).addImm(Rel).addImm(CC),
+                     JccSize);
+}
+
+void addJmp(InstSequence &Insts, int64_t Rel) {
+  Insts.emplace_back(MCInstBuilder(X86::JMP_4).addImm(Rel), JmpSize);
+}
+
+void addRet(InstSequence &Insts) {
+  Insts.emplace_back(MCInstBuilder(X86::RET64), RetSize);
+}
+
+// A chain of NumDiamonds if-then constructs. Each construct conditionally
+// defines EAX, giving a deep CFG with two blocks per construct.
+InstSequence buildDeepFunction(unsigned NumDiamonds) {
+  InstSequence Insts;
+  for (unsigned Idx = 0; Idx < NumDiamonds; Idx++) {
+    addTest(Insts, X86::EDI);
+    addJcc(Insts, MovSize, X86::COND_E);
+    addMov(Insts, X86::EAX, Idx);
+  }
+  addRet(Insts);
+  return Insts;
+}
+
+// A cascade of NumCases conditional branches, each to a block that defines
+// EAX and jumps to a common exit block. This gives a wide CFG whose exit
+// block has NumCases + 1 predecessors.
+InstSequence buildWideFunction(unsigned NumCases) {
+  InstSequence Insts;
+  const uint64_t DispatchSize = NumCases * (TestSize + JccSize) + JmpSize;
+  const uint64_t CaseSize = MovSize + JmpSize;
+  const uint64_t ExitStart = DispatchSize + NumCases * CaseSize;
+  for (unsigned Idx = 0; Idx < NumCases; Idx++) {
+    uint64_t JccEnd = (Idx + 1) * (TestSize + JccSize);
+    uint64_t CaseStart = DispatchSize + Idx * CaseSize;
+    addTest(Insts, X86::ESI);
+    addJcc(Insts, CaseStart - JccEnd, X86::COND_E);
+  }
+  addJmp(Insts, ExitStart - DispatchSize);
+  for (unsigned Idx = 0; Idx < NumCases; Idx++) {
+    uint64_t CaseEnd = DispatchSize + (Idx + 1) * CaseSize;
+    addMov(Insts, X86::EAX, Idx);
+    addJmp(Insts, ExitStart - CaseEnd);
+  }
+  addRet(Insts);
+  return Insts;
+}
+
+// Module raiser not associated with any object file. Functions are added
+// from instruction sequences, recording instructions and branch targets the
+// same way as is done while decoding a text section.
+class SyntheticModuleRaiser : public X86ModuleRaiser {
+public:
+  SyntheticModuleRaiser() : Mod("bench", Ctx), NextFuncStart(0) {
+    X86TargetInfo &Info = X86TargetInfo::get();
+    Mod.setDataLayout(Info.TM->createDataLayout());
+    MMIWP = std::make_unique<MachineModuleInfoWrapperPass>(
+        static_cast<const LLVMTargetMachine *>(Info.TM.get()));
+    MMIWP->doInitialization(Mod);
+    setModuleRaiserInfo(&Mod, Info.TM.get(), &MMIWP->getMMI(), Info.MIA.get(),
+                        Info.MII.get(), Info.MRI.get(), nullptr, nullptr,
+                        nullptr);
+  }
+
+  ~SyntheticModuleRaiser() override {
+    for (auto *MFR : MFRaiserVector) {
+      delete MFR->getMachineInstrRaiser();
+      delete MFR;
+    }
+  }
+
+  MachineFunctionRaiser *addFunction(StringRef Name,
+                                     const InstSequence &Insts) {
+    uint64_t Start = NextFuncStart;
+    uint64_t End = Start;
+    for (auto &InstAndSize : Insts)
+      End += InstAndSize.second;
+    NextFuncStart = End;
+
+    FunctionType *FTy = FunctionType::get(Type::getVoidTy(Ctx), false);
+    Function *Func =
+        Function::Create(FTy, GlobalValue::ExternalLinkage, Name, &Mod);
+    MachineFunctionRaiser *MFR =
+        CreateAndAddMachineFunctionRaiser(Func, this, Start, End);
+    MCInstRaiser *MCIR = MFR->getMCInstRaiser();
+
+    std::set<uint64_t> BranchTargets = {Start};
+    uint64_t Index = Start;
+    for (auto &InstAndSize : Insts) {
+      const MCInst &Inst = InstAndSize.first;
+      uint64_t Size = InstAndSize.second;
+      MCIR->addMCInstOrData(Index, Inst);
+      if (MIA->isBranch(Inst)) {
+        uint64_t Target;
+        if (MIA->evaluateBranch(Inst, Index, Size, Target))
+          BranchTargets.insert(Target);
+        if (Index + Size < End)
+          BranchTargets.insert(Index + Size);
+      }
+      Index += Size;
+    }
+    for (auto Target : BranchTargets)
+      MCIR->addTarget(Target);
+    return MFR;
+  }
+
+  // Build the CFG of the function raised by MFR.
+  void buildCFG(MachineFunctionRaiser *MFR) {
+    MFR->getMCInstRaiser()->buildCFG(MFR->getMachineFunction(), MIA, MII);
+  }
+
+private:
+  LLVMContext Ctx;
+  Module Mod;
+  std::unique_ptr<MachineModuleInfoWrapperPass> MMIWP;
+  uint64_t NextFuncStart;
+};
+
+// Return the number of the block ending with a return instruction.
+int getReturnBlockNumber(MachineFunction &MF) {
+  for (MachineBasicBlock &MBB : MF)
+    if (!MBB.empty() && MBB.back().isReturn())
+      return MBB.getNumber();
+  llvm_unreachable("Synthetic function without return block");
+}
+
+void BM_BuildCFG(benchmark::State &State) {
+  InstSequence Insts = buildDeepFunction(State.range(0));
+  for (auto _ : State) {
+    State.PauseTiming();
+    auto MR = std::make_unique<SyntheticModuleRaiser>();
+    MachineFunctionRaiser *MFR = MR->addFunction("deep", Insts);
+    State.ResumeTiming();
+
+    MR->buildCFG(MFR);
+
+    State.PauseTiming();
+    MR.reset();
+    State.ResumeTiming();
+  }
+  State.SetItemsProcessed(State.iterations() * Insts.size());
+}
+BENCHMARK(BM_BuildCFG)->RangeMultiplier(4)->Range(256, 16384);
+
+void BM_GetRaisedFunctionPrototype(benchmark::State &State) {
+  InstSequence Insts = buildWideFunction(State.range(0));
+  for (auto _ : State) {
+    State.PauseTiming();
+    auto MR = std::make_unique<SyntheticModuleRaiser>();
+    MachineFunctionRaiser *MFR = MR->addFunction("wide", Insts);
+    MR->buildCFG(MFR);
+    State.ResumeTiming();
+
+    benchmark::DoNotOptimize(
+        MFR->getMachineInstrRaiser()->getRaisedFunctionPrototype());
+
+    State.PauseTiming();
+    MR.reset();
+    State.ResumeTiming();
+  }
+  State.SetItemsProcessed(State.iterations() * Insts.size());
+}
+BENCHMARK(BM_GetRaisedFunctionPrototype)->RangeMultiplier(4)->Range(64, 4096);
+
+// Query reaching definitions of RAX, which is defined along some paths, and
+// of RCX, which is not defined in the function, at the return block of
+// the function built by BuildFn.
+template <InstSequence (*BuildFn)(unsigned)>
+void BM_GetGlobalReachingDefs(benchmark::State &State) {
+  SyntheticModuleRaiser MR;
+  MachineFunctionRaiser *MFR = MR.addFunction("func", BuildFn(State.range(0)));
+  MR.buildCFG(MFR);
+  auto *X86MIR =
+      static_cast<X86MachineInstructionRaiser *>(MFR->getMachineInstrRaiser());
+  X86MIR->getRaisedFunctionPrototype();
+  X86RaisedValueTracker Tracker(X86MIR);
+  int RetMBBNo = getReturnBlockNumber(MFR->getMachineFunction());
+
+  for (auto _ : State) {
+    benchmark::DoNotOptimize(Tracker.getGlobalReachingDefs(X86::RAX, RetMBBNo));
+    benchmark::DoNotOptimize(Tracker.getGlobalReachingDefs(X86::RCX, RetMBBNo));
+  }
+  State.SetComplexityN(State.range(0));
+}
+BENCHMARK_TEMPLATE(BM_GetGlobalReachingDefs, buildDeepFunction)
+    ->RangeMultiplier(4)
+    ->Range(64, 4096)
+    ->Complexity();
+BENCHMARK_TEMPLATE(BM_GetGlobalReachingDefs, buildWideFunction)
+    ->RangeMultiplier(4)
+    ->Range(64, 4096)
+    ->Complexity();
+
+void BM_GetInstructionKind(benchmark::State &State) {
+  const MCInstrInfo &MII = *X86TargetInfo::get().MII;
+  std::vector<unsigned> Opcodes;
+  for (unsigned Opc = 0, E = MII.getNumOpcodes(); Opc < E; Opc++)
+    if (X86AddlInstrInfo.count(Opc))
+      Opcodes.push_back(Opc);
+
+  for (auto _ : State)
+    for (unsigned Opc : Opcodes)
+      benchmark::DoNotOptimize(getInstructionKind(Opc));
+  State.SetItemsProcessed(State.iterations() * Opcodes.size());
+}
+BENCHMARK(BM_GetInstructionKind);
+
+void BM_ParsePrototypeStr(benchmark::State &State) {
+  LLVMContext Ctx;
+  Module Mod("bench", Ctx);
+  FunctionFilter Filter(Mod);
+  const StringRef Prototypes[] = {
+      "i32 main(i32, i8**)",
+      "void free(i8*)",
+      "i8* memcpy(i8*, i8*, i64)",
+      "double pow(double, double)",
+      "i32 printf(i8*, ...)",
+      "ldouble fabsl(ldouble)",
+      "i64 strtol(i8*, i8**, i32)",
+      "void exit(void)",
+  };
+  FunctionFilter::FuncInfo Info;
+
+  for (auto _ : State) {
+    for (StringRef Prototype : Prototypes) {
+      if (!Filter.parsePrototypeStr(Prototype, Info))
+        State.SkipWithError("Failed to parse prototype");
+      benchmark::DoNotOptimize(Info.FuncType);
+    }
+  }
+  State.SetItemsProcessed(State.iterations() * array_lengthof(Prototypes));
+}
+BENCHMARK(BM_ParsePrototypeStr);
+
+} // namespace
+
+BENCHMARK_MAIN();
@@ -13,10 +13,15 @@
 #include "llvm-mctoll.h"
 #include "EmitRaisedOutputPass.h"
 #include "PeepholeOptimizationPass.h"
+#include "Raiser/AnalysisDatabase.h"
+#include "Raiser/BranchProfile.h"
+#include "Raiser/FunctionBoundaryDiscovery.h"
+#include "Raiser/FunctionDigests.h"
 #include "Raiser/IncludedFileInfo.h"
 #include "Raiser/MCInstOrData.h"
 #include "Raiser/MachineFunctionRaiser.h"
 #include "Raiser/ModuleRaiser.h"
+#include "Raiser/ReachableFunctions.h"
 #include "llvm/ADT/Optional.h"
 #include "llvm/ADT/STLExtras.h"
 #include "llvm/ADT/StringExtras.h"
@@ -37,6 +42,7 @@
 #include "llvm/IR/LegacyPassManager.h"
 #include "llvm/IR/Module.h"
 #include "llvm/IR/Type.h"
+#include "llvm/IRReader/IRReader.h"
 #include "llvm/MC/MCAsmInfo.h"
 #include "llvm/MC/MCContext.h"
 #include "llvm/MC/MCDisassembler/MCDisassembler.h"
@@ -73,7 +79,11 @@
 #include "llvm/Support/Signals.h"
 #include "llvm/Support/SourceMgr.h"
 #include "llvm/Support/TargetSelect.h"
+#include "llvm/Support/ThreadPool.h"
+#include "llvm/Support/Threading.h"
+#include "llvm/Support/TimeProfiler.h"
 #include "llvm/Support/ToolOutputFile.h"
+#include "llvm/Support/WithColor.h"
 #include "llvm/Support/raw_ostream.h"
 #include "llvm/Target/TargetMachine.h"
 #include "llvm/Target/TargetOptions.h"
@@ -81,6 +91,7 @@
 #include <cctype>
 #include <cstring>
 #include <fstream>
+#include <mutex>
 #include <set>
 #include <system_error>
 #include <unordered_map>
@@ -169,12 +180,49 @@ static bool HasStartAddressFlag;
 static uint64_t StopAddress = UINT64_MAX;
 static bool HasStopAddressFlag;
 
+/// Functions from which the functions to raise are reached
+static std::vector<std::string> Roots;
+
+/// Fold functions with identical code
+static bool ICF;
+
+/// Only decode and report a census of the functions to raise
+static bool Census;
+
+/// Allocate stack slots whose address is not taken separately
+static bool SplitStackFrame;
+
+/// Emit debug locations with the addresses of raised instructions
+static bool DebugAddresses;
+
+/// Handling of functions that fail to raise, and budgets for raising each
+static ModuleRaiser::FallbackKind Fallback = ModuleRaiser::FallbackKind::Abort;
+static unsigned FunctionTimeBudget;
+static unsigned FunctionMemoryBudget;
+
+/// File of analysis results recorded by earlier runs
+static std::string AnalysisDBFile;
+
+/// File of sampled branch execution counts of the input binary
+static std::string ProfileFile;
+
+/// Earlier version of the input binary and the module raised from it
+static std::string PreviousBinaryFile;
+static std::string PreviousModuleFile;
+
 /// String vector of include files to parse for external definitions
 std::vector<std::string> mctoll::IncludeFileNames;
 std::string mctoll::CompilationDBDir;
 
 static bool PrintImmHex;
 
+// Number of threads decoding text sections; 0 to use all hardware threads.
+static unsigned NumThreads;
+
+static bool TimeTrace;
+static unsigned TimeTraceGranularity = 500;
+static std::string TimeTraceFile;
+
 namespace {
 static ManagedStatic<std::vector<std::string>> RunPassNames;
 
@@ -243,8 +291,6 @@ private:
 SectionFilter toolSectionFilter(llvm::object::ObjectFile const &O) {
   return SectionFilter(
       [](llvm::object::SectionRef const &S) {
-        if (FilterSections.empty())
-          return true;
         llvm::StringRef String;
         if (auto NameOrErr = S.getName())
           String = *NameOrErr;
@@ -253,6 +299,12 @@ SectionFilter toolSectionFilter(llvm::object::ObjectFile const &O) {
           return false;
         }
 
+        // In addition to the specified sections, operate on .text and on the
+        // sections with code placed by the compiler or a post-link optimizer
+        // (e.g., .text.hot, .text.unlikely, .text.cold or .text.<function>
+        // with -ffunction-sections).
+        if (String == ".text" || String.startswith(".text."))
+          return true;
         return is_contained(FilterSections, String);
       },
       O);
@@ -701,6 +753,136 @@ static void initializeAllModuleRaisers() {
 #include "Raisers.def"
 }
 
+// Return a string representation of the options that analysis results
+// recorded in the analysis database depend on.
+static std::string getAnalysisOptions() {
+  std::string Options;
+  raw_string_ostream OS(Options);
+  OS << TripleName << ";" << MCPU << ";" << join(MAttrs, ",") << ";"
+     << SysRoot << ";" << CompilationDBDir;
+  for (const std::string &File : IncludeFileNames)
+    OS << ";" << File;
+  return OS.str();
+}
+
+// Discover the functions of text section Section of stripped binary Obj. The
+// functions recorded in AnalysisDB as discovered in the same section of an
+// identical binary, if any, are added instead.
+static unsigned discoverFunctions(const ObjectFile *Obj,
+                                  FunctionBoundaryDiscovery &BoundaryDiscovery,
+                                  const SectionRef &Section,
+                                  SectionSymbolsTy &Symbols,
+                                  StringSaver &Saver,
+                                  AnalysisDatabase *AnalysisDB) {
+  if (AnalysisDB == nullptr)
+    return BoundaryDiscovery.discover(Section, Symbols, Saver);
+
+  // Discovery looks at sections other than Section (e.g., .eh_frame), so the
+  // key is computed from the whole binary.
+  std::string Key =
+      AnalysisDB->getKey(arrayRefFromStringRef(Obj->getData()),
+                         "section " + std::to_string(Section.getIndex()));
+  if (const auto *Recorded = AnalysisDB->lookupDiscoveredFunctions(Key)) {
+    for (const AnalysisDatabase::DiscoveredFunction &F : *Recorded)
+      Symbols.emplace_back(F.first, Saver.save(F.second), ELF::STT_FUNC);
+    return Recorded->size();
+  }
+
+  size_t NumSymbols = Symbols.size();
+  unsigned NumAdded = BoundaryDiscovery.discover(Section, Symbols, Saver);
+  std::vector<AnalysisDatabase::DiscoveredFunction> Discovered;
+  for (size_t Idx = NumSymbols; Idx < Symbols.size(); Idx++)
+    Discovered.emplace_back(Symbols[Idx].Addr, Symbols[Idx].Name.str());
+  AnalysisDB->recordDiscoveredFunctions(Key, std::move(Discovered));
+  return NumAdded;
+}
+
+// Raise Obj incrementally with respect to the module raised from an earlier
+// version of the binary. Functions whose code is the same in both versions
+// are copied from that module instead of being raised.
+static void setIncrementalBase(const ObjectFile *Obj, ModuleRaiser *MR,
+                               const MCDisassembler *DisAsm,
+                               const MCInstrAnalysis *MIA) {
+  TimeTraceScope DiffScope("DiffPreviousBinary");
+  OwningBinary<Binary> PrevBinary = unwrapOrError(
+      createBinary(PreviousBinaryFile), PreviousBinaryFile);
+  const auto *PrevObj = dyn_cast<ObjectFile>(PrevBinary.getBinary());
+  if ((PrevObj == nullptr) || (PrevObj->getArch() != Obj->getArch()))
+    reportError(PreviousBinaryFile,
+                "not an object file of the architecture of the input");
+
+  SMDiagnostic Err;
+  std::unique_ptr<Module> PrevModule =
+      parseIRFile(PreviousModuleFile, Err, MR->getModule()->getContext());
+  if (PrevModule == nullptr)
+    reportError(PreviousModuleFile, Err.getMessage());
+
+  StringMap<std::string> PrevDigests =
+      FunctionDigests(PrevObj, DisAsm, MIA).compute();
+  StringMap<std::string> Digests = FunctionDigests(Obj, DisAsm, MIA).compute();
+  StringSet<> Unchanged;
+  for (const auto &Entry : Digests) {
+    auto PrevIter = PrevDigests.find(Entry.first());
+    const Function *PrevF = PrevModule->getFunction(Entry.first());
+    if (!Entry.second.empty() && (PrevIter != PrevDigests.end()) &&
+        (PrevIter->second == Entry.second) && (PrevF != nullptr) &&
+        !PrevF->isDeclaration())
+      Unchanged.insert(Entry.first());
+  }
+  LLVM_DEBUG(dbgs() << Unchanged.size() << " of " << Digests.size()
+                    << " function(s) unchanged since " << PreviousBinaryFile
+                    << "\n");
+  MR->setIncrementalBase(std::move(PrevModule), std::move(Unchanged));
+}
+
+// Return true if Section overlaps the window of addresses being raised, as
+// given by --start-address and --stop-address.
+static bool isInAddressWindow(const SectionRef &Section) {
+  uint64_t SectionAddr = Section.getAddress();
+  return (SectionAddr + Section.getSize() > StartAddress) &&
+         (SectionAddr <= StopAddress);
+}
+
+namespace {
+/// A function decoded from a text section
+struct DecodedFunction {
+  DecodedFunction(StringRef Name, uint64_t Start, uint64_t End)
+      : Name(Name), Start(Start), End(End) {}
+
+  StringRef Name;
+  /// Start and end offsets of the function in the section
+  uint64_t Start;
+  uint64_t End;
+  /// Instructions and data of the function, keyed by section offset
+  std::vector<std::pair<uint64_t, MCInstOrData>> Insts;
+  /// Offsets of the branch targets recorded while decoding the function
+  std::set<uint64_t> Targets;
+};
+
+/// A text section and the functions decoded from it
+struct DecodedSection {
+  SectionRef Section;
+  StringRef Name;
+  ArrayRef<uint8_t> Bytes;
+  SectionSymbolsTy *Symbols = nullptr;
+  /// Context, disassembler and instruction printer used to decode the
+  /// section. They are not thread-safe and keep state (e.g., symbols of the
+  /// context or ARM IT blocks of the disassembler), so each section has ones
+  /// of its own.
+  std::unique_ptr<MCContext> Ctx;
+  std::unique_ptr<MCDisassembler> DisAsm;
+  std::unique_ptr<MCInstPrinter> IP;
+  std::vector<DecodedFunction> Functions;
+  /// Names of the symbols decoded
+  std::vector<StringRef> DecodedSymbols;
+  /// Names and offsets of functions not raised since they are not reachable
+  std::vector<std::pair<StringRef, uint64_t>> UnraisedFunctions;
+  /// Output and diagnostics printed while decoding the section
+  std::string Output;
+  std::string Errors;
+};
+} // end anonymous namespace
+
 static void disassembleObject(const ObjectFile *Obj, bool InlineRelocs) {
   if (StartAddress > StopAddress)
     error("Start address should be less than stop address");
@@ -780,8 +962,33 @@ static void disassembleObject(const ObjectFile *Obj, bool InlineRelocs) {
                           MIA.get(), MII.get(), MRI.get(), IP.get(), Obj,
                           DisAsm.get());
 
-  // Collect dynamic relocations.
+  MR->setFallback(Fallback, FunctionTimeBudget, FunctionMemoryBudget);
+  MR->setSplitStackFrame(SplitStackFrame);
+  MR->setDebugAddresses(DebugAddresses);
+
+  // Reuse the results of analyses recorded by earlier runs.
+  std::unique_ptr<AnalysisDatabase> AnalysisDB;
+  if (!AnalysisDBFile.empty()) {
+    AnalysisDB = std::make_unique<AnalysisDatabase>(AnalysisDBFile,
+                                                    getAnalysisOptions());
+    if (Error E = AnalysisDB->load())
+      WithColor::warning(errs(), ToolName)
+          << toString(std::move(E)) << ". Recording a new database\n";
+    MR->setAnalysisDatabase(AnalysisDB.get());
+  }
+
+  // Annotate raised branches with sampled execution counts.
+  std::unique_ptr<BranchProfile> Profile;
+  if (!ProfileFile.empty()) {
+    Profile = std::make_unique<BranchProfile>(ProfileFile);
+    if (Error E = Profile->load())
+      reportError(std::move(E), ProfileFile);
+    MR->setBranchProfile(Profile.get());
+  }
+
+  // Collect dynamic relocations, sorted by offset.
   MR->collectDynamicRelocations();
+  MR->sortDynamicRelocations();
 
   // Create a mapping, RelocSecs = SectionRelocMap[S], where sections
   // in RelocSecs contain the relocations for section S.
@@ -822,12 +1029,24 @@ static void disassembleObject(const ObjectFile *Obj, bool InlineRelocs) {
     uint8_t SymbolType = ELF::STT_NOTYPE;
     if (Obj->isELF())
       SymbolType = getElfSymbolType(Obj, Symbol);
+    // Section symbols do not denote functions or data in the section.
+    if (SymbolType == ELF::STT_SECTION)
+      continue;
 
     AllSymbols[*SecI].emplace_back(Address, *Name, SymbolType);
   }
-  if (AllSymbols.empty() && Obj->isELF())
+  // A stripped binary has no symbol table. Function boundaries are then
+  // discovered for each text section below.
+  bool IsStripped = AllSymbols.empty() && Obj->isELF();
+  if (IsStripped)
     addDynamicElfSymbols(Obj, AllSymbols);
 
+  // Storage for names of symbols of discovered functions.
+  BumpPtrAllocator DiscoveredNamesAlloc;
+  StringSaver DiscoveredNames(DiscoveredNamesAlloc);
+  FunctionBoundaryDiscovery BoundaryDiscovery(Obj, DisAsm.get(), MIA.get(),
+                                              MRI.get());
+
   // Create a mapping from virtual address to section.
   std::vector<std::pair<uint64_t, SectionRef>> SectionAddresses;
   for (SectionRef Sec : Obj->sections())
@@ -867,23 +1086,95 @@ static void disassembleObject(const ObjectFile *Obj, bool InlineRelocs) {
   for (std::pair<const SectionRef, SectionSymbolsTy> &SecSyms : AllSymbols)
     array_pod_sort(SecSyms.second.begin(), SecSyms.second.end());
 
+  FunctionFilter *FuncFilter = MR->getFunctionFilter();
+  if (!FilterConfigFileName.empty()) {
+    if (!FuncFilter->readFilterFunctionConfigFile(FilterConfigFileName)) {
+      dbgs() << "Unable to read function filter configuration file "
+             << FilterConfigFileName << ". Ignoring\n";
+    }
+  }
+
+  // Discover function boundaries of stripped binaries and, if roots are
+  // specified, find the functions reachable from the roots before decoding
+  // any function. Only the reachable functions are decoded and raised.
+  ReachableFunctions Reachable(Obj, DisAsm.get(), MIA.get());
+  for (const SectionRef &Section : toolSectionFilter(*Obj)) {
+    if (!Section.isText() || Section.isVirtual() || !Section.getSize())
+      continue;
+    if (!isInAddressWindow(Section))
+      continue;
+
+    SectionSymbolsTy &Symbols = AllSymbols[Section];
+    if (IsStripped && MIA &&
+        discoverFunctions(Obj, BoundaryDiscovery, Section, Symbols,
+                          DiscoveredNames, AnalysisDB.get()) > 0)
+      array_pod_sort(Symbols.begin(), Symbols.end());
+    if (!Roots.empty())
+      Reachable.addSection(Section, Symbols);
+  }
+  if (!Roots.empty()) {
+    TimeTraceScope ReachableScope("ComputeReachableFunctions");
+    std::vector<std::string> NotFound = Reachable.compute(Roots);
+    if (!NotFound.empty()) {
+      errs() << "***** WARNING: The following root symbol(s) are not found :\n";
+      for (const std::string &Root : NotFound)
+        errs() << Root << "\n";
+    }
+  }
+
+  // Collect the text sections to decode. Sections are decoded concurrently,
+  // each with an MC context, a disassembler and an instruction printer of its
+  // own. Decoding only reads the object file; the functions decoded are added
+  // to the module raiser afterwards, in the order of sections, so that the
+  // raised module does not depend on the order in which decoding completes.
+  std::vector<DecodedSection> DecodedSections;
   for (const SectionRef &Section : toolSectionFilter(*Obj)) {
     if ((!Section.isText() || Section.isVirtual()))
       continue;
 
-    StringRef SectionName;
+    if (!Section.getSize())
+      continue;
+
+    // Skip sections that do not overlap the address window being raised
+    // without reading their contents.
+    if (!isInAddressWindow(Section))
+      continue;
+
+    DecodedSection &DS = DecodedSections.emplace_back();
+    DS.Section = Section;
     if (auto NameOrErr = Section.getName())
-      SectionName = *NameOrErr;
+      DS.Name = *NameOrErr;
     else
       consumeError(NameOrErr.takeError());
+    StringRef BytesStr =
+        unwrapOrError(Section.getContents(), Obj->getFileName());
+    DS.Bytes = ArrayRef<uint8_t>(
+        reinterpret_cast<const uint8_t *>(BytesStr.data()), BytesStr.size());
+    DS.Symbols = &AllSymbols[Section];
+    DS.Ctx = std::make_unique<MCContext>(Triple(TripleName), AsmInfo.get(),
+                                         MRI.get(), STI.get());
+    DS.DisAsm.reset(TheTarget->createMCDisassembler(*STI, *DS.Ctx));
+    DS.IP.reset(TheTarget->createMCInstPrinter(
+        Triple(TripleName), AsmPrinterVariant, *AsmInfo, *MII, *MRI));
+    DS.IP->setPrintImmHex(PrintImmHex);
+  }
+
+  // Serializes accesses to the function filter by the decoding threads.
+  // Symbols are removed from the filter once all sections are decoded.
+  std::mutex FuncFilterMutex;
 
+  // Decode the functions of section DS.Section into DS.Functions.
+  auto DecodeSection = [&](DecodedSection &DS) {
+    const SectionRef &Section = DS.Section;
+    StringRef SectionName = DS.Name;
     uint64_t SectionAddr = Section.getAddress();
     uint64_t SectSize = Section.getSize();
-    if (!SectSize)
-      continue;
+    ArrayRef<uint8_t> Bytes = DS.Bytes;
+    raw_string_ostream Out(DS.Output);
+    raw_string_ostream Errs(DS.Errors);
 
     // Get the list of all the symbols in this section.
-    SectionSymbolsTy &Symbols = AllSymbols[Section];
+    SectionSymbolsTy &Symbols = *DS.Symbols;
     std::vector<uint64_t> DataMappingSymsAddr;
     std::vector<uint64_t> TextMappingSymsAddr;
     if (isArmElf(Obj)) {
@@ -916,35 +1207,35 @@ static void disassembleObject(const ObjectFile *Obj, bool InlineRelocs) {
     SmallString<40> Comments;
     raw_svector_ostream CommentStream(Comments);
 
-    StringRef BytesStr =
-        unwrapOrError(Section.getContents(), Obj->getFileName());
-    ArrayRef<uint8_t> Bytes(reinterpret_cast<const uint8_t *>(BytesStr.data()),
-                            BytesStr.size());
-
     uint64_t Size;
     uint64_t Index;
 
-    FunctionFilter *FuncFilter = MR->getFunctionFilter();
-    if (!FilterConfigFileName.empty()) {
-      if (!FuncFilter->readFilterFunctionConfigFile(FilterConfigFileName)) {
-        dbgs() << "Unable to read function filter configuration file "
-               << FilterConfigFileName << ". Ignoring\n";
-      }
+    // Time taken to decode the section.
+    TimeTraceScope DecodeScope("DecodeSection", SectionName);
+
+    // Disassemble symbol by symbol and record the instructions and branch
+    // targets of each function in DS.Functions. Bytes of symbols that are not
+    // function symbols belong to the most recent function.
+    //
+    // Only the symbols overlapping the address window are decoded. Symbols
+    // are sorted, so the first symbol ending at or after StartAddress (i.e.,
+    // the one preceding the first symbol at or after StartAddress) is found by
+    // binary search, and decoding stops at the first symbol starting after
+    // StopAddress.
+    unsigned FirstSI = 0;
+    if (HasStartAddressFlag) {
+      FirstSI = llvm::partition_point(Symbols,
+                                      [](const SymbolInfoTy &Symbol) {
+                                        return Symbol.Addr < StartAddress;
+                                      }) -
+                Symbols.begin();
+      if (FirstSI > 0)
+        --FirstSI;
     }
+    for (unsigned SI = FirstSI, SSize = Symbols.size(); SI != SSize; ++SI) {
+      if (Symbols[SI].Addr > StopAddress)
+        break;
 
-    // Build a map of relocations (if they exist in the binary) of text
-    // section whose instructions are being raised.
-    MR->collectTextSectionRelocs(Section);
-
-    // Set used to record all branch targets of a function.
-    std::set<uint64_t> BranchTargetSet;
-    MachineFunctionRaiser *CurMFRaiser = nullptr;
-
-    // Disassemble symbol by symbol and fill MR->MFRaiserVector by
-    // MachineFunctionRaiser for each function
-    LLVM_DEBUG(dbgs() << "BEGIN Disassembly of Functions in Section : "
-                      << SectionName.data() << "\n");
-    for (unsigned SI = 0, SSize = Symbols.size(); SI != SSize; ++SI) {
       uint64_t Start = Symbols[SI].Addr - SectionAddr;
       // The end is either the section end or the beginning of the next
       // symbol.
@@ -957,13 +1248,6 @@ static void disassembleObject(const ObjectFile *Obj, bool InlineRelocs) {
       if (Start >= End)
         continue;
 
-      // Check if we need to skip symbol
-      // Skip if the symbol's data is not between StartAddress and StopAddress
-      if (End + SectionAddr < StartAddress ||
-          Start + SectionAddr > StopAddress) {
-        continue;
-      }
-
       // Stop disassembly at the stop address specified
       if (End + SectionAddr > StopAddress)
         End = StopAddress - SectionAddr;
@@ -992,6 +1276,7 @@ static void disassembleObject(const ObjectFile *Obj, bool InlineRelocs) {
 
         bool RaiseFuncSymbol = true;
         if ((!FilterConfigFileName.empty())) {
+          std::lock_guard<std::mutex> Lock(FuncFilterMutex);
           // Check the symbol name whether it should be excluded or not.
           // Check in a non-empty exclude list
           if (!FuncFilter->isFilterSetEmpty(FunctionFilter::FILTER_EXCLUDE)) {
@@ -1021,57 +1306,31 @@ static void disassembleObject(const ObjectFile *Obj, bool InlineRelocs) {
         if (ELFCRTSymbols.find(SymStr) != ELFCRTSymbols.end())
           RaiseFuncSymbol = false;
 
+        // Skip functions not reachable from the roots. References to them,
+        // if any remain, resolve to external declarations.
+        if (RaiseFuncSymbol && !Roots.empty() &&
+            !Reachable.isReachable(Section, Symbols[SI].Addr)) {
+          DS.UnraisedFunctions.emplace_back(SymStr, Start);
+          RaiseFuncSymbol = false;
+        }
+
         // Check if raising function symbol should be skipped
         if (!RaiseFuncSymbol)
           continue;
 
-        // Note that since LLVM infrastructure was built to be used to build a
-        // conventional compiler pipeline, MachineFunction is built well after
-        // Function object was created and populated fully. Hence, creation of
-        // a Function object is necessary to build MachineFunction.
-        // However, in a raiser, we are conceptually walking the traditional
-        // compiler pipeline backwards. So we build MachineFunction from
-        // the binary before building Function object. Given the dependency,
-        // build a placeholder Function object to allow for building the
-        // MachineFunction object.
-        // This Function object is NOT populated when raising MachineFunction
-        // abstraction of the binary function. Instead, a new Function is
-        // created using the LLVMContext and name of this Function object.
-        FunctionType *FTy = FunctionType::get(Type::getVoidTy(LlvmCtx), false);
         StringRef FunctionName(Symbols[SI].Name);
         // Strip leading underscore if the binary is MachO
         if (Obj->isMachO()) {
           FunctionName.consume_front("_");
         }
-        Function *Func = Function::Create(FTy, GlobalValue::ExternalLinkage,
-                                          FunctionName, &M);
-
-        // New function symbol encountered. Record all targets collected to
-        // current MachineFunctionRaiser before we start parsing the new
-        // function bytes.
-        CurMFRaiser = MR->getCurrentMachineFunctionRaiser();
-        for (auto TargetIdx : BranchTargetSet) {
-          assert(CurMFRaiser != nullptr &&
-                 "Encountered uninitialized MachineFunction raiser object");
-          CurMFRaiser->getMCInstRaiser()->addTarget(TargetIdx);
-        }
-
-        // Clear the set used to record all branch targets of this function.
-        BranchTargetSet.clear();
-        // Create a new MachineFunction raiser
-        CurMFRaiser =
-            MR->CreateAndAddMachineFunctionRaiser(Func, MR, Start, End);
-        LLVM_DEBUG(dbgs() << "\nFunction " << Symbols[SI].Name << ":\n");
+        // New function symbol encountered.
+        DS.Functions.emplace_back(FunctionName, Start, End);
       } else {
-        // Continue using to the most recent MachineFunctionRaiser
-        // Get current MachineFunctionRaiser
-        CurMFRaiser = MR->getCurrentMachineFunctionRaiser();
-        // assert(curMFRaiser != nullptr && "Current Machine Function Raiser not
-        // initialized");
-        if (CurMFRaiser == nullptr) {
+        // Continue using to the most recent function of this section.
+        if (DS.Functions.empty()) {
           // At this point in the instruction stream, we do not have a function
-          // symbol to which the bytes being parsed can be made part of. So skip
-          // parsing the bytes of this symbol.
+          // symbol of this section to which the bytes being parsed can be made
+          // part of. So skip parsing the bytes of this symbol.
           continue;
         }
 
@@ -1079,28 +1338,23 @@ static void disassembleObject(const ObjectFile *Obj, bool InlineRelocs) {
         // current symbol. This represents a situation where we have discovered
         // bytes (most likely data bytes) that belong to the most recent
         // function being parsed.
-        MCInstRaiser *InstRaiser = CurMFRaiser->getMCInstRaiser();
-        if (InstRaiser->getFuncEnd() < End) {
-          assert(InstRaiser->adjustFuncEnd(End) &&
-                 "Unable to adjust function end value");
-        }
+        if (DS.Functions.back().End < End)
+          DS.Functions.back().End = End;
       }
 
-      // Get the associated MCInstRaiser
-      MCInstRaiser *InstRaiser = CurMFRaiser->getMCInstRaiser();
+      // Get the function being decoded
+      DecodedFunction &CurFunc = DS.Functions.back();
 
       // Start new basic block at the symbol.
-      BranchTargetSet.insert(Start);
+      CurFunc.Targets.insert(Start);
 
-      for (Index = Start; Index < End; Index += Size) {
-        MCInst Inst;
+      // Begin decoding at StartAddress if it lies within the symbol.
+      uint64_t FirstIndex = Start;
+      if (StartAddress > SectionAddr + Start)
+        FirstIndex = StartAddress - SectionAddr;
 
-        if (Index + SectionAddr < StartAddress ||
-            Index + SectionAddr > StopAddress) {
-          // skip byte by byte till StartAddress is reached
-          Size = 1;
-          continue;
-        }
+      for (Index = FirstIndex; Index < End; Index += Size) {
+        MCInst Inst;
 
         // AArch64 ELF binaries can interleave data and text in the
         // same section. We rely on the markers introduced to
@@ -1128,7 +1382,7 @@ static void disassembleObject(const ObjectFile *Obj, bool InlineRelocs) {
                                                                   Index);
                   Data = *Word;
                 }
-                InstRaiser->addMCInstOrData(Index, Data);
+                CurFunc.Insts.emplace_back(Index, Data);
               } else if (Index + 2 <= End) {
                 Stride = 2;
                 uint16_t Data = 0;
@@ -1143,10 +1397,11 @@ static void disassembleObject(const ObjectFile *Obj, bool InlineRelocs) {
                                                                   Index);
                   Data = *Short;
                 }
-                InstRaiser->addMCInstOrData(Index, Data);
+                CurFunc.Insts.emplace_back(Index, Data);
               } else {
                 Stride = 1;
-                InstRaiser->addMCInstOrData(Index, Bytes.slice(Index, 1)[0]);
+                CurFunc.Insts.emplace_back(
+                    Index, (uint32_t)Bytes.slice(Index, 1)[0]);
               }
               Index += Stride;
 
@@ -1174,11 +1429,11 @@ static void disassembleObject(const ObjectFile *Obj, bool InlineRelocs) {
                 ((SectionAddr + Index) > StopAddress))
               continue;
             if (NumBytes == 0) {
-              outs() << format("%8" PRIx64 ":", SectionAddr + Index);
-              outs() << "\t";
+              Out << format("%8" PRIx64 ":", SectionAddr + Index);
+              Out << "\t";
             }
             Byte = Bytes.slice(Index)[0];
-            outs() << format(" %02x", Byte);
+            Out << format(" %02x", Byte);
             AsciiData[NumBytes] = isprint(Byte) ? Byte : '.';
 
             uint8_t IndentOffset = 0;
@@ -1193,9 +1448,9 @@ static void disassembleObject(const ObjectFile *Obj, bool InlineRelocs) {
             }
             if (NumBytes == 8) {
               AsciiData[8] = '\0';
-              outs() << std::string(IndentOffset, ' ') << "         ";
-              outs() << reinterpret_cast<char *>(AsciiData);
-              outs() << '\n';
+              Out << std::string(IndentOffset, ' ') << "         ";
+              Out << reinterpret_cast<char *>(AsciiData);
+              Out << '\n';
               NumBytes = 0;
             }
           }
@@ -1205,26 +1460,27 @@ static void disassembleObject(const ObjectFile *Obj, bool InlineRelocs) {
           break;
 
         // Disassemble a real instruction or a data
-        bool Disassembled = DisAsm->getInstruction(
-            Inst, Size, Bytes.slice(Index), SectionAddr + Index, CommentStream);
+        bool Disassembled =
+            DS.DisAsm->getInstruction(Inst, Size, Bytes.slice(Index),
+                                      SectionAddr + Index, CommentStream);
         if (Size == 0)
           Size = 1;
 
         if (!Disassembled) {
-          errs() << "**** Warning: Failed to decode instruction\n";
-          PIP.printInst(*IP, Disassembled ? &Inst : nullptr,
-                        Bytes.slice(Index, Size), SectionAddr + Index, outs(),
+          Errs << "**** Warning: Failed to decode instruction\n";
+          PIP.printInst(*DS.IP, Disassembled ? &Inst : nullptr,
+                        Bytes.slice(Index, Size), SectionAddr + Index, Out,
                         "", *STI);
-          outs() << CommentStream.str();
+          Out << CommentStream.str();
           Comments.clear();
-          errs() << "\n";
+          Errs << "\n";
         }
 
         // Add MCInst to the list if all instructions were decoded
         // successfully till now. Else, do not bother adding since no attempt
         // will be made to raise this function.
         if (Disassembled) {
-          InstRaiser->addMCInstOrData(Index, Inst);
+          CurFunc.Insts.emplace_back(Index, Inst);
 
           // Find branch target and record it. Call targets are not
           // recorded as they are not needed to build per-function CFG.
@@ -1253,36 +1509,118 @@ static void disassembleObject(const ObjectFile *Obj, bool InlineRelocs) {
                 }
               }
               // Add the index Target to target indices set.
-              BranchTargetSet.insert(BranchTarget);
+              CurFunc.Targets.insert(BranchTarget);
             }
 
             // Mark the next instruction as a target, if it is not beyond the
             // function end
             uint64_t FallThruIndex = Index + Size;
             if (FallThruIndex < End) {
-              BranchTargetSet.insert(FallThruIndex);
+              CurFunc.Targets.insert(FallThruIndex);
             }
           }
         }
       }
-      FuncFilter->eraseFunctionBySymbol(Symbols[SI].Name,
-                                        FunctionFilter::FILTER_INCLUDE);
+      DS.DecodedSymbols.push_back(Symbols[SI].Name);
     }
-    LLVM_DEBUG(dbgs() << "END Disassembly of Functions in Section : "
-                      << SectionName.data() << "\n");
+  };
+
+  // Decode the functions of all text sections.
+  {
+    ThreadPool Pool(hardware_concurrency(NumThreads));
+    for (DecodedSection &DS : DecodedSections)
+      Pool.async([&DecodeSection, &DS]() {
+        // The time profiler records the events of each thread separately.
+        // They are merged into the trace once the thread finishes. Without
+        // thread support, sections are decoded by the main thread, which
+        // already records events.
+        bool TraceThread = TimeTrace && !timeTraceProfilerEnabled();
+        if (TraceThread)
+          timeTraceProfilerInitialize(TimeTraceGranularity, ToolName);
+        DecodeSection(DS);
+        if (TraceThread)
+          timeTraceProfilerFinishThread();
+      });
+    Pool.wait();
+  }
 
-    // Record all targets of the last function parsed
-    CurMFRaiser = MR->getCurrentMachineFunctionRaiser();
-    for (auto TargetIdx : BranchTargetSet)
-      CurMFRaiser->getMCInstRaiser()->addTarget(TargetIdx);
+  // Add the decoded functions to the module raiser. Functions are raised
+  // once all sections are decoded, so that calls across sections (e.g., to
+  // the .text.unlikely part of a function) resolve to raised functions.
+  for (DecodedSection &DS : DecodedSections) {
+    outs() << DS.Output;
+    errs() << DS.Errors;
 
-    MR->runMachineFunctionPasses();
+    // Build a map of relocations (if they exist in the binary) of text
+    // section whose instructions are being raised.
+    MR->collectTextSectionRelocs(DS.Section);
+    for (const auto &Unraised : DS.UnraisedFunctions)
+      MR->addUnraisedFunction(Unraised.first, Unraised.second);
 
-    if (!FuncFilter->isFilterSetEmpty(FunctionFilter::FILTER_INCLUDE)) {
-      errs() << "***** WARNING: The following include filter symbol(s) are not "
-                "found :\n";
-      FuncFilter->dump(FunctionFilter::FILTER_INCLUDE);
+    LLVM_DEBUG(dbgs() << "BEGIN Disassembly of Functions in Section : "
+                      << DS.Name << "\n");
+    for (DecodedFunction &DF : DS.Functions) {
+      // Note that since LLVM infrastructure was built to be used to build a
+      // conventional compiler pipeline, MachineFunction is built well after
+      // Function object was created and populated fully. Hence, creation of
+      // a Function object is necessary to build MachineFunction.
+      // However, in a raiser, we are conceptually walking the traditional
+      // compiler pipeline backwards. So we build MachineFunction from
+      // the binary before building Function object. Given the dependency,
+      // build a placeholder Function object to allow for building the
+      // MachineFunction object.
+      // This Function object is NOT populated when raising MachineFunction
+      // abstraction of the binary function. Instead, a new Function is
+      // created using the LLVMContext and name of this Function object.
+      FunctionType *FTy = FunctionType::get(Type::getVoidTy(LlvmCtx), false);
+      Function *Func = Function::Create(FTy, GlobalValue::ExternalLinkage,
+                                        DF.Name, &M);
+
+      // Create a new MachineFunction raiser and record the instructions and
+      // branch targets of the function.
+      MachineFunctionRaiser *CurMFRaiser =
+          MR->CreateAndAddMachineFunctionRaiser(Func, MR, DF.Start, DF.End);
+      MCInstRaiser *InstRaiser = CurMFRaiser->getMCInstRaiser();
+      for (const auto &IndexedInst : DF.Insts)
+        InstRaiser->addMCInstOrData(IndexedInst.first, IndexedInst.second);
+      for (uint64_t TargetIdx : DF.Targets)
+        InstRaiser->addTarget(TargetIdx);
+      LLVM_DEBUG(dbgs() << "\nFunction " << DF.Name << ":\n");
     }
+    LLVM_DEBUG(dbgs() << "END Disassembly of Functions in Section : "
+                      << DS.Name << "\n");
+    for (StringRef &SymbolName : DS.DecodedSymbols)
+      FuncFilter->eraseFunctionBySymbol(SymbolName,
+                                        FunctionFilter::FILTER_INCLUDE);
+  }
+
+  // Report the census of the decoded functions instead of raising them.
+  if (Census) {
+    MR->printCensus(outs());
+    if (AnalysisDB)
+      if (Error E = AnalysisDB->save())
+        WithColor::warning(errs(), ToolName) << toString(std::move(E)) << "\n";
+    return;
+  }
+
+  // Raise only one of the functions with identical code. This changes the
+  // addresses of all but one of them.
+  if (ICF) {
+    unsigned NumFolded = MR->foldIdenticalFunctions();
+    LLVM_DEBUG(dbgs() << "Folded " << NumFolded
+                      << " function(s) with identical code\n");
+    (void)NumFolded;
+  }
+
+  if (!PreviousBinaryFile.empty())
+    setIncrementalBase(Obj, MR, DisAsm.get(), MIA.get());
+
+  MR->runMachineFunctionPasses();
+
+  if (!FuncFilter->isFilterSetEmpty(FunctionFilter::FILTER_INCLUDE)) {
+    errs() << "***** WARNING: The following include filter symbol(s) are not "
+              "found :\n";
+    FuncFilter->dump(FunctionFilter::FILTER_INCLUDE);
   }
 
   // Add the pass manager
@@ -1349,6 +1687,7 @@ static void disassembleObject(const ObjectFile *Obj, bool InlineRelocs) {
     outs() << ToolName << "run system pass!\n";
   }
 
+  TimeTraceScope EmitScope("EmitOutput", OutputFilename);
   PM.run(M);
 }
 
@@ -1420,12 +1759,14 @@ static void dumpInput(StringRef File) {
                   "binary formats. Thanks!\n";
         exit(1);
       }
-      // Raise x86_64 relocatable binaries (.o files) is not supported.
+      // Raise x86_64 executables, shared libraries and relocatable binaries
+      // (.o files).
       auto EType = Elf64LEObjFile->getELFFile().getHeader().e_type;
-      if ((EType == ELF::ET_DYN) || (EType == ELF::ET_EXEC))
+      if ((EType == ELF::ET_DYN) || (EType == ELF::ET_EXEC) ||
+          (EType == ELF::ET_REL))
         dumpObject(O);
       else {
-        errs() << "Raising x64 relocatable (.o) x64 binaries not supported\n";
+        errs() << "Raising x64 core files is not supported\n";
         exit(1);
       }
     } else if (O->getArch() == Triple::arm)
@@ -1487,6 +1828,35 @@ static void parseOptions(const llvm::opt::InputArgList &InputArgs) {
   HasStartAddressFlag = InputArgs.hasArg(OPT_start_address_EQ);
   parseIntArg(InputArgs, OPT_stop_address_EQ, StopAddress);
   HasStopAddressFlag = InputArgs.hasArg(OPT_stop_address_EQ);
+  Roots = commaSeparatedValues(InputArgs, OPT_roots_EQ);
+  ICF = InputArgs.hasArg(OPT_icf);
+  Census = InputArgs.hasArg(OPT_census);
+  SplitStackFrame = InputArgs.hasArg(OPT_split_stack_frame);
+  DebugAddresses = InputArgs.hasArg(OPT_debug_addresses);
+  if (const opt::Arg *A = InputArgs.getLastArg(OPT_fallback_EQ)) {
+    Optional<ModuleRaiser::FallbackKind> Kind =
+        StringSwitch<Optional<ModuleRaiser::FallbackKind>>(A->getValue())
+            .Case("abort", ModuleRaiser::FallbackKind::Abort)
+            .Case("trap", ModuleRaiser::FallbackKind::Trap)
+            .Case("declare", ModuleRaiser::FallbackKind::Declare)
+            .Default(None);
+    if (!Kind)
+      invalidArgValue(A);
+    Fallback = *Kind;
+  }
+  parseIntArg(InputArgs, OPT_function_time_budget_EQ, FunctionTimeBudget);
+  parseIntArg(InputArgs, OPT_function_memory_budget_EQ, FunctionMemoryBudget);
+  AnalysisDBFile = InputArgs.getLastArgValue(OPT_analysis_db_EQ).str();
+  ProfileFile = InputArgs.getLastArgValue(OPT_profile_EQ).str();
+  PreviousBinaryFile = InputArgs.getLastArgValue(OPT_previous_binary_EQ).str();
+  PreviousModuleFile = InputArgs.getLastArgValue(OPT_previous_module_EQ).str();
+  if (PreviousBinaryFile.empty() != PreviousModuleFile.empty())
+    reportCmdLineError("--previous-binary and --previous-module must be "
+                       "specified together");
+  parseIntArg(InputArgs, OPT_threads_EQ, NumThreads);
+  TimeTrace = InputArgs.hasArg(OPT_time_trace);
+  parseIntArg(InputArgs, OPT_time_trace_granularity_EQ, TimeTraceGranularity);
+  TimeTraceFile = InputArgs.getLastArgValue(OPT_time_trace_file_EQ).str();
   TargetName = InputArgs.getLastArgValue(OPT_target_EQ).str();
   SysRoot = InputArgs.getLastArgValue(OPT_sysyroot_EQ).str();
   OutputFilename = InputArgs.getLastArgValue(OPT_outfile_EQ).str();
@@ -1581,14 +1951,22 @@ int main(int argc, char **argv) {
   }
   // Restore stashed OutputFileName
   OutputFilename = OF;
-  // Disassemble contents of .text section.
+  // Disassemble contents of .text sections.
   Disassemble = true;
-  FilterSections.push_back(".text");
 #ifndef NDEBUG
   llvm::setCurrentDebugType(DEBUG_TYPE);
 #endif
+  if (TimeTrace)
+    timeTraceProfilerInitialize(TimeTraceGranularity, ToolName);
+
   std::for_each(InputFNames.begin(), InputFNames.end(), dumpInput);
 
+  if (TimeTrace) {
+    if (auto E = timeTraceProfilerWrite(TimeTraceFile, OutputFilename))
+      reportError(std::move(E), TimeTraceFile);
+    timeTraceProfilerCleanup();
+  }
+
   return EXIT_SUCCESS;
 }
 #undef DEBUG_TYPE
@@ -0,0 +1,65 @@
+// FNV-1a hashing and an open addressing hash table of integer keys.
+
+#include <stdio.h>
+
+#define BUF_SIZE (1 << 20)
+#define TABLE_SIZE (1 << 18)
+#define NUM_KEYS (TABLE_SIZE / 2)
+#define REPS 8
+
+unsigned char Buffer[BUF_SIZE];
+unsigned Keys[TABLE_SIZE];
+int Values[TABLE_SIZE];
+
+unsigned fnv1a(const unsigned char *P, int Len) {
+  unsigned H = 2166136261u;
+  for (int I = 0; I < Len; I++) {
+    H ^= P[I];
+    H *= 16777619u;
+  }
+  return H;
+}
+
+unsigned mix(unsigned K) {
+  K ^= K >> 16;
+  K *= 0x45d9f3bu;
+  K ^= K >> 16;
+  return K;
+}
+
+void insert(unsigned Key, int Value) {
+  unsigned Slot = mix(Key) & (TABLE_SIZE - 1);
+  while (Keys[Slot] != 0 && Keys[Slot] != Key)
+    Slot = (Slot + 1) & (TABLE_SIZE - 1);
+  Keys[Slot] = Key;
+  Values[Slot] = Value;
+}
+
+int lookup(unsigned Key) {
+  unsigned Slot = mix(Key) & (TABLE_SIZE - 1);
+  while (Keys[Slot] != 0) {
+    if (Keys[Slot] == Key)
+      return Values[Slot];
+    Slot = (Slot + 1) & (TABLE_SIZE - 1);
+  }
+  return -1;
+}
+
+int main(void) {
+  for (int I = 0; I < BUF_SIZE; I++)
+    Buffer[I] = (unsigned char)(I * 31 + (I >> 7));
+
+  unsigned H = 0;
+  long Found = 0;
+  for (int R = 0; R < REPS; R++) {
+    H = H * 31 + fnv1a(Buffer, BUF_SIZE);
+    for (int I = 0; I < TABLE_SIZE; I++)
+      Keys[I] = 0;
+    for (int I = 1; I <= NUM_KEYS; I++)
+      insert((unsigned)I * 2654435761u, I);
+    for (int I = 1; I <= NUM_KEYS * 2; I++)
+      Found += lookup((unsigned)I * 2654435761u) > 0;
+  }
+  printf("hash checksum %u %ld\n", H, Found);
+  return 0;
+}
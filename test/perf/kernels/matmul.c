@@ -0,0 +1,41 @@
+// Dense double precision matrix multiplication.
+
+#include <stdio.h>
+
+#define N 256
+#define REPS 8
+
+double A[N][N];
+double B[N][N];
+double C[N][N];
+
+void init(void) {
+  for (int I = 0; I < N; I++)
+    for (int J = 0; J < N; J++) {
+      A[I][J] = (double)((I * 7 + J * 3) % 17) / 8.0;
+      B[I][J] = (double)((I * 5 + J * 11) % 13) / 4.0;
+      C[I][J] = 0.0;
+    }
+}
+
+void matmul(void) {
+  for (int I = 0; I < N; I++)
+    for (int K = 0; K < N; K++) {
+      double AIK = A[I][K];
+      for (int J = 0; J < N; J++)
+        C[I][J] += AIK * B[K][J];
+    }
+}
+
+int main(void) {
+  init();
+  for (int R = 0; R < REPS; R++)
+    matmul();
+
+  double Sum = 0.0;
+  for (int I = 0; I < N; I++)
+    for (int J = 0; J < N; J++)
+      Sum += C[I][J];
+  printf("matmul checksum %.1f\n", Sum);
+  return 0;
+}
@@ -0,0 +1,78 @@
+// Sorting of pseudo-random integers with quicksort and insertion sort.
+
+#include <stdio.h>
+
+#define N 200000
+#define REPS 5
+
+int Data[N];
+unsigned Seed;
+
+unsigned nextRandom(void) {
+  Seed = Seed * 1103515245u + 12345u;
+  return Seed >> 8;
+}
+
+void fill(void) {
+  for (int I = 0; I < N; I++)
+    Data[I] = (int)(nextRandom() % 1000000);
+}
+
+void insertionSort(int *A, int Lo, int Hi) {
+  for (int I = Lo + 1; I <= Hi; I++) {
+    int V = A[I];
+    int J = I - 1;
+    while (J >= Lo && A[J] > V) {
+      A[J + 1] = A[J];
+      J--;
+    }
+    A[J + 1] = V;
+  }
+}
+
+void quickSort(int *A, int Lo, int Hi) {
+  while (Hi - Lo > 16) {
+    int Pivot = A[Lo + (Hi - Lo) / 2];
+    int I = Lo;
+    int J = Hi;
+    while (I <= J) {
+      while (A[I] < Pivot)
+        I++;
+      while (A[J] > Pivot)
+        J--;
+      if (I <= J) {
+        int T = A[I];
+        A[I] = A[J];
+        A[J] = T;
+        I++;
+        J--;
+      }
+    }
+    // Recurse into the smaller partition to bound the stack depth.
+    if (J - Lo < Hi - I) {
+      quickSort(A, Lo, J);
+      Lo = I;
+    } else {
+      quickSort(A, I, Hi);
+      Hi = J;
+    }
+  }
+  insertionSort(A, Lo, Hi);
+}
+
+int main(void) {
+  long Checksum = 0;
+  Seed = 42;
+  for (int R = 0; R < REPS; R++) {
+    fill();
+    quickSort(Data, 0, N - 1);
+    for (int I = 1; I < N; I++)
+      if (Data[I - 1] > Data[I]) {
+        printf("sort failed\n");
+        return 1;
+      }
+    Checksum += Data[N / 2] + Data[N / 4];
+  }
+  printf("sort checksum %ld\n", Checksum);
+  return 0;
+}
@@ -0,0 +1,63 @@
+// Naive and Boyer-Moore-Horspool substring search.
+
+#include <stdio.h>
+#include <string.h>
+
+#define TEXT_SIZE (1 << 20)
+#define REPS 4
+
+char Text[TEXT_SIZE + 1];
+
+int naiveCount(const char *T, int N, const char *P, int M) {
+  int Count = 0;
+  for (int I = 0; I + M <= N; I++) {
+    int J = 0;
+    while (J < M && T[I + J] == P[J])
+      J++;
+    if (J == M)
+      Count++;
+  }
+  return Count;
+}
+
+int horspoolCount(const char *T, int N, const char *P, int M) {
+  int Shift[256];
+  for (int I = 0; I < 256; I++)
+    Shift[I] = M;
+  for (int I = 0; I < M - 1; I++)
+    Shift[(unsigned char)P[I]] = M - 1 - I;
+
+  int Count = 0;
+  int I = 0;
+  while (I + M <= N) {
+    int J = M - 1;
+    while (J >= 0 && T[I + J] == P[J])
+      J--;
+    if (J < 0)
+      Count++;
+    I += Shift[(unsigned char)T[I + M - 1]];
+  }
+  return Count;
+}
+
+int main(void) {
+  const char *Alphabet = "abcdefghij";
+  unsigned Seed = 7;
+  for (int I = 0; I < TEXT_SIZE; I++) {
+    Seed = Seed * 1103515245u + 12345u;
+    Text[I] = Alphabet[(Seed >> 16) % 10];
+  }
+  Text[TEXT_SIZE] = '\0';
+
+  const char *Patterns[] = {"abc", "jihgf", "aaaa", "abcdefgh", "deadbeef"};
+  long Naive = 0;
+  long Horspool = 0;
+  for (int R = 0; R < REPS; R++)
+    for (int P = 0; P < 5; P++) {
+      int M = (int)strlen(Patterns[P]);
+      Naive += naiveCount(Text, TEXT_SIZE, Patterns[P], M);
+      Horspool += horspoolCount(Text, TEXT_SIZE, Patterns[P], M);
+    }
+  printf("strsearch checksum %ld %ld\n", Naive, Horspool);
+  return Naive != Horspool;
+}
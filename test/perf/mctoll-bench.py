@@ -0,0 +1,360 @@
+#!/usr/bin/env python3
+# ===-- mctoll-bench.py - Raising throughput benchmark ----------*- python -*-===#
+#
+# Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+# See https://llvm.org/LICENSE.txt for license information.
+# SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+#
+# ===------------------------------------------------------------------------===#
+#
+# Compiles a fixed corpus of in-tree C sources for each requested target and
+# optimization level, raises each resulting binary with llvm-mctoll and reports
+# the raising throughput (functions/sec, instructions/sec) and the peak
+# resident set size of llvm-mctoll. Results are compared against the baselines
+# stored in baselines.json; the script exits with a non-zero status if any
+# configuration regresses by more than the specified tolerance. Configurations
+# without a comparable baseline are reported as warnings.
+#
+# ===------------------------------------------------------------------------===#
+
+import argparse
+import json
+import os
+import platform
+import re
+import shutil
+import statistics
+import subprocess
+import sys
+import tempfile
+
+from perfutil import find_tool, run_and_measure
+
+SCRIPT_DIR = os.path.dirname(os.path.abspath(__file__))
+TEST_DIR = os.path.dirname(SCRIPT_DIR)
+
+# Target name -> (clang target triple, additional flags).
+TARGETS = {
+    'x86-64': ('x86_64-linux-gnu', []),
+    'arm': ('arm-linux-gnueabi', ['-fuse-ld=lld']),
+}
+
+# Headers providing prototypes of the library functions referenced by the
+# corpus. Same as those used by the dhrystone lit test.
+DEFAULT_INCLUDES = [
+    '/usr/include/stdlib.h', '/usr/include/string.h', '/usr/include/stdio.h',
+    '/usr/include/time.h'
+]
+
+DHRY_FLAGS = ['-DTIME', '-DHZ=2133', '-DNOSTRUCTASSIGN']
+
+INSTR_LINE_RE = re.compile(r'^\s*[0-9a-f]+:\s')
+
+
+class Binary(object):
+    """A corpus entry: a set of sources compiled into one binary."""
+
+    def __init__(self, name, sources, flags=None, shared=False):
+        self.name = name
+        self.sources = sources
+        self.flags = flags or []
+        self.shared = shared
+
+
+# Smoke tests raised as part of the corpus. The corpus is pinned, rather than
+# taken from the smoke test directory, so that adding a test does not change
+# the benchmark and invalidate the baselines. Programs are self-contained; the
+# libraries are raised as shared objects.
+SMOKE_PROGRAMS = [
+    'call-function-pointer', 'call-memset', 'div-mem', 'division-tests',
+    'double_float_int_args', 'eflags-test', 'float_conversions', 'fp-ops',
+    'global-array-access-opt', 'hello', 'linked-list', 'matmul',
+    'matrix-back-edge', 'raise-cmov-insts', 'raise-switch-table', 'setbit',
+    'string-split', 'switch-with-indirect-branch', 'test-call-graph',
+    'test-jmptbl', 'test-linked-list', 'test-pass-struct-on-stack',
+    'variadic-call-test', 'wrapper-calls'
+]
+SMOKE_LIBRARIES = [
+    'externvar-lib', 'factorial', 'fibfunc', 'globalvar', 'param-long',
+    'reduce', 'simple-phi', 'strcmp', 'switch_func', 'test-1', 'test-2',
+    'test-3', 'transform'
+]
+
+
+def get_corpus(extra_sources):
+    corpus = [
+        Binary('dhrystone', [
+            os.path.join(TEST_DIR, 'dhrystone', 'dhry_main.c'),
+            os.path.join(TEST_DIR, 'dhrystone', 'dhry_funcs_mod.c')
+        ], DHRY_FLAGS + ['-mno-sse']),
+        Binary('dhrystone-dso',
+               [os.path.join(TEST_DIR, 'dhrystone', 'dhry_funcs_mod.c')],
+               DHRY_FLAGS, shared=True),
+    ]
+    smoke_dir = os.path.join(TEST_DIR, 'smoke_test')
+    for name in SMOKE_PROGRAMS:
+        corpus.append(
+            Binary('smoke/' + name, [os.path.join(smoke_dir, name + '.c')]))
+    for name in SMOKE_LIBRARIES:
+        corpus.append(
+            Binary('smoke/Inputs/' + name,
+                   [os.path.join(smoke_dir, 'Inputs', name + '.c')],
+                   shared=True))
+    # Large sources that are not part of the tree (e.g. the sqlite
+    # amalgamation) may be added to the corpus from the command line.
+    for src in extra_sources:
+        corpus.append(
+            Binary('extra/' + os.path.splitext(os.path.basename(src))[0],
+                   [os.path.abspath(src)], shared=True))
+    return corpus
+
+
+def count_text_instructions(objdump, binary):
+    out = subprocess.run([objdump, '-d', '--no-show-raw-insn', '-j', '.text',
+                          binary], stdout=subprocess.PIPE,
+                         stderr=subprocess.DEVNULL, universal_newlines=True)
+    if out.returncode != 0:
+        return 0
+    return sum(1 for line in out.stdout.splitlines()
+               if INSTR_LINE_RE.match(line))
+
+
+def count_raised_functions(ll_file):
+    with open(ll_file) as f:
+        return sum(1 for line in f if line.startswith('define '))
+
+
+def compile_binary(args, target, opt, entry, out):
+    triple, target_flags = TARGETS[target]
+    cmd = [args.clang, '--target=' + triple, '-' + opt, '-o', out]
+    cmd += target_flags + entry.flags
+    if entry.shared:
+        cmd += ['-shared', '-fPIC']
+    if target == 'arm' and args.arm_sysroot:
+        cmd += ['--sysroot=' + args.arm_sysroot]
+    cmd += entry.sources
+    return subprocess.call(cmd, stdout=subprocess.DEVNULL,
+                           stderr=subprocess.DEVNULL) == 0
+
+
+def bench_config(args, target, opt, corpus, work_dir):
+    """Raise each corpus binary built for target at opt. Return the results."""
+    binaries = {}
+    for entry in corpus:
+        base = os.path.join(work_dir, target, opt,
+                            entry.name.replace('/', '_'))
+        os.makedirs(os.path.dirname(base), exist_ok=True)
+        exe = base + ('.so' if entry.shared else '')
+        if not compile_binary(args, target, opt, entry, exe):
+            binaries[entry.name] = {'status': 'compile-failed'}
+            continue
+        ll_file = base + '-dis.ll'
+        cmd = [args.mctoll, '-d', '-o', ll_file]
+        for inc in args.include:
+            cmd += ['-I', inc]
+        cmd.append(exe)
+        times = []
+        peak_rss = 0
+        status = 'ok'
+        for _ in range(args.repeat):
+            rc, elapsed, rss = run_and_measure(cmd)
+            if rc != 0:
+                status = 'raise-failed'
+                break
+            times.append(elapsed)
+            peak_rss = max(peak_rss, rss)
+        if status != 'ok':
+            binaries[entry.name] = {'status': status}
+            continue
+        binaries[entry.name] = {
+            'status': status,
+            'time_sec': statistics.median(times),
+            'functions': count_raised_functions(ll_file),
+            'instructions': count_text_instructions(args.objdump, exe),
+            'peak_rss_kib': peak_rss,
+        }
+
+    raised = [b for b in binaries.values() if b['status'] == 'ok']
+    total_time = sum(b['time_sec'] for b in raised)
+    summary = {
+        'corpus': sorted(binaries),
+        'binaries_raised': len(raised),
+        'binaries_failed': len(binaries) - len(raised),
+        'functions': sum(b['functions'] for b in raised),
+        'instructions': sum(b['instructions'] for b in raised),
+        'time_sec': total_time,
+        'functions_per_sec': (sum(b['functions'] for b in raised) /
+                              total_time if total_time else 0.0),
+        'instructions_per_sec': (sum(b['instructions'] for b in raised) /
+                                 total_time if total_time else 0.0),
+        'peak_rss_kib': max([b['peak_rss_kib'] for b in raised] or [0]),
+    }
+    return summary, binaries
+
+
+def compare(key, summary, baseline, tolerance, warnings):
+    """Return a list of regression messages of summary relative to baseline."""
+    # Throughput is only comparable if the same binaries are raised.
+    if baseline.get('corpus') != summary['corpus']:
+        warnings.append('%s: corpus differs from the baseline; record new '
+                        'baselines with --update-baselines' % key)
+        return []
+    regressions = []
+    for metric in ('functions_per_sec', 'instructions_per_sec'):
+        base = baseline.get(metric)
+        if base and summary[metric] < base * (1.0 - tolerance):
+            regressions.append(
+                '%s: %s dropped from %.1f to %.1f (%.1f%%)' %
+                (key, metric, base, summary[metric],
+                 100.0 * (summary[metric] - base) / base))
+    base = baseline.get('peak_rss_kib')
+    if base and summary['peak_rss_kib'] > base * (1.0 + tolerance):
+        regressions.append(
+            '%s: peak_rss_kib grew from %d to %d (+%.1f%%)' %
+            (key, base, summary['peak_rss_kib'],
+             100.0 * (summary['peak_rss_kib'] - base) / base))
+    # Binaries that were raised when the baseline was recorded should still
+    # be raised.
+    base = baseline.get('binaries_raised')
+    if base and summary['binaries_raised'] < base:
+        regressions.append('%s: only %d of %d binaries raised' %
+                           (key, summary['binaries_raised'], base))
+    return regressions
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description='Measure raising throughput of llvm-mctoll on a fixed '
+        'corpus of binaries and compare it against stored baselines.')
+    parser.add_argument('--tools-dir', help='Directory containing llvm-mctoll,'
+                        ' clang and llvm-objdump')
+    parser.add_argument('--mctoll', help='Path to llvm-mctoll')
+    parser.add_argument('--clang', help='Path to clang')
+    parser.add_argument('--objdump', help='Path to llvm-objdump')
+    parser.add_argument('--targets', default='x86-64,arm',
+                        help='Comma separated list of targets (default: '
+                        '%(default)s). Targets whose binaries cannot be built '
+                        'are skipped.')
+    parser.add_argument('--opt-levels', default='O0,O2',
+                        help='Comma separated list of optimization levels '
+                        '(default: %(default)s)')
+    parser.add_argument('--arm-sysroot', help='Sysroot used to link ARM '
+                        'binaries')
+    parser.add_argument('--extra-source', action='append', default=[],
+                        help='Additional C source (e.g. sqlite3.c) to compile '
+                        'as a shared library and raise')
+    parser.add_argument('-I', '--include', action='append',
+                        help='Header passed to llvm-mctoll with -I (default: '
+                        + ', '.join(DEFAULT_INCLUDES) + ')')
+    parser.add_argument('--repeat', type=int, default=3,
+                        help='Number of times each binary is raised; the '
+                        'median time is reported (default: %(default)s)')
+    parser.add_argument('--baselines',
+                        default=os.path.join(SCRIPT_DIR, 'baselines.json'),
+                        help='Baselines file (default: %(default)s)')
+    parser.add_argument('--tolerance', type=float, default=0.10,
+                        help='Allowed relative regression (default: '
+                        '%(default)s)')
+    parser.add_argument('--update-baselines', action='store_true',
+                        help='Store the results as the new baselines')
+    parser.add_argument('--output', help='Write detailed results to this '
+                        'JSON file')
+    parser.add_argument('--work-dir', help='Directory for the compiled corpus '
+                        'and raised output (default: a temporary directory)')
+    parser.add_argument('-v', '--verbose', action='store_true',
+                        help='Print the results of each binary')
+    args = parser.parse_args()
+
+    args.mctoll = args.mctoll or find_tool('llvm-mctoll', args.tools_dir)
+    args.clang = args.clang or find_tool('clang', args.tools_dir)
+    args.objdump = args.objdump or find_tool('llvm-objdump', args.tools_dir)
+    for tool in ('mctoll', 'clang', 'objdump'):
+        if not getattr(args, tool):
+            parser.error('unable to find %s' % tool)
+    args.include = args.include or [
+        inc for inc in DEFAULT_INCLUDES if os.path.exists(inc)
+    ]
+    if args.repeat < 1:
+        parser.error('--repeat must be at least 1')
+
+    corpus = get_corpus(args.extra_source)
+    work_dir = args.work_dir or tempfile.mkdtemp(prefix='mctoll-bench-')
+
+    baselines = {}
+    if os.path.exists(args.baselines):
+        with open(args.baselines) as f:
+            baselines = json.load(f).get('configurations', {})
+
+    results = {}
+    regressions = []
+    warnings = []
+    for target in args.targets.split(','):
+        if target not in TARGETS:
+            parser.error('unknown target %s' % target)
+        for opt in args.opt_levels.split(','):
+            key = '%s/%s' % (target, opt)
+            summary, binaries = bench_config(args, target, opt, corpus,
+                                             work_dir)
+            if summary['binaries_raised'] == 0:
+                print('%-12s skipped: no binaries could be built and raised' %
+                      key)
+                if key in baselines:
+                    regressions.append('%s: no binaries raised' % key)
+                continue
+            results[key] = {'summary': summary, 'binaries': binaries}
+            print('%-12s %5d binaries %7d functions %9.1f functions/sec '
+                  '%11.1f instructions/sec %8d KiB peak RSS' %
+                  (key, summary['binaries_raised'], summary['functions'],
+                   summary['functions_per_sec'],
+                   summary['instructions_per_sec'], summary['peak_rss_kib']))
+            if args.verbose:
+                for name, res in sorted(binaries.items()):
+                    if res['status'] != 'ok':
+                        print('    %-40s %s' % (name, res['status']))
+                    else:
+                        print('    %-40s %5d functions %7d instructions '
+                              '%8.3f s %8d KiB' %
+                              (name, res['functions'], res['instructions'],
+                               res['time_sec'], res['peak_rss_kib']))
+            if key in baselines:
+                regressions += compare(key, summary, baselines[key],
+                                       args.tolerance, warnings)
+            elif not args.update_baselines:
+                warnings.append('%s: no baseline recorded; record baselines '
+                                'with --update-baselines' % key)
+
+    if args.output:
+        with open(args.output, 'w') as f:
+            json.dump(results, f, indent=2, sort_keys=True)
+
+    if not args.work_dir:
+        shutil.rmtree(work_dir, ignore_errors=True)
+
+    if args.update_baselines:
+        with open(args.baselines, 'w') as f:
+            json.dump({
+                'host': platform.node(),
+                'configurations': {
+                    key: res['summary'] for key, res in results.items()
+                }
+            }, f, indent=2, sort_keys=True)
+            f.write('\n')
+        print('Baselines written to %s' % args.baselines)
+        return 0
+
+    if warnings:
+        print('\nWarnings:')
+        for msg in warnings:
+            print('  ' + msg)
+
+    if regressions:
+        print('\nPerformance regressions (tolerance %.0f%%):' %
+              (100.0 * args.tolerance))
+        for msg in regressions:
+            print('  ' + msg)
+        return 1
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
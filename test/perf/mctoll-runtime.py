@@ -0,0 +1,243 @@
+#!/usr/bin/env python3
+# ===-- mctoll-runtime.py - Performance of raised code ----------*- python -*-===#
+#
+# Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+# See https://llvm.org/LICENSE.txt for license information.
+# SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+#
+# ===------------------------------------------------------------------------===#
+#
+# Compiles dhrystone, the self-contained smoke test programs and the CPU
+# kernels in kernels/ at -O2, raises each binary, recompiles the raised IR at
+# -O2 and times the original and the recompiled binary over repeated runs.
+# The slowdown of raised code (recompiled time / original time) is reported
+# for each program along with the geometric mean. Given the results of an
+# earlier run with --baseline, the change in slowdown of each program is
+# reported as well, to quantify the effect of changes to the raiser on the
+# performance of raised code.
+#
+# ===------------------------------------------------------------------------===#
+
+import argparse
+import glob
+import json
+import math
+import os
+import shutil
+import statistics
+import subprocess
+import sys
+import tempfile
+
+from perfutil import find_tool, run_and_measure
+
+SCRIPT_DIR = os.path.dirname(os.path.abspath(__file__))
+TEST_DIR = os.path.dirname(SCRIPT_DIR)
+
+DEFAULT_INCLUDES = [
+    '/usr/include/stdlib.h', '/usr/include/string.h', '/usr/include/stdio.h',
+    '/usr/include/time.h'
+]
+
+
+class Program(object):
+    """A program of the suite. Output of programs with verify set is
+    compared between the original and the recompiled binary."""
+
+    def __init__(self, name, sources, flags=None, verify=True):
+        self.name = name
+        self.sources = sources
+        self.flags = flags or []
+        self.verify = verify
+
+
+def get_programs(include_smoke_tests):
+    programs = []
+    for src in sorted(glob.glob(os.path.join(SCRIPT_DIR, 'kernels', '*.c'))):
+        programs.append(Program(os.path.basename(src)[:-2], [src]))
+    # Dhrystone prints timing information, so its output is not compared.
+    programs.append(
+        Program('dhrystone', [
+            os.path.join(TEST_DIR, 'dhrystone', 'dhry_main.c'),
+            os.path.join(TEST_DIR, 'dhrystone', 'dhry_funcs_mod.c')
+        ], ['-DTIME', '-DHZ=2133', '-DNOSTRUCTASSIGN', '-mno-sse'],
+                verify=False))
+    if include_smoke_tests:
+        for src in sorted(
+                glob.glob(os.path.join(TEST_DIR, 'smoke_test', '*.c'))):
+            programs.append(
+                Program('smoke/' + os.path.basename(src)[:-2], [src]))
+    return programs
+
+
+def run_output(binary):
+    try:
+        out = subprocess.run([binary], stdout=subprocess.PIPE,
+                             stderr=subprocess.STDOUT, timeout=600)
+    except subprocess.TimeoutExpired:
+        return None
+    return (out.returncode, out.stdout)
+
+
+def time_binary(binary, repeat):
+    times = []
+    for _ in range(repeat):
+        rc, elapsed, _ = run_and_measure([binary])
+        if rc < 0:
+            return None
+        times.append(elapsed)
+    return statistics.median(times)
+
+
+def bench_program(args, prog, work_dir):
+    base = os.path.join(work_dir, prog.name.replace('/', '_'))
+    orig = base + '-orig'
+    raised_ll = base + '-dis.ll'
+    raised = base + '-raised'
+
+    cmd = [args.clang, '-O2', '-o', orig] + prog.flags + prog.sources
+    if subprocess.call(cmd, stdout=subprocess.DEVNULL,
+                       stderr=subprocess.DEVNULL) != 0:
+        return {'status': 'compile-failed'}
+
+    cmd = [args.mctoll, '-d', '-o', raised_ll]
+    for inc in args.include:
+        cmd += ['-I', inc]
+    cmd.append(orig)
+    if subprocess.call(cmd, stdout=subprocess.DEVNULL,
+                       stderr=subprocess.DEVNULL) != 0:
+        return {'status': 'raise-failed'}
+
+    cmd = [args.clang, '-O2', '-o', raised, raised_ll]
+    if subprocess.call(cmd, stdout=subprocess.DEVNULL,
+                       stderr=subprocess.DEVNULL) != 0:
+        return {'status': 'recompile-failed'}
+
+    orig_out = run_output(orig)
+    raised_out = run_output(raised)
+    if raised_out is None:
+        return {'status': 'timeout'}
+    if prog.verify and orig_out != raised_out:
+        return {'status': 'output-mismatch'}
+
+    orig_time = time_binary(orig, args.repeat)
+    raised_time = time_binary(raised, args.repeat)
+    if orig_time is None or raised_time is None:
+        return {'status': 'crashed'}
+    return {
+        'status': 'ok',
+        'original_sec': orig_time,
+        'raised_sec': raised_time,
+        'slowdown': raised_time / orig_time if orig_time else float('nan'),
+    }
+
+
+def geomean(values):
+    values = [v for v in values if v > 0 and not math.isnan(v)]
+    if not values:
+        return float('nan')
+    return math.exp(sum(math.log(v) for v in values) / len(values))
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description='Compare the run time of raised and recompiled binaries '
+        'against the original binaries.')
+    parser.add_argument('--tools-dir', help='Directory containing llvm-mctoll'
+                        ' and clang')
+    parser.add_argument('--mctoll', help='Path to llvm-mctoll')
+    parser.add_argument('--clang', help='Path to clang')
+    parser.add_argument('-I', '--include', action='append',
+                        help='Header passed to llvm-mctoll with -I (default: '
+                        + ', '.join(DEFAULT_INCLUDES) + ')')
+    parser.add_argument('--repeat', type=int, default=5,
+                        help='Number of timed runs of each binary; the median '
+                        'is reported (default: %(default)s)')
+    parser.add_argument('--no-smoke-tests', action='store_true',
+                        help='Only run dhrystone and the kernels')
+    parser.add_argument('--filter', help='Only run programs whose name '
+                        'contains this string')
+    parser.add_argument('--baseline', help='Results of an earlier run '
+                        '(written with --output) to compare against')
+    parser.add_argument('--max-slowdown', type=float,
+                        help='Fail if the geometric mean slowdown exceeds '
+                        'this value')
+    parser.add_argument('--output', help='Write the results to this JSON '
+                        'file')
+    parser.add_argument('--work-dir', help='Directory for the binaries '
+                        '(default: a temporary directory)')
+    args = parser.parse_args()
+
+    args.mctoll = args.mctoll or find_tool('llvm-mctoll', args.tools_dir)
+    args.clang = args.clang or find_tool('clang', args.tools_dir)
+    if not args.mctoll or not args.clang:
+        parser.error('unable to find llvm-mctoll or clang')
+    args.include = args.include or [
+        inc for inc in DEFAULT_INCLUDES if os.path.exists(inc)
+    ]
+    if args.repeat < 1:
+        parser.error('--repeat must be at least 1')
+
+    baseline = {}
+    if args.baseline:
+        with open(args.baseline) as f:
+            baseline = json.load(f)
+
+    work_dir = args.work_dir or tempfile.mkdtemp(prefix='mctoll-runtime-')
+    os.makedirs(work_dir, exist_ok=True)
+
+    header = '%-36s %10s %10s %9s' % ('program', 'original', 'raised',
+                                      'slowdown')
+    if baseline:
+        header += ' %9s %8s' % ('baseline', 'change')
+    print(header)
+
+    results = {}
+    for prog in get_programs(not args.no_smoke_tests):
+        if args.filter and args.filter not in prog.name:
+            continue
+        res = bench_program(args, prog, work_dir)
+        results[prog.name] = res
+        if res['status'] != 'ok':
+            print('%-36s %s' % (prog.name, res['status']))
+            continue
+        line = '%-36s %9.3fs %9.3fs %8.2fx' % (prog.name, res['original_sec'],
+                                               res['raised_sec'],
+                                               res['slowdown'])
+        base = baseline.get(prog.name, {})
+        if base.get('status') == 'ok':
+            line += ' %8.2fx %+7.1f%%' % (
+                base['slowdown'],
+                100.0 * (res['slowdown'] - base['slowdown']) / base['slowdown'])
+        print(line)
+
+    ok = {name: res for name, res in results.items() if res['status'] == 'ok'}
+    mean = geomean([res['slowdown'] for res in ok.values()])
+    print('\n%d of %d programs raised and run correctly' %
+          (len(ok), len(results)))
+    line = 'Geometric mean slowdown of raised code: ' + (
+        '%.2fx' % mean if ok else 'n/a')
+    # Compare against the baseline over the programs measured in both runs.
+    common = [name for name in ok if baseline.get(name, {}).get('status') ==
+              'ok']
+    if common:
+        new = geomean([ok[name]['slowdown'] for name in common])
+        old = geomean([baseline[name]['slowdown'] for name in common])
+        line += ' (%.2fx -> %.2fx over %d programs common with baseline)' % (
+            old, new, len(common))
+    print(line)
+
+    if args.output:
+        with open(args.output, 'w') as f:
+            json.dump(results, f, indent=2, sort_keys=True)
+    if not args.work_dir:
+        shutil.rmtree(work_dir, ignore_errors=True)
+
+    if args.max_slowdown is not None and mean > args.max_slowdown:
+        print('Geometric mean slowdown exceeds %.2fx' % args.max_slowdown)
+        return 1
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
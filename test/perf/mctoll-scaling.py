@@ -0,0 +1,209 @@
+#!/usr/bin/env python3
+# ===-- mctoll-scaling.py - Raiser complexity stress test -------*- python -*-===#
+#
+# Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+# See https://llvm.org/LICENSE.txt for license information.
+# SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+#
+# ===------------------------------------------------------------------------===#
+#
+# Generates C programs whose size grows along one axis at a time, builds them
+# with the host toolchain and raises them with llvm-mctoll. The time and peak
+# memory used to raise each program is recorded and a power law
+# (cost = c * size^k) is fit to the measurements of each axis, so that
+# superlinear behavior of the raiser shows up as an exponent k > 1.
+#
+# The axes are
+#   blocks    - a single function with a growing number of basic blocks
+#   switch    - a single function with a growing dense switch (jump table)
+#   symbols   - a growing number of small functions and global symbols
+#   tailcalls - a growing chain of functions ending in tail calls, which
+#               stresses return type propagation across callees
+#
+# ===------------------------------------------------------------------------===#
+
+import argparse
+import json
+import math
+import os
+import shutil
+import subprocess
+import sys
+import tempfile
+
+from perfutil import find_tool, run_and_measure
+
+
+def gen_blocks(n):
+    """One function with about n basic blocks."""
+    lines = ['int blocks(int x) {', '  int r = 0;']
+    for i in range(n // 2):
+        lines.append('  if (x & %d)' % ((i % 31) + 1))
+        lines.append('    r += %d;' % (i + 1))
+        lines.append('  else')
+        lines.append('    r ^= %d;' % (i + 1))
+    lines += ['  return r;', '}', '',
+              'int main(int argc, char **argv) { return blocks(argc) & 1; }']
+    return '\n'.join(lines) + '\n'
+
+
+def gen_switch(n):
+    """One function with a dense switch of n cases."""
+    lines = ['int sw(int x) {', '  switch (x) {']
+    for i in range(n):
+        lines.append('  case %d: return x * %d + %d;' % (i, i + 3, i))
+    lines += ['  default: return -1;', '  }', '}', '',
+              'int main(int argc, char **argv) { return sw(argc) & 1; }']
+    return '\n'.join(lines) + '\n'
+
+
+def gen_symbols(n):
+    """n small functions each referencing a distinct global variable."""
+    lines = []
+    for i in range(n):
+        lines.append('int g%d = %d;' % (i, i))
+        lines.append('int f%d(int x) { return x + g%d; }' % (i, i))
+    lines += ['', 'int main(int argc, char **argv) {', '  int r = 0;']
+    # Call a bounded subset so that main does not dominate the raising time.
+    for i in range(0, n, max(1, n // 64)):
+        lines.append('  r += f%d(argc);' % i)
+    lines += ['  return r & 1;', '}']
+    return '\n'.join(lines) + '\n'
+
+
+def gen_tailcalls(n):
+    """A chain of n functions, each tail calling the next one."""
+    lines = ['int t%d(long x) { return (int)x; }' % n]
+    for i in range(n - 1, -1, -1):
+        lines.append('__attribute__((noinline)) int t%d(long x) '
+                     '{ return t%d(x + %d); }' % (i, i + 1, i))
+    lines += ['', 'int main(int argc, char **argv) { return t0(argc) & 1; }']
+    # Functions are defined callee first so that no declarations are needed.
+    lines[0] = '__attribute__((noinline)) ' + lines[0]
+    return '\n'.join(lines) + '\n'
+
+
+# Axis -> (generator, optimization level, default sizes).
+AXES = {
+    'blocks': (gen_blocks, 'O0', [500, 1000, 2000, 4000, 8000]),
+    'switch': (gen_switch, 'O0', [250, 500, 1000, 2000, 4000]),
+    'symbols': (gen_symbols, 'O0', [1000, 2000, 4000, 8000, 16000]),
+    # Tail calls are only emitted with optimization.
+    'tailcalls': (gen_tailcalls, 'O2', [250, 500, 1000, 2000, 4000]),
+}
+
+
+def fit_exponent(sizes, values):
+    """Least squares fit of log(value) = k * log(size) + c. Return k."""
+    points = [(math.log(s), math.log(v)) for s, v in zip(sizes, values)
+              if v > 0]
+    if len(points) < 2:
+        return float('nan')
+    mean_x = sum(x for x, _ in points) / len(points)
+    mean_y = sum(y for _, y in points) / len(points)
+    var = sum((x - mean_x) ** 2 for x, _ in points)
+    if var == 0:
+        return float('nan')
+    return sum((x - mean_x) * (y - mean_y) for x, y in points) / var
+
+
+def run_axis(args, axis, sizes, work_dir):
+    gen, opt, _ = AXES[axis]
+    curve = []
+    for size in sizes:
+        base = os.path.join(work_dir, '%s-%d' % (axis, size))
+        with open(base + '.c', 'w') as f:
+            f.write(gen(size))
+        if subprocess.call([args.cc, '-' + opt, '-o', base, base + '.c'],
+                           stdout=subprocess.DEVNULL,
+                           stderr=subprocess.DEVNULL) != 0:
+            print('%-10s %8d  compile failed' % (axis, size))
+            continue
+        rc, elapsed, rss = run_and_measure(
+            [args.mctoll, '-d', '-o', base + '-dis.ll', base])
+        status = 'ok' if rc == 0 else 'raise failed (%d)' % rc
+        print('%-10s %8d %10.3f s %10d KiB  %s' % (axis, size, elapsed, rss,
+                                                   status))
+        curve.append({'size': size, 'time_sec': elapsed, 'peak_rss_kib': rss,
+                      'status': status})
+        if elapsed > args.timeout:
+            print('%-10s stopping: raising took more than %d s' %
+                  (axis, args.timeout))
+            break
+    ok = [p for p in curve if p['status'] == 'ok']
+    time_exp = fit_exponent([p['size'] for p in ok],
+                            [p['time_sec'] for p in ok])
+    rss_exp = fit_exponent([p['size'] for p in ok],
+                           [p['peak_rss_kib'] for p in ok])
+    return {'opt': opt, 'points': curve, 'time_exponent': time_exp,
+            'rss_exponent': rss_exp}
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description='Measure how raising time and memory scale with the size '
+        'of synthetic binaries.')
+    parser.add_argument('--tools-dir', help='Directory containing llvm-mctoll')
+    parser.add_argument('--mctoll', help='Path to llvm-mctoll')
+    parser.add_argument('--cc', help='Host C compiler (default: clang, else cc)')
+    parser.add_argument('--axes', default=','.join(sorted(AXES)),
+                        help='Comma separated list of axes (default: '
+                        '%(default)s)')
+    parser.add_argument('--sizes', help='Comma separated list of sizes used '
+                        'for every axis instead of the per-axis defaults')
+    parser.add_argument('--scale', type=float, default=1.0,
+                        help='Multiply the default sizes by this factor')
+    parser.add_argument('--timeout', type=int, default=600,
+                        help='Stop growing an axis once raising takes longer '
+                        'than this many seconds (default: %(default)s)')
+    parser.add_argument('--max-exponent', type=float,
+                        help='Fail if the fitted time exponent of any axis '
+                        'exceeds this value')
+    parser.add_argument('--output', help='Write the curves to this JSON file')
+    parser.add_argument('--work-dir', help='Directory for the generated '
+                        'programs (default: a temporary directory)')
+    args = parser.parse_args()
+
+    args.mctoll = args.mctoll or find_tool('llvm-mctoll', args.tools_dir)
+    args.cc = (args.cc or find_tool('clang', args.tools_dir) or
+               shutil.which('cc'))
+    if not args.mctoll or not args.cc:
+        parser.error('unable to find llvm-mctoll or a C compiler')
+
+    work_dir = args.work_dir or tempfile.mkdtemp(prefix='mctoll-scaling-')
+    os.makedirs(work_dir, exist_ok=True)
+
+    results = {}
+    for axis in args.axes.split(','):
+        if axis not in AXES:
+            parser.error('unknown axis %s' % axis)
+        if args.sizes:
+            sizes = [int(s) for s in args.sizes.split(',')]
+        else:
+            sizes = [max(1, int(s * args.scale)) for s in AXES[axis][2]]
+        results[axis] = run_axis(args, axis, sizes, work_dir)
+
+    print('\n%-10s %14s %14s' % ('axis', 'time exponent', 'rss exponent'))
+    failed = []
+    for axis, res in results.items():
+        print('%-10s %14.2f %14.2f' % (axis, res['time_exponent'],
+                                       res['rss_exponent']))
+        if (args.max_exponent is not None and
+                res['time_exponent'] > args.max_exponent):
+            failed.append(axis)
+
+    if args.output:
+        with open(args.output, 'w') as f:
+            json.dump(results, f, indent=2, sort_keys=True)
+    if not args.work_dir:
+        shutil.rmtree(work_dir, ignore_errors=True)
+
+    if failed:
+        print('\nTime exponent exceeds %.2f for: %s' %
+              (args.max_exponent, ', '.join(failed)))
+        return 1
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -0,0 +1,33 @@
+# ===-- perfutil.py - Helpers shared by the perf scripts --------*- python -*-===#
+#
+# Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+# See https://llvm.org/LICENSE.txt for license information.
+# SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+#
+# ===------------------------------------------------------------------------===#
+
+import os
+import shutil
+import subprocess
+import time
+
+
+def run_and_measure(cmd):
+    """Run cmd and return (exit code, wall time in seconds, peak RSS in KiB)."""
+    start = time.perf_counter()
+    proc = subprocess.Popen(cmd, stdout=subprocess.DEVNULL,
+                            stderr=subprocess.DEVNULL)
+    _, status, rusage = os.wait4(proc.pid, 0)
+    elapsed = time.perf_counter() - start
+    proc.returncode = (os.WEXITSTATUS(status) if os.WIFEXITED(status) else
+                       -os.WTERMSIG(status))
+    return proc.returncode, elapsed, rusage.ru_maxrss
+
+
+def find_tool(name, tools_dir):
+    """Return the path of tool name, preferring the one in tools_dir."""
+    if tools_dir:
+        path = os.path.join(tools_dir, name)
+        if os.path.exists(path):
+            return path
+    return shutil.which(name)
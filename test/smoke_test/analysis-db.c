@@ -0,0 +1,27 @@
+// REQUIRES: system-linux
+// RUN: clang -o %t %s -O1
+// RUN: rm -f %t.db
+// RUN: llvm-mctoll -d -I /usr/include/stdio.h --analysis-db=%t.db %t
+// RUN: FileCheck %s -check-prefix=DB < %t.db
+// RUN: llvm-mctoll -d -I /usr/include/stdio.h --analysis-db=%t.db -o %t-reused.ll %t
+// RUN: FileCheck %s -check-prefix=IR < %t-reused.ll
+// RUN: clang -o %t-dis %t-reused.ll
+// RUN: %t-dis 2>&1 | FileCheck %s
+// A prototype recorded for the code of add_scaled is used rather than the one
+// discovered, even if it is wrong.
+// RUN: sed -e 's/"i32 (i32, i32)"/"i64 (i32, i32)"/' %t.db > %t-poisoned.db
+// RUN: llvm-mctoll -d -I /usr/include/stdio.h --analysis-db=%t-poisoned.db -o %t-poisoned.ll %t
+// RUN: FileCheck %s -check-prefix=POISONED < %t-poisoned.ll
+// DB: "prototype": "i32 (i32, i32)"
+// IR: define dso_local i32 @add_scaled(i32 %arg1, i32 %arg2)
+// POISONED: define dso_local i64 @add_scaled(i32 %arg1, i32 %arg2)
+// CHECK: add_scaled(3, 4) = 15
+
+#include <stdio.h>
+
+__attribute__((noinline)) int add_scaled(int A, int B) { return A + B * 3; }
+
+int main(int argc, char **argv) {
+  printf("add_scaled(3, 4) = %d\n", add_scaled(3, 4));
+  return 0;
+}
@@ -0,0 +1,31 @@
+// REQUIRES: system-linux
+// RUN: clang -o %t %s -O2
+// RUN: llvm-mctoll -d -I /usr/include/stdio.h -I /usr/include/stdlib.h %t
+// RUN: FileCheck --check-prefix=IR %s < %t-dis.ll
+// RUN: clang -o %t-dis %t-dis.ll
+// RUN: %t-dis 2>&1 | FileCheck %s
+// IR-DAG: !{!"branch_weights", i32 124, i32 4}
+// IR-DAG: !{!"branch_weights", i32 {{1, i32 1048575|1048575, i32 1}}}
+// CHECK: hash: 1026
+// CHECK-NEXT: hash: 0
+
+#include <stdio.h>
+#include <stdlib.h>
+
+// The branch to the call to abort is unlikely and the loop back edge is
+// likely.
+int __attribute__((noinline)) hash(const int *A, int N) {
+  if (N < 0)
+    abort();
+  int H = 0;
+  for (int I = 0; I < N; I++)
+    H = H * 31 + A[I];
+  return H;
+}
+
+int main(void) {
+  int A[] = {1, 2, 3};
+  printf("hash: %d\n", hash(A, 3));
+  printf("hash: %d\n", hash(A, 0));
+  return 0;
+}
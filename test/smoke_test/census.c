@@ -0,0 +1,21 @@
+// REQUIRES: system-linux
+// RUN: clang -o %t %s -O2
+// RUN: llvm-mctoll -d --census %t | FileCheck %s
+// CHECK: Function{{ +}}Insts{{ +}}Blocks{{ +}}IndBr{{ +}}IndCall{{ +}}Cost{{ +}}Unsupported
+// CHECK-DAG: {{^}}sum {{ +}}{{[0-9]+ +[0-9]+ +0 +0 +[0-9]+}}
+// CHECK-DAG: {{^}}main {{ +}}{{[0-9]+ +[0-9]+ +0 +0 +[0-9]+}}
+// CHECK: 2 function(s), {{[0-9]+}} instruction(s), estimated cost {{[0-9]+}}
+
+#include <stdio.h>
+
+__attribute__((noinline)) int sum(int N) {
+  int S = 0;
+  for (int I = 1; I <= N; I++)
+    S += I * I;
+  return S;
+}
+
+int main(int argc, char **argv) {
+  printf("sum(10) = %d\n", sum(argc + 9));
+  return 0;
+}
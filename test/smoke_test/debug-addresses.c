@@ -0,0 +1,24 @@
+// REQUIRES: system-linux
+// RUN: clang -o %t %s -O2
+// RUN: llvm-mctoll -d --debug-addresses -I /usr/include/stdio.h %t
+// RUN: FileCheck --check-prefix=IR %s < %t-dis.ll
+// RUN: clang -o %t-dis %t-dis.ll
+// RUN: %t-dis 2>&1 | FileCheck %s
+// IR: define dso_local i32 @square(i32 %arg1) {{.*}}!dbg [[SQUARE:![0-9]+]]
+// IR: mul {{.*}}, !dbg
+// IR: define dso_local i32 @main({{.*}}!dbg [[MAIN:![0-9]+]]
+// IR: call {{.*}}@printf({{.*}}, !dbg
+// IR-DAG: !{i32 2, !"Debug Info Version", i32 3}
+// IR-DAG: !DICompileUnit(language: DW_LANG_C, {{.*}}producer: "llvm-mctoll"
+// IR-DAG: [[SQUARE]] = distinct !DISubprogram(name: "square"
+// IR-DAG: [[MAIN]] = distinct !DISubprogram(name: "main"
+// CHECK: square: 49
+
+#include <stdio.h>
+
+int __attribute__((noinline)) square(int X) { return X * X; }
+
+int main(void) {
+  printf("square: %d\n", square(7));
+  return 0;
+}
@@ -0,0 +1,32 @@
+// REQUIRES: system-linux
+// RUN: clang -o %t %s -O2
+// RUN: llvm-mctoll -d -I /usr/include/stdio.h %t
+// RUN: FileCheck --check-prefix=IR %s < %t-dis.ll
+// RUN: clang -o %t-dis %t-dis.ll
+// RUN: %t-dis 2>&1 | FileCheck %s
+// IR-LABEL: define dso_local i64 @print_squares(
+// IR-NOT: 3735928559
+// IR: ret i64
+// CHECK: square: 1
+// CHECK-NEXT: square: 4
+// CHECK-NEXT: square: 9
+// CHECK-NEXT: sum: 14
+
+#include <stdio.h>
+
+// I, N and S are live across calls to printf, so they are held in
+// callee-saved registers that are saved in the prolog and restored in the
+// epilog.
+long __attribute__((noinline)) print_squares(int N) {
+  long S = 0;
+  for (int I = 1; I <= N; I++) {
+    printf("square: %d\n", I * I);
+    S += I * I;
+  }
+  return S;
+}
+
+int main(void) {
+  printf("sum: %ld\n", print_squares(3));
+  return 0;
+}
@@ -0,0 +1,31 @@
+// REQUIRES: system-linux
+// RUN: clang -o %t %s -O1
+// RUN: llvm-mctoll -d -I /usr/include/stdio.h --fallback=trap %t 2>&1 | FileCheck %s -check-prefix=WARN
+// RUN: FileCheck %s -check-prefix=IR < %t-dis.ll
+// RUN: clang -o %t-dis %t-dis.ll
+// RUN: %t-dis 2>&1 | FileCheck %s
+// WARN: The following function(s) failed to raise and are emitted as trapping stubs :
+// WARN-NEXT: cpu_vendor : failed while raising
+// IR: define dso_local i32 @cpu_vendor(
+// IR-NEXT: entry:
+// IR-NEXT: call void @llvm.trap()
+// IR-NEXT: unreachable
+// CHECK: square(7) = 49
+
+#include <stdio.h>
+
+// cpuid is not raised.
+__attribute__((noinline)) int cpu_vendor(int Leaf) {
+  int A, B, C, D;
+  __asm__ volatile("cpuid" : "=a"(A), "=b"(B), "=c"(C), "=d"(D) : "a"(Leaf));
+  return B;
+}
+
+__attribute__((noinline)) int square(int N) { return N * N; }
+
+int main(int argc, char **argv) {
+  if (argc > 5)
+    printf("vendor = %x\n", cpu_vendor(0));
+  printf("square(7) = %d\n", square(7));
+  return 0;
+}
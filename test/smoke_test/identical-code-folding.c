@@ -0,0 +1,34 @@
+// REQUIRES: system-linux
+// RUN: clang -o %t %s -O1
+// RUN: llvm-mctoll -d -I /usr/include/stdio.h --icf %t
+// RUN: FileCheck %s -check-prefix=IR < %t-dis.ll
+// RUN: clang -o %t-dis %t-dis.ll
+// RUN: %t-dis 2>&1 | FileCheck %s
+// RUN: llvm-mctoll -d -I /usr/include/stdio.h -o %t-noicf.ll %t
+// RUN: FileCheck %s -check-prefix=NOICF < %t-noicf.ll
+// IR-DAG: @scale_b = alias {{.*}} @scale_a
+// IR-DAG: @scale_c = internal alias {{.*}} @scale_a
+// IR-NOT: define {{.*}} @scale_b(
+// IR-NOT: define {{.*}} @scale_c(
+// NOICF-DAG: define dso_local i32 @scale_a(
+// NOICF-DAG: define dso_local i32 @scale_b(
+// NOICF-DAG: define dso_local i32 @scale_c(
+// NOICF-NOT: alias
+// CHECK: scale_a(3) = 22
+// CHECK: scale_b(5) = 36
+// CHECK: scale_c(1) = 8
+
+#include <stdio.h>
+
+__attribute__((noinline)) int scale_a(int N) { return N * 7 + 1; }
+
+__attribute__((noinline)) int scale_b(int N) { return N * 7 + 1; }
+
+__attribute__((noinline)) static int scale_c(int N) { return N * 7 + 1; }
+
+int main(int argc, char **argv) {
+  printf("scale_a(3) = %d\n", scale_a(3));
+  printf("scale_b(5) = %d\n", scale_b(5));
+  printf("scale_c(1) = %d\n", scale_c(1));
+  return 0;
+}
@@ -0,0 +1,38 @@
+// REQUIRES: system-linux
+// RUN: clang -o %t-v1 %s -O1
+// RUN: llvm-mctoll -d -I /usr/include/stdio.h -o %t-v1.ll %t-v1
+// RUN: clang -o %t-v2 %s -O1 -DPATCHED
+// RUN: llvm-mctoll -d -I /usr/include/stdio.h --previous-binary=%t-v1 --previous-module=%t-v1.ll -o %t-v2.ll %t-v2
+// RUN: FileCheck %s -check-prefix=IR < %t-v2.ll
+// RUN: clang -o %t-dis %t-v2.ll
+// RUN: %t-dis 2>&1 | FileCheck %s
+// Only the values referenced by the copied functions are copied.
+// IR-NOT: @legacy
+// CHECK: offset(5) = 17
+// CHECK: square(5) = 25
+
+#include <stdio.h>
+
+// The patched function precedes the unchanged one, which therefore moves.
+__attribute__((noinline)) int offset(int N) {
+#ifdef PATCHED
+  return N * 3 + 2;
+#else
+  return N + 1;
+#endif
+}
+
+__attribute__((noinline)) int square(int N) { return N * N; }
+
+#ifndef PATCHED
+__attribute__((noinline)) int legacy(int N) { return N - 1; }
+#endif
+
+int main(int argc, char **argv) {
+  printf("offset(5) = %d\n", offset(5));
+  printf("square(5) = %d\n", square(5));
+#ifndef PATCHED
+  printf("legacy(5) = %d\n", legacy(5));
+#endif
+  return 0;
+}
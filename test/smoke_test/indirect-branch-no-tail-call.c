@@ -0,0 +1,46 @@
+// REQUIRES: system-linux
+// RUN: clang -o %t %s -O2
+// RUN: llvm-mctoll -d -I /usr/include/stdio.h --fallback=trap %t 2>&1 | FileCheck %s -check-prefix=WARN
+// RUN: FileCheck %s -check-prefix=IR < %t-dis.ll
+// RUN: clang -o %t-dis %t-dis.ll
+// RUN: %t-dis 2>&1 | FileCheck %s
+// WARN: The following function(s) failed to raise and are emitted as trapping stubs :
+// WARN-NEXT: run : failed while
+// IR-LABEL: define {{.*}}@run(
+// IR-NEXT: entry:
+// IR-NEXT: call void @llvm.trap()
+// IR-NEXT: unreachable
+// IR-LABEL: define {{.*}}@forward(
+// IR: tail call
+// CHECK: forward: 42
+
+#include <stdio.h>
+
+// The indirect jumps of a computed goto transfer control within the function
+// and are not raised as tail calls.
+__attribute__((noinline)) int run(const unsigned char *Ops) {
+  static const void *Labels[] = {&&inc, &&dbl, &&done};
+  int Acc = 0;
+  goto *Labels[*Ops++];
+inc:
+  Acc++;
+  goto *Labels[*Ops++];
+dbl:
+  Acc *= 2;
+  goto *Labels[*Ops++];
+done:
+  return Acc;
+}
+
+__attribute__((noinline)) int twice(int X) { return 2 * X; }
+
+// Tail jump through a function pointer that is only known to the caller
+__attribute__((noinline)) int forward(int (*F)(int), int X) { return F(X); }
+
+int main(int argc, char **argv) {
+  static const unsigned char Ops[] = {0, 1, 0, 2};
+  if (argc > 5)
+    printf("run: %d\n", run(Ops));
+  printf("forward: %d\n", forward(twice, 21));
+  return 0;
+}
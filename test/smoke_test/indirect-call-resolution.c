@@ -0,0 +1,36 @@
+// REQUIRES: system-linux
+// RUN: clang -o %t %s -O2 -fno-plt
+// RUN: llvm-mctoll -d -I /usr/include/stdio.h %t
+// RUN: FileCheck --check-prefix=IR %s < %t-dis.ll
+// RUN: clang -o %t-dis %t-dis.ll
+// RUN: %t-dis 2>&1 | FileCheck %s
+// IR-DAG: tail call i32 @puts(
+// IR-DAG: call i32 @puts(
+// CHECK: hello
+// CHECK-NEXT: again
+// CHECK-NEXT: again
+// CHECK-NEXT: again
+// CHECK-NEXT: apply: 43
+
+#include <stdio.h>
+
+// Tail jump through the GOT slot of puts
+int __attribute__((noinline)) greet(const char *S) { return puts(S); }
+
+// Calls through the GOT slot of puts
+void __attribute__((noinline)) repeat(const char *S, int N) {
+  for (int I = 0; I < N; I++)
+    puts(S);
+}
+
+int __attribute__((noinline)) twice(int X) { return 2 * X; }
+
+// Call through a function pointer that is only known to the caller
+int __attribute__((noinline)) apply(int (*F)(int), int X) { return F(X) + 1; }
+
+int main(void) {
+  greet("hello");
+  repeat("again", 3);
+  printf("apply: %d\n", apply(twice, 21));
+  return 0;
+}
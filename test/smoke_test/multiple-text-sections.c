@@ -0,0 +1,26 @@
+// REQUIRES: system-linux
+// RUN: clang -o %t %s -O1
+// RUN: llvm-mctoll -d -I /usr/include/stdio.h --section=hot_text %t
+// RUN: clang -o %t-dis %t-dis.ll
+// RUN: %t-dis 2>&1 | FileCheck %s
+// RUN: llvm-mctoll -d -I /usr/include/stdio.h --section=hot_text --threads=1 \
+// RUN:   -o %t-serial.ll %t
+// RUN: diff %t-dis.ll %t-serial.ll
+// CHECK: square(7) = 49
+// CHECK: cube(3) = 27
+
+#include <stdio.h>
+
+__attribute__((noinline, section("hot_text"))) int square(int N) {
+  return N * N;
+}
+
+__attribute__((noinline, section("hot_text"))) int cube(int N) {
+  return square(N) * N;
+}
+
+int main(int argc, char **argv) {
+  printf("square(7) = %d\n", square(7));
+  printf("cube(3) = %d\n", cube(3));
+  return 0;
+}
@@ -0,0 +1,94 @@
+// REQUIRES: system-linux
+// RUN: clang -o %t %s -O2
+// RUN: llvm-mctoll -d -I /usr/include/stdio.h %t
+// RUN: FileCheck --check-prefix=IR %s < %t-dis.ll
+// RUN: clang -o %t-dis %t-dis.ll
+// RUN: %t-dis 2>&1 | FileCheck %s
+// IR-DAG: atomicrmw add
+// IR-DAG: atomicrmw xchg
+// IR-DAG: cmpxchg
+// CHECK: fetch_add: 0 1 3
+// CHECK: exchange: 3 42
+// CHECK: cas: 1 0 7
+// CHECK: release: 1 0
+// CHECK: xadd carry: 1 0
+// CHECK: inc overflow: 0 1
+
+#include <stdio.h>
+
+long Counter;
+int Flag;
+unsigned Word;
+
+long __attribute__((noinline)) fetch_add(long N) {
+  return __atomic_fetch_add(&Counter, N, __ATOMIC_SEQ_CST);
+}
+
+long __attribute__((noinline)) exchange(long V) {
+  return __atomic_exchange_n(&Counter, V, __ATOMIC_SEQ_CST);
+}
+
+int __attribute__((noinline)) cas(int Expected, int Desired) {
+  return __atomic_compare_exchange_n(&Flag, &Expected, Desired, 0,
+                                     __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST);
+}
+
+// Decrement Flag and report whether it dropped to 0, as reference counts do.
+int __attribute__((noinline)) release(void) {
+  __atomic_thread_fence(__ATOMIC_SEQ_CST);
+  return __atomic_sub_fetch(&Flag, 1, __ATOMIC_SEQ_CST) == 0;
+}
+
+// Add V to Word and return the carry of the sum.
+int __attribute__((noinline)) add_carries(unsigned V) {
+  unsigned char Carry;
+  asm volatile("lock xaddl %1, %0\n\t"
+               "setc %2"
+               : "+m"(Word), "+r"(V), "=q"(Carry)
+               :
+               : "memory", "cc");
+  return Carry;
+}
+
+// Increment Flag and report whether the signed result overflowed.
+int __attribute__((noinline)) inc_overflows(void) {
+  int Overflow = 0;
+  asm volatile("lock incl %0\n\t"
+               "jno 1f\n\t"
+               "movl $1, %1\n"
+               "1:"
+               : "+m"(Flag), "+r"(Overflow)
+               :
+               : "memory", "cc");
+  return Overflow;
+}
+
+int main(void) {
+  long A = fetch_add(1);
+  long B = fetch_add(2);
+  long C = fetch_add(0);
+  printf("fetch_add: %ld %ld %ld\n", A, B, C);
+
+  long Old = exchange(42);
+  printf("exchange: %ld %ld\n", Old, Counter);
+
+  int S1 = cas(0, 7);
+  int S2 = cas(0, 8);
+  printf("cas: %d %d %d\n", S1, S2, Flag);
+
+  Flag = 2;
+  int R1 = release();
+  int R2 = release();
+  printf("release: %d %d\n", R2, R1);
+
+  Word = 0xffffffff;
+  int C1 = add_carries(1);
+  int C2 = add_carries(1);
+  printf("xadd carry: %d %d\n", C1, C2);
+
+  Flag = 0x7ffffffe;
+  int O1 = inc_overflows();
+  int O2 = inc_overflows();
+  printf("inc overflow: %d %d\n", O1, O2);
+  return 0;
+}
@@ -0,0 +1,57 @@
+// REQUIRES: system-linux
+// RUN: clang -o %t %s -O2
+// RUN: llvm-mctoll -d -I /usr/include/stdio.h %t
+// RUN: FileCheck --check-prefix=IR %s < %t-dis.ll
+// RUN: clang -o %t-dis %t-dis.ll
+// RUN: %t-dis 2>&1 | FileCheck %s
+// IR-DAG: call i32 @llvm.ctpop.i32(
+// IR-DAG: call i64 @llvm.ctlz.i64(
+// IR-DAG: call i32 @llvm.cttz.i32(
+// IR-DAG: call i32 @llvm.bswap.i32(
+// IR-DAG: call i32 @llvm.fshl.i32(
+// IR-DAG: call i64 @llvm.x86.bmi.pext.64(
+// IR-DAG: call i32 @llvm.x86.sse42.crc32.32.8(
+// CHECK: popcount: 16
+// CHECK: clz: 27
+// CHECK: ctz: 4
+// CHECK: bswap: 0x78563412
+// CHECK: rotl: 0x23456781
+// CHECK: pext: 0xff
+// CHECK: crc32c: 0xe3069283
+
+#include <stdio.h>
+
+#define BITS __attribute__((noinline, target("popcnt,lzcnt,bmi,bmi2,sse4.2")))
+
+int BITS popcount(unsigned X) { return __builtin_popcount(X); }
+
+int BITS clz(unsigned long X) { return __builtin_clzl(X); }
+
+int BITS ctz(unsigned X) { return __builtin_ctz(X); }
+
+unsigned BITS bswap(unsigned X) { return __builtin_bswap32(X); }
+
+unsigned BITS rotl(unsigned X, int N) { return (X << N) | (X >> (-N & 31)); }
+
+unsigned long BITS pext(unsigned long X, unsigned long Mask) {
+  return __builtin_ia32_pext_di(X, Mask);
+}
+
+// CRC-32C of a string, a byte at a time
+unsigned BITS crc32c(const char *S) {
+  unsigned Crc = ~0U;
+  for (; *S; S++)
+    Crc = __builtin_ia32_crc32qi(Crc, *S);
+  return ~Crc;
+}
+
+int main(void) {
+  printf("popcount: %d\n", popcount(0xf0f0f0f0));
+  printf("clz: %d\n", clz(0x1234567890UL));
+  printf("ctz: %d\n", ctz(0x30));
+  printf("bswap: 0x%x\n", bswap(0x12345678));
+  printf("rotl: 0x%x\n", rotl(0x12345678, 4));
+  printf("pext: 0x%lx\n", pext(0xff00ff00UL, 0x0f00f000UL));
+  printf("crc32c: 0x%x\n", crc32c("123456789"));
+  return 0;
+}
@@ -0,0 +1,131 @@
+// REQUIRES: system-linux
+// RUN: clang -o %t %s -O2
+// RUN: llvm-mctoll -d -I /usr/include/stdio.h %t
+// RUN: FileCheck --check-prefix=IR %s < %t-dis.ll
+// RUN: clang -o %t-dis %t-dis.ll
+// RUN: %t-dis 2>&1 | FileCheck %s
+// IR-DAG: add <8 x i32>
+// IR-DAG: fmul <4 x float>
+// IR-DAG: shufflevector
+// IR-DAG: ashr <4 x i32>
+// CHECK: add: 11 22 33 44 55 66 77 88
+// CHECK: scale: 0.5 1 1.5 2
+// CHECK: sign_mask: 5
+// CHECK: sum: 36
+// CHECK: merge: 2 2 3 4 5 6 7 8
+// CHECK: shuffle_bytes: 15 14 13 0 1 2 0 0 8 8 8 8 8 8 8 8
+// CHECK: permute: 8 6 7 5 4 3 2 1
+// CHECK: shift: 2 -2147483648 0 4 -1 -1 -1 -4
+
+#include <immintrin.h>
+#include <stdio.h>
+
+#define AVX2 __attribute__((noinline, target("avx2")))
+
+void AVX2 add(int *Dst, const int *A, const int *B) {
+  __m256i X = _mm256_loadu_si256((const __m256i *)A);
+  __m256i Y = _mm256_loadu_si256((const __m256i *)B);
+  _mm256_storeu_si256((__m256i *)Dst, _mm256_add_epi32(X, Y));
+}
+
+void AVX2 scale(float *Dst, const float *A, float S) {
+  _mm_storeu_ps(Dst, _mm_mul_ps(_mm_loadu_ps(A), _mm_set1_ps(S)));
+}
+
+int AVX2 sign_mask(const float *A) { return _mm_movemask_ps(_mm_loadu_ps(A)); }
+
+// Horizontal sum of 8 ints, across the lanes of a ymm register.
+int AVX2 sum(const int *A) {
+  __m256i V = _mm256_loadu_si256((const __m256i *)A);
+  __m128i S = _mm_add_epi32(_mm256_castsi256_si128(V),
+                            _mm256_extracti128_si256(V, 1));
+  S = _mm_add_epi32(S, _mm_shuffle_epi32(S, 0x4e));
+  S = _mm_add_epi32(S, _mm_shuffle_epi32(S, 0xb1));
+  return _mm_cvtsi128_si32(S);
+}
+
+// A legacy SSE instruction writing xmm0 keeps the upper half of ymm0.
+void AVX2 merge(float *A) {
+  asm volatile("vmovups (%0), %%ymm0\n\t"
+               "addss %%xmm0, %%xmm0\n\t"
+               "vmovups %%ymm0, (%0)\n\t"
+               "vzeroupper"
+               :
+               : "r"(A)
+               : "xmm0", "memory");
+}
+
+// Select bytes by a mask that is only known at run time.
+void AVX2 shuffle_bytes(unsigned char *A, const unsigned char *Mask) {
+  __m128i V = _mm_loadu_si128((const __m128i *)A);
+  __m128i M = _mm_loadu_si128((const __m128i *)Mask);
+  _mm_storeu_si128((__m128i *)A, _mm_shuffle_epi8(V, M));
+}
+
+// Permute elements across the lanes of a ymm register.
+void AVX2 permute(int *A, const int *Indices) {
+  __m256i V = _mm256_loadu_si256((const __m256i *)A);
+  __m256i I = _mm256_loadu_si256((const __m256i *)Indices);
+  V = _mm256_permutevar8x32_epi32(V, I);
+  _mm256_storeu_si256((__m256i *)A, _mm256_permute4x64_epi64(V, 0x4e));
+}
+
+// Shift elements by counts that are only known at run time, including
+// counts of the element size or more.
+void AVX2 shift(int *Dst, const int *A, const int *Counts) {
+  __m128i V = _mm_loadu_si128((const __m128i *)A);
+  __m128i C = _mm_loadu_si128((const __m128i *)Counts);
+  __m128i N = _mm_sub_epi32(_mm_setzero_si128(), V);
+  _mm_storeu_si128((__m128i *)Dst, _mm_sllv_epi32(V, C));
+  _mm_storeu_si128((__m128i *)(Dst + 4), _mm_srav_epi32(N, C));
+}
+
+int main(void) {
+  int A[8] = {1, 2, 3, 4, 5, 6, 7, 8};
+  int B[8] = {10, 20, 30, 40, 50, 60, 70, 80};
+  int C[8];
+  float F[4] = {1, 2, 3, 4};
+  float G[4] = {-1, 2, -3, 4};
+  float H[4];
+
+  add(C, A, B);
+  printf("add:");
+  for (int I = 0; I < 8; I++)
+    printf(" %d", C[I]);
+  printf("\n");
+
+  scale(H, F, 0.5f);
+  printf("scale: %g %g %g %g\n", H[0], H[1], H[2], H[3]);
+
+  printf("sign_mask: %d\n", sign_mask(G));
+  printf("sum: %d\n", sum(A));
+
+  float M[8] = {1, 2, 3, 4, 5, 6, 7, 8};
+  merge(M);
+  printf("merge: %g %g %g %g %g %g %g %g\n", M[0], M[1], M[2], M[3], M[4],
+         M[5], M[6], M[7]);
+
+  unsigned char Bytes[16] = {0, 1, 2,  3,  4,  5,  6,  7,
+                             8, 9, 10, 11, 12, 13, 14, 15};
+  const unsigned char Mask[16] = {15, 14, 13, 16, 1, 2, 0x80, 0xff,
+                                  8,  8,  8,  8,  8, 8, 8,    8};
+  shuffle_bytes(Bytes, Mask);
+  printf("shuffle_bytes:");
+  for (int I = 0; I < 16; I++)
+    printf(" %d", Bytes[I]);
+  printf("\n");
+
+  const int Indices[8] = {3, 2, 1, 0, 15, 13, 14, 12};
+  permute(A, Indices);
+  printf("permute: %d %d %d %d %d %d %d %d\n", A[0], A[1], A[2], A[3], A[4],
+         A[5], A[6], A[7]);
+
+  const int Vals[4] = {1, 1, 1, 4};
+  const int Counts[4] = {1, 31, 32, 0};
+  shift(C, Vals, Counts);
+  printf("shift:");
+  for (int I = 0; I < 8; I++)
+    printf(" %d", C[I]);
+  printf("\n");
+  return 0;
+}
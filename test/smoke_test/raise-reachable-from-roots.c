@@ -0,0 +1,47 @@
+// REQUIRES: system-linux
+// RUN: clang -o %t %s -O1
+// RUN: llvm-mctoll -d -I /usr/include/stdio.h --roots=main %t
+// RUN: FileCheck %s -check-prefix=IR < %t-dis.ll
+// RUN: FileCheck %s -check-prefix=UNREACHED < %t-dis.ll
+// RUN: clang -o %t-dis %t-dis.ll
+// RUN: %t-dis 2>&1 | FileCheck %s
+// IR-DAG: define dso_local i32 @main(
+// IR-DAG: define dso_local i32 @square(
+// IR-DAG: define dso_local i32 @apply(
+// IR-DAG: define dso_local i32 @twice(
+// IR-DAG: define dso_local i32 @add_one(
+// IR-DAG: define dso_local i32 @negate(
+// IR-DAG: define dso_local void @setup(
+// UNREACHED-NOT: @unused(
+// CHECK: apply(square, 3) = 9
+// CHECK: twice(4) = 10
+
+#include <stdio.h>
+
+__attribute__((noinline)) int square(int N) { return N * N; }
+
+__attribute__((noinline)) int apply(int (*F)(int), int N) { return F(N); }
+
+__attribute__((noinline)) int add_one(int N) { return N + 1; }
+
+// Tail call of add_one
+__attribute__((noinline)) int twice(int N) { return add_one(N * 2 + 1); }
+
+__attribute__((noinline)) int unused(int N) { return N - 1; }
+
+// Only referenced by a table of addresses, as in vtables
+__attribute__((noinline)) int negate(int N) { return -N; }
+
+__attribute__((used, section(".data.rel.ro"))) int (*const Handlers[])(int) = {
+    negate};
+
+// Only referenced by .init_array
+int Initialized;
+
+__attribute__((constructor, noinline)) void setup(void) { Initialized = 1; }
+
+int main(int argc, char **argv) {
+  printf("apply(square, 3) = %d\n", apply(square, 3));
+  printf("twice(4) = %d\n", twice(4));
+  return 0;
+}
@@ -0,0 +1,67 @@
+// REQUIRES: system-linux
+// RUN: clang -o %t %s -O2
+// RUN: llvm-mctoll -d -I /usr/include/stdio.h %t
+// RUN: FileCheck --check-prefix=IR %s < %t-dis.ll
+// RUN: clang -o %t-dis %t-dis.ll
+// RUN: %t-dis 2>&1 | FileCheck %s
+// IR: call void @llvm.memmove
+// IR: call void @llvm.memset
+// CHECK: copy: hello, world
+// CHECK: zero: 0 0 0 0 0 0 0 0
+// CHECK: fill: 7 7 7 7
+// CHECK: compare: 0 1 -1 0
+
+#include <stdio.h>
+
+void __attribute__((noinline))
+copy(char *Dst, const char *Src, unsigned long N) {
+  asm volatile("rep movsb" : "+D"(Dst), "+S"(Src), "+c"(N) : : "memory");
+}
+
+void __attribute__((noinline)) zero(char *Dst, unsigned long N) {
+  asm volatile("rep stosb" : "+D"(Dst), "+c"(N) : "a"(0) : "memory");
+}
+
+void __attribute__((noinline)) fill(long *Dst, long V, unsigned long N) {
+  asm volatile("rep stosq" : "+D"(Dst), "+c"(N) : "a"(V) : "memory");
+}
+
+int __attribute__((noinline))
+compare(const char *A, const char *B, unsigned long N) {
+  unsigned char Above, Below;
+  asm volatile("cmp %%rcx, %%rcx\n\t"
+               "repe cmpsb\n\t"
+               "seta %0\n\t"
+               "setb %1"
+               : "=r"(Above), "=r"(Below), "+S"(A), "+D"(B), "+c"(N)
+               :
+               : "memory", "cc");
+  return Above - Below;
+}
+
+int main(void) {
+  char Buf[16];
+  char Bytes[8] = {1, 2, 3, 4, 5, 6, 7, 8};
+  long Longs[4];
+
+  copy(Buf, "hello, world", 13);
+  printf("copy: %s\n", Buf);
+
+  zero(Bytes, 8);
+  printf("zero:");
+  for (int I = 0; I < 8; I++)
+    printf(" %d", Bytes[I]);
+  printf("\n");
+
+  fill(Longs, 7, 4);
+  printf("fill:");
+  for (int I = 0; I < 4; I++)
+    printf(" %ld", Longs[I]);
+  printf("\n");
+
+  // A compare of no elements does not access the strings.
+  printf("compare: %d %d %d %d\n", compare("abcd", "abcd", 4),
+         compare("abce", "abcd", 4), compare("abcd", "abdd", 4),
+         compare(NULL, NULL, 0));
+  return 0;
+}
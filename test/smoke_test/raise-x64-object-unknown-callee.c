@@ -0,0 +1,23 @@
+// REQUIRES: system-linux
+// RUN: clang -c %s -o %t.o
+// RUN: llvm-mctoll -d -I /usr/include/stdio.h --fallback=declare %t.o 2>&1 | FileCheck %s -check-prefix=WARN
+// RUN: FileCheck %s -check-prefix=IR < %t-dis.ll
+// WARN: Unknown prototype for function : undeclared
+// WARN: The following function(s) failed to raise and are declared external :
+// WARN-NEXT: call_undeclared : failed while
+// IR-DAG: declare {{.*}}@call_undeclared(
+// IR-DAG: define dso_local i32 @main(
+
+#include <stdio.h>
+
+// Not declared in the included files
+int undeclared(int N);
+
+int call_undeclared(int N) { return undeclared(N) + 1; }
+
+int main(int argc, char **argv) {
+  if (argc > 5)
+    printf("%d\n", call_undeclared(argc));
+  printf("done\n");
+  return 0;
+}
@@ -1,11 +1,21 @@
 // REQUIRES: system-linux
-// XFAIL: x86_64
-// RUN: clang -c %s -o %t
-// RUN: llvm-mctoll -d -I /usr/include/stdio.h %t 2>&1 | FileCheck %s
-// CHECK: Raising x64 relocatable (.o) x64 binaries not supported
+// RUN: clang -c %s -o %t.o
+// RUN: llvm-mctoll -d -I /usr/include/stdio.h %t.o
+// RUN: clang -o %t-dis %t-dis.ll
+// RUN: %t-dis 2>&1 | FileCheck %s
+// CHECK: Hello world!
+// CHECK-NEXT: Total = 15
 
 #include <stdio.h>
+
+int Counter = 5;
+static int Total;
+
+static int add(int A, int B) { return A + B; }
+
 int main(int argc, char **argv) {
   printf("Hello world!\n");
+  Total = add(Counter, 10);
+  printf("Total = %d\n", Total);
   return 0;
 }
@@ -0,0 +1,48 @@
+// REQUIRES: system-linux
+// RUN: clang -o %t %s -O2
+// RUN: llvm-mctoll -d -I /usr/include/stdio.h %t
+// RUN: FileCheck --check-prefix=IR %s < %t-dis.ll
+// RUN: clang -o %t-dis %t-dis.ll
+// RUN: %t-dis 2>&1 | FileCheck %s
+// IR-DAG: fadd x86_fp80
+// IR-DAG: fdiv x86_fp80
+// IR-DAG: fcmp
+// CHECK: sum: 3.75
+// CHECK: lerp: 2.25
+// CHECK: count_above: 1
+
+#include <stdio.h>
+
+long double A[4] = {0.5L, 1.25L, -2.0L, 4.0L};
+long double L = 2.0L;
+long double M;
+
+// The running sum stays in ST(0) across the loop and is returned in ST(0).
+long double __attribute__((noinline)) sum(const long double *V, int N) {
+  long double S = 0;
+  for (int I = 0; I < N; I++)
+    S += V[I];
+  return S;
+}
+
+void __attribute__((noinline))
+lerp(long double *Dst, const long double *X, const long double *Y, int T) {
+  *Dst = *X + (*Y - *X) / T;
+}
+
+int __attribute__((noinline))
+count_above(const long double *V, int N, const long double *Limit) {
+  int Count = 0;
+  for (int I = 0; I < N; I++)
+    if (V[I] > *Limit)
+      Count++;
+  return Count;
+}
+
+int main(void) {
+  printf("sum: %g\n", (double)sum(A, 4));
+  lerp(&M, &A[0], &A[3], 2);
+  printf("lerp: %g\n", (double)M);
+  printf("count_above: %d\n", count_above(A, 4, &L));
+  return 0;
+}
@@ -0,0 +1,42 @@
+// REQUIRES: system-linux
+// RUN: clang -O0 -o %t %s
+// RUN: llvm-mctoll -d --split-stack-frame -I /usr/include/stdio.h %t
+// RUN: FileCheck --check-prefix=IR %s < %t-dis.ll
+// RUN: clang -o %t-dis %t-dis.ll
+// RUN: %t-dis 2>&1 | FileCheck %s
+// IR-LABEL: define dso_local i32 @sum(
+// IR-NOT: stktop
+// IR: ret i32
+// IR-LABEL: define dso_local i32 @sum_array(
+// IR: stktop
+// CHECK: sum: 45
+// CHECK: sum_array: 56
+
+#include <stdio.h>
+
+// All locals are scalars whose address is not taken. Each is allocated
+// separately.
+int __attribute__((noinline)) sum(int N) {
+  int S = 0;
+  for (int I = 0; I < N; I++)
+    S += I;
+  return S;
+}
+
+// The array is indexed through its address. It is part of the stack frame,
+// along with the locals above it.
+int __attribute__((noinline)) sum_array(int N) {
+  int A[8];
+  for (int I = 0; I < 8; I++)
+    A[I] = I * N;
+  int S = 0;
+  for (int I = 0; I < 8; I++)
+    S += A[I];
+  return S;
+}
+
+int main(void) {
+  printf("sum: %d\n", sum(10));
+  printf("sum_array: %d\n", sum_array(2));
+  return 0;
+}
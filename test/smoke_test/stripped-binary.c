@@ -0,0 +1,29 @@
+// REQUIRES: system-linux
+// RUN: clang -o %t %s -O1 -s
+// RUN: llvm-mctoll -d -I /usr/include/stdio.h %t
+// RUN: FileCheck %s -check-prefix=IR < %t-dis.ll
+// RUN: clang -o %t-dis %t-dis.ll
+// RUN: %t-dis 2>&1 | FileCheck %s
+// IR-DAG: define dso_local i32 @main(
+// IR-DAG: define dso_local i32 @sub_{{[0-9a-f]+}}(
+// CHECK: sum(10) = 55
+// CHECK: fact(6) = 720
+
+#include <stdio.h>
+
+__attribute__((noinline)) int sum(int N) {
+  int S = 0;
+  for (int I = 1; I <= N; I++)
+    S += I;
+  return S;
+}
+
+__attribute__((noinline)) int fact(int N) {
+  return (N <= 1) ? 1 : N * fact(N - 1);
+}
+
+int main(int argc, char **argv) {
+  printf("sum(10) = %d\n", sum(10));
+  printf("fact(6) = %d\n", fact(6));
+  return 0;
+}
@@ -0,0 +1,15 @@
+// REQUIRES: system-linux
+// RUN: clang -o %t %s -O2
+// RUN: llvm-mctoll -d -I /usr/include/stdio.h --time-trace --time-trace-granularity=0 --time-trace-file=%t.json %t
+// RUN: FileCheck %s < %t.json
+// CHECK-DAG: "traceEvents"
+// CHECK-DAG: "name":"DecodeSection"
+// CHECK-DAG: "name":"RaiseFunction","args":{"detail":"main@0x
+// CHECK-DAG: "name":"RaiseMachineInstrs"
+
+#include <stdio.h>
+
+int main(int argc, char **argv) {
+  printf("argc = %d\n", argc);
+  return 0;
+}